@@ -4,16 +4,24 @@
 #include "TestMonsterB.h"
 #include "EntityEleteMonster.h"
 #include "Animator.h"
+void AtteckAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_isAttackingKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_attackCountKey.Resolve(blackBoard);
+}
+
 
 NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 
-    bool hasIdentity = blackBoard.HasKey("Identity");
+    bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
     std::string identity = "";
     if (hasIdentity)
     {
-        identity = blackBoard.GetValueAsString("Identity");
+        identity = blackBoard.GetValueAsString(m_identityKey);
     }
 
     if (identity == "MonsterNomal")
@@ -25,8 +33,8 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
 			// ƴҽ  
 			script->isAttack = true;
             script->isAttackAnimation = true;
-			script->m_animator->SetParameter("Attack", true);
-            blackBoard.SetValueAsBool("IsAttacking", true);
+			DeferWrite([script] { script->m_animator->SetParameter("Attack", true); });
+            blackBoard.SetValueAsBool(m_isAttackingKey, true);
             return NodeStatus::Running;
         }
         else {
@@ -58,15 +66,11 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
             // ƴҽ  
             script->isAttack = true;
             script->isAttackAnimation = true;
-            if (isMelee) 
-            {
-                script->m_animator->SetParameter("Attack", true);
-            }
-            else 
+            DeferWrite([script, isMelee]
             {
-                script->m_animator->SetParameter("RangeAttack", true);
-            }
-            blackBoard.SetValueAsBool("IsAttacking", true);
+                script->m_animator->SetParameter(isMelee ? "Attack" : "RangeAttack", true);
+            });
+            blackBoard.SetValueAsBool(m_isAttackingKey, true);
             return NodeStatus::Running;
         }
         else {
@@ -97,10 +101,13 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
             // ƴҽ  
             script->isAttack = true;
             script->isAttackAnimation = true;
-            script->m_animator->SetParameter("Attack", true);
-            script->m_animator->SetParameter("RangeAttack", true);
+            DeferWrite([script]
+            {
+                script->m_animator->SetParameter("Attack", true);
+                script->m_animator->SetParameter("RangeAttack", true);
+            });
             
-            blackBoard.SetValueAsBool("IsAttacking", true);
+            blackBoard.SetValueAsBool(m_isAttackingKey, true);
             return NodeStatus::Running;
         }
         else {
@@ -121,23 +128,23 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
     }
 
 
-	bool hasAttackState = blackBoard.HasKey("IsAttacking");
-	bool hasState = blackBoard.HasKey("State");
+	bool hasAttackState = blackBoard.HasKey(m_isAttackingKey);
+	bool hasState = blackBoard.HasKey(m_stateKey);
 	bool isActionRunning = false;
 	std::string state ="";
 
     if (hasAttackState) {
-        isActionRunning = blackBoard.GetValueAsBool("IsAttacking");
+        isActionRunning = blackBoard.GetValueAsBool(m_isAttackingKey);
     }
 
     if (hasState) {
-		state = blackBoard.GetValueAsString("State");
+		state = blackBoard.GetValueAsString(m_stateKey);
     }
 
     if (state != "Atteck")
     {
         //Ʈ  ƴҽ ù  ν  
-        blackBoard.SetValueAsBool("IsAttacking", true); //--> ̰ ϸ̼ǿ false ٲ
+        blackBoard.SetValueAsBool(m_isAttackingKey, true); //--> ̰ ϸ̼ǿ false ٲ
 
         //// 3. ĳ  ϴ. //wait  
         //if (auto* movement = m_owner->GetComponent<CharacterControllerComponent>())
@@ -152,9 +159,9 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
         }*/
 
         // attack count    
-        blackBoard.SetValueAsInt("AttackCount", 1); // --> ̰ ƼƼ  Ȯ 0 ٲ
+        blackBoard.SetValueAsInt(m_attackCountKey, 1); // --> ̰ ƼƼ  Ȯ 0 ٲ
         // ¸ Atteck 
-        blackBoard.SetValueAsString("State", "Atteck");  // --> ̰ BT  Ʈ 
+        blackBoard.SetValueAsString(m_stateKey, "Atteck");  // --> ̰ BT  Ʈ 
 
         // 5. BT Running ¸ ȯϿ,  ൿ    ˸ϴ.
         return NodeStatus::Running;
@@ -167,7 +174,7 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
         //LOG("AtteckAction Running...");
         //LOG("IsAttacking: " << blackBoard.GetValueAsBool("IsAttacking"));
         // Blackboard "IsAttacking" ÷׸  Ȯմϴ.
-        if (blackBoard.GetValueAsBool("IsAttacking"))
+        if (blackBoard.GetValueAsBool(m_isAttackingKey))
         {
             //  true, AttackBehavior ȣ   ̹Ƿ ִϸ̼  Դϴ.
             //  Running ¸ ȯմϴ.
@@ -182,7 +189,7 @@ NodeStatus AtteckAction::Tick(float deltatime, BlackBoard& blackBoard)
             // 2. BT Success ȯϿ ൿ   ˸ϴ.
 			//std::cout << "AtteckAction: Attack animation completed." << std::endl;
 			//Ʈ Idle 
-			blackBoard.SetValueAsString("State", "Idle");
+			blackBoard.SetValueAsString(m_stateKey, "Idle");
             return NodeStatus::Success;
         }
 
@@ -11,4 +11,11 @@ public:
 		m_name = "AtteckAction"; m_typeID = TypeTrait::GUIDCreator::GetTypeID<ActionNode>(); m_scriptTypeID = TypeTrait::GUIDCreator::GetTypeID<AtteckAction>();
 	} virtual ~AtteckAction() = default;
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;	
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_isAttackingKey{ "IsAttacking" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_attackCountKey{ "AttackCount" };
 };
@@ -1,6 +1,14 @@
 #include "BP001BodyAtack.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void BP001BodyAtack::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_counterKey.Resolve(blackBoard);
+	m_countersKey.Resolve(blackBoard);
+	m_idleTimeKey.Resolve(blackBoard);
+}
+
 NodeStatus BP001BodyAtack::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	LOG("BP001BodyAtack call");
@@ -8,11 +16,11 @@ NodeStatus BP001BodyAtack::Tick(float deltatime, BlackBoard& blackBoard)
 	float actionDuration = 5.0f;
 
 	// Test code --> todo :: add action and animation Set
-	bool isTimeCounter = blackBoard.HasKey("Counter");
+	bool isTimeCounter = blackBoard.HasKey(m_counterKey);
 	float time; 
 
 	if (isTimeCounter) {
-		time = blackBoard.GetValueAsFloat("Counters");
+		time = blackBoard.GetValueAsFloat(m_countersKey);
 	}
 	else {
 		time = 0.0f;
@@ -31,6 +39,6 @@ NodeStatus BP001BodyAtack::Tick(float deltatime, BlackBoard& blackBoard)
 	
 	//
 	LOG("attack action Success end");
-	blackBoard.SetValueAsFloat("IdleTime", 5.0f); //body atteck is add to IdleTime 5secend
+	blackBoard.SetValueAsFloat(m_idleTimeKey, 5.0f); //body atteck is add to IdleTime 5secend
 	return NodeStatus::Success;
 }
@@ -8,4 +8,10 @@ class BP001BodyAtack : public ActionNode
 public:
 	BT_ACTION_BODY(BP001BodyAtack)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_counterKey{ "Counter" };
+	BlackBoardKey m_countersKey{ "Counters" };
+	BlackBoardKey m_idleTimeKey{ "IdleTime" };
 };
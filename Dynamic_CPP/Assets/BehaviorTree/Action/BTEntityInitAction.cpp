@@ -2,24 +2,33 @@
 #include "Animator.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void BTEntityInitAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_maxHPKey.Resolve(blackBoard);
+	m_currHPKey.Resolve(blackBoard);
+	m_identityKey.Resolve(blackBoard);
+	m_initializedKey.Resolve(blackBoard);
+}
+
 NodeStatus BTEntityInitAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	//initialize the Behavior Tree Entity
 	
-	bool useDead = blackBoard.HasKey("MaxHP");
+	bool useDead = blackBoard.HasKey(m_maxHPKey);
 	if (useDead)
 	{
 		//set the current HP to the initial HP
-		int hp = blackBoard.GetValueAsInt("MaxHP");
-		blackBoard.SetValueAsInt("CurrHP", hp);
+		int hp = blackBoard.GetValueAsInt(m_maxHPKey);
+		blackBoard.SetValueAsInt(m_currHPKey, hp);
 	}
 
 	//todo : initialize other properties as needed
 
-	std::string name = blackBoard.GetValueAsString("Identity");
+	std::string name = blackBoard.GetValueAsString(m_identityKey);
 
 	
-	blackBoard.SetValueAsBool("Initialized", true);
+	blackBoard.SetValueAsBool(m_initializedKey, true);
 	//LOG("Behavior Tree Entity Initialized : "<< m_owner->GetHashedName().ToString());
 	return NodeStatus::Success;
 }
@@ -8,4 +8,11 @@ class BTEntityInitAction : public ActionNode
 public:
 	BT_ACTION_BODY(BTEntityInitAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_maxHPKey{ "MaxHP" };
+	BlackBoardKey m_currHPKey{ "CurrHP" };
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_initializedKey{ "Initialized" };
 };
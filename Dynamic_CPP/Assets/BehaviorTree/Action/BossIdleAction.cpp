@@ -2,28 +2,35 @@
 #include "pch.h"
 #include "DebugLog.h"
 #include "TBoss1.h"
+
+void BossIdleAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_idleTimeKey.Resolve(blackBoard);
+}
+
 NodeStatus BossIdleAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	//Idle is dufualt State
 
 	//animation and logic to first
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	std::string Identity = "";
 	if (hasIdentity) {
-		Identity = blackBoard.GetValueAsString("Identity");
+		Identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 
-	bool isTime = blackBoard.HasKey("IdleTime");
+	bool isTime = blackBoard.HasKey(m_idleTimeKey);
 	float duration;
 
 	if (isTime) {
-		duration = blackBoard.GetValueAsFloat("IdleTime");
+		duration = blackBoard.GetValueAsFloat(m_idleTimeKey);
 		
 		duration -= deltatime;
 
 		if (duration < 0) {
 			duration = 0.0f;
-			blackBoard.SetValueAsFloat("IdleTime", duration);
+			blackBoard.SetValueAsFloat(m_idleTimeKey, duration);
 			LOG("Boss Idle end to atteck");
 
 			////test code  
@@ -44,7 +51,7 @@ NodeStatus BossIdleAction::Tick(float deltatime, BlackBoard& blackBoard)
 			return NodeStatus::Success; //end Idle
 		}
 
-		blackBoard.SetValueAsFloat("IdleTime", duration);
+		blackBoard.SetValueAsFloat(m_idleTimeKey, duration);
 		LOG("Boss Idle Running Remain Time : " << duration);
 		return NodeStatus::Running;// running Idle
 	}
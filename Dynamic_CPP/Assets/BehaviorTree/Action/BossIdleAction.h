@@ -8,4 +8,9 @@ class BossIdleAction : public ActionNode
 public:
 	BT_ACTION_BODY(BossIdleAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_idleTimeKey{ "IdleTime" };
 };
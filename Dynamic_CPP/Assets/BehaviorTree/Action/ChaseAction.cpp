@@ -6,44 +6,56 @@
 #include "TestMonsterB.h"
 #include "EntityEleteMonster.h"
 #include "CharacterControllerComponent.h"
+void ChaseAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_speedKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_closedTargetKey.Resolve(blackBoard);
+	m_chaseRangeKey.Resolve(blackBoard);
+	m_chaseOutTimeKey.Resolve(blackBoard);
+	m_chaseOutDurationKey.Resolve(blackBoard);
+	m_targetKey.Resolve(blackBoard);
+}
+
 
 NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	std::string identity = "";
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 
 	if (identity == "MonsterNomal")
 	{
 		EntityMonsterA* script = m_owner->GetComponent<EntityMonsterA>();
-		script->ChaseTarget(deltatime);
+		DeferWrite([script, deltatime] { script->ChaseTarget(deltatime); });
 		return NodeStatus::Success;
 	}
 	else if(identity == "MonsterRange")
 	{
 		TestMonsterB* script = m_owner->GetComponent<TestMonsterB>();
-		script->ChaseTarget(deltatime);
+		DeferWrite([script, deltatime] { script->ChaseTarget(deltatime); });
 		return NodeStatus::Success;
 	}
 	else if (identity == "MonsterMage")
 	{
 		EntityEleteMonster* script = m_owner->GetComponent<EntityEleteMonster>();
-		script->ChaseTarget(deltatime);
+		DeferWrite([script, deltatime] { script->ChaseTarget(deltatime); });
 		return NodeStatus::Success;
 	}
 
 
-	bool isSpeed = blackBoard.HasKey("Speed");
-	bool HasState = blackBoard.HasKey("State");
+	bool isSpeed = blackBoard.HasKey(m_speedKey);
+	bool HasState = blackBoard.HasKey(m_stateKey);
 
 	//self
 	Transform* selfTransform = m_owner->GetComponent<Transform>();
 	Mathf::Vector3 pos = selfTransform->GetWorldPosition();
 
-	GameObject* closedTarget = blackBoard.GetValueAsGameObject("ClosedTarget");
+	GameObject* closedTarget = blackBoard.GetValueAsGameObject(m_closedTargetKey);
 	CharacterControllerComponent* movement = m_owner->GetComponent<CharacterControllerComponent>();
 	Mathf::Vector3 targetpos = Mathf::Vector3::Zero;
 
@@ -62,25 +74,25 @@ NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 	/*float speed = 0.0f;
 	if (isSpeed)
 	{
-		speed = blackBoard.GetValueAsFloat("Speed");
+		speed = blackBoard.GetValueAsFloat(m_speedKey);
 
 	}
 	else {
 		std::cout << "not found Speed don`t move";
 	}*/
-	bool useChase = blackBoard.HasKey("ChaseRange");
-	bool useChaseOutTime = blackBoard.HasKey("ChaseOutTime");
-	bool useOutDuration = blackBoard.HasKey("ChaseOutDuration");
-	float range = blackBoard.GetValueAsFloat("ChaseRange");
+	bool useChase = blackBoard.HasKey(m_chaseRangeKey);
+	bool useChaseOutTime = blackBoard.HasKey(m_chaseOutTimeKey);
+	bool useOutDuration = blackBoard.HasKey(m_chaseOutDurationKey);
+	float range = blackBoard.GetValueAsFloat(m_chaseRangeKey);
 	float outTime = 0.0f;
 	float duration = 0.0f;
 	if (useOutDuration)
 	{
-		duration = blackBoard.GetValueAsFloat("ChaseOutDuration");
+		duration = blackBoard.GetValueAsFloat(m_chaseOutDurationKey);
 	}
 	if (useChaseOutTime)
 	{
-		outTime = blackBoard.GetValueAsFloat("ChaseOutTime");
+		outTime = blackBoard.GetValueAsFloat(m_chaseOutTimeKey);
 	}
 
 	Mathf::Vector3 dir = targetpos - pos;
@@ -93,7 +105,7 @@ NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 		outTime -= deltatime; // Decrease outTime if not within range
 	}
 
-	blackBoard.SetValueAsFloat("ChaseOutTime", outTime);
+	blackBoard.SetValueAsFloat(m_chaseOutTimeKey, outTime);
 
 	Mathf::Vector2 dir2D = { dir.x, dir.z }; // Assuming y is up, we only care about x and z for 2D direction
 	
@@ -110,12 +122,15 @@ NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 		{
 			//selfTransform->AddPosition(dir * Speed * deltatime);
 			if (movement) {
-				movement->Move(dir2D);
-				enemy->m_animator->SetParameter("Move", true);
+				DeferWrite([movement, enemy, dir2D]
+				{
+					movement->Move(dir2D);
+					enemy->m_animator->SetParameter("Move", true);
+				});
 				//std::cout << "ChaseAction executed. Moving towards target." << std::endl;
 				if (HasState)
 				{
-					std::string state = blackBoard.GetValueAsString("State");
+					std::string state = blackBoard.GetValueAsString(m_stateKey);
 					if (state == "Chase")
 					{
 						//std::cout << "Chase action already in progress." << std::endl;
@@ -123,7 +138,7 @@ NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 					}
 					else
 					{
-						blackBoard.SetValueAsString("State", "Chase");
+						blackBoard.SetValueAsString(m_stateKey, "Chase");
 						//std::cout << "Switching to Move state." << std::endl;
 					}
 				}
@@ -136,7 +151,7 @@ NodeStatus ChaseAction::Tick(float deltatime, BlackBoard& blackBoard)
 	if (closedTarget)
 	{
 		//std::cout << "ChaseAction: Setting Target to " << closedTarget->ToString() << std::endl;
-		blackBoard.SetValueAsGameObject("Target", closedTarget->ToString());
+		blackBoard.SetValueAsGameObject(m_targetKey, closedTarget->ToString());
 	}
 
 	return NodeStatus::Success;
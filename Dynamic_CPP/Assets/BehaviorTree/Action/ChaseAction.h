@@ -9,4 +9,15 @@ class ChaseAction : public ActionNode
 public:
 	BT_ACTION_BODY(ChaseAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_speedKey{ "Speed" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_chaseRangeKey{ "ChaseRange" };
+	BlackBoardKey m_chaseOutTimeKey{ "ChaseOutTime" };
+	BlackBoardKey m_chaseOutDurationKey{ "ChaseOutDuration" };
+	BlackBoardKey m_targetKey{ "Target" };
 };
@@ -2,17 +2,23 @@
 #include "pch.h"
 #include "EffectComponent.h"
 #include "EntityMonsterA.h"
+void DaedAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_stateKey.Resolve(blackBoard);
+	m_identityKey.Resolve(blackBoard);
+}
+
 
 
 NodeStatus DaedAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	// Example action: Print a message to the console
-	bool hasState = blackBoard.HasKey("State");
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasState = blackBoard.HasKey(m_stateKey);
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	std::string identity = "";
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 
 	if (identity == "MonsterNomal")
@@ -8,7 +8,10 @@ class DaedAction : public ActionNode
 public:
 	BT_ACTION_BODY(DaedAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
 
 private:
 	Mathf::Quaternion finalRotation = Mathf::Quaternion::Identity;
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_identityKey{ "Identity" };
 };
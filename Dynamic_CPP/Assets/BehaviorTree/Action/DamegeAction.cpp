@@ -3,16 +3,24 @@
 #include "EntityEnemy.h"
 #include "CharacterControllerComponent.h"
 #include "DebugLog.h"
+
+void DamegeAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_damageKey.Resolve(blackBoard);
+	m_currHPKey.Resolve(blackBoard);
+	m_delayDamageActionKey.Resolve(blackBoard);
+}
+
 NodeStatus DamegeAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	
-	int damage = blackBoard.GetValueAsInt("Damage");
-	int currHP = blackBoard.GetValueAsInt("CurrHP");
+	int damage = blackBoard.GetValueAsInt(m_damageKey);
+	int currHP = blackBoard.GetValueAsInt(m_currHPKey);
 
 	currHP -=damage;
 
-	blackBoard.SetValueAsInt("CurrHP", currHP);
-	blackBoard.SetValueAsInt("Damage", 0);
+	blackBoard.SetValueAsInt(m_currHPKey, currHP);
+	blackBoard.SetValueAsInt(m_damageKey, 0);
 
 	EntityEnemy* enemy = m_owner->GetComponent<EntityEnemy>();
 
@@ -25,14 +33,15 @@ NodeStatus DamegeAction::Tick(float deltatime, BlackBoard& blackBoard)
 			{
 				enemy->isKnockBack = false;
 				enemy->KnockBackElapsedTime = 0.f;
-				m_owner->GetComponent<CharacterControllerComponent>()->StopForcedMove();
+				auto controller = m_owner->GetComponent<CharacterControllerComponent>();
+				DeferWrite([controller] { controller->StopForcedMove(); });
 				return NodeStatus::Success; //˹鳡
 			}
 			else
 			{
 				auto forward = m_owner->m_transform.GetForward(); // ⿡ иԲ 
 				auto controller = m_owner->GetComponent<CharacterControllerComponent>();
-				controller->Move({ -forward.x , -forward.z });
+				DeferWrite([controller, forward] { controller->Move({ -forward.x , -forward.z }); });
 				
 				return NodeStatus::Running; //˹
 			}
@@ -40,13 +49,13 @@ NodeStatus DamegeAction::Tick(float deltatime, BlackBoard& blackBoard)
 	}
 	//todo ::    ð̶ ˹ȿ ־
 
-	/*bool isDelayDamageAction = blackBoard.HasKey("DelayDamageAction");
+	/*bool isDelayDamageAction = blackBoard.HasKey(m_delayDamageActionKey);
 	float delayDamageTime = 0.0f;
 	if (isDelayDamageAction)
 	{
-		delayDamageTime = blackBoard.GetValueAsFloat("DelayDamageAction");
+		delayDamageTime = blackBoard.GetValueAsFloat(m_delayDamageActionKey);
 		delayDamageTime -= deltatime;
-		blackBoard.SetValueAsFloat("DelayDamageAction", delayDamageTime);
+		blackBoard.SetValueAsFloat(m_delayDamageActionKey, delayDamageTime);
 	}
 	else {
 		
@@ -54,7 +63,7 @@ NodeStatus DamegeAction::Tick(float deltatime, BlackBoard& blackBoard)
 		
 		
 		"No delay damage action found.");
-		blackBoard.SetValueAsFloat("DelayDamageAction", 2.0f);
+		blackBoard.SetValueAsFloat(m_delayDamageActionKey, 2.0f);
 	}
 
 	LOG("Damege action executed successfully.");*/
@@ -8,4 +8,10 @@ class DamegeAction : public ActionNode
 public:
 	BT_ACTION_BODY(DamegeAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_damageKey{ "Damage" };
+	BlackBoardKey m_currHPKey{ "CurrHP" };
+	BlackBoardKey m_delayDamageActionKey{ "DelayDamageAction" };
 };
@@ -2,13 +2,18 @@
 #include "pch.h"
 #include "TBoss1.h"
 
+void DetectAndTargetingAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+}
+
 NodeStatus DetectAndTargetingAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	if (!hasIdentity) {
 		return NodeStatus::Failure; // Identity Ű  
 	}
-	std::string identity = blackBoard.GetValueAsString("Identity");
+	const std::string& identity = blackBoard.GetValueAsString(m_identityKey);
 	if (identity != "Boss1") {
 		return NodeStatus::Failure; // Identity "Boss1" ƴϸ 
 	}
@@ -8,4 +8,8 @@ class DetectAndTargetingAction : public ActionNode
 public:
 	BT_ACTION_BODY(DetectAndTargetingAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
 };
@@ -1,9 +1,15 @@
 #include "GroggyAction.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void GroggyAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_groggyTimeKey.Resolve(blackBoard);
+}
+
 NodeStatus GroggyAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
-	float groggyTime = blackBoard.GetValueAsFloat("GroggyTime");
+	float groggyTime = blackBoard.GetValueAsFloat(m_groggyTimeKey);
 	
 	LOG("GroggyAction Tick: Current GroggyTime: " << groggyTime);
 
@@ -15,11 +21,11 @@ NodeStatus GroggyAction::Tick(float deltatime, BlackBoard& blackBoard)
 	if (groggyTime <= 0.0f)
 	{
 		groggyTime = 0.0f; // Ensure groggy time does not go below zero
-		blackBoard.SetValueAsFloat("GroggyTime", groggyTime); // Update the blackboard with the new groggy time
+		blackBoard.SetValueAsFloat(m_groggyTimeKey, groggyTime); // Update the blackboard with the new groggy time
 		return NodeStatus::Success; // Action performed successfully
 	}
 	else {
-		blackBoard.SetValueAsFloat("GroggyTime", groggyTime); // Update the blackboard with the new groggy time
+		blackBoard.SetValueAsFloat(m_groggyTimeKey, groggyTime); // Update the blackboard with the new groggy time
 		return NodeStatus::Running; // Action is still running, groggy time is not yet over
 	}
 }
@@ -8,4 +8,8 @@ class GroggyAction : public ActionNode
 public:
 	BT_ACTION_BODY(GroggyAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_groggyTimeKey{ "GroggyTime" };
 };
@@ -4,31 +4,43 @@
 #include "TestMonsterB.h"
 #include "EntityEleteMonster.h"
 #include "DebugLog.h"
+
+void Idle::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_player1Key.Resolve(blackBoard);
+	m_player2Key.Resolve(blackBoard);
+	m_asisKey.Resolve(blackBoard);
+	m_closedTargetKey.Resolve(blackBoard);
+	m_eAsisKey.Resolve(blackBoard);
+}
+
 NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 {
 
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	std::string identity = "";
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 
 	if (identity == "MonsterNomal")
 	{
 		CharacterControllerComponent* movement = m_owner->GetComponent<CharacterControllerComponent>();
-		bool isState = blackBoard.HasKey("State");
+		bool isState = blackBoard.HasKey(m_stateKey);
 		EntityMonsterA* script = m_owner->GetComponent<EntityMonsterA>();
 		// Perform idle behavior, such as waiting or doing nothing
 		// This is a placeholder for actual idle logic
 		if (movement)
 		{
-			movement->Move(Mathf::Vector2(0.0f, 0.0f)); // Stop movement during idle
+			DeferWrite([movement] { movement->Move(Mathf::Vector2(0.0f, 0.0f)); }); // Stop movement during idle
 			//LOG("Idle action executed. Stopping movement.");
 		}
 		if (isState)
 		{
-			std::string state = blackBoard.GetValueAsString("State");
+			std::string state = blackBoard.GetValueAsString(m_stateKey);
 			if (state == "Idle")
 			{
 				//LOG("Idle action already in progress.");
@@ -41,13 +53,13 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 			{
 				//LOG("Switching to Idle state.");
 				script->m_state = "Idle";
-				blackBoard.SetValueAsString("State", "Idle");
+				blackBoard.SetValueAsString(m_stateKey, "Idle");
 			}
 		}
 		else
 		{
 			script->m_state = "Idle";
-			blackBoard.SetValueAsString("State", "Idle");
+			blackBoard.SetValueAsString(m_stateKey, "Idle");
 			//LOG("Setting Idle state for the first time.");
 		}
 		return NodeStatus::Success; // BT '' ȯϿ  ׼ 
@@ -56,18 +68,18 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	if (identity == "MonsterRange")
 	{
 		CharacterControllerComponent* movement = m_owner->GetComponent<CharacterControllerComponent>();
-		bool isState = blackBoard.HasKey("State");
+		bool isState = blackBoard.HasKey(m_stateKey);
 		TestMonsterB* script = m_owner->GetComponent<TestMonsterB>();
 		// Perform idle behavior, such as waiting or doing nothing
 		// This is a placeholder for actual idle logic
 		if (movement)
 		{
-			movement->Move(Mathf::Vector2(0.0f, 0.0f)); // Stop movement during idle
+			DeferWrite([movement] { movement->Move(Mathf::Vector2(0.0f, 0.0f)); }); // Stop movement during idle
 			//LOG("Idle action executed. Stopping movement.");
 		}
 		if (isState)
 		{
-			std::string state = blackBoard.GetValueAsString("State");
+			std::string state = blackBoard.GetValueAsString(m_stateKey);
 			if (state == "Idle")
 			{
 				//LOG("Idle action already in progress.");
@@ -80,13 +92,13 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 			{
 				//LOG("Switching to Idle state.");
 				script->m_state = "Idle";
-				blackBoard.SetValueAsString("State", "Idle");
+				blackBoard.SetValueAsString(m_stateKey, "Idle");
 			}
 		}
 		else
 		{
 			script->m_state = "Idle";
-			blackBoard.SetValueAsString("State", "Idle");
+			blackBoard.SetValueAsString(m_stateKey, "Idle");
 			//LOG("Setting Idle state for the first time.");
 		}
 		return NodeStatus::Success; // BT '' ȯϿ  ׼ 
@@ -94,18 +106,18 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 
 	if (identity == "MonsterMage") {
 		CharacterControllerComponent* movement = m_owner->GetComponent<CharacterControllerComponent>();
-		bool isState = blackBoard.HasKey("State");
+		bool isState = blackBoard.HasKey(m_stateKey);
 		EntityEleteMonster* script = m_owner->GetComponent<EntityEleteMonster>();
 		// Perform idle behavior, such as waiting or doing nothing
 		// This is a placeholder for actual idle logic
 		if (movement)
 		{
-			movement->Move(Mathf::Vector2(0.0f, 0.0f)); // Stop movement during idle
+			DeferWrite([movement] { movement->Move(Mathf::Vector2(0.0f, 0.0f)); }); // Stop movement during idle
 			//LOG("Idle action executed. Stopping movement.");
 		}
 		if (isState)
 		{
-			std::string state = blackBoard.GetValueAsString("State");
+			std::string state = blackBoard.GetValueAsString(m_stateKey);
 			if (state == "Idle")
 			{
 				//LOG("Idle action already in progress.");
@@ -118,30 +130,30 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 			{
 				//LOG("Switching to Idle state.");
 				script->m_state = "Idle";
-				blackBoard.SetValueAsString("State", "Idle");
+				blackBoard.SetValueAsString(m_stateKey, "Idle");
 			}
 		}
 		else
 		{
 			script->m_state = "Idle";
-			blackBoard.SetValueAsString("State", "Idle");
+			blackBoard.SetValueAsString(m_stateKey, "Idle");
 			//LOG("Setting Idle state for the first time.");
 		}
 		return NodeStatus::Success; // BT '' ȯϿ  ׼ 
 	}
 
 
-	bool isP1 = blackBoard.HasKey("Player1");
-	bool isP2 = blackBoard.HasKey("Player2");
-	bool isAsis = blackBoard.HasKey("Asis");
+	bool isP1 = blackBoard.HasKey(m_player1Key);
+	bool isP2 = blackBoard.HasKey(m_player2Key);
+	bool isAsis = blackBoard.HasKey(m_asisKey);
 
 	CharacterControllerComponent* movement = m_owner->GetComponent<CharacterControllerComponent>();
-	bool isState = blackBoard.HasKey("State");
+	bool isState = blackBoard.HasKey(m_stateKey);
 	// Perform idle behavior, such as waiting or doing nothing
 	// This is a placeholder for actual idle logic
 	if (movement)
 	{
-		movement->Move(Mathf::Vector2(0.0f, 0.0f)); // Stop movement during idle
+		DeferWrite([movement] { movement->Move(Mathf::Vector2(0.0f, 0.0f)); }); // Stop movement during idle
 		//LOG("Idle action executed. Stopping movement.");
 	}
 	// Return success to indicate that the idle action completed successfully
@@ -151,7 +163,7 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	//init Target;
 	GameObject* Target = nullptr;
 	//LOG("Idle action: Starting retargeting process.");
-	blackBoard.SetValueAsGameObject("ClosedTarget","");
+	blackBoard.SetValueAsGameObject(m_closedTargetKey,"");
 
 	//self
 	Transform* selfTransform = m_owner->GetComponent<Transform>();
@@ -163,7 +175,7 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	Mathf::Vector3 p1dir;
 
 	if (isP1) {
-		Player1 = blackBoard.GetValueAsGameObject("Player1");
+		Player1 = blackBoard.GetValueAsGameObject(m_player1Key);
 		if (Player1 != nullptr) {
 			player1Transform = Player1->GetComponent<Transform>();
 			Mathf::Vector3 p1pos = player1Transform->GetWorldPosition();
@@ -180,7 +192,7 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	Mathf::Vector3 p2dir;
 
 	if (isP2) {
-		Player2 = blackBoard.GetValueAsGameObject("Player2");
+		Player2 = blackBoard.GetValueAsGameObject(m_player2Key);
 		if (Player2 != nullptr) {
 			player2Transform = Player2->GetComponent<Transform>();
 			Mathf::Vector3 p2pos = player2Transform->GetWorldPosition();
@@ -206,17 +218,17 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	}
 
 	//asis
-	bool useAsis = blackBoard.HasKey("eAsis");
+	bool useAsis = blackBoard.HasKey(m_eAsisKey);
 	bool asisTarget = false;
 	if (useAsis)
 	{
-		asisTarget = blackBoard.GetValueAsBool("eAsis");
+		asisTarget = blackBoard.GetValueAsBool(m_eAsisKey);
 	}
 	GameObject* asis = nullptr;
 	Transform* asisTransform = nullptr;
 	Mathf::Vector3 asisdir;
 	if (isAsis) {
-		asis = blackBoard.GetValueAsGameObject("Asis");
+		asis = blackBoard.GetValueAsGameObject(m_asisKey);
 		if (asis != nullptr) {
 			asisTransform = asis->GetComponent<Transform>();
 			Mathf::Vector3 asispos = asisTransform->GetWorldPosition();
@@ -252,12 +264,12 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	if (Target)
 	{
 		//LOG("Idle action: Target is set to " << Target->ToString());
-		blackBoard.SetValueAsGameObject("ClosedTarget", Target->ToString());
+		blackBoard.SetValueAsGameObject(m_closedTargetKey, Target->ToString());
 	}
 	else
 	{
 		//LOG("Idle action: No valid target found. Setting ClosedTarget to empty.");
-		blackBoard.SetValueAsGameObject("ClosedTarget", "");
+		blackBoard.SetValueAsGameObject(m_closedTargetKey, "");
 	}
 
 	//end idle state Retargeting 
@@ -266,7 +278,7 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	
 	if (isState)
 	{
-		std::string state = blackBoard.GetValueAsString("State");
+		std::string state = blackBoard.GetValueAsString(m_stateKey);
 		if (state == "Idle")
 		{
 			//LOG("Idle action already in progress.");
@@ -282,7 +294,7 @@ NodeStatus Idle::Tick(float deltatime, BlackBoard& blackBoard)
 	}
 	else
 	{
-		blackBoard.SetValueAsString("State", "Idle");
+		blackBoard.SetValueAsString(m_stateKey, "Idle");
 		//LOG("Setting Idle state for the first time.");
 	}
 
@@ -10,4 +10,14 @@ class Idle : public ActionNode
 public:
 	BT_ACTION_BODY(Idle)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_player1Key{ "Player1" };
+	BlackBoardKey m_player2Key{ "Player2" };
+	BlackBoardKey m_asisKey{ "Asis" };
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_eAsisKey{ "eAsis" };
 };
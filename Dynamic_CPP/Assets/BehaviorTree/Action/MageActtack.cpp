@@ -2,19 +2,30 @@
 #include "MageActtack.h"
 #include "RigidBodyComponent.h"
 #include "DebugLog.h"
+
+void MageActtack::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_eAtkCooldownKey.Resolve(blackBoard);
+	m_targetKey.Resolve(blackBoard);
+	m_eProjectileSpeedKey.Resolve(blackBoard);
+	m_atkCooldownKey.Resolve(blackBoard);
+}
+
 NodeStatus MageActtack::Tick(float deltatime, BlackBoard& blackBoard)
 {
-	auto Identity = blackBoard.GetValueAsString("Identity");
-	auto State = blackBoard.GetValueAsString("State");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
+	auto State = blackBoard.GetValueAsString(m_stateKey);
 	if (Identity.empty() || Identity != "Mage")
 	{
 		return NodeStatus::Failure; // Identity ų "Mage" ƴ   ȯ
 	}
 
-	float coolTime = blackBoard.GetValueAsFloat("eAtkCooldown");
+	float coolTime = blackBoard.GetValueAsFloat(m_eAtkCooldownKey);
 
 	//  
-	auto target = blackBoard.GetValueAsGameObject("Target");
+	auto target = blackBoard.GetValueAsGameObject(m_targetKey);
 	if (!target)
 	{
 		return NodeStatus::Failure; // Ÿ   ȯ
@@ -25,7 +36,7 @@ NodeStatus MageActtack::Tick(float deltatime, BlackBoard& blackBoard)
 	Transform* targetTransform = target->GetComponent<Transform>();
 	Mathf::Vector3 dir = targetTransform->GetWorldPosition() - selfTransform->GetWorldPosition();
 
-	float projectileSpeed = blackBoard.GetValueAsFloat("eProjectileSpeed");
+	float projectileSpeed = blackBoard.GetValueAsFloat(m_eProjectileSpeedKey);
 
 	dir.Normalize();
 
@@ -45,14 +56,14 @@ NodeStatus MageActtack::Tick(float deltatime, BlackBoard& blackBoard)
 		// 
 		//߻ 
 		LOG("Mage Attack: Firing projectile");
-		blackBoard.SetValueAsFloat("AtkCooldown", coolTime); //  Ÿ 
+		blackBoard.SetValueAsFloat(m_atkCooldownKey, coolTime); //  Ÿ 
 		//Ÿ  Ǿ ̰ ȵ 
 		
 		//ϸ̼  ο  
 	}
 	else {
 		State = "Attack"; // ¸  
-		blackBoard.SetValueAsString("State", State); // ¸ 忡 
+		blackBoard.SetValueAsString(m_stateKey, State); // ¸ 忡 
 		//⼭   
 		
 		return NodeStatus::Running; //   ۵Ǿ Ÿ  Running  ȯ
@@ -8,4 +8,13 @@ class MageActtack : public ActionNode
 public:
 	BT_ACTION_BODY(MageActtack)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_eAtkCooldownKey{ "eAtkCooldown" };
+	BlackBoardKey m_targetKey{ "Target" };
+	BlackBoardKey m_eProjectileSpeedKey{ "eProjectileSpeed" };
+	BlackBoardKey m_atkCooldownKey{ "AtkCooldown" };
 };
@@ -2,14 +2,21 @@
 #include "pch.h"
 #include "EntityEleteMonster.h"
 #include "DebugLog.h"
+
+void RetreatAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_stateKey.Resolve(blackBoard);
+	m_reteatCooldownKey.Resolve(blackBoard);
+}
+
 NodeStatus RetreatAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 
 	//ǿ ˻ѰŴ ǳʶ Ǹ   
-	bool hasState = blackBoard.HasKey("State");
+	bool hasState = blackBoard.HasKey(m_stateKey);
 	std::string State = "";
 	if (hasState) {
-		State = blackBoard.GetValueAsString("State");
+		State = blackBoard.GetValueAsString(m_stateKey);
 	}
 
 
@@ -32,16 +39,16 @@ NodeStatus RetreatAction::Tick(float deltatime, BlackBoard& blackBoard)
 		{
 			//   Ÿ 
 			State = "Idle"; // ʱȭ
-			blackBoard.SetValueAsString("State", State); // ¸ 忡 
+			blackBoard.SetValueAsString(m_stateKey, State); // ¸ 忡 
 			float cooldown = script->m_retreatCoolTime;
-			blackBoard.SetValueAsFloat("ReteatCooldown",cooldown); // Ÿ 
+			blackBoard.SetValueAsFloat(m_reteatCooldownKey,cooldown); // Ÿ 
 			return NodeStatus::Success;
 		}
 	}
 	else {
 		State = "Retreat"; // ¸  
-		blackBoard.SetValueAsString("State", State); // ¸ 忡 
-		script->StartRetreat();
+		blackBoard.SetValueAsString(m_stateKey, State); // ¸ 忡 
+		DeferWrite([script] { script->StartRetreat(); });
 		return NodeStatus::Running;
 	}
 
@@ -8,4 +8,9 @@ class RetreatAction : public ActionNode
 public:
 	BT_ACTION_BODY(RetreatAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_reteatCooldownKey{ "ReteatCooldown" };
 };
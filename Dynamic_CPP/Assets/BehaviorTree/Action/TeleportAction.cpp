@@ -2,14 +2,20 @@
 #include "pch.h"
 #include "EntityEleteMonster.h"
 #include "DebugLog.h"
+
+void TeleportAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_stateKey.Resolve(blackBoard);
+}
+
 NodeStatus TeleportAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	//Ÿ   ϰ     Ƿ ۵Ǵ 
 	//ǿ ˻ѰŴ ǳʶ Ǹ   
-	bool hasState = blackBoard.HasKey("State");
+	bool hasState = blackBoard.HasKey(m_stateKey);
 	std::string State = "";
 	if (hasState) {
-		State = blackBoard.GetValueAsString("State");
+		State = blackBoard.GetValueAsString(m_stateKey);
 	}
 
 
@@ -24,7 +30,7 @@ NodeStatus TeleportAction::Tick(float deltatime, BlackBoard& blackBoard)
 		else //ൿ   · 
 		{
 			State = "Idle";
-			blackBoard.SetValueAsString("State", State);
+			blackBoard.SetValueAsString(m_stateKey, State);
 			script->m_isTeleport = false;
 			script->m_posset = false;
 			return NodeStatus::Success;
@@ -33,9 +39,9 @@ NodeStatus TeleportAction::Tick(float deltatime, BlackBoard& blackBoard)
 	else //ù Խ ڷƮ 
 	{
 		State = "Teleport";
-		blackBoard.SetValueAsString("State", State);
+		blackBoard.SetValueAsString(m_stateKey, State);
 		if (script) {
-			script->StartTeleport();
+			DeferWrite([script] { script->StartTeleport(); });
 		}
 		return NodeStatus::Running;
 	}
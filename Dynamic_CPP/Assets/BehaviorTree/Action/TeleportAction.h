@@ -8,4 +8,8 @@ class TeleportAction : public ActionNode
 public:
 	BT_ACTION_BODY(TeleportAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_stateKey{ "State" };
 };
@@ -1,18 +1,24 @@
 #include "TestAction.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void TestAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_cond1Key.Resolve(blackBoard);
+}
+
 NodeStatus TestAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
 	LOG("TestAction Tick called with deltatime: " << deltatime);
-	bool condition = blackBoard.HasKey("Cond1");
+	bool condition = blackBoard.HasKey(m_cond1Key);
 	int a = 0;
 	if (condition) {
-		a = blackBoard.GetValueAsInt("Cond1");
+		a = blackBoard.GetValueAsInt(m_cond1Key);
 	}
 	
 	LOG("TestAction: a incremented to " << a);
 
-	blackBoard.SetValueAsInt("Cond1", ++a); // Increment the value of "Cond1" by 1
+	blackBoard.SetValueAsInt(m_cond1Key, ++a); // Increment the value of "Cond1" by 1
 	
 
 	return NodeStatus::Success;
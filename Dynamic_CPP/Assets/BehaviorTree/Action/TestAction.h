@@ -8,4 +8,8 @@ class TestAction : public ActionNode
 public:
 	BT_ACTION_BODY(TestAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_cond1Key{ "Cond1" };
 };
@@ -6,10 +6,15 @@
 #include "EntityEleteMonster.h"
 #include "Animator.h"
 #include "CharacterControllerComponent.h"
+void WaitAction::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+}
+
 
 NodeStatus WaitAction::Tick(float deltatime, BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
 	Animator* animator = nullptr;
 	std::string identity = "";
@@ -19,7 +24,7 @@ NodeStatus WaitAction::Tick(float deltatime, BlackBoard& blackBoard)
 
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 
 	if (identity == "MonsterNomal")
@@ -8,4 +8,8 @@ class WaitAction : public ActionNode
 public:
 	BT_ACTION_BODY(WaitAction)
 	virtual NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
 };
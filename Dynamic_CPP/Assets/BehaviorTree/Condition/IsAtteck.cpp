@@ -1,45 +1,58 @@
 #include "IsAtteck.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsAtteck::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_targetKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_atkRangeKey.Resolve(blackBoard);
+	m_atkDelayKey.Resolve(blackBoard);
+	m_projectileRangeKey.Resolve(blackBoard);
+	m_rangedAttackCoolTimeKey.Resolve(blackBoard);
+	m_asisKey.Resolve(blackBoard);
+}
+
 bool IsAtteck::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
 	//LOG("IsAtteck ConditionCheck: Checking if entity is in attack range.");
 
 
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
 	std::string identity = "";
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 	//this based target logic
-	bool isTarget = blackBoard.HasKey("Target");
-	bool hasState = blackBoard.HasKey("State");
+	bool isTarget = blackBoard.HasKey(m_targetKey);
+	bool hasState = blackBoard.HasKey(m_stateKey);
 
 	bool useAttack = false;
 	bool hasAtkDelay = false;
 	float atkRange = 0.0f;
 	if (identity == "MonsterNomal")
 	{
-		useAttack = blackBoard.HasKey("AtkRange");
-		hasAtkDelay = blackBoard.HasKey("AtkDelay");
-		atkRange = blackBoard.GetValueAsFloat("AtkRange");
+		useAttack = blackBoard.HasKey(m_atkRangeKey);
+		hasAtkDelay = blackBoard.HasKey(m_atkDelayKey);
+		atkRange = blackBoard.GetValueAsFloat(m_atkRangeKey);
 	}
 
 	if (identity == "MonsterRange") 
 	{
-		useAttack = blackBoard.HasKey("ProjectileRange");
-		hasAtkDelay = blackBoard.HasKey("RangedAttackCoolTime");
-		atkRange = blackBoard.GetValueAsFloat("ProjectileRange");
+		useAttack = blackBoard.HasKey(m_projectileRangeKey);
+		hasAtkDelay = blackBoard.HasKey(m_rangedAttackCoolTimeKey);
+		atkRange = blackBoard.GetValueAsFloat(m_projectileRangeKey);
 	}
 
 
 	if (identity == "MonsterMage")
 	{
-		useAttack = blackBoard.HasKey("ProjectileRange");
-		hasAtkDelay = blackBoard.HasKey("RangedAttackCoolTime");
-		atkRange = blackBoard.GetValueAsFloat("ProjectileRange");
+		useAttack = blackBoard.HasKey(m_projectileRangeKey);
+		hasAtkDelay = blackBoard.HasKey(m_rangedAttackCoolTimeKey);
+		atkRange = blackBoard.GetValueAsFloat(m_projectileRangeKey);
 	}
 
 	//if (hasState) {
@@ -73,7 +86,7 @@ bool IsAtteck::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	Transform* selfTransform = m_owner->GetComponent<Transform>();
 	Mathf::Vector3 pos = selfTransform->GetWorldPosition();
 
-	GameObject* target = blackBoard.GetValueAsGameObject("Target");
+	GameObject* target = blackBoard.GetValueAsGameObject(m_targetKey);
 	Transform* targetTransform = target->GetComponent<Transform>();
 	Mathf::Vector3 targetPos = targetTransform->GetWorldPosition();
 	Mathf::Vector3 dir = targetPos - pos;
@@ -148,7 +161,7 @@ bool IsAtteck::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 
 	
 	//Asis a non-Attackable entity, other logic can be added here if needed
-	/*Transform asisTransform = blackBoard.GetValueAsTransform("Asis");
+	/*Transform asisTransform = blackBoard.GetValueAsTransform(m_asisKey);
 	Mathf::Vector3 asispos = asisTransform.GetWorldPosition();
 
 	Mathf::Vector3 dir = asispos - pos;*/
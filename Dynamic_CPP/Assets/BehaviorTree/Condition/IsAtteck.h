@@ -8,4 +8,15 @@ class IsAtteck : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsAtteck)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_targetKey{ "Target" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_atkRangeKey{ "AtkRange" };
+	BlackBoardKey m_atkDelayKey{ "AtkDelay" };
+	BlackBoardKey m_projectileRangeKey{ "ProjectileRange" };
+	BlackBoardKey m_rangedAttackCoolTimeKey{ "RangedAttackCoolTime" };
+	BlackBoardKey m_asisKey{ "Asis" };
 };
@@ -1,26 +1,36 @@
 #include "IsChase.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsChase::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_closedTargetKey.Resolve(blackBoard);
+	m_chaseRangeKey.Resolve(blackBoard);
+	m_chaseOutTimeKey.Resolve(blackBoard);
+	m_stateKey.Resolve(blackBoard);
+	m_identityKey.Resolve(blackBoard);
+}
+
 bool IsChase::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool hasClosedTarget = blackBoard.HasKey("ClosedTarget");
-	bool useChase = blackBoard.HasKey("ChaseRange");
-	bool useChaseOutTime = blackBoard.HasKey("ChaseOutTime");
-	bool haState = blackBoard.HasKey("State");
+	bool hasClosedTarget = blackBoard.HasKey(m_closedTargetKey);
+	bool useChase = blackBoard.HasKey(m_chaseRangeKey);
+	bool useChaseOutTime = blackBoard.HasKey(m_chaseOutTimeKey);
+	bool haState = blackBoard.HasKey(m_stateKey);
 
 	float chaseRange = 0.0f;
 	float chaseOutTime = 0.0f;
 
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
 	if (useChaseOutTime) {
-		chaseOutTime = blackBoard.GetValueAsFloat("ChaseOutTime");
+		chaseOutTime = blackBoard.GetValueAsFloat(m_chaseOutTimeKey);
 	}
 
 	std::string identity = "";
 	if (hasIdentity)
 	{
-		identity = blackBoard.GetValueAsString("Identity");
+		identity = blackBoard.GetValueAsString(m_identityKey);
 	}
 	if (identity == "MonsterMage") {
 		int a = 0;
@@ -29,7 +39,7 @@ bool IsChase::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 
 	if (haState)
 	{
-		std::string state = blackBoard.GetValueAsString("State");
+		std::string state = blackBoard.GetValueAsString(m_stateKey);
 		//LOG("BT STATE :" << state);
 		if (state == "Chase")
 		{
@@ -60,7 +70,7 @@ bool IsChase::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		return false;
 	}
 	else {
-		chaseRange = blackBoard.GetValueAsFloat("ChaseRange");
+		chaseRange = blackBoard.GetValueAsFloat(m_chaseRangeKey);
 	}
 
 	
@@ -68,7 +78,7 @@ bool IsChase::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 
 	if (hasClosedTarget)
 	{
-		GameObject* closedTarget = blackBoard.GetValueAsGameObject("ClosedTarget");
+		GameObject* closedTarget = blackBoard.GetValueAsGameObject(m_closedTargetKey);
 		if (closedTarget)
 		{
 		//recalculate distance 
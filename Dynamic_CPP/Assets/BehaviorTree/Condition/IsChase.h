@@ -8,4 +8,12 @@ class IsChase : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsChase)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_chaseRangeKey{ "ChaseRange" };
+	BlackBoardKey m_chaseOutTimeKey{ "ChaseOutTime" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_identityKey{ "Identity" };
 };
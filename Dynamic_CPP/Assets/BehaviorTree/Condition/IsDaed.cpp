@@ -1,9 +1,17 @@
 #include "IsDaed.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsDaed::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_hPKey.Resolve(blackBoard);
+	m_currHPKey.Resolve(blackBoard);
+}
+
 bool IsDaed::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool HasIdentity = blackBoard.HasKey("Identity");
+	bool HasIdentity = blackBoard.HasKey(m_identityKey);
 	
 	if (!HasIdentity)
 	{
@@ -11,11 +19,11 @@ bool IsDaed::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		return false; // No Identity key, cannot determine if it's a dead entity
 	}
 
-	bool useDead = blackBoard.HasKey("HP");
-	bool started = blackBoard.HasKey("CurrHP");
+	bool useDead = blackBoard.HasKey(m_hPKey);
+	bool started = blackBoard.HasKey(m_currHPKey);
 	if (useDead)
 	{
-		int hp = blackBoard.GetValueAsInt("CurrHP");
+		int hp = blackBoard.GetValueAsInt(m_currHPKey);
 		if (hp <= 0)
 		{
 			return true; // Entity is dead
@@ -8,4 +8,10 @@ class IsDaed : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsDaed)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_hPKey{ "HP" };
+	BlackBoardKey m_currHPKey{ "CurrHP" };
 };
@@ -1,9 +1,16 @@
 #include "IsGroggy.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsGroggy::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_groggyTimeKey.Resolve(blackBoard);
+}
+
 bool IsGroggy::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool HasIdentity = blackBoard.HasKey("Identity");
+	bool HasIdentity = blackBoard.HasKey(m_identityKey);
 
 	if (!HasIdentity)
 	{
@@ -11,7 +18,7 @@ bool IsGroggy::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		return false; // No Identity key, cannot determine if it's a dead entity
 	}
 
-	bool HasGroggyTime = blackBoard.HasKey("GroggyTime");
+	bool HasGroggyTime = blackBoard.HasKey(m_groggyTimeKey);
 
 	if (!HasGroggyTime)
 	{
@@ -19,7 +26,7 @@ bool IsGroggy::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		return false; // No GroggyTime key, cannot determine if it's groggy
 	}
 
-	float groggyTime = blackBoard.GetValueAsFloat("GroggyTime");
+	float groggyTime = blackBoard.GetValueAsFloat(m_groggyTimeKey);
 
 	if (groggyTime > 0.0f)
 	{
@@ -8,4 +8,9 @@ class IsGroggy : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsGroggy)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_groggyTimeKey{ "GroggyTime" };
 };
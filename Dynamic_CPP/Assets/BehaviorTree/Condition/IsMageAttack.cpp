@@ -1,23 +1,31 @@
 #include "IsMageAttack.h"
 #include "pch.h"
+void IsMageAttack::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_atkCooldownKey.Resolve(blackBoard);
+	m_eTargetRangeKey.Resolve(blackBoard);
+	m_targetKey.Resolve(blackBoard);
+}
+
 
 bool IsMageAttack::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 	if (Identity.empty()||Identity!="Mage")
 	{
 		return false; // Identity ų "Mage" ƴ  false ȯ
 	}
 	
-	float cooldown = blackBoard.GetValueAsFloat("AtkCooldown");
+	float cooldown = blackBoard.GetValueAsFloat(m_atkCooldownKey);
 	if (cooldown > 0.0f)
 	{
 		return false; //  Ÿ  false ȯ
 	}
 
-	float range = blackBoard.GetValueAsFloat("eTargetRange");
+	float range = blackBoard.GetValueAsFloat(m_eTargetRangeKey);
 
-	auto target = blackBoard.GetValueAsGameObject("Target");
+	auto target = blackBoard.GetValueAsGameObject(m_targetKey);
 	if (!target)
 	{
 		return false; // Ÿ  false ȯ
@@ -8,4 +8,11 @@ class IsMageAttack : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsMageAttack)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_atkCooldownKey{ "AtkCooldown" };
+	BlackBoardKey m_eTargetRangeKey{ "eTargetRange" };
+	BlackBoardKey m_targetKey{ "Target" };
 };
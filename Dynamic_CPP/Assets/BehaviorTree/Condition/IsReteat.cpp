@@ -1,21 +1,29 @@
 #include "IsReteat.h"
 #include "pch.h"
+void IsReteat::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_reteatCooldownKey.Resolve(blackBoard);
+	m_closedTargetKey.Resolve(blackBoard);
+	m_retreatRangeKey.Resolve(blackBoard);
+}
+
 
 bool IsReteat::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	if (!hasIdentity) return false; //Identity  bt ü ƴ 
 
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 	if (Identity.empty() || Identity != "MonsterMage")
 	{
 		return false; // Identity ų "MonsterMage" ƴ  false ȯ
 	}
 	
-	bool hasCooldown = blackBoard.HasKey("ReteatCooldown");
+	bool hasCooldown = blackBoard.HasKey(m_reteatCooldownKey);
 	if (hasCooldown)
 	{
-		float cooldown = blackBoard.GetValueAsFloat("ReteatCooldown");
+		float cooldown = blackBoard.GetValueAsFloat(m_reteatCooldownKey);
 		if (cooldown > 0.01f)
 		{
 			return false; //  Ÿ  false ȯ
@@ -23,9 +31,9 @@ bool IsReteat::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		//0.01 ۰ų ƿ ٸ  
 	}
 
-	bool hasTarget = blackBoard.HasKey("ClosedTarget");
+	bool hasTarget = blackBoard.HasKey(m_closedTargetKey);
 	if (!hasTarget) return false; //Ÿ  ư   ÷̾   տ .
-	auto ClosedTarget = blackBoard.GetValueAsGameObject("ClosedTarget");
+	auto ClosedTarget = blackBoard.GetValueAsGameObject(m_closedTargetKey);
 
 	auto selfTransform = m_owner->GetComponent<Transform>();
 	auto TargetTransform = ClosedTarget->GetComponent<Transform>();
@@ -33,7 +41,7 @@ bool IsReteat::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	Mathf::Vector3 Dir = TargetTransform->GetWorldPosition() - selfTransform->GetWorldPosition();
 	float len = Dir.Length();
 	//std::cout << "len : " << len << "and";
-	float invokeRange = blackBoard.GetValueAsFloat("RetreatRange");
+	float invokeRange = blackBoard.GetValueAsFloat(m_retreatRangeKey);
 	if (Dir.Length() < invokeRange)
 	{
 		return true; //  ÷̾ ϸ 
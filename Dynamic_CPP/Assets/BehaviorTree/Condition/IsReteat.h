@@ -8,4 +8,11 @@ class IsReteat : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsReteat)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_reteatCooldownKey{ "ReteatCooldown" };
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_retreatRangeKey{ "RetreatRange" };
 };
@@ -1,21 +1,29 @@
 #include "IsTeleport.h"
 #include "pch.h"
+void IsTeleport::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_teleportCooldownKey.Resolve(blackBoard);
+	m_closedTargetKey.Resolve(blackBoard);
+	m_teleportDistanceKey.Resolve(blackBoard);
+}
+
 
 bool IsTeleport::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
 	//std::cout << "IsTeleport ConditionCheck " << std::endl;
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 	if (!hasIdentity) return false; //Identity  bt ü ƴ 
 
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 	if (Identity.empty() || Identity != "MonsterMage")
 	{
 		return false; // Identity ų "MonsterMage" ƴ  false ȯ
 	}
-	bool hasCooldown = blackBoard.HasKey("TeleportCooldown");
+	bool hasCooldown = blackBoard.HasKey(m_teleportCooldownKey);
 	if (hasCooldown) 
 	{
-		float cooldown = blackBoard.GetValueAsFloat("TeleportCooldown");
+		float cooldown = blackBoard.GetValueAsFloat(m_teleportCooldownKey);
 		if (cooldown > 0.01f)
 		{
 			return false; // ڷƮ Ÿ  false ȯ
@@ -23,9 +31,9 @@ bool IsTeleport::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		//0.01 ۰ų ƿ ٸ ڷƮ 
 	}
 
-	bool hasTarget = blackBoard.HasKey("ClosedTarget");
+	bool hasTarget = blackBoard.HasKey(m_closedTargetKey);
 	if (!hasTarget) return false; //Ÿ  ư   ÷̾   տ .
-	auto ClosedTarget = blackBoard.GetValueAsGameObject("ClosedTarget"); 
+	auto ClosedTarget = blackBoard.GetValueAsGameObject(m_closedTargetKey); 
 	
 	auto selfTransform = m_owner->GetComponent<Transform>(); 
 	auto TargetTransform = ClosedTarget->GetComponent<Transform>();
@@ -34,7 +42,7 @@ bool IsTeleport::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	Mathf::Vector3 Dir = TargetTransform->GetWorldPosition() - selfTransform->GetWorldPosition();
 	float len = Dir.Length();
 //	std::cout << "len : " << len << "and";
-	float invokeRange = blackBoard.GetValueAsFloat("TeleportDistance");
+	float invokeRange = blackBoard.GetValueAsFloat(m_teleportDistanceKey);
 	if (Dir.Length() < invokeRange)
 	{
 		return true; //  ÷̾ ϸ ڷƮ
@@ -8,4 +8,11 @@ class IsTeleport : public ConditionNode
 public:
 	BT_CONDITION_BODY(IsTeleport)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_teleportCooldownKey{ "TeleportCooldown" };
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_teleportDistanceKey{ "TeleportDistance" };
 };
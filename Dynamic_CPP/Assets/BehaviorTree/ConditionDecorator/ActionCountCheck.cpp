@@ -1,15 +1,20 @@
 #include "ActionCountCheck.h"
 #include "pch.h"
 #include "TBoss1.h"
+void ActionCountCheck::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+}
+
 
 bool ActionCountCheck::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
 	if (!hasIdentity) {
 		return false;
 	}
-	std::string identity = blackBoard.GetValueAsString("Identity");
+	std::string identity = blackBoard.GetValueAsString(m_identityKey);
 	if (identity == "Boss1")
 	{
 		TBoss1* script = m_owner->GetComponent<TBoss1>();
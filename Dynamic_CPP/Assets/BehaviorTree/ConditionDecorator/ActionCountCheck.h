@@ -8,4 +8,8 @@ class ActionCountCheck : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(ActionCountCheck)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
 };
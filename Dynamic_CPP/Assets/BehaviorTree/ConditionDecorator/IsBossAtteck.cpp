@@ -1,14 +1,20 @@
 #include "IsBossAtteck.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsBossAtteck::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_idleTimeKey.Resolve(blackBoard);
+}
+
 bool IsBossAtteck::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
 
-	bool isProcessed = blackBoard.HasKey("IdleTime");
+	bool isProcessed = blackBoard.HasKey(m_idleTimeKey);
 	float idleTime; 
 	if (isProcessed) {
 		// atteack is add IdleTime to ActionNode
-		idleTime = blackBoard.GetValueAsFloat("IdleTime");
+		idleTime = blackBoard.GetValueAsFloat(m_idleTimeKey);
 		LOG("IdleTime is : " << idleTime);
 	}
 	else 
@@ -8,4 +8,8 @@ class IsBossAtteck : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsBossAtteck)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_idleTimeKey{ "IdleTime" };
 };
@@ -2,17 +2,24 @@
 #include "pch.h"
 #include "TestEnemy.h"
 #include "DebugLog.h"
+void IsDamege::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_animeStateKey.Resolve(blackBoard);
+	m_delayDamageActionKey.Resolve(blackBoard);
+	m_damageKey.Resolve(blackBoard);
+}
+
 bool IsDamege::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool isAnime = blackBoard.HasKey("AnimeState");
-	bool isDelayDamageAction = blackBoard.HasKey("DelayDamageAction");
+	bool isAnime = blackBoard.HasKey(m_animeStateKey);
+	bool isDelayDamageAction = blackBoard.HasKey(m_delayDamageActionKey);
 	float delayDamageTime = 0.0f;
 
-	bool hasDamage = blackBoard.HasKey("Damage");
+	bool hasDamage = blackBoard.HasKey(m_damageKey);
 	int damage=0;
 	if (hasDamage)
 	{
-		damage = blackBoard.GetValueAsInt("Damage");
+		damage = blackBoard.GetValueAsInt(m_damageKey);
 	}
 	else
 	{
@@ -27,12 +34,12 @@ bool IsDamege::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 
 	if (isDelayDamageAction)
 	{
-		delayDamageTime = blackBoard.GetValueAsFloat("DelayDamageAction");
+		delayDamageTime = blackBoard.GetValueAsFloat(m_delayDamageActionKey);
 	}
 
 	if (isAnime)
 	{
-		std::string state = blackBoard.GetValueAsString("AnimeState");
+		const std::string& state = blackBoard.GetValueAsString(m_animeStateKey);
 		if (state == "Damege")
 		{
 			LOG("Atteck action already in progress.");
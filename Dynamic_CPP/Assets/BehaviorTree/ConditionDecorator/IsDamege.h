@@ -9,4 +9,10 @@ class IsDamege : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsDamege)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_animeStateKey{ "AnimeState" };
+	BlackBoardKey m_delayDamageActionKey{ "DelayDamageAction" };
+	BlackBoardKey m_damageKey{ "Damage" };
 };
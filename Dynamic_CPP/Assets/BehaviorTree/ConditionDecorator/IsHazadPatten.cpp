@@ -1,16 +1,21 @@
 #include "IsHazadPatten.h"
 #include "pch.h"
 #include "TBoss1.h"
+void IsHazadPatten::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+}
+
 
 bool IsHazadPatten::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool hasIdentity = blackBoard.HasKey("Identity");
+	bool hasIdentity = blackBoard.HasKey(m_identityKey);
 
 	if (!hasIdentity) {
 		return false;
 	}
 
-	std::string identity = blackBoard.GetValueAsString("Identity");
+	std::string identity = blackBoard.GetValueAsString(m_identityKey);
 	if (identity == "Boss1")
 	{
 		TBoss1* script = m_owner->GetComponent<TBoss1>();
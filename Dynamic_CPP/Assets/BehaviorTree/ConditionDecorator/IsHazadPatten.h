@@ -8,4 +8,8 @@ class IsHazadPatten : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsHazadPatten)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
 };
@@ -1,10 +1,17 @@
 #include "IsInitialize.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsInitialize::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_initializedKey.Resolve(blackBoard);
+}
+
 bool IsInitialize::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
 	// Check if the "Identity" key exists in the blackboard
-	bool HasIdentity = blackBoard.HasKey("Identity");
+	bool HasIdentity = blackBoard.HasKey(m_identityKey);
 	if (!HasIdentity)
 	{
 		//LOG("IsInitialize ConditionCheck: No Identity key found in blackboard.");
@@ -13,14 +20,14 @@ bool IsInitialize::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	}
 
 	// Check if the "Initialized" key exists in the blackboard
-	bool HasInitialized = blackBoard.HasKey("Initialized");
+	bool HasInitialized = blackBoard.HasKey(m_initializedKey);
 	if (!HasInitialized)
 	{
 		//LOG("IsInitialize ConditionCheck: No Initialized key found in blackboard.");
 		return true; // Entity is not initialized -> initialize action will be executed
 	}
 
-	bool isInitialized = blackBoard.GetValueAsBool("Initialized");
+	bool isInitialized = blackBoard.GetValueAsBool(m_initializedKey);
 	if (isInitialized)
 	{
 		//LOG("IsInitialize ConditionCheck: Entity is initialized.");
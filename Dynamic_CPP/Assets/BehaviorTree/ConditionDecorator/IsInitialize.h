@@ -8,4 +8,9 @@ class IsInitialize : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsInitialize)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_initializedKey{ "Initialized" };
 };
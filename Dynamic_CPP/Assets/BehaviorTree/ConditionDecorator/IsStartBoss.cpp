@@ -1,11 +1,18 @@
 #include "IsStartBoss.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsStartBoss::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_isStartKey.Resolve(blackBoard);
+}
+
 bool IsStartBoss::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
 	// Check boos stage Bettle start 
-	bool HasIdentity = blackBoard.HasKey("Identity");
-	bool HasIsStart = blackBoard.HasKey("IsStart");
+	bool HasIdentity = blackBoard.HasKey(m_identityKey);
+	bool HasIsStart = blackBoard.HasKey(m_isStartKey);
 
 	if (!HasIdentity)
 	{
@@ -19,14 +26,14 @@ bool IsStartBoss::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	}
 
 
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 	if (Identity != "Boss1")
 	{
 		LOG("IsStartBoss: Not a boss stage, Identity: " << Identity);
 		return false; // Not a boss stage
 	}
 
-	auto IsStart = blackBoard.GetValueAsBool("IsStart");
+	auto IsStart = blackBoard.GetValueAsBool(m_isStartKey);
 	if (IsStart)
 	{
 		//LOG("IsStartBoss: Boss stage has started, Identity: " << Identity);
@@ -8,4 +8,9 @@ class IsStartBoss : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsStartBoss)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_isStartKey{ "IsStart" };
 };
@@ -1,15 +1,23 @@
 #include "IsUseAsis.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void IsUseAsis::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_eAsisKey.Resolve(blackBoard);
+	m_targetKey.Resolve(blackBoard);
+	m_asisKey.Resolve(blackBoard);
+}
+
 bool IsUseAsis::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool isUseAsis = blackBoard.HasKey("eAsis");
+	bool isUseAsis = blackBoard.HasKey(m_eAsisKey);
 
 	bool isAsisAction = false;
 
 	if (isUseAsis)
 	{
-		isAsisAction = blackBoard.GetValueAsBool("eAsis");
+		isAsisAction = blackBoard.GetValueAsBool(m_eAsisKey);
 	}
 	else 
 	{
@@ -18,9 +26,9 @@ bool IsUseAsis::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 	}
 
 	GameObject* Target = nullptr;
-	bool isTarget = blackBoard.HasKey("Target");
+	bool isTarget = blackBoard.HasKey(m_targetKey);
 	if (isTarget) {
-		Target = blackBoard.GetValueAsGameObject("Target");
+		Target = blackBoard.GetValueAsGameObject(m_targetKey);
 		if (Target == nullptr) {
 			LOG("IsUseAsis: Target is not set in blackboard.");
 			return false; // If Target is not set, return false
@@ -31,9 +39,9 @@ bool IsUseAsis::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 		return false; // If Target key does not exist, return false
 	}
 	GameObject* Asis = nullptr;
-	bool isAsis = blackBoard.HasKey("Asis");
+	bool isAsis = blackBoard.HasKey(m_asisKey);
 	if (isAsis) {
-		Asis = blackBoard.GetValueAsGameObject("Asis");
+		Asis = blackBoard.GetValueAsGameObject(m_asisKey);
 		if (Asis == nullptr) {
 			LOG("IsUseAsis: Asis is not set in blackboard.");
 			return false; // If Asis is not set, return false
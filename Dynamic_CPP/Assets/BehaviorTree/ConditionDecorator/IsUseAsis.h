@@ -8,4 +8,10 @@ class IsUseAsis : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(IsUseAsis)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_eAsisKey{ "eAsis" };
+	BlackBoardKey m_targetKey{ "Target" };
+	BlackBoardKey m_asisKey{ "Asis" };
 };
@@ -8,4 +8,10 @@ class Phase1 : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(Phase1)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_maxHPKey{ "MaxHP" };
+	BlackBoardKey m_currHPKey{ "CurrHP" };
 };
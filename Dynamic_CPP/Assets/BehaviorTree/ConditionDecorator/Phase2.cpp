@@ -1,14 +1,22 @@
 #include "Phase2.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void Phase2::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_maxHPKey.Resolve(blackBoard);
+	m_currHPKey.Resolve(blackBoard);
+}
+
 bool Phase2::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 
 	if (Identity != "Boss1") return false;
 
-	int maxHp = blackBoard.GetValueAsInt("MaxHP");
-	int hp = blackBoard.GetValueAsInt("CurrHP");
+	int maxHp = blackBoard.GetValueAsInt(m_maxHPKey);
+	int hp = blackBoard.GetValueAsInt(m_currHPKey);
 
 	float hpRatio = static_cast<float>(hp) / static_cast<float>(maxHp);
 
@@ -1,14 +1,21 @@
 #include "Phase3.h"
 #include "pch.h"
+void Phase3::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_identityKey.Resolve(blackBoard);
+	m_eHPKey.Resolve(blackBoard);
+	m_eCurrentHPKey.Resolve(blackBoard);
+}
+
 
 bool Phase3::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	auto Identity = blackBoard.GetValueAsString("Identity");
+	auto Identity = blackBoard.GetValueAsString(m_identityKey);
 
 	if (Identity != "Boss1") return false;
 
-	int maxHp = blackBoard.GetValueAsInt("eHP");
-	int hp = blackBoard.GetValueAsInt("eCurrentHP");
+	int maxHp = blackBoard.GetValueAsInt(m_eHPKey);
+	int hp = blackBoard.GetValueAsInt(m_eCurrentHPKey);
 
 	float hpRatio = static_cast<float>(hp) / static_cast<float>(maxHp);
 
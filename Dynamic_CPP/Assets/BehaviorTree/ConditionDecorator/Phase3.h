@@ -8,4 +8,10 @@ class Phase3 : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(Phase3)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_eHPKey{ "eHP" };
+	BlackBoardKey m_eCurrentHPKey{ "eCurrentHP" };
 };
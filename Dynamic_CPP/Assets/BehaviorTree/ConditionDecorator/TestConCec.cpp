@@ -1,11 +1,17 @@
 #include "TestConCec.h"
 #include "pch.h"
 #include "DebugLog.h"
+
+void TestConCec::ResolveKeys(const BlackBoard& blackBoard)
+{
+	m_cond1Key.Resolve(blackBoard);
+}
+
 bool TestConCec::ConditionCheck(float deltatime, const BlackBoard& blackBoard)
 {
-	bool condition = blackBoard.HasKey("Cond1");
+	bool condition = blackBoard.HasKey(m_cond1Key);
 	if (condition) {
-		int a = blackBoard.GetValueAsInt("Cond1");
+		int a = blackBoard.GetValueAsInt(m_cond1Key);
 		if (a>10)
 		{
 			LOG("ConditionCheck: a is greater than 10");
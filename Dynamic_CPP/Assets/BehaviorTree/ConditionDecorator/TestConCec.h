@@ -7,4 +7,8 @@ class TestConCec : public ConditionDecoratorNode
 public:
 	BT_CONDITIONDECORATOR_BODY(TestConCec)
 	virtual bool ConditionCheck(float deltatime, const BlackBoard& blackBoard) override;
+	virtual void ResolveKeys(const BlackBoard& blackBoard) override;
+
+private:
+	BlackBoardKey m_cond1Key{ "Cond1" };
 };
@@ -469,23 +469,29 @@ void EntityEleteMonster::ChaseTarget(float deltatime)
 			Mathf::Matrix rotRight = Mathf::Matrix::CreateRotationY(Mathf::ToRadians(m_avoidanceAngle));
 			Mathf::Vector3 leftFeelerDir = Mathf::Vector3::TransformNormal(forwardDir, rotLeft);
 			Mathf::Vector3 rightFeelerDir = Mathf::Vector3::TransformNormal(forwardDir, rotRight);
-			std::vector<Mathf::Vector3> feelerDirs = { forwardDir, leftFeelerDir, rightFeelerDir };
+			const Mathf::Vector3 feelerDirs[] = { forwardDir, leftFeelerDir, rightFeelerDir };
 
+			//  ̸  ġ 
+			SceneQueryBatch feelerQueries;
+			const Mathf::Vector3 feelerOrigin = m_transform->GetWorldPosition();
 			for (const auto& feelerDir : feelerDirs)
 			{
-				std::vector<HitResult> res;
+				feelerQueries.AddRaycast(feelerOrigin, feelerDir, m_obstacleAvoidanceDistance, ~0u);
+			}
+			PhysicsManagers->ExecuteQueries(feelerQueries);
 
-				if (RaycastAll(m_transform->GetWorldPosition(), feelerDir, m_obstacleAvoidanceDistance, ~0, res))
+			std::vector<HitResult> res;
+			for (uint32_t i = 0; i < feelerQueries.Size(); ++i)
+			{
+				res.clear();
+				if (PhysicsManagers->AppendQueryHits(feelerQueries, i, res) > 0)
 				{
-					if (res.size() > 0)
+					for (auto& hit : res)
 					{
-						for (auto& hit : res)
+						if (hit.gameObject != m_pOwner && hit.gameObject != target)
 						{
-							if (hit.gameObject != m_pOwner && hit.gameObject != target)
-							{
-								obstacleDetected = true;
-								avoidanceForce += -feelerDir;
-							}
+							obstacleDetected = true;
+							avoidanceForce += -feelerDirs[i];
 						}
 					}
 				}
@@ -306,16 +306,18 @@ void EntityEnemy::MeleeAttack()
 
 	pos.y = 0.5f; // ray cast height 
 
-	std::vector<HitResult> hits;
-	int size = RaycastAll(pos, dir, 2.f, ~0, hits);
-
-	std::vector<HitResult> hits1;
-	int size1 = RaycastAll(pos, dir1, 1.7f, ~0, hits1);
-	std::vector<HitResult> hits2;
-	int size2 = RaycastAll(pos, dir2, 1.7f, ~0, hits2);
+	// ¿ ̸  ġ 
+	SceneQueryBatch rayQueries;
+	rayQueries.AddRaycast(pos, dir, 2.f, ~0u);
+	rayQueries.AddRaycast(pos, dir1, 1.7f, ~0u);
+	rayQueries.AddRaycast(pos, dir2, 1.7f, ~0u);
+	PhysicsManagers->ExecuteQueries(rayQueries);
 
-	hits.insert(hits.end(), hits1.begin(), hits1.end());
-	hits.insert(hits.end(), hits2.begin(), hits2.end());
+	std::vector<HitResult> hits;
+	for (uint32_t i = 0; i < rayQueries.Size(); ++i)
+	{
+		PhysicsManagers->AppendQueryHits(rayQueries, i, hits);
+	}
 
 
 	//LOG(dir.x << " " << dir.y << " " << dir.z);
@@ -45,6 +45,21 @@ void EntityMonsterA::Start()
 
 	enemyBT = m_pOwner->GetComponent<BehaviorTreeComponent>();
 	blackBoard = enemyBT->GetBlackBoard();
+	m_identityKey.Resolve(*blackBoard);
+	m_stateKey.Resolve(*blackBoard);
+	m_maxHPKey.Resolve(*blackBoard);
+	m_currHPKey.Resolve(*blackBoard);
+	m_moveSpeedKey.Resolve(*blackBoard);
+	m_chaseRangeKey.Resolve(*blackBoard);
+	m_chaseOutTimeKey.Resolve(*blackBoard);
+	m_atkRangeKey.Resolve(*blackBoard);
+	m_attackDamageKey.Resolve(*blackBoard);
+	m_player1Key.Resolve(*blackBoard);
+	m_player2Key.Resolve(*blackBoard);
+	m_asisKey.Resolve(*blackBoard);
+	m_closedTargetKey.Resolve(*blackBoard);
+	m_targetKey.Resolve(*blackBoard);
+	m_isAttackingKey.Resolve(*blackBoard);
 	auto childred = m_pOwner->m_childrenIndices;
 	for (auto& child : childred)
 	{
@@ -98,9 +113,9 @@ void EntityMonsterA::Start()
 		hitBaseScale = Vector3(hitscale.x, hitscale.y, hitscale.z);
 	}
 
-	bool hasid = blackBoard->HasKey("Identity");
+	bool hasid = blackBoard->HasKey(m_identityKey);
 	if (hasid) {
-		std::string id = blackBoard->GetValueAsString("Identity");
+		std::string id = blackBoard->GetValueAsString(m_identityKey);
 		if (id == "MonsterNomal") {
 			/*m_animator->SetParameter("Dead", false);
 			m_animator->SetParameter("Atteck", false);
@@ -116,18 +131,18 @@ void EntityMonsterA::Start()
 		 GM = GMObj->GetComponent<GameManager>();
 	}
 	//blackboard initialize
-	blackBoard->SetValueAsString("State", m_state); // 
-	blackBoard->SetValueAsString("Identity", m_identity); // ̵ƼƼ
+	blackBoard->SetValueAsString(m_stateKey, m_state); // 
+	blackBoard->SetValueAsString(m_identityKey, m_identity); // ̵ƼƼ
 
-	blackBoard->SetValueAsInt("MaxHP", m_maxHP); //ִ ü
-	blackBoard->SetValueAsInt("CurrHP", m_currentHP); // ü
+	blackBoard->SetValueAsInt(m_maxHPKey, m_maxHP); //ִ ü
+	blackBoard->SetValueAsInt(m_currHPKey, m_currentHP); // ü
 
-	blackBoard->SetValueAsFloat("MoveSpeed", m_moveSpeed); //̵ ӵ
-	blackBoard->SetValueAsFloat("ChaseRange", m_chaseRange); //  Ÿ
-	blackBoard->SetValueAsFloat("ChaseOutTime", m_rangeOutDuration); //  ð
+	blackBoard->SetValueAsFloat(m_moveSpeedKey, m_moveSpeed); //̵ ӵ
+	blackBoard->SetValueAsFloat(m_chaseRangeKey, m_chaseRange); //  Ÿ
+	blackBoard->SetValueAsFloat(m_chaseOutTimeKey, m_rangeOutDuration); //  ð
 
-	blackBoard->SetValueAsFloat("AtkRange", m_attackRange); //  Ÿ
-	blackBoard->SetValueAsInt("AttackDamage", m_attackDamage); //  
+	blackBoard->SetValueAsFloat(m_atkRangeKey, m_attackRange); //  Ÿ
+	blackBoard->SetValueAsInt(m_attackDamageKey, m_attackDamage); //  
 
 	if (GM)
 	{
@@ -139,18 +154,18 @@ void EntityMonsterA::Start()
 		//	blackBoard->SetValueAsString("Player2", players[1]->GetOwner()->ToString());
 		//}
 	}
-	bool hasAsis = blackBoard->HasKey("Asis");
-	bool hasP1 = blackBoard->HasKey("Player1");
-	bool hasP2 = blackBoard->HasKey("Player2");
+	bool hasAsis = blackBoard->HasKey(m_asisKey);
+	bool hasP1 = blackBoard->HasKey(m_player1Key);
+	bool hasP2 = blackBoard->HasKey(m_player2Key);
 
 	if (hasAsis) {
-		m_asis = blackBoard->GetValueAsGameObject("Asis");
+		m_asis = blackBoard->GetValueAsGameObject(m_asisKey);
 	}
 	if (hasP1) {
-		m_player1 = blackBoard->GetValueAsGameObject("Player1");
+		m_player1 = blackBoard->GetValueAsGameObject(m_player1Key);
 	}
 	if (hasP2) {
-		m_player2 = blackBoard->GetValueAsGameObject("Player2");
+		m_player2 = blackBoard->GetValueAsGameObject(m_player2Key);
 	}
 	HitImpulseStart();
 }
@@ -165,18 +180,18 @@ void EntityMonsterA::Update(float tick)
 	CharacterControllerComponent* controller = GetOwner()->GetComponent<CharacterControllerComponent>();
 	controller->SetBaseSpeed(m_moveSpeed);
 
-	bool hasAsis = blackBoard->HasKey("Asis");
-	bool hasP1 = blackBoard->HasKey("Player1");
-	bool hasP2 = blackBoard->HasKey("Player2");
+	bool hasAsis = blackBoard->HasKey(m_asisKey);
+	bool hasP1 = blackBoard->HasKey(m_player1Key);
+	bool hasP2 = blackBoard->HasKey(m_player2Key);
 
 	if (hasAsis && !m_asis) {
-		m_asis = blackBoard->GetValueAsGameObject("Asis");
+		m_asis = blackBoard->GetValueAsGameObject(m_asisKey);
 	}
 	if (hasP1 && !m_player1){
-		m_player1 = blackBoard->GetValueAsGameObject("Player1");
+		m_player1 = blackBoard->GetValueAsGameObject(m_player1Key);
 	}
 	if (hasP2 && !m_player2) {
-		m_player2 = blackBoard->GetValueAsGameObject("Player2");
+		m_player2 = blackBoard->GetValueAsGameObject(m_player2Key);
 	}
 	
 	Transform* m_transform = m_pOwner->GetComponent<Transform>();
@@ -242,19 +257,19 @@ void EntityMonsterA::Update(float tick)
 	if (closedTarget) {
 		if (closedDist == FLT_MAX) {
 			target = nullptr;
-			blackBoard->SetValueAsGameObject("ClosedTarget", "");
-			blackBoard->SetValueAsGameObject("Target", "");
+			blackBoard->SetValueAsGameObject(m_closedTargetKey, "");
+			blackBoard->SetValueAsGameObject(m_targetKey, "");
 		}
 		else {
 			target = closedTarget;
-			blackBoard->SetValueAsGameObject("ClosedTarget", closedTarget->ToString());
-			blackBoard->SetValueAsGameObject("Target", closedTarget->ToString());
+			blackBoard->SetValueAsGameObject(m_closedTargetKey, closedTarget->ToString());
+			blackBoard->SetValueAsGameObject(m_targetKey, closedTarget->ToString());
 		}
 	}
 	else {
 		target = nullptr;
-		blackBoard->SetValueAsGameObject("ClosedTarget", "");
-		blackBoard->SetValueAsGameObject("Target", "");
+		blackBoard->SetValueAsGameObject(m_closedTargetKey, "");
+		blackBoard->SetValueAsGameObject(m_targetKey, "");
 	}
 
 	if (isBoxAttack) {
@@ -328,9 +343,9 @@ void EntityMonsterA::Update(float tick)
 	}
 
 
-	bool haskey = blackBoard->HasKey("IsAttacking");
+	bool haskey = blackBoard->HasKey(m_isAttackingKey);
 	if (haskey) {
-		isAttackAnimation = blackBoard->GetValueAsBool("IsAttacking");
+		isAttackAnimation = blackBoard->GetValueAsBool(m_isAttackingKey);
 	}
 	
 	Benchmark bm;
@@ -401,12 +416,12 @@ void EntityMonsterA::ChaseTarget(float deltatime)
 			Mathf::Vector3 dir = targetpos - pos;
 			dir.y = 0.f;
 
-			bool useChaseOutTime = blackBoard->HasKey("ChaseOutTime");
+			bool useChaseOutTime = blackBoard->HasKey(m_chaseOutTimeKey);
 			float outTime = 0.0f;
 			
 			if (useChaseOutTime)
 			{
-				outTime = blackBoard->GetValueAsFloat("ChaseOutTime");
+				outTime = blackBoard->GetValueAsFloat(m_chaseOutTimeKey);
 			}
 
 			//std::cout << "dist "<< dir.Length() << std::endl;
@@ -418,8 +433,8 @@ void EntityMonsterA::ChaseTarget(float deltatime)
 			else {
 				outTime -= deltatime; // Decrease outTime if not within range
 			}
-			blackBoard->SetValueAsString("State", m_state);
-			blackBoard->SetValueAsFloat("ChaseOutTime", outTime);
+			blackBoard->SetValueAsString(m_stateKey, m_state);
+			blackBoard->SetValueAsFloat(m_chaseOutTimeKey, outTime);
 
 			dir.Normalize();
 			
@@ -432,23 +447,29 @@ void EntityMonsterA::ChaseTarget(float deltatime)
 			Mathf::Matrix rotRight = Mathf::Matrix::CreateRotationY(Mathf::ToRadians(m_avoidanceAngle));
 			Mathf::Vector3 leftFeelerDir = Mathf::Vector3::TransformNormal(forwardDir, rotLeft);
 			Mathf::Vector3 rightFeelerDir = Mathf::Vector3::TransformNormal(forwardDir, rotRight);
-			std::vector<Mathf::Vector3> feelerDirs = { forwardDir, leftFeelerDir, rightFeelerDir };
+			const Mathf::Vector3 feelerDirs[] = { forwardDir, leftFeelerDir, rightFeelerDir };
 
+			//  ̸  ġ 
+			SceneQueryBatch feelerQueries;
+			const Mathf::Vector3 feelerOrigin = m_transform->GetWorldPosition();
 			for (const auto& feelerDir : feelerDirs)
 			{
-				std::vector<HitResult> res;
+				feelerQueries.AddRaycast(feelerOrigin, feelerDir, m_obstacleAvoidanceDistance, ~0u);
+			}
+			PhysicsManagers->ExecuteQueries(feelerQueries);
 
-				if (RaycastAll(m_transform->GetWorldPosition(), feelerDir, m_obstacleAvoidanceDistance, ~0, res))
+			std::vector<HitResult> res;
+			for (uint32_t i = 0; i < feelerQueries.Size(); ++i)
+			{
+				res.clear();
+				if (PhysicsManagers->AppendQueryHits(feelerQueries, i, res) > 0)
 				{
-					if (res.size() > 0) 
+					for (auto& hit : res) 
 					{
-						for (auto& hit : res) 
+						if (hit.gameObject != m_pOwner && hit.gameObject != target)
 						{
-							if (hit.gameObject != m_pOwner && hit.gameObject != target)
-							{
-								obstacleDetected = true;
-								avoidanceForce += -feelerDir;
-							}
+							obstacleDetected = true;
+							avoidanceForce += -feelerDirs[i];
 						}
 					}
 				}
@@ -568,7 +589,7 @@ void EntityMonsterA::SendDamage(Entity* sender, int damage, HitInfo hitinfo)
 			//忡  
 			//blackBoard->SetValueAsInt("Damage", damage);
 			m_currentHP -= damage;
-			blackBoard->SetValueAsInt("CurrHP", m_currentHP);
+			blackBoard->SetValueAsInt(m_currHPKey, m_currentHP);
 
 
 			if (GM)
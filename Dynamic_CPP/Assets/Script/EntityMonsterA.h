@@ -2,9 +2,9 @@
 #include "Core.Minimal.h"
 #include "ModuleBehavior.h"
 #include "Entity.h"
+#include "Blackboard.h"
 #include "EntityMonsterA.generated.h"
 class BehaviorTreeComponent;
-class BlackBoard;
 class Animator;
 class EffectComponent;
 class CharacterControllerComponent;
@@ -35,6 +35,21 @@ public:
 
 	BehaviorTreeComponent* enemyBT = nullptr;
 	BlackBoard* blackBoard = nullptr;
+	BlackBoardKey m_identityKey{ "Identity" };
+	BlackBoardKey m_stateKey{ "State" };
+	BlackBoardKey m_maxHPKey{ "MaxHP" };
+	BlackBoardKey m_currHPKey{ "CurrHP" };
+	BlackBoardKey m_moveSpeedKey{ "MoveSpeed" };
+	BlackBoardKey m_chaseRangeKey{ "ChaseRange" };
+	BlackBoardKey m_chaseOutTimeKey{ "ChaseOutTime" };
+	BlackBoardKey m_atkRangeKey{ "AtkRange" };
+	BlackBoardKey m_attackDamageKey{ "AttackDamage" };
+	BlackBoardKey m_player1Key{ "Player1" };
+	BlackBoardKey m_player2Key{ "Player2" };
+	BlackBoardKey m_asisKey{ "Asis" };
+	BlackBoardKey m_closedTargetKey{ "ClosedTarget" };
+	BlackBoardKey m_targetKey{ "Target" };
+	BlackBoardKey m_isAttackingKey{ "IsAttacking" };
 	Animator* m_animator = nullptr;
 	EffectComponent* markEffect = nullptr; //ũƼ ũ 
 	CriticalMark* m_criticalMark = nullptr;
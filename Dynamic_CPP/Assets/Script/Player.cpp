@@ -1877,7 +1877,6 @@ void Player::MeleeAttack()
 	Mathf::Vector3 direction = handPos - rayOrigin;
 	direction.y = 0;
 	direction.Normalize();
-	std::vector<HitResult> hits;
 	rayOrigin.y +=  0.5f;
 	
 	float distacne = 2.0f;
@@ -1891,22 +1890,24 @@ void Player::MeleeAttack()
 
 	unsigned int layerMask = 1 << 0 | 1 << 8 | 1 << 10 | 1<< 14;
 
-	int size = RaycastAll(rayOrigin, direction, distacne, layerMask, hits);
-
 	constexpr float angle = XMConvertToRadians(15.0f);
 	Vector3 leftDir = Vector3::Transform(direction, Matrix::CreateRotationY(-angle));
 	leftDir.Normalize();
 	Vector3 rightDir = Vector3::Transform(direction, Matrix::CreateRotationY(angle));
 	rightDir.Normalize();
-	std::vector<HitResult> leftHits;
-	int leftSize = RaycastAll(rayOrigin, leftDir, distacne, layerMask, leftHits);
-	std::vector<HitResult> rightHits;
-	int rightSize = RaycastAll(rayOrigin, rightDir, distacne, layerMask, rightHits);
+
+	//정면, 좌, 우 레이를 한 배치로 실행
+	SceneQueryBatch rayQueries;
+	rayQueries.AddRaycast(rayOrigin, direction, distacne, layerMask);
+	rayQueries.AddRaycast(rayOrigin, leftDir, distacne, layerMask);
+	rayQueries.AddRaycast(rayOrigin, rightDir, distacne, layerMask);
+	PhysicsManagers->ExecuteQueries(rayQueries);
+
 	std::vector<HitResult> allHits;
-	allHits.reserve(size + leftSize + rightSize);
-	allHits.insert(allHits.end(), hits.begin(), hits.end());
-	allHits.insert(allHits.end(), leftHits.begin(), leftHits.end());
-	allHits.insert(allHits.end(), rightHits.begin(), rightHits.end());
+	for (uint32_t i = 0; i < rayQueries.Size(); ++i)
+	{
+		PhysicsManagers->AppendQueryHits(rayQueries, i, allHits);
+	}
 	for (auto& hit : allHits)
 	{
 		auto object = hit.gameObject;
@@ -1956,15 +1957,21 @@ void Player::MeleeAttackOnce(float degAngleRange, float degIntervalAngle)
 	int rayCount = static_cast<int>(degAngleRange / degIntervalAngle) + 1;
 
 	Mathf::Vector3 forward = GetOwner()->m_transform.GetForward();
-	std::vector<HitResult> hits;
-	hits.reserve(100);
+	//부채꼴 레이를 모두 모아 한 번에 실행 (레이 수가 많으면 잡으로 나뉜다)
+	SceneQueryBatch rayQueries;
 	for (int i = 0; i < rayCount; i++) {
-		std::vector<HitResult> tempHits;
 		float angle = XMConvertToRadians(startAngle + i * degIntervalAngle);
 		Vector3 dir = Vector3::Transform(forward, Matrix::CreateRotationY(-angle));
 		dir.Normalize();
-		int leftSize = RaycastAll(rayOrigin, dir, distacne, layerMask, tempHits);
-		hits.insert(hits.end(), tempHits.begin(), tempHits.end());
+		rayQueries.AddRaycast(rayOrigin, dir, distacne, layerMask);
+	}
+	PhysicsManagers->ExecuteQueries(rayQueries);
+
+	std::vector<HitResult> hits;
+	hits.reserve(100);
+	for (uint32_t i = 0; i < rayQueries.Size(); ++i)
+	{
+		PhysicsManagers->AppendQueryHits(rayQueries, i, hits);
 	}
 	for (auto& hit : hits)
 	{
@@ -48,10 +48,7 @@ void DirectX11::Dx11Main::Initialize()
     g_progressWindow->SetStatusText(L"Initializing RenderEngine...");
     m_deviceResources->RegisterDeviceNotify(this);
 
-    XMFLOAT3 center = { 0.0f, 0.0f, 0.0f };
-    XMFLOAT3 extents = { 2000.f, 2000.f, 2000.f };
-    BoundingBox fixedBounds(center, extents);
-    CullingManagers->Initialize(fixedBounds, 3, 30);
+    CullingManagers->Initialize();
     TagManagers->Initialize();
 
     g_progressWindow->SetProgress(50);
@@ -253,6 +250,7 @@ void DirectX11::Dx11Main::Update()
     {
         InfoWindow();
         InputManagement->Update(EngineSettingInstance->frameDeltaTime);
+        SceneManagers->WaitAIUpdate();
 #ifdef EDITOR
         if(!SceneManagers->IsGameStart())
         {
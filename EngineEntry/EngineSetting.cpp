@@ -1,6 +1,7 @@
 #include "EngineSetting.h"
 #include "ReflectionYml.h"
 #include "PakHelper.h"
+#include "Core.PakFileSystem.h"
 
 
 bool EngineSetting::Initialize()
@@ -45,7 +46,7 @@ bool EngineSetting::Initialize()
 
 	isSuccess = EngineSetting::LoadSettings();
 #else
-	UnpackageGameAssets();
+	MountGameAssets();
 	bool isSuccess = EngineSetting::LoadSettings();
 #endif
 
@@ -70,6 +71,8 @@ bool EngineSetting::SaveSettings()
 	rootNode["buildGameName"] = buildGameProjectName.string();
 	rootNode["startupSceneName"] = startupSceneName.string();
 	rootNode["imguiScale"] = m_imguiScale;
+	rootNode["releaseMeshCPUData"] = m_releaseMeshCPUData;
+	rootNode["aiTickBudgetMs"] = m_aiTickBudgetMs;
 
 	settingsFile << rootNode;
 
@@ -84,13 +87,14 @@ bool EngineSetting::LoadSettings()
 	// Implement loading logic here
 	file::path engineSettingsPath = PathFinder::ProjectSettingPath("EngineSettings.asset");
 
-	if (!file::exists(engineSettingsPath))
+	if (!PakFileSystems->Exists(engineSettingsPath))
 	{
 		//initialize default settings
 		isSuccess = SaveSettings();
 	}
 
-	MetaYml::Node rootNode = MetaYml::LoadFile(engineSettingsPath.string());
+	AssetStream settingsFile(engineSettingsPath);
+	MetaYml::Node rootNode = MetaYml::Load(settingsFile);
 
 	m_lastWindowSize =
 	{
@@ -119,5 +123,15 @@ bool EngineSetting::LoadSettings()
 		m_imguiScale = rootNode["imguiScale"].as<float>();
 	}
 
+	if (rootNode["releaseMeshCPUData"])
+	{
+		m_releaseMeshCPUData = rootNode["releaseMeshCPUData"].as<bool>();
+	}
+
+	if (rootNode["aiTickBudgetMs"])
+	{
+		m_aiTickBudgetMs = rootNode["aiTickBudgetMs"].as<float>();
+	}
+
 	return isSuccess;
 }
\ No newline at end of file
@@ -89,6 +89,14 @@ public:
 	std::wstring GetStartupSceneName() const { return m_startupSceneName; }
 	void SetStartupSceneName(const std::wstring& name) { m_startupSceneName = name; }
 
+	// Drop CPU-side vertex/index copies of cooked meshes after upload (runtime LOD generation and lightmap baking need them)
+	bool IsReleaseMeshCPUData() const { return m_releaseMeshCPUData; }
+	void SetReleaseMeshCPUData(bool release) { m_releaseMeshCPUData = release; }
+
+	// Per-frame time budget for AI ticks in milliseconds (applied to AIManager on startup)
+	float GetAITickBudget() const { return m_aiTickBudgetMs; }
+	void SetAITickBudget(float milliseconds) { m_aiTickBudgetMs = milliseconds; }
+
 	std::atomic<bool> m_isRenderPaused{ false };
 
 	std::atomic_flag gameToRenderLock = ATOMIC_FLAG_INIT;
@@ -107,6 +115,13 @@ private:
     bool m_isEditorMode{ true };
 	bool m_isMinimized{ false };
 	bool m_isDebugMode{ false };
+#ifdef BUILD_FLAG
+	// Game builds never load the settings file and have no lightmap baker or effect editor, so drop the copies by default
+	bool m_releaseMeshCPUData{ true };
+#else
+	bool m_releaseMeshCPUData{ false };
+#endif
+	float m_aiTickBudgetMs{ 2.f };
 
 
 	MSVCVersion m_msvcVersion{ MSVCVersion::None };
@@ -3,6 +3,8 @@
 #include "EngineSetting.h"
 #include "MSBuildHelper.h"
 #include "PakHelper.h"
+#include "TextureCache.h"
+#include "SceneBinary.h"
 
 void GameBuilderSystem::Initialize()
 {
@@ -63,6 +65,10 @@ void GameBuilderSystem::BuildGame()
 
 bool GameBuilderSystem::PackageGameAssets()
 {
+	// Ƽ ؽó ̸  Cooked  ΰ pak   ´
+	TextureCaches->CookAll(PathFinder::MaterialSourcePath(), MaterialTextureCookSettings);
+	//  ε ߿ ŷ Ƿ ⼭ .scenebin  ֽ 
+	SceneBinary::CookAll(PathFinder::Relative("Scenes"));
 	return ::PackageGameAssets();
 }
 
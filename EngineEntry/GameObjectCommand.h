@@ -138,6 +138,7 @@ namespace Meta
                     cloned->m_parentIndex = parentIndex;
                     cloned->m_transform.SetParentID(parentIndex);
                     parentObj->m_childrenIndices.push_back(cloned->m_index);
+                    m_scene->MarkHierarchyDirty();
                 }
             }
 
@@ -347,6 +347,7 @@ HierarchyWindow::HierarchyWindow(SceneRenderer* ptr) :
 						draggedObj->m_parentIndex = 0;
 						sceneGameObject->m_childrenIndices.push_back(draggedIndex);
 						draggedObj->m_transform.SetParentID(draggedObj->m_parentIndex);
+						scene->MarkHierarchyDirty();
 						if (auto* rect = draggedObj->GetComponent<RectTransformComponent>())
 						{
 							rect->SetParentKeepWorldPosition(sceneGameObject);
@@ -539,6 +540,7 @@ void HierarchyWindow::DrawSceneObject(const std::shared_ptr<GameObject>& obj)
 
 				//Matrix처리
 				draggedObj->m_transform.SetParentID(obj->m_index);
+				scene->MarkHierarchyDirty();
 
 				if (auto* rect = draggedObj->GetComponent<RectTransformComponent>())
 				{
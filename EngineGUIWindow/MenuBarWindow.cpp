@@ -1880,8 +1880,8 @@ void MenuBarWindow::ShowBlackBoardWindow()
 
             // List of existing keys
             std::vector<std::pair<std::string, BlackBoardValue>> sortedKeys;
-            for (const auto& pair : editorBlackBoard.m_values) {
-				sortedKeys.push_back(pair);
+            for (uint32_t slot = 0; slot < editorBlackBoard.m_slots.size(); ++slot) {
+				sortedKeys.emplace_back(editorBlackBoard.m_slotNames[slot], editorBlackBoard.m_slots[slot]);
             }
 			std::sort(sortedKeys.begin(), sortedKeys.end(),
 				[](const auto& a,const auto& b) {
@@ -1967,7 +1967,7 @@ void MenuBarWindow::ShowBlackBoardWindow()
         {
             if (!selectedKey.empty() && editorBlackBoard.HasKey(selectedKey))
             {
-                auto& value = editorBlackBoard.m_values.at(selectedKey);
+                auto& value = editorBlackBoard.m_slots[editorBlackBoard.m_slotIndex.at(selectedKey)];
                 std::string currentKey = selectedKey;
 
                 // --- Key Name Editor ---
@@ -2592,7 +2592,12 @@ void MenuBarWindow::SHowInputActionMap()
                     action->SetControllerButton(ControllerButton::RIGHT_THUMB);
                 ImGui::EndPopup();
             }
-            
+
+            // settings are edited in place; let PlayerInputComponent recompile its bindings
+            if (ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+            {
+                InputActionManagers->m_actionMaps[seletedActionMapIndex]->MarkDirty();
+            }
         }
 
         ImGui::EndChild();
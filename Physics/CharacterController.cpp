@@ -45,6 +45,12 @@ void CharacterController::Initialize(const CharacterControllerInfo& info, const
 }
 
 void CharacterController::Update(float deltaTime)
+{
+	ComputeMove(deltaTime);
+	ApplyMove(deltaTime);
+}
+
+void CharacterController::ComputeMove(float deltaTime)
 {
 	// ̹ ӿ   ̵  
 	physx::PxVec3 currentFrameVelocity(0.f, 0.f, 0.f);
@@ -114,6 +120,14 @@ void CharacterController::Update(float deltaTime)
 		currentFrameVelocity.z = 0.0f;
 	}
 
+	m_pendingMove = currentFrameVelocity;
+}
+
+void CharacterController::ApplyMove(float deltaTime)
+{
+	physx::PxVec3 currentFrameVelocity = m_pendingMove;
+	m_pendingMove = physx::PxVec3(0.f, 0.f, 0.f);
+
 	// 3. Ʈѷ ̵  (  - move() ⼭   !)
 	physx::PxControllerCollisionFlags collisionFlag = m_controller->move(currentFrameVelocity, 0.01f, deltaTime, *m_filters);
 
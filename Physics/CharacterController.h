@@ -43,6 +43,10 @@ public:
 
 	void Initialize(const CharacterControllerInfo& info,const CharacterMovementInfo& moveInfo,physx::PxControllerManager* CCTManager,physx::PxMaterial* material,CollisionData* collisionData, unsigned int* collisionMatrix, std::function<void(CollisionData, ECollisionEventType)> callback);
 	void Update(float deltaTime);
+	// Update  ѷ  . ComputeMove  ڱ ¸ ٲٹǷ  Ʈѷ ķ  ǰ,
+	// ApplyMove  PxControllerManager  ǵ帮Ƿ  忡 ʷ ҷ Ѵ.
+	void ComputeMove(float deltaTime);
+	void ApplyMove(float deltaTime);
 
 	void AddMovementInput(const DirectX::SimpleMath::Vector3& input, bool isDynamic);
 
@@ -51,6 +55,12 @@ public:
 	void SetMoveRestrct(std::array<bool, 4> moveRestrict) {
 		m_bMoveRestrict = moveRestrict;
 	}
+	// ERestrictDirection Ʈ ũ  (ControllerUploadBatch)
+	void SetMoveRestrctMask(uint8_t mask) {
+		for (int i = 0; i < static_cast<int>(ERestrictDirection::END); ++i) {
+			m_bMoveRestrict[i] = 0 != (mask & (1u << i));
+		}
+	}
 
 	inline physx::PxController* GetController() { return m_controller; }
 	inline void SetController(physx::PxController* controller) { m_controller = controller; }
@@ -87,6 +97,7 @@ protected:
 	DirectX::SimpleMath::Vector3 m_inputMove; 
 	bool m_IsDynamic;
 	std::array<bool, 4> m_bMoveRestrict;
+	physx::PxVec3 m_pendingMove{ 0.f, 0.f, 0.f }; //ComputeMove   ̹  ̵
 
 	CharacterMovement* m_characterMovement; //ĳ ̵ 
 	
@@ -0,0 +1,64 @@
+#pragma once
+#include "PhysicsCommon.h"
+#include <cstdint>
+#include <vector>
+
+constexpr uint32_t CollisionEventTypeCount = 6;	// ECollisionEventType 개수
+
+// 한 물리 스텝 동안 쌓인 충돌/트리거 이벤트 (SoA)
+// - PhysX 콜백은 fetchResults 를 부른 스레드에서, CCT 히트 리포트는 move 중에 쓰고
+//   PhysicsManager::ProcessCallback 이 같은 스레드에서 읽은 뒤 Clear 한다 (쓰기/읽기 단계가 나뉘어 잠금이 없다)
+// - 이벤트는 방향이 있다 (this 쪽 콜백용). 한 쌍의 두 방향은 같은 접점 구간을 공유한다
+// - Clear 는 용량을 남기므로 스텝마다 할당하지 않는다
+struct ContactEventBuffer
+{
+	std::vector<unsigned int>					thisIds;
+	std::vector<unsigned int>					otherIds;
+	std::vector<unsigned int>					thisLayers;
+	std::vector<unsigned int>					otherLayers;
+	std::vector<ECollisionEventType>			types;
+	std::vector<uint32_t>						pointOffsets;	// points[offset, offset + count)
+	std::vector<uint32_t>						pointCounts;
+	std::vector<DirectX::SimpleMath::Vector3>	normals;		// this 쪽에서 본 접점 법선 평균 (트리거는 0)
+	std::vector<float>							impulses;		// 접점 충격량 크기 합 (트리거는 0)
+
+	std::vector<DirectX::SimpleMath::Vector3>	points;			// 접점 아레나
+
+	uint32_t AppendPoints(const DirectX::SimpleMath::Vector3* src, uint32_t count)
+	{
+		const uint32_t offset = static_cast<uint32_t>(points.size());
+		points.insert(points.end(), src, src + count);
+		return offset;
+	}
+
+	void Push(unsigned int thisId, unsigned int otherId, unsigned int thisLayer, unsigned int otherLayer, ECollisionEventType type,
+		uint32_t pointOffset = 0, uint32_t pointCount = 0, const DirectX::SimpleMath::Vector3& normal = {}, float impulse = 0.f)
+	{
+		thisIds.push_back(thisId);
+		otherIds.push_back(otherId);
+		thisLayers.push_back(thisLayer);
+		otherLayers.push_back(otherLayer);
+		types.push_back(type);
+		pointOffsets.push_back(pointOffset);
+		pointCounts.push_back(pointCount);
+		normals.push_back(normal);
+		impulses.push_back(impulse);
+	}
+
+	void Clear()
+	{
+		thisIds.clear();
+		otherIds.clear();
+		thisLayers.clear();
+		otherLayers.clear();
+		types.clear();
+		pointOffsets.clear();
+		pointCounts.clear();
+		normals.clear();
+		impulses.clear();
+		points.clear();
+	}
+
+	size_t Size() const { return thisIds.size(); }
+	bool Empty() const { return thisIds.empty(); }
+};
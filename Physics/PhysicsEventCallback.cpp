@@ -81,6 +81,13 @@ void PhysicsEventCallback::StartTrigger()
 				continue;
 			}
 
+			if (m_eventBuffer)
+			{
+				m_eventBuffer->Push(TriggerActorData->thisId, OtherActorData->thisId, TriggerActorData->thisLayerNumber, OtherActorData->thisLayerNumber, ECollisionEventType::ON_OVERLAP);
+				m_eventBuffer->Push(OtherActorData->thisId, TriggerActorData->thisId, OtherActorData->thisLayerNumber, TriggerActorData->thisLayerNumber, ECollisionEventType::ON_OVERLAP);
+				++otherTrigger;
+				continue;
+			}
 
 			CollisionData ThisData;
 			CollisionData OtherData;
@@ -106,65 +113,81 @@ void PhysicsEventCallback::StartTrigger()
 
 void PhysicsEventCallback::SettingCollisionData(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, const ECollisionEventType& eventType)
 {
-	// ϴ 浹  浹    
-	std::vector<physx::PxContactPairPoint> contactPoints;
-
 	// 浹 
 	const physx::PxContactPair& contactPair = pairs[0];
-	//̺귯  浹  浹  
-	std::vector<DirectX::SimpleMath::Vector3> points;
 
+	CollisionData* firstData = (CollisionData*)pairHeader.actors[0]->userData;
+	CollisionData* secondData = (CollisionData*)pairHeader.actors[1]->userData;
 
-	//浹  浹    ŭ ͸ Ҵ
-	physx::PxU32 contactCount = contactPair.contactCount;
-	contactPoints.resize(contactCount);
-	points.resize(contactCount);
-	
-	//浹  浹   Ϳ 
-	//PxContactPairPoint
-	if (contactCount > 0 )
+	//浹  ȿ Ȯ
+	if (firstData == nullptr || secondData == nullptr)
 	{
-		contactPair.extractContacts(&contactPoints[0], contactCount);
+		return;
 	}
-	//PxContactPairPoint->Vector3
-	for (physx::PxU32 i = 0; i < contactCount; i++)
+
+	//浹  浹    ۿ 
+	physx::PxU32 contactCount = contactPair.contactCount;
+	m_contactScratch.resize(contactCount);
+	if (contactCount > 0)
 	{
-		points[i].x = contactPoints[i].position.x;
-		points[i].y = contactPoints[i].position.y;
-		points[i].z = contactPoints[i].position.z;
+		contactCount = contactPair.extractContacts(m_contactScratch.data(), contactCount);
 	}
 
-	// 浹 
-	CollisionData firstActor;
-	CollisionData secondActor;
-	CollisionData* firstData = (CollisionData*)pairHeader.actors[0]->userData;
-	CollisionData* secondData = (CollisionData*)pairHeader.actors[1]->userData;
-	
-	//浹  ȿ Ȯ
-	if (firstData == nullptr || secondData == nullptr)
+	if (m_eventBuffer)
 	{
-		return;
+		//̺Ʈ ۿ ٷ  ( Ʒ  ,     )
+		const uint32_t pointOffset = static_cast<uint32_t>(m_eventBuffer->points.size());
+		DirectX::SimpleMath::Vector3 normal;
+		float impulse = 0.f;
+		for (physx::PxU32 i = 0; i < contactCount; i++)
+		{
+			const physx::PxContactPairPoint& contact = m_contactScratch[i];
+			m_eventBuffer->points.emplace_back(contact.position.x, contact.position.y, contact.position.z);
+			normal += DirectX::SimpleMath::Vector3(contact.normal.x, contact.normal.y, contact.normal.z);
+			impulse += contact.impulse.magnitude();
+		}
+		if (contactCount > 0)
+		{
+			normal.Normalize();
+		}
+
+		//PhysX   °  ù °   Ѵ
+		m_eventBuffer->Push(firstData->thisId, secondData->thisId, firstData->thisLayerNumber, secondData->thisLayerNumber, eventType, pointOffset, contactCount, normal, impulse);
+		m_eventBuffer->Push(secondData->thisId, firstData->thisId, secondData->thisLayerNumber, firstData->thisLayerNumber, eventType, pointOffset, contactCount, -normal, impulse);
 	}
+	else
+	{
+		//̺귯  浹  浹  
+		std::vector<DirectX::SimpleMath::Vector3> points(contactCount);
+		for (physx::PxU32 i = 0; i < contactCount; i++)
+		{
+			points[i].x = m_contactScratch[i].position.x;
+			points[i].y = m_contactScratch[i].position.y;
+			points[i].z = m_contactScratch[i].position.z;
+		}
 
-	//浹  浹   
-	
-	//firstActor
-	firstActor.thisId = firstData->thisId;
-	firstActor.otherId = secondData->thisId;
-	firstActor.thisLayerNumber = firstData->thisLayerNumber;
-	firstActor.otherLayerNumber = secondData->thisLayerNumber;
-	firstActor.contactPoints = points;
-
-	//secondActor
-	secondActor.thisId = secondData->thisId;
-	secondActor.otherId = firstData->thisId;
-	secondActor.thisLayerNumber = secondData->thisLayerNumber;
-	secondActor.otherLayerNumber = firstData->thisLayerNumber;
-	secondActor.contactPoints = points;
-
-	//ݹ Լ ȣ
-	m_callbackFunction(firstActor, eventType);
-	m_callbackFunction(secondActor, eventType);
+		// 浹 
+		CollisionData firstActor;
+		CollisionData secondActor;
+
+		//firstActor
+		firstActor.thisId = firstData->thisId;
+		firstActor.otherId = secondData->thisId;
+		firstActor.thisLayerNumber = firstData->thisLayerNumber;
+		firstActor.otherLayerNumber = secondData->thisLayerNumber;
+		firstActor.contactPoints = points;
+
+		//secondActor
+		secondActor.thisId = secondData->thisId;
+		secondActor.otherId = firstData->thisId;
+		secondActor.thisLayerNumber = secondData->thisLayerNumber;
+		secondActor.otherLayerNumber = firstData->thisLayerNumber;
+		secondActor.contactPoints = std::move(points);
+
+		//ݹ Լ ȣ
+		m_callbackFunction(firstActor, eventType);
+		m_callbackFunction(secondActor, eventType);
+	}
 
 	//ü  ϴ  data isDead ÷׸ Ȯ
 	if (eventType == ECollisionEventType::END_COLLISION && firstData->isDead) {
@@ -177,8 +200,6 @@ void PhysicsEventCallback::SettingCollisionData(const physx::PxContactPairHeader
 
 void PhysicsEventCallback::SettingTriggerData(const physx::PxTriggerPair* pairs, const ECollisionEventType& eventType)
 {
-	CollisionData firstActor;
-	CollisionData secondActor;
 	CollisionData* firstData = (CollisionData*)pairs->triggerActor->userData;
 	CollisionData* secondData = (CollisionData*)pairs->otherActor->userData;
 
@@ -188,21 +209,32 @@ void PhysicsEventCallback::SettingTriggerData(const physx::PxTriggerPair* pairs,
 		return;
 	}
 
-	//浹  浹   
-	//firstActor
-	firstActor.thisId = firstData->thisId;
-	firstActor.otherId = secondData->thisId;
-	firstActor.thisLayerNumber = firstData->thisLayerNumber;
-	firstActor.otherLayerNumber = secondData->thisLayerNumber;
-	//secondActor
-	secondActor.thisId = secondData->thisId;
-	secondActor.otherId = firstData->thisId;
-	secondActor.thisLayerNumber = secondData->thisLayerNumber;
-	secondActor.otherLayerNumber = firstData->thisLayerNumber;
-
-	//ݹ Լ ȣ
-	m_callbackFunction(firstActor, eventType);
-	m_callbackFunction(secondActor, eventType);
+	if (m_eventBuffer)
+	{
+		m_eventBuffer->Push(firstData->thisId, secondData->thisId, firstData->thisLayerNumber, secondData->thisLayerNumber, eventType);
+		m_eventBuffer->Push(secondData->thisId, firstData->thisId, secondData->thisLayerNumber, firstData->thisLayerNumber, eventType);
+	}
+	else
+	{
+		CollisionData firstActor;
+		CollisionData secondActor;
+
+		//浹  浹   
+		//firstActor
+		firstActor.thisId = firstData->thisId;
+		firstActor.otherId = secondData->thisId;
+		firstActor.thisLayerNumber = firstData->thisLayerNumber;
+		firstActor.otherLayerNumber = secondData->thisLayerNumber;
+		//secondActor
+		secondActor.thisId = secondData->thisId;
+		secondActor.otherId = firstData->thisId;
+		secondActor.thisLayerNumber = secondData->thisLayerNumber;
+		secondActor.otherLayerNumber = firstData->thisLayerNumber;
+
+		//ݹ Լ ȣ
+		m_callbackFunction(firstActor, eventType);
+		m_callbackFunction(secondActor, eventType);
+	}
 
 	//Ʈ  
 	CountTrigger(firstData->thisId, secondData->thisId, eventType);
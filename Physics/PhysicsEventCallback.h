@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <functional>
 #include "PhysicsCommon.h"
+#include "ContactEventBuffer.h"
 
 using namespace physx;
 
@@ -39,8 +40,17 @@ public:
 		m_callbackFunction = callbackFunction;
 	}
 
+	// Ǹ ̺Ʈ ݹ  ۿ ٷ Ѵ (CollisionData,   Ҵ )
+	inline void SetEventBuffer(ContactEventBuffer* eventBuffer)
+	{
+		m_eventBuffer = eventBuffer;
+	}
+	inline ContactEventBuffer* GetEventBuffer() const { return m_eventBuffer; }
+
 private:
 	std::function<void(const CollisionData&, ECollisionEventType)> m_callbackFunction;
+	ContactEventBuffer* m_eventBuffer{};
+	std::vector<physx::PxContactPairPoint> m_contactScratch;
 
 	std::unordered_map<unsigned int, std::set<unsigned int>> m_triggerMap; //Ʈ 
 };
@@ -0,0 +1,136 @@
+#pragma once
+#include "PhysicsCommon.h"
+#include <vector>
+
+// 게임 씬 -> PxScene 일괄 업로드 버퍼
+// 변경된 바디만 항목별 SoA 스트림에 담아 PhysicX::ApplyRigidBodyBatch 로 한 번에 적용한다.
+struct RigidBodyUploadBatch
+{
+	// 상태/속성이 바뀐 바디는 기존과 같이 전체 데이터를 적용한다 (드물게 발생)
+	std::vector<unsigned int>					stateIds;
+	std::vector<RigidBodyGetSetData>			states;
+
+	// 포즈 (+ 스케일)
+	std::vector<unsigned int>					poseIds;
+	std::vector<DirectX::SimpleMath::Vector3>		posePositions;
+	std::vector<DirectX::SimpleMath::Quaternion>	poseRotations;
+	std::vector<DirectX::SimpleMath::Vector3>		poseScales;
+
+	// 속도
+	std::vector<unsigned int>					velocityIds;
+	std::vector<DirectX::SimpleMath::Vector3>		linearVelocities;
+	std::vector<DirectX::SimpleMath::Vector3>		angularVelocities;
+
+	// 힘
+	std::vector<unsigned int>					forceIds;
+	std::vector<DirectX::SimpleMath::Vector3>		forces;
+	std::vector<int>							forceModes;
+
+	// 활성화 상태 전환
+	std::vector<unsigned int>					sleepIds;
+	std::vector<unsigned int>					wakeIds;
+
+	void Clear()
+	{
+		stateIds.clear();
+		states.clear();
+		poseIds.clear();
+		posePositions.clear();
+		poseRotations.clear();
+		poseScales.clear();
+		velocityIds.clear();
+		linearVelocities.clear();
+		angularVelocities.clear();
+		forceIds.clear();
+		forces.clear();
+		forceModes.clear();
+		sleepIds.clear();
+		wakeIds.clear();
+	}
+
+	bool Empty() const
+	{
+		return stateIds.empty() && poseIds.empty() && velocityIds.empty() &&
+			forceIds.empty() && sleepIds.empty() && wakeIds.empty();
+	}
+};
+
+// PxScene -> 게임 씬 읽기 버퍼
+// 이번 스텝에 시뮬레이션된(active) 다이나믹 바디만 담긴다.
+struct RigidBodyReadbackBatch
+{
+	std::vector<unsigned int>					ids;
+	std::vector<DirectX::SimpleMath::Vector3>		positions;
+	std::vector<DirectX::SimpleMath::Quaternion>	rotations;
+	std::vector<DirectX::SimpleMath::Vector3>		scales;
+	std::vector<DirectX::SimpleMath::Vector3>		linearVelocities;
+	std::vector<DirectX::SimpleMath::Vector3>		angularVelocities;
+	// 작은 속도를 0 으로 잘라냈으면 1 (다음 스텝에 다시 업로드해야 함)
+	std::vector<uint8_t>						velocityClamped;
+
+	void Clear()
+	{
+		ids.clear();
+		positions.clear();
+		rotations.clear();
+		scales.clear();
+		linearVelocities.clear();
+		angularVelocities.clear();
+		velocityClamped.clear();
+	}
+
+	size_t Size() const { return ids.size(); }
+};
+
+// 게임 씬 -> CCT 일괄 업로드 버퍼
+// 고정 스텝마다 모든 CCT 의 입력과 이동 상태를 항목별 SoA 스트림에 모아 PhysicX::ApplyControllerBatch 로 한 번에 넘긴다.
+struct ControllerUploadBatch
+{
+	std::vector<unsigned int>					ids;
+	std::vector<DirectX::SimpleMath::Vector3>		positions;
+	std::vector<unsigned int>					layers;			// UINT_MAX 면 바뀌지 않음
+	std::vector<DirectX::SimpleMath::Vector3>		inputs;			// 정규화된 이동 입력
+	std::vector<uint8_t>						isDynamic;
+	std::vector<DirectX::SimpleMath::Vector3>		velocities;
+	std::vector<float>							maxSpeeds;
+	std::vector<float>							accelerations;
+	std::vector<uint8_t>						isFall;
+	std::vector<uint8_t>						restricts;		// ERestrictDirection 비트 마스크
+	float										deltaTime{};	// 이번 고정 스텝 길이 (CharacterMovement::Update 에 넘긴다)
+
+	void Clear()
+	{
+		ids.clear();
+		positions.clear();
+		layers.clear();
+		inputs.clear();
+		isDynamic.clear();
+		velocities.clear();
+		maxSpeeds.clear();
+		accelerations.clear();
+		isFall.clear();
+		restricts.clear();
+	}
+
+	size_t Size() const { return ids.size(); }
+	bool Empty() const { return ids.empty(); }
+};
+
+// CCT -> 게임 씬 읽기 버퍼 (생성이 끝난 컨트롤러만 담긴다)
+struct ControllerReadbackBatch
+{
+	std::vector<unsigned int>					ids;
+	std::vector<DirectX::SimpleMath::Vector3>		positions;
+	std::vector<DirectX::SimpleMath::Vector3>		velocities;
+	std::vector<uint8_t>						isFall;
+
+	void Clear()
+	{
+		ids.clear();
+		positions.clear();
+		velocities.clear();
+		isFall.clear();
+	}
+
+	size_t Size() const { return ids.size(); }
+};
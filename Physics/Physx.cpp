@@ -5,11 +5,13 @@
 #include "ConvexMeshResource.h"
 #include "TriangleMeshResource.h"
 #include "HeightFieldResource.h"
+#include "Core.JobSystem.h"
 #include <thread>
 #include <atomic>
 #include <condition_variable>
 #include <vector>
 #include <tuple>
+#include <algorithm>
 #include <mutex>
 #include <iostream>
 
@@ -321,6 +323,14 @@ void PhysicX::UnInitialize() {
 
 
 void PhysicX::Update(float fixedDeltaTime)
+{
+	if (Simulate(fixedDeltaTime))
+	{
+		FetchResults();
+	}
+}
+
+bool PhysicX::Simulate(float fixedDeltaTime)
 {
 	// PxScene 업데이트
 	RemoveActors();
@@ -345,14 +355,7 @@ void PhysicX::Update(float fixedDeltaTime)
 	{
 		//캐릭터 업데이트
 		//캐릭터 컨트롤러 업데이트
-		for (const auto& controller : m_characterControllerContainer) {
-			controller.second->Update(fixedDeltaTime);
-			//컨트롤러의 물리 상태가 변하면
-			//if(todo : condition){
-			//controller.second->GetController()->release();
-			// }
-
-		}
+		UpdateControllers(fixedDeltaTime);
 		//새로 생성된 캐릭터 컨트롤러를 업데이트 리스트에 추가
 		for (auto& [contrllerInfo, movementInfo] : m_updateCCTList)
 		{
@@ -404,6 +407,7 @@ void PhysicX::Update(float fixedDeltaTime)
 
 			CreateCollisionData(contrllerInfo.id, collisionData);
 			m_characterControllerContainer.insert({ controller->GetID(), controller });
+			m_controllerList.push_back(controller);
 		}
 		m_updateCCTList.clear();
 
@@ -442,8 +446,13 @@ void PhysicX::Update(float fixedDeltaTime)
 	if (!m_scene->simulate(fixedDeltaTime))
 	{
 		Debug->LogCritical("physic m_scene simulate failed");
-		return;
+		return false;
 	}
+	return true;
+}
+
+void PhysicX::FetchResults()
+{
 	//시뮬레이션 결과 가져오기
 	if (!m_scene->fetchResults(true))
 	{
@@ -470,6 +479,16 @@ void PhysicX::SetCallBackCollisionFunction(std::function<void(const CollisionDat
 	m_collisionCallback = func;
 }
 
+void PhysicX::SetContactEventBuffer(ContactEventBuffer* eventBuffer)
+{
+	m_eventCallback->SetEventBuffer(eventBuffer);
+}
+
+ContactEventBuffer* PhysicX::GetContactEventBuffer() const
+{
+	return m_eventCallback->GetEventBuffer();
+}
+
 void PhysicX::SetPhysicsInfo()
 {
 		
@@ -1278,6 +1297,177 @@ void PhysicX::SetRigidBodyData(const unsigned int& id, RigidBodyGetSetData& rigi
 	}
 }
 
+void PhysicX::ApplyRigidBodyBatch(const RigidBodyUploadBatch& batch)
+{
+	//활성화 상태 전환 (비활성 -> 활성 전환에서만 깨운다)
+	for (unsigned int id : batch.sleepIds)
+	{
+		PutToSleep(id);
+	}
+	for (unsigned int id : batch.wakeIds)
+	{
+		WakeUp(id);
+	}
+
+	//속성/플래그가 바뀐 바디는 기존 경로로 전체 적용
+	for (size_t i = 0; i < batch.stateIds.size(); ++i)
+	{
+		RigidBodyGetSetData data = batch.states[i];
+		SetRigidBodyData(batch.stateIds[i], data);
+	}
+
+	//포즈
+	for (size_t i = 0; i < batch.poseIds.size(); ++i)
+	{
+		auto it = m_rigidBodyContainer.find(batch.poseIds[i]);
+		if (it == m_rigidBodyContainer.end() || !it->second)
+		{
+			continue;
+		}
+
+		physx::PxTransform pxTransform;
+		ConvertVectorDxToPx(batch.posePositions[i], pxTransform.p);
+		ConvertQuaternionDxToPx(batch.poseRotations[i], pxTransform.q);
+
+		physx::PxRigidActor* pxActor = nullptr;
+		if (auto dynamicBody = dynamic_cast<DynamicRigidBody*>(it->second))
+		{
+			dynamicBody->SetConvertScale(batch.poseScales[i], m_physics, m_collisionMatrix);
+			pxActor = dynamicBody->GetRigidDynamic();
+		}
+		else if (auto staticBody = dynamic_cast<StaticRigidBody*>(it->second))
+		{
+			staticBody->SetConvertScale(batch.poseScales[i], m_physics, m_collisionMatrix);
+			pxActor = staticBody->GetRigidStatic();
+		}
+
+		if (pxActor && IsTransformDifferent(pxActor->getGlobalPose(), pxTransform))
+		{
+			pxActor->setGlobalPose(pxTransform);
+		}
+	}
+
+	//속도
+	for (size_t i = 0; i < batch.velocityIds.size(); ++i)
+	{
+		auto it = m_rigidBodyContainer.find(batch.velocityIds[i]);
+		if (it == m_rigidBodyContainer.end())
+		{
+			continue;
+		}
+
+		DynamicRigidBody* dynamicBody = dynamic_cast<DynamicRigidBody*>(it->second);
+		if (!dynamicBody || !dynamicBody->GetRigidDynamic())
+		{
+			continue;
+		}
+
+		physx::PxRigidDynamic* pxBody = dynamicBody->GetRigidDynamic();
+		if (pxBody->getRigidBodyFlags() & physx::PxRigidBodyFlag::eKINEMATIC)
+		{
+			continue;
+		}
+
+		physx::PxVec3 pxLinearVelocity;
+		physx::PxVec3 pxAngularVelocity;
+		ConvertVectorDxToPx(batch.linearVelocities[i], pxLinearVelocity);
+		ConvertVectorDxToPx(batch.angularVelocities[i], pxAngularVelocity);
+		pxBody->setLinearVelocity(pxLinearVelocity);
+		pxBody->setAngularVelocity(pxAngularVelocity);
+	}
+
+	//힘
+	for (size_t i = 0; i < batch.forceIds.size(); ++i)
+	{
+		auto it = m_rigidBodyContainer.find(batch.forceIds[i]);
+		if (it == m_rigidBodyContainer.end())
+		{
+			continue;
+		}
+
+		DynamicRigidBody* dynamicBody = dynamic_cast<DynamicRigidBody*>(it->second);
+		if (!dynamicBody || !dynamicBody->GetRigidDynamic())
+		{
+			continue;
+		}
+
+		PxVec3 force;
+		ConvertVectorDxToPx(batch.forces[i], force);
+		dynamicBody->GetRigidDynamic()->addForce(force, static_cast<physx::PxForceMode::Enum>(batch.forceModes[i]));
+	}
+}
+
+void PhysicX::ReadActiveRigidBodies(RigidBodyReadbackBatch& outBatch)
+{
+	outBatch.Clear();
+
+	physx::PxU32 activeCount = 0;
+	physx::PxActor** activeActors = m_scene->getActiveActors(activeCount);
+	if (!activeActors || activeCount == 0)
+	{
+		return;
+	}
+
+	for (physx::PxU32 i = 0; i < activeCount; ++i)
+	{
+		physx::PxRigidDynamic* pxBody = activeActors[i]->is<physx::PxRigidDynamic>();
+		if (!pxBody || !pxBody->userData)
+		{
+			continue;
+		}
+
+		if (pxBody->getRigidBodyFlags() & physx::PxRigidBodyFlag::eKINEMATIC)
+		{
+			continue;
+		}
+
+		//CCT 액터, 래그돌 링크는 userData 가 같아도 컨테이너의 액터와 다르므로 제외된다
+		const unsigned int id = static_cast<CollisionData*>(pxBody->userData)->thisId;
+		auto it = m_rigidBodyContainer.find(id);
+		if (it == m_rigidBodyContainer.end())
+		{
+			continue;
+		}
+
+		DynamicRigidBody* dynamicBody = dynamic_cast<DynamicRigidBody*>(it->second);
+		if (!dynamicBody || dynamicBody->GetRigidDynamic() != pxBody)
+		{
+			continue;
+		}
+
+		const physx::PxTransform pxTransform = pxBody->getGlobalPose();
+		DirectX::SimpleMath::Vector3 position;
+		DirectX::SimpleMath::Quaternion rotation;
+		DirectX::SimpleMath::Vector3 linearVelocity;
+		DirectX::SimpleMath::Vector3 angularVelocity;
+		ConvertVectorPxToDx(pxTransform.p, position);
+		ConvertQuaternionPxToDx(pxTransform.q, rotation);
+		ConvertVectorPxToDx(pxBody->getLinearVelocity(), linearVelocity);
+		ConvertVectorPxToDx(pxBody->getAngularVelocity(), angularVelocity);
+
+		//GetRigidBodyData 와 동일한 데드존
+		uint8_t clamped = 0;
+		if (linearVelocity.x != 0.0f && std::abs(linearVelocity.x) < 0.01f)
+		{
+			linearVelocity.x = 0.0f;
+			clamped = 1;
+		}
+		if (linearVelocity.z != 0.0f && std::abs(linearVelocity.z) < 0.01f)
+		{
+			linearVelocity.z = 0.0f;
+			clamped = 1;
+		}
+
+		outBatch.ids.push_back(id);
+		outBatch.positions.push_back(position);
+		outBatch.rotations.push_back(rotation);
+		outBatch.scales.push_back(dynamicBody->GetScale());
+		outBatch.linearVelocities.push_back(linearVelocity);
+		outBatch.angularVelocities.push_back(angularVelocity);
+		outBatch.velocityClamped.push_back(clamped);
+	}
+}
+
 void PhysicX::RemoveRigidBody(const unsigned int& id, physx::PxScene* scene, std::vector<physx::PxActor*>& removeActorList)
 {
 	//등록되어 있는지 검색
@@ -1400,6 +1590,12 @@ void PhysicX::RemoveCCT(const unsigned int& id)
 	}
 
 	// 4. 우리 엔진의 CCT 래퍼 객체와 컨테이너 항목을 정리합니다.
+	auto listIt = std::find(m_controllerList.begin(), m_controllerList.end(), controllerWrapper);
+	if (listIt != m_controllerList.end())
+	{
+		*listIt = m_controllerList.back();
+		m_controllerList.pop_back();
+	}
 	delete controllerWrapper; // 래퍼 클래스 메모리 해제
 	m_characterControllerContainer.erase(iter); // 컨테이너에서 제거
 	
@@ -1409,10 +1605,36 @@ void PhysicX::RemoveAllCCT()
 {
 	m_characterControllerManager->purgeControllers();
 	m_characterControllerContainer.clear();
+	m_controllerList.clear();
 	m_updateCCTList.clear();
 	m_waittingCCTList.clear();
 }
 
+void PhysicX::UpdateControllers(float fixedDeltaTime)
+{
+	const uint32_t controllerCount = static_cast<uint32_t>(m_controllerList.size());
+	if (0 == controllerCount)
+	{
+		return;
+	}
+
+	//1. 이동량 계산 (강제 이동 감쇠, 가속/마찰, 이동 제한) : 컨트롤러마다 독립적이므로 병렬로 돌린다
+	JobHandle computeGroup = JobSystems->ParallelFor(controllerCount, 0, [this, fixedDeltaTime](uint32 begin, uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+		{
+			m_controllerList[i]->ComputeMove(fixedDeltaTime);
+		}
+	});
+	JobSystems->Wait(computeGroup);
+
+	//2. PxController::move 는 컨트롤러 매니저와 히트 리포트 콜백을 공유하므로 한 스레드에서 차례로
+	for (CharacterController* controller : m_controllerList)
+	{
+		controller->ApplyMove(fixedDeltaTime);
+	}
+}
+
 void PhysicX::AddInputMove(const CharactorControllerInputInfo& info)
 {
 	if (m_characterControllerContainer.find(info.id) == m_characterControllerContainer.end())
@@ -1638,6 +1860,58 @@ void PhysicX::SetMovementData(const unsigned int& id,const CharacterMovementGetS
 	}
 }
 
+void PhysicX::ApplyControllerBatch(const ControllerUploadBatch& batch)
+{
+	for (size_t i = 0; i < batch.Size(); ++i)
+	{
+		const unsigned int id = batch.ids[i];
+		auto it = m_characterControllerContainer.find(id);
+		if (it == m_characterControllerContainer.end())
+		{
+			//아직 생성 대기 중이면 생성 위치만 갱신
+			CharacterControllerGetSetData data;
+			data.position = batch.positions[i];
+			SetCCTData(id, data);
+			continue;
+		}
+
+		CharacterController* controller = it->second;
+		controller->ChangeLayerNumber(batch.layers[i], m_collisionMatrix);
+		controller->SetPosition(batch.positions[i]);
+		controller->SetMoveRestrctMask(batch.restricts[i]);
+
+		CharacterMovement* movement = controller->GetCharacterMovement();
+		movement->SetIsFall(0 != batch.isFall[i]);
+		movement->SetVelocity(batch.velocities[i]);
+		movement->SetMaxSpeed(batch.maxSpeeds[i]);
+		movement->SetAcceleration(batch.accelerations[i]);
+
+		controller->AddMovementInput(batch.inputs[i], 0 != batch.isDynamic[i]);
+	}
+}
+
+void PhysicX::ReadControllers(ControllerReadbackBatch& outBatch)
+{
+	outBatch.Clear();
+
+	const size_t controllerCount = m_controllerList.size();
+	outBatch.ids.resize(controllerCount);
+	outBatch.positions.resize(controllerCount);
+	outBatch.velocities.resize(controllerCount);
+	outBatch.isFall.resize(controllerCount);
+
+	for (size_t i = 0; i < controllerCount; ++i)
+	{
+		CharacterController* controller = m_controllerList[i];
+		CharacterMovement* movement = controller->GetCharacterMovement();
+
+		outBatch.ids[i] = controller->GetID();
+		controller->GetPosition(outBatch.positions[i]);
+		outBatch.velocities[i] = movement->GetOutVector();
+		outBatch.isFall[i] = movement->GetIsFall() ? 1 : 0;
+	}
+}
+
 //===================================================
 //캐릭터 물리 제어 -> 래그돌
 
@@ -2511,6 +2785,223 @@ OverlapOutput PhysicX::CapsuleOverlap(const OverlapInput& in, float radius, floa
 	return out;
 }
 
+namespace
+{
+	// 배치 쿼리 공통 필터 데이터 (레이어 비교는 단일 쿼리와 같은 Block/TouchRaycastQueryFilter 가 한다)
+	physx::PxQueryFilterData MakeBatchFilterData(unsigned int layerMask, bool touchOnly)
+	{
+		physx::PxQueryFilterData filterData;
+		filterData.flags = physx::PxQueryFlag::eSTATIC
+			| physx::PxQueryFlag::eDYNAMIC
+			| physx::PxQueryFlag::ePREFILTER
+			| physx::PxQueryFlag::eDISABLE_HARDCODED_FILTER;
+		if (touchOnly)
+		{
+			filterData.flags |= physx::PxQueryFlag::eNO_BLOCK;
+		}
+		filterData.data.word0 = layerMask;
+		return filterData;
+	}
+
+	physx::PxGeometryHolder MakeBatchGeometry(const SceneQuery& query)
+	{
+		switch (query.type)
+		{
+		case SceneQueryType::BoxSweep:
+		case SceneQueryType::BoxOverlap:
+			return physx::PxBoxGeometry(query.shape.x, query.shape.y, query.shape.z);
+		case SceneQueryType::SphereSweep:
+		case SceneQueryType::SphereOverlap:
+			return physx::PxSphereGeometry(query.shape.x);
+		default:
+			return physx::PxCapsuleGeometry(query.shape.x, query.shape.y);
+		}
+	}
+
+	bool FillBatchHit(const physx::PxActor* actor, SceneQueryHit& outHit)
+	{
+		if (!actor || !actor->userData) return false;
+
+		CollisionData* userData = static_cast<CollisionData*>(actor->userData);
+		outHit.id = userData->thisId;
+		outHit.layer = userData->thisLayerNumber;
+		return true;
+	}
+}
+
+/**
+ * @brief 모아 둔 씬 쿼리를 잡 시스템으로 나눠 실행합니다.
+ * 쿼리마다 batch.hits 의 자기 구간에만 쓰므로 잠금 없이 병렬로 돌 수 있고,
+ * 결과 변환 규칙은 단일 쿼리 함수(Raycast, RaycastAll, *Sweep, *Overlap)와 같습니다.
+ * 단, 스윕도 레이어 마스크 필터를 적용합니다.
+ * @param batch 실행할 쿼리 배치 (spans, hits 가 채워집니다)
+ */
+void PhysicX::ExecuteSceneQueries(SceneQueryBatch& batch)
+{
+	batch.PrepareResults();
+	if (batch.Empty() || !m_scene)
+	{
+		return;
+	}
+
+	auto executeRange = [this, &batch](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			ExecuteSceneQuery(batch.queries[i], batch.spans[i], batch.hits.data() + batch.spans[i].offset);
+		}
+	};
+
+	// 쿼리 몇 개는 잡으로 나누는 비용이 더 크다
+	constexpr uint32_t parallelThreshold = 8;
+	const uint32_t queryCount = static_cast<uint32_t>(batch.Size());
+	if (queryCount < parallelThreshold)
+	{
+		executeRange(0, queryCount);
+		return;
+	}
+
+	JobHandle handle = JobSystems->ParallelFor(queryCount, 0, executeRange);
+	JobSystems->Wait(handle);
+}
+
+void PhysicX::ExecuteSceneQuery(const SceneQuery& query, SceneQuerySpan& span, SceneQueryHit* outHits)
+{
+	span.count = 0;
+	if (0 == query.layerMask || 0 == query.maxHits)
+	{
+		return;
+	}
+
+	const physx::PxU32 maxHits = (std::min)(query.maxHits, SceneQueryBatch::MaxHitsLimit);
+	BlockRaycastQueryFilter blockFilter;
+	TouchRaycastQueryFilter touchFilter;
+
+	switch (query.type)
+	{
+	case SceneQueryType::RaycastClosest:
+	{
+		physx::PxVec3 pxOrigin;
+		physx::PxVec3 pxDirection;
+		ConvertVectorDxToPx(query.origin, pxOrigin);
+		ConvertVectorDxToPx(query.direction, pxDirection);
+		pxDirection.normalize();
+
+		physx::PxRaycastBuffer hitBufferStruct;
+		const physx::PxQueryFilterData filterData = MakeBatchFilterData(query.layerMask, false);
+		if (!m_scene->raycast(pxOrigin, pxDirection, query.distance, hitBufferStruct, physx::PxHitFlag::eDEFAULT, filterData, &blockFilter) || !hitBufferStruct.hasBlock)
+		{
+			return;
+		}
+
+		const physx::PxRaycastHit& hit = hitBufferStruct.block;
+		if (!hit.shape || !hit.shape->userData) return;
+
+		SceneQueryHit& out = outHits[0];
+		CollisionData* userData = static_cast<CollisionData*>(hit.shape->userData);
+		out.id = userData->thisId;
+		out.layer = userData->thisLayerNumber;
+		out.distance = hit.distance;
+		ConvertVectorPxToDx(hit.position, out.point);
+		ConvertVectorPxToDx(hit.normal, out.normal);
+		span.count = 1;
+		return;
+	}
+	case SceneQueryType::RaycastAll:
+	{
+		physx::PxVec3 pxOrigin;
+		physx::PxVec3 pxDirection;
+		ConvertVectorDxToPx(query.origin, pxOrigin);
+		ConvertVectorDxToPx(query.direction, pxDirection);
+		pxDirection.normalize();
+
+		physx::PxRaycastHit hitBuffer[SceneQueryBatch::MaxHitsLimit];
+		physx::PxRaycastBuffer hitBufferStruct(hitBuffer, maxHits);
+		const physx::PxQueryFilterData filterData = MakeBatchFilterData(query.layerMask, true);
+		if (!m_scene->raycast(pxOrigin, pxDirection, query.distance, hitBufferStruct, physx::PxHitFlag::eDEFAULT, filterData, &touchFilter))
+		{
+			return;
+		}
+
+		for (physx::PxU32 i = 0; i < hitBufferStruct.nbTouches; ++i)
+		{
+			const physx::PxRaycastHit& hit = hitBufferStruct.touches[i];
+			if (!hit.shape || !hit.shape->userData) continue;
+
+			SceneQueryHit& out = outHits[span.count++];
+			CollisionData* userData = static_cast<CollisionData*>(hit.shape->userData);
+			out.id = userData->thisId;
+			out.layer = userData->thisLayerNumber;
+			out.distance = hit.distance;
+			ConvertVectorPxToDx(hit.position, out.point);
+			ConvertVectorPxToDx(hit.normal, out.normal);
+		}
+		return;
+	}
+	case SceneQueryType::BoxSweep:
+	case SceneQueryType::SphereSweep:
+	case SceneQueryType::CapsuleSweep:
+	{
+		physx::PxTransform startPose;
+		ConvertVectorDxToPx(query.origin, startPose.p);
+		ConvertQuaternionDxToPx(query.rotation, startPose.q);
+
+		physx::PxVec3 unitDir;
+		ConvertVectorDxToPx(query.direction, unitDir);
+		unitDir.normalize();
+
+		const physx::PxGeometryHolder geometry = MakeBatchGeometry(query);
+		physx::PxSweepHit hitBuffer[SceneQueryBatch::MaxHitsLimit];
+		physx::PxSweepBuffer sweepResult(hitBuffer, maxHits);
+		const physx::PxQueryFilterData filterData = MakeBatchFilterData(query.layerMask, true);
+		if (!m_scene->sweep(geometry.any(), startPose, unitDir, query.distance, sweepResult, physx::PxHitFlag::eDEFAULT | physx::PxHitFlag::eMESH_MULTIPLE, filterData, &touchFilter))
+		{
+			return;
+		}
+
+		for (physx::PxU32 i = 0; i < sweepResult.nbTouches; ++i)
+		{
+			const physx::PxSweepHit& hit = sweepResult.touches[i];
+			SceneQueryHit& out = outHits[span.count];
+			if (!FillBatchHit(hit.actor, out)) continue;
+
+			out.distance = hit.distance;
+			ConvertVectorPxToDx(hit.position, out.point);
+			ConvertVectorPxToDx(hit.normal, out.normal);
+			++span.count;
+		}
+		return;
+	}
+	default:
+	{
+		physx::PxTransform pose;
+		ConvertVectorDxToPx(query.origin, pose.p);
+		ConvertQuaternionDxToPx(query.rotation, pose.q);
+
+		const physx::PxGeometryHolder geometry = MakeBatchGeometry(query);
+		physx::PxOverlapHit hitBuffer[SceneQueryBatch::MaxHitsLimit];
+		physx::PxOverlapBuffer overlapResult(hitBuffer, maxHits);
+		const physx::PxQueryFilterData filterData = MakeBatchFilterData(query.layerMask, true);
+		if (!m_scene->overlap(geometry.any(), pose, overlapResult, filterData, &touchFilter))
+		{
+			return;
+		}
+
+		for (physx::PxU32 i = 0; i < overlapResult.nbTouches; ++i)
+		{
+			SceneQueryHit& out = outHits[span.count];
+			if (!FillBatchHit(overlapResult.touches[i].actor, out)) continue;
+
+			out.point = {};
+			out.normal = {};
+			out.distance = -1.f;
+			++span.count;
+		}
+		return;
+	}
+	}
+}
+
 void PhysicX::PutToSleep(unsigned int id)
 {
 	// 1. 전달받은 ID로 PxRigidDynamic 포인터를 찾습니다. (RigidBody 또는 CCT)
@@ -13,6 +13,8 @@
 #include "DynamicRigidBody.h"
 #include "CharacterController.h"
 #include "RagdollPhysics.h"
+#include "PhysicsSyncBuffer.h"
+#include "SceneQuery.h"
 
 class PhysicsEventCallback;
 class QueryBlockFilterCallback;
@@ -34,6 +36,9 @@ public:
 
 	// Ʈ
 	void Update(float fixedDeltaTime);
+	// Update  simulate ۰    .  ̿ PxScene    ȴ
+	bool Simulate(float fixedDeltaTime);
+	void FetchResults();
 
 	void AddActor(physx::PxActor* actor) { m_scene->addActor(*actor); }
 
@@ -46,6 +51,9 @@ public:
 
 	//ݸ ̺Ʈ 
 	void SetCallBackCollisionFunction(std::function<void(const CollisionData&, ECollisionEventType)> func);
+	//ùķ̼ 浹/Ʈ ̺Ʈ ݹ    (nullptr ̸ ݹ)
+	void SetContactEventBuffer(ContactEventBuffer* eventBuffer);
+	ContactEventBuffer* GetContactEventBuffer() const;
 
 	//  
 	void SetPhysicsInfo();
@@ -94,6 +102,10 @@ public:
 	bool IsTrigger(unsigned int id) const;
 	bool IsColliderEnabled(unsigned int id) const;
 	bool IsUseGravity(unsigned int id) const;
+	// ϰ  (PhysicsManager::SetPhysicData)
+	void ApplyRigidBodyBatch(const RigidBodyUploadBatch& batch);
+	//̹ ܿ ùķ̼ǵ ̳ ٵ б (PhysicsManager::GetPhysicData)
+	void ReadActiveRigidBodies(RigidBodyReadbackBatch& outBatch);
 
 	//ο 
 	void RemoveRigidBody(const unsigned int& id,physx::PxScene* scene,std::vector<physx::PxActor*>& removeActorList);
@@ -128,6 +140,10 @@ public:
 	CharacterMovementGetSetData GetMovementData(const unsigned int& id);
 	void SetCCTData(const unsigned int& id ,const CharacterControllerGetSetData& controllerData);
 	void SetMovementData(const unsigned int& id,const CharacterMovementGetSetData& movementData);
+	//Է/̵  ϰ  (PhysicsManager::SetPhysicData)
+	void ApplyControllerBatch(const ControllerUploadBatch& batch);
+	//  CCT  ġ/ӵ/  ϰ б (PhysicsManager::GetPhysicData)
+	void ReadControllers(ControllerReadbackBatch& outBatch);
 	//===================================================
 	//ɸ   -> ׵
 	//߰
@@ -173,6 +189,8 @@ public:
 	void RemoveActors();
 	//  CCT 
 	void RemoveControllers();
+	//CCT ̵ : ̵  , PxController::move  ʷ
+	void UpdateControllers(float fixedDeltaTime);
 
 	void UnInitialize(); // 
 	void ShowNotRelease(); //    ü 
@@ -225,6 +243,10 @@ public:
 	OverlapOutput SphereOverlap(const OverlapInput& in, float radius);
 	OverlapOutput CapsuleOverlap(const OverlapInput& in, float radius, float halfHeight);
 	//===========================================================================================
+	//  ġ :    ϰ  batch.hits  
+	void ExecuteSceneQueries(SceneQueryBatch& batch);
+	void ExecuteSceneQuery(const SceneQuery& query, SceneQuerySpan& span, SceneQueryHit* outHits);
+	//===========================================================================================
 	//Sleep  
 	void PutToSleep(unsigned int id);
 	void WakeUp(unsigned int id);
@@ -273,6 +295,7 @@ private:
 	//character controller 
 	physx::PxControllerManager* m_characterControllerManager{};
 	std::unordered_map<unsigned int, CharacterController*> m_characterControllerContainer{}; //character controller 
+	std::vector<CharacterController*> m_controllerList{}; //ȸ (m_characterControllerContainer   )
 
 	std::vector<std::pair<CharacterControllerInfo, CharacterMovementInfo>> m_waittingCCTList{}; // ĳ Ʈѷ Ʈ
 	std::vector<std::pair<CharacterControllerInfo, CharacterMovementInfo>> m_updateCCTList{}; //Ʈ  ĳ Ʈѷ Ʈ
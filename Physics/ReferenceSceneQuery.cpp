@@ -0,0 +1,302 @@
+#include "ReferenceSceneQuery.h"
+#include <emmintrin.h>
+#include <bit>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// 쿼리 셰이프를 감싸는 구의 반지름 (레이는 0)
+	float QueryBoundingRadius(const SceneQuery& query)
+	{
+		switch (query.type)
+		{
+		case SceneQueryType::BoxSweep:
+		case SceneQueryType::BoxOverlap:
+			return query.shape.Length();
+		case SceneQueryType::SphereSweep:
+		case SceneQueryType::SphereOverlap:
+			return query.shape.x;
+		case SceneQueryType::CapsuleSweep:
+		case SceneQueryType::CapsuleOverlap:
+			return query.shape.x + query.shape.y;
+		default:
+			return 0.f;
+		}
+	}
+
+	bool IsOverlapQuery(SceneQueryType type)
+	{
+		return SceneQueryType::BoxOverlap == type || SceneQueryType::SphereOverlap == type || SceneQueryType::CapsuleOverlap == type;
+	}
+}
+
+uint32_t ReferenceSceneQueryBackend::AddSphere(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, float radius)
+{
+	AddShape(id, layer, center, { radius, radius, radius }, true);
+	return static_cast<uint32_t>(m_ids.size() - 1);
+}
+
+uint32_t ReferenceSceneQueryBackend::AddBox(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& halfExtents)
+{
+	AddShape(id, layer, center, halfExtents, false);
+	return static_cast<uint32_t>(m_ids.size() - 1);
+}
+
+void ReferenceSceneQueryBackend::AddShape(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extents, bool isSphere)
+{
+	m_ids.push_back(id);
+	m_layers.push_back(layer);
+	m_isSphere.push_back(isSphere ? 1 : 0);
+	m_layerBits.push_back(layer < 32 ? 1u << layer : 0u);
+	m_centerX.push_back(center.x);
+	m_centerY.push_back(center.y);
+	m_centerZ.push_back(center.z);
+	m_extentX.push_back(extents.x);
+	m_extentY.push_back(extents.y);
+	m_extentZ.push_back(extents.z);
+	m_minX.push_back(center.x - extents.x);
+	m_minY.push_back(center.y - extents.y);
+	m_minZ.push_back(center.z - extents.z);
+	m_maxX.push_back(center.x + extents.x);
+	m_maxY.push_back(center.y + extents.y);
+	m_maxZ.push_back(center.z + extents.z);
+}
+
+void ReferenceSceneQueryBackend::Clear()
+{
+	m_ids.clear();
+	m_layers.clear();
+	m_isSphere.clear();
+	m_layerBits.clear();
+	m_centerX.clear();
+	m_centerY.clear();
+	m_centerZ.clear();
+	m_extentX.clear();
+	m_extentY.clear();
+	m_extentZ.clear();
+	m_minX.clear();
+	m_minY.clear();
+	m_minZ.clear();
+	m_maxX.clear();
+	m_maxY.clear();
+	m_maxZ.clear();
+	m_candidates.clear();
+}
+
+void ReferenceSceneQueryBackend::Execute(SceneQueryBatch& batch)
+{
+	batch.PrepareResults();
+	for (size_t i = 0; i < batch.Size(); ++i)
+	{
+		SceneQuerySpan& span = batch.spans[i];
+		ExecuteQuery(batch.queries[i], span, batch.hits.data() + span.offset);
+	}
+}
+
+void ReferenceSceneQueryBackend::GatherCandidates(unsigned int layerMask, const DirectX::SimpleMath::Vector3& boundsMin, const DirectX::SimpleMath::Vector3& boundsMax)
+{
+	m_candidates.clear();
+
+	const uint32_t shapeCount = static_cast<uint32_t>(m_ids.size());
+	const uint32_t simdCount = shapeCount & ~3u;
+
+	const __m128i mask = _mm_set1_epi32(static_cast<int>(layerMask));
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 queryMinX = _mm_set1_ps(boundsMin.x);
+	const __m128 queryMinY = _mm_set1_ps(boundsMin.y);
+	const __m128 queryMinZ = _mm_set1_ps(boundsMin.z);
+	const __m128 queryMaxX = _mm_set1_ps(boundsMax.x);
+	const __m128 queryMaxY = _mm_set1_ps(boundsMax.y);
+	const __m128 queryMaxZ = _mm_set1_ps(boundsMax.z);
+
+	for (uint32_t i = 0; i < simdCount; i += 4)
+	{
+		// 레이어 : (layerBits & mask) != 0
+		const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_layerBits.data() + i));
+		const __m128i rejected = _mm_cmpeq_epi32(_mm_and_si128(bits, mask), zero);
+		int accept = ~_mm_movemask_ps(_mm_castsi128_ps(rejected)) & 0xF;
+		if (0 == accept)
+		{
+			continue;
+		}
+
+		// 경계 상자 : shapeMin <= queryMax && queryMin <= shapeMax (세 축 모두)
+		__m128 overlap = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_minX.data() + i), queryMaxX), _mm_cmple_ps(queryMinX, _mm_loadu_ps(m_maxX.data() + i)));
+		overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_minY.data() + i), queryMaxY), _mm_cmple_ps(queryMinY, _mm_loadu_ps(m_maxY.data() + i))));
+		overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(m_minZ.data() + i), queryMaxZ), _mm_cmple_ps(queryMinZ, _mm_loadu_ps(m_maxZ.data() + i))));
+		accept &= _mm_movemask_ps(overlap);
+
+		while (accept)
+		{
+			const int lane = std::countr_zero(static_cast<unsigned int>(accept));
+			m_candidates.push_back(i + lane);
+			accept &= accept - 1;
+		}
+	}
+
+	for (uint32_t i = simdCount; i < shapeCount; ++i)
+	{
+		if (0 == (m_layerBits[i] & layerMask)) continue;
+		if (m_minX[i] > boundsMax.x || boundsMin.x > m_maxX[i]) continue;
+		if (m_minY[i] > boundsMax.y || boundsMin.y > m_maxY[i]) continue;
+		if (m_minZ[i] > boundsMax.z || boundsMin.z > m_maxZ[i]) continue;
+		m_candidates.push_back(i);
+	}
+}
+
+void ReferenceSceneQueryBackend::ExecuteQuery(const SceneQuery& query, SceneQuerySpan& span, SceneQueryHit* outHits)
+{
+	span.count = 0;
+	if (0 == query.layerMask || 0 == query.maxHits)
+	{
+		return;
+	}
+
+	const float radius = QueryBoundingRadius(query);
+	const DirectX::SimpleMath::Vector3 inflate(radius, radius, radius);
+
+	if (IsOverlapQuery(query.type))
+	{
+		GatherCandidates(query.layerMask, query.origin - inflate, query.origin + inflate);
+		for (uint32_t shape : m_candidates)
+		{
+			if (span.count >= query.maxHits) break;
+			if (!Overlaps(shape, query.origin, radius)) continue;
+
+			SceneQueryHit& hit = outHits[span.count++];
+			hit = {};
+			hit.id = m_ids[shape];
+			hit.layer = m_layers[shape];
+		}
+		return;
+	}
+
+	DirectX::SimpleMath::Vector3 direction = query.direction;
+	direction.Normalize();
+	const DirectX::SimpleMath::Vector3 end = query.origin + direction * query.distance;
+	GatherCandidates(query.layerMask, DirectX::SimpleMath::Vector3::Min(query.origin, end) - inflate, DirectX::SimpleMath::Vector3::Max(query.origin, end) + inflate);
+
+	const bool closestOnly = SceneQueryType::RaycastClosest == query.type;
+	for (uint32_t shape : m_candidates)
+	{
+		float distance = 0.f;
+		DirectX::SimpleMath::Vector3 normal;
+		if (!IntersectRay(shape, query.origin, direction, query.distance, radius, distance, normal)) continue;
+
+		if (closestOnly)
+		{
+			if (0 != span.count && outHits[0].distance <= distance) continue;
+			span.count = 1;
+		}
+		else if (span.count >= query.maxHits)
+		{
+			break;
+		}
+
+		SceneQueryHit& hit = closestOnly ? outHits[0] : outHits[span.count++];
+		hit.id = m_ids[shape];
+		hit.layer = m_layers[shape];
+		hit.distance = distance;
+		hit.normal = normal;
+		// 스윕은 쿼리 셰이프 중심이 닿은 위치를 접점에서 반지름만큼 되돌린 값으로 근사한다
+		hit.point = query.origin + direction * distance - normal * radius;
+	}
+}
+
+bool ReferenceSceneQueryBackend::IntersectRay(uint32_t shape, const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, float inflate, float& outDistance, DirectX::SimpleMath::Vector3& outNormal) const
+{
+	const DirectX::SimpleMath::Vector3 center(m_centerX[shape], m_centerY[shape], m_centerZ[shape]);
+
+	if (m_isSphere[shape])
+	{
+		const float radius = m_extentX[shape] + inflate;
+		const DirectX::SimpleMath::Vector3 toOrigin = origin - center;
+		const float b = toOrigin.Dot(direction);
+		const float c = toOrigin.LengthSquared() - radius * radius;
+		if (c <= 0.f)
+		{
+			// 시작점이 이미 안에 있다 (PhysX 와 같이 거리 0, 진행 반대 방향 법선)
+			outDistance = 0.f;
+			outNormal = -direction;
+			return true;
+		}
+
+		const float discriminant = b * b - c;
+		if (b > 0.f || discriminant < 0.f) return false;
+
+		const float t = -b - std::sqrt(discriminant);
+		if (t > maxDistance) return false;
+
+		outDistance = t;
+		outNormal = origin + direction * t - center;
+		outNormal.Normalize();
+		return true;
+	}
+
+	// 부풀린 AABB 슬랩 검사
+	const float originAxis[3] = { origin.x - center.x, origin.y - center.y, origin.z - center.z };
+	const float directionAxis[3] = { direction.x, direction.y, direction.z };
+	const float extentAxis[3] = { m_extentX[shape] + inflate, m_extentY[shape] + inflate, m_extentZ[shape] + inflate };
+
+	float tMin = 0.f;
+	float tMax = maxDistance;
+	int hitAxis = -1;
+	float hitSign = 0.f;
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		if (std::abs(directionAxis[axis]) < 1e-8f)
+		{
+			if (std::abs(originAxis[axis]) > extentAxis[axis]) return false;
+			continue;
+		}
+
+		const float inv = 1.f / directionAxis[axis];
+		float tNear = (-extentAxis[axis] - originAxis[axis]) * inv;
+		float tFar = (extentAxis[axis] - originAxis[axis]) * inv;
+		float sign = -1.f;
+		if (tNear > tFar)
+		{
+			std::swap(tNear, tFar);
+			sign = 1.f;
+		}
+
+		if (tNear > tMin)
+		{
+			tMin = tNear;
+			hitAxis = axis;
+			hitSign = sign;
+		}
+		tMax = (std::min)(tMax, tFar);
+		if (tMin > tMax) return false;
+	}
+
+	outDistance = tMin;
+	if (hitAxis < 0)
+	{
+		outNormal = -direction;
+	}
+	else
+	{
+		float normalAxis[3] = {};
+		normalAxis[hitAxis] = hitSign;
+		outNormal = DirectX::SimpleMath::Vector3(normalAxis[0], normalAxis[1], normalAxis[2]);
+	}
+	return true;
+}
+
+bool ReferenceSceneQueryBackend::Overlaps(uint32_t shape, const DirectX::SimpleMath::Vector3& center, float radius) const
+{
+	if (m_isSphere[shape])
+	{
+		const DirectX::SimpleMath::Vector3 shapeCenter(m_centerX[shape], m_centerY[shape], m_centerZ[shape]);
+		const float reach = m_extentX[shape] + radius;
+		return (center - shapeCenter).LengthSquared() <= reach * reach;
+	}
+
+	// 구와 AABB : 구 중심에서 상자까지 가장 가까운 점
+	const float dx = (std::max)((std::max)(m_minX[shape] - center.x, 0.f), center.x - m_maxX[shape]);
+	const float dy = (std::max)((std::max)(m_minY[shape] - center.y, 0.f), center.y - m_maxY[shape]);
+	const float dz = (std::max)((std::max)(m_minZ[shape] - center.z, 0.f), center.z - m_maxZ[shape]);
+	return dx * dx + dy * dy + dz * dz <= radius * radius;
+}
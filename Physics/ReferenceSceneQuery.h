@@ -0,0 +1,38 @@
+#pragma once
+#include "SceneQuery.h"
+
+// PhysX 없이 구/AABB 셰이프만으로 씬 쿼리를 실행하는 참조 백엔드 (벤치마크, 헤드리스 검증용)
+// - 셰이프는 SoA 로 두고, 레이어 마스크 + 쿼리 경계 상자 사전 필터를 SSE 로 4개씩 검사한다
+// - 스윕은 셰이프를 쿼리 셰이프의 경계 구 반지름만큼 부풀려 레이로, 오버랩은 쿼리 경계 구로 근사한다
+// - 쿼리는 호출 스레드에서 차례로 실행한다 (PhysX 백엔드와 쿼리 비용만 비교할 수 있게)
+class ReferenceSceneQueryBackend final : public ISceneQueryBackend
+{
+public:
+	uint32_t AddSphere(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, float radius);
+	uint32_t AddBox(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& halfExtents);
+	void Clear();
+
+	void Execute(SceneQueryBatch& batch) override;
+
+	size_t GetShapeCount() const { return m_ids.size(); }
+
+private:
+	void AddShape(unsigned int id, unsigned int layer, const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extents, bool isSphere);
+	// layerMask 와 겹치고 경계 상자가 [boundsMin, boundsMax] 와 겹치는 셰이프 인덱스를 m_candidates 에 모은다
+	void GatherCandidates(unsigned int layerMask, const DirectX::SimpleMath::Vector3& boundsMin, const DirectX::SimpleMath::Vector3& boundsMax);
+	void ExecuteQuery(const SceneQuery& query, SceneQuerySpan& span, SceneQueryHit* outHits);
+	bool IntersectRay(uint32_t shape, const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, float inflate, float& outDistance, DirectX::SimpleMath::Vector3& outNormal) const;
+	bool Overlaps(uint32_t shape, const DirectX::SimpleMath::Vector3& center, float radius) const;
+
+	// 셰이프 SoA (사전 필터가 4개씩 읽는다, 4로 나누어 떨어지지 않는 나머지는 스칼라로 검사)
+	std::vector<unsigned int>	m_ids;
+	std::vector<unsigned int>	m_layers;
+	std::vector<uint8_t>		m_isSphere;
+	std::vector<uint32_t>		m_layerBits;		// 1 << layer
+	std::vector<float>			m_centerX, m_centerY, m_centerZ;
+	std::vector<float>			m_extentX, m_extentY, m_extentZ;	// 구는 반지름
+	std::vector<float>			m_minX, m_minY, m_minZ;
+	std::vector<float>			m_maxX, m_maxY, m_maxZ;
+
+	std::vector<uint32_t>		m_candidates;
+};
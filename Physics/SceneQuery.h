@@ -0,0 +1,193 @@
+#pragma once
+// 게임 스크립트의 씬 쿼리(레이/스윕/오버랩)를 모아 한 번에 실행하는 배치와 실행 백엔드 경계.
+// PhysX 헤더를 쓰지 않으므로 PhysX 없이 참조 백엔드(ReferenceSceneQueryBackend)로도 돌릴 수 있다.
+#include "PhysicsCommon.h"
+#include <cstdint>
+#include <vector>
+
+enum class SceneQueryType : uint8_t
+{
+	RaycastClosest,	// 가장 가까운 block 하나 (PhysicX::Raycast)
+	RaycastAll,		// 경로의 모든 touch (PhysicX::RaycastAll)
+	BoxSweep,
+	SphereSweep,
+	CapsuleSweep,
+	BoxOverlap,
+	SphereOverlap,
+	CapsuleOverlap,
+};
+
+struct SceneQuery
+{
+	SceneQueryType					type{ SceneQueryType::RaycastAll };
+	DirectX::SimpleMath::Vector3		origin{};		// 레이 시작점, 스윕 시작 위치, 오버랩 중심
+	DirectX::SimpleMath::Quaternion	rotation{};		// 스윕/오버랩 셰이프 회전
+	DirectX::SimpleMath::Vector3		direction{};	// 레이/스윕 방향 (정규화는 백엔드가 한다)
+	float							distance{};
+	DirectX::SimpleMath::Vector3		shape{};		// Box : half extents, Sphere : (radius), Capsule : (radius, halfHeight)
+	unsigned int					layerMask{ ~0u };
+	uint32_t						maxHits{};
+};
+
+struct SceneQueryHit
+{
+	unsigned int					id{};
+	unsigned int					layer{};
+	DirectX::SimpleMath::Vector3		point{};		// 오버랩은 0
+	DirectX::SimpleMath::Vector3		normal{};		// 오버랩은 0
+	float							distance{ -1.f };	// 오버랩은 -1
+};
+
+// 쿼리 하나의 결과 구간 : hits[offset, offset + count)
+struct SceneQuerySpan
+{
+	uint32_t offset{};
+	uint32_t count{};
+};
+
+// 쿼리를 모아 두었다가 PhysicsManager::ExecuteQueries 로 한 번에 실행한다.
+// 결과는 쿼리마다 maxHits 칸을 미리 잡아 둔 아레나(hits)에 쓰이므로 쿼리별 할당이 없고,
+// 쿼리끼리 쓰는 구간이 겹치지 않아 백엔드가 쿼리를 병렬로 실행할 수 있다.
+// 배치를 멤버로 두고 매 프레임 Clear 해서 쓰면 용량이 재사용된다.
+struct SceneQueryBatch
+{
+	static constexpr uint32_t DefaultMaxHits = 20;	// 기존 단일 쿼리의 히트 버퍼 크기
+	static constexpr uint32_t MaxHitsLimit = 64;
+
+	std::vector<SceneQuery>		queries;
+	std::vector<SceneQuerySpan>	spans;
+	std::vector<SceneQueryHit>	hits;
+
+	uint32_t Add(const SceneQuery& query)
+	{
+		queries.push_back(query);
+		SceneQuery& added = queries.back();
+		if (0 == added.maxHits || added.maxHits > MaxHitsLimit)
+		{
+			added.maxHits = 0 == added.maxHits ? DefaultMaxHits : MaxHitsLimit;
+		}
+		if (SceneQueryType::RaycastClosest == added.type)
+		{
+			added.maxHits = 1;
+		}
+		return static_cast<uint32_t>(queries.size() - 1);
+	}
+
+	uint32_t AddRaycast(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float distance, unsigned int layerMask, uint32_t maxHits = DefaultMaxHits)
+	{
+		SceneQuery query;
+		query.type = SceneQueryType::RaycastAll;
+		query.origin = origin;
+		query.direction = direction;
+		query.distance = distance;
+		query.layerMask = layerMask;
+		query.maxHits = maxHits;
+		return Add(query);
+	}
+
+	uint32_t AddRaycastClosest(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float distance, unsigned int layerMask)
+	{
+		SceneQuery query;
+		query.type = SceneQueryType::RaycastClosest;
+		query.origin = origin;
+		query.direction = direction;
+		query.distance = distance;
+		query.layerMask = layerMask;
+		return Add(query);
+	}
+
+	uint32_t AddBoxSweep(const SweepInput& in, const DirectX::SimpleMath::Vector3& halfExtents, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeSweep(SceneQueryType::BoxSweep, in, halfExtents, maxHits));
+	}
+
+	uint32_t AddSphereSweep(const SweepInput& in, float radius, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeSweep(SceneQueryType::SphereSweep, in, { radius, 0.f, 0.f }, maxHits));
+	}
+
+	uint32_t AddCapsuleSweep(const SweepInput& in, float radius, float halfHeight, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeSweep(SceneQueryType::CapsuleSweep, in, { radius, halfHeight, 0.f }, maxHits));
+	}
+
+	uint32_t AddBoxOverlap(const OverlapInput& in, const DirectX::SimpleMath::Vector3& halfExtents, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeOverlap(SceneQueryType::BoxOverlap, in, halfExtents, maxHits));
+	}
+
+	uint32_t AddSphereOverlap(const OverlapInput& in, float radius, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeOverlap(SceneQueryType::SphereOverlap, in, { radius, 0.f, 0.f }, maxHits));
+	}
+
+	uint32_t AddCapsuleOverlap(const OverlapInput& in, float radius, float halfHeight, uint32_t maxHits = DefaultMaxHits)
+	{
+		return Add(MakeOverlap(SceneQueryType::CapsuleOverlap, in, { radius, halfHeight, 0.f }, maxHits));
+	}
+
+	// 실행 직전에 백엔드가 부른다 : 쿼리마다 결과 구간을 잡고 개수를 0 으로 만든다
+	void PrepareResults()
+	{
+		spans.resize(queries.size());
+		uint32_t offset = 0;
+		for (size_t i = 0; i < queries.size(); ++i)
+		{
+			spans[i].offset = offset;
+			spans[i].count = 0;
+			offset += queries[i].maxHits;
+		}
+		if (hits.size() < offset)
+		{
+			hits.resize(offset);
+		}
+	}
+
+	uint32_t GetHitCount(uint32_t query) const { return query < spans.size() ? spans[query].count : 0; }
+	const SceneQueryHit* GetHits(uint32_t query) const { return query < spans.size() ? hits.data() + spans[query].offset : nullptr; }
+
+	void Clear()
+	{
+		queries.clear();
+		spans.clear();
+	}
+
+	size_t Size() const { return queries.size(); }
+	bool Empty() const { return queries.empty(); }
+
+private:
+	static SceneQuery MakeSweep(SceneQueryType type, const SweepInput& in, const DirectX::SimpleMath::Vector3& shape, uint32_t maxHits)
+	{
+		SceneQuery query;
+		query.type = type;
+		query.origin = in.startPosition;
+		query.rotation = in.startRotation;
+		query.direction = in.direction;
+		query.distance = in.distance;
+		query.shape = shape;
+		query.layerMask = in.layerMask;
+		query.maxHits = maxHits;
+		return query;
+	}
+
+	static SceneQuery MakeOverlap(SceneQueryType type, const OverlapInput& in, const DirectX::SimpleMath::Vector3& shape, uint32_t maxHits)
+	{
+		SceneQuery query;
+		query.type = type;
+		query.origin = in.position;
+		query.rotation = in.rotation;
+		query.shape = shape;
+		query.layerMask = in.layerMask;
+		query.maxHits = maxHits;
+		return query;
+	}
+};
+
+class ISceneQueryBackend
+{
+public:
+	virtual ~ISceneQueryBackend() = default;
+
+	// batch.PrepareResults() 후 쿼리마다 spans[i].count 개의 결과를 hits 구간에 채운다
+	virtual void Execute(SceneQueryBatch& batch) = 0;
+};
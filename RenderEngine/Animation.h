@@ -2,6 +2,7 @@
 #include "Core.Minimal.h"
 #include "Animation.generated.h"
 #include "KeyFrameEvent.h"
+#include "BakedAnimation.h"
 struct NodeAnimation
 {
 	std::string m_name{};
@@ -43,6 +44,8 @@ public:
 	double m_ticksPerSecond{};
 	[[Property]]
 	bool m_isLoop = true;
+	// Skeleton::BakeAnimations  Ǵ  ε  ø 
+	BakedAnimation m_baked;
 
 	int preKey = 0;
 	int curKey = 0; //&&&&&  Ǵ  Ȯʿ 
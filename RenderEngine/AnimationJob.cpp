@@ -12,28 +12,8 @@ using namespace DirectX;
 
 std::vector<std::weak_ptr<Animator>> m_currAnimator;
 
-inline float lerp(float a, float b, float f)
-{
-    return a + f * (b - a);
-}
-
-template <typename T>
-int CurrentKeyIndex(std::vector<T>& keys, double time)
-{
-    float duration = time;
-    for (UINT i = 0; i < keys.size() - 1; ++i)
-    {
-        if (duration <= keys[i + 1].m_time)
-        {
-            return i;
-        }
-    }
-    return -1;
-}
-
 AnimationJob::AnimationJob()
 {
-	m_UpdateThreadPool = new ThreadPool<std::function<void()>>(8); // 8 threads for animation updates
 	m_sceneLoadedHandle = SceneManagers->sceneLoadedEvent.AddRaw(this, &AnimationJob::PrepareAnimation);
     m_AnimationUpdateHandle = SceneManagers->InternalAnimationUpdateEvent.AddRaw(this, &AnimationJob::Update);
 	m_sceneUnloadedHandle = SceneManagers->sceneUnloadedEvent.AddRaw(this, &AnimationJob::CleanUp);
@@ -48,7 +28,6 @@ AnimationJob::~AnimationJob()
 
 void AnimationJob::Finalize()
 {
-    delete m_UpdateThreadPool;
 	m_currAnimator.clear();
 }
 
@@ -66,6 +45,7 @@ void AnimationJob::Update(float deltaTime)
         m_currAnimator.push_back(animator);
     }
 
+    JobHandle updateGroup = JobSystems->CreateGroup();
     for(auto& weakanimator : m_currAnimator)
     {
         auto animator = weakanimator.lock();
@@ -81,7 +61,12 @@ void AnimationJob::Update(float deltaTime)
             if (controller.lock() == nullptr)
                 return;
         }
-        m_UpdateThreadPool->Enqueue([this, animator, controllers, delta = deltaTime] ()
+        // Ʈ  ۿ ߰ ִϸ̼ Ŀ ѱ   忡 ´
+        if (animator->m_Skeleton && !animator->m_Skeleton->IsAnimationBaked())
+        {
+            animator->m_Skeleton->BakeAnimations();
+        }
+        JobSystems->Schedule(updateGroup, [this, animator, controllers, delta = deltaTime] ()
         {
             Skeleton* skeleton = animator->m_Skeleton;
             if (!skeleton) return;
@@ -145,11 +130,11 @@ void AnimationJob::Update(float deltaTime)
                         animationcontroller->m_nextTimeElapsed = fmod(animationcontroller->m_nextTimeElapsed, nextanimation.m_duration);
                         animationcontroller->preNextAnimationProgress = animationcontroller->nextAnimationProgress;
                         animationcontroller->nextAnimationProgress = animationcontroller->m_nextTimeElapsed / nextanimation.m_duration;
-                        UpdateBlendBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);
+                        UpdateBlendBone(*animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);
                     }
                     else
                     {
-                        UpdateBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed);
+                        UpdateBone(*animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed);
                     }
 
                     if (deltaT <= 0.f) continue;
@@ -163,7 +148,7 @@ void AnimationJob::Update(float deltaTime)
                 
                 XMMATRIX rootTransform = skeleton->m_rootTransform;
 
-                UpdateBoneLayer(skeleton->m_rootBone, *animator , rootTransform);
+                UpdateBoneLayer(*animator , rootTransform);
                
             }
             else
@@ -199,11 +184,11 @@ void AnimationJob::Update(float deltaTime)
                         Animation& nextanimation = skeleton->m_animations[animator->nextAnimIndex];
                         animator->m_nextTimeElapsed += deltaT * nextanimation.m_ticksPerSecond;
                         animator->m_nextTimeElapsed = fmod(animator->m_nextTimeElapsed, nextanimation.m_duration);
-                        UpdateBlendBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animator).m_TimeElapsed, (*animator).m_nextTimeElapsed);
+                        UpdateBlendBone(*animator, animationcontroller, rootTransform, (*animator).m_TimeElapsed, (*animator).m_nextTimeElapsed);
                     }
                     else
                     {
-                        UpdateBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animator).m_TimeElapsed);
+                        UpdateBone(*animator, animationcontroller, rootTransform, (*animator).m_TimeElapsed);
                     }
                     //animation.InvokeEvent(animator);
                 }
@@ -256,7 +241,7 @@ void AnimationJob::Update(float deltaTime)
                         /*Animation& nextanimation = skeleton->m_animations[animationcontroller->GetNextAnimationIndex()];
                         animationcontroller->m_nextTimeElapsed += delta * nextanimation.m_ticksPerSecond;
                         animationcontroller->m_nextTimeElapsed = fmod(animationcontroller->m_nextTimeElapsed, nextanimation.m_duration);
-                        UpdateBlendBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);*/
+                        UpdateBlendBone(*animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);*/
 
 
                         Animation& nextanimation = skeleton->m_animations[animationcontroller->GetNextAnimationIndex()];
@@ -264,7 +249,7 @@ void AnimationJob::Update(float deltaTime)
                         animationcontroller->m_nextTimeElapsed = fmod(animationcontroller->m_nextTimeElapsed, nextanimation.m_duration);
                         animationcontroller->preNextAnimationProgress = animationcontroller->nextAnimationProgress;
                         animationcontroller->nextAnimationProgress = animationcontroller->m_nextTimeElapsed / nextanimation.m_duration;
-                        UpdateBlendBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);
+                        UpdateBlendBone(*animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed, (*animationcontroller).m_nextTimeElapsed);
 
 
 
@@ -272,7 +257,7 @@ void AnimationJob::Update(float deltaTime)
                     }
                     else
                     {
-                        UpdateBone(skeleton->m_rootBone, *animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed);
+                        UpdateBone(*animator, animationcontroller, rootTransform, (*animationcontroller).m_timeElapsed);
                     }
                     // skeleton->m_animations[animationcontroller->GetAnimationIndex()].InvokeEvent(animator);
 
@@ -309,7 +294,7 @@ void AnimationJob::Update(float deltaTime)
         });
     }
 
-    m_UpdateThreadPool->NotifyAllAndWait();
+    JobSystems->Wait(updateGroup);
 }
 
 void AnimationJob::PrepareAnimation()
@@ -333,112 +318,144 @@ void AnimationJob::CleanUp()
 	m_objectSize = 0;
 }
 
-void AnimationJob::UpdateBlendBone(Bone* bone, Animator& animator, AnimationController* controller,const DirectX::XMMATRIX& parentTransform, float time, float nextanitime)
+namespace
+{
+    // Ŀ 庰  ۷ι  ӽ  (Skeleton   ִϸͰ ϹǷ    ʴ´)
+    std::vector<XMMATRIX>& BoneGlobalScratch(const Skeleton* skeleton)
+    {
+        thread_local std::vector<XMMATRIX> globals;
+        if (globals.size() < skeleton->m_bones.size())
+        {
+            globals.resize(skeleton->m_bones.size());
+        }
+        return globals;
+    }
+}
+
+void AnimationJob::UpdateBlendBone(Animator& animator, AnimationController* controller, const DirectX::XMMATRIX& rootTransform, float time, float nextanitime)
 {
     Skeleton* skeleton = animator.m_Skeleton;
     Animation* animation;
     Animation* nextanimation;
+    AnimationKeyCursor* cursor;
+    AnimationKeyCursor* nextCursor;
     if (controller)
     {
         animation = &skeleton->m_animations[controller->GetAnimationIndex()];
         nextanimation = &skeleton->m_animations[controller->GetNextAnimationIndex()];
+        cursor = &controller->m_keyCursor;
+        nextCursor = &controller->m_nextKeyCursor;
     }
     else
     {
         animation = &skeleton->m_animations[animator.m_AnimIndexChosen];
         nextanimation = &skeleton->m_animations[animator.nextAnimIndex];
+        cursor = &animator.m_keyCursor;
+        nextCursor = &animator.m_nextKeyCursor;
     }
 
-    std::string& boneName = bone->m_name;
+    const BakedAnimation& clip = animation->m_baked;
+    const BakedAnimation& nextClip = nextanimation->m_baked;
+    cursor->Bind(&clip, time);
+    nextCursor->Bind(&nextClip, nextanitime);
 
-
-    auto it = animation->m_nodeAnimations.find(boneName);
-    if (it == animation->m_nodeAnimations.end())
+    std::vector<XMMATRIX>& globals = BoneGlobalScratch(skeleton);
+    const size_t boneCount = skeleton->m_boneOrder.size();
+    for (size_t i = 0; i < boneCount; ++i)
     {
-        for (Bone* child : bone->m_children)
+        const int boneIndex = skeleton->m_boneOrder[i];
+        const int parentIndex = skeleton->m_boneOrderParent[i];
+        const XMMATRIX parentTransform = parentIndex < 0 ? rootTransform : globals[parentIndex];
+
+        // Ʈ   θ  ״ ڽĿ ѱ
+        const int32 track = clip.GetTrack(boneIndex);
+        if (track == BakedAnimation::NullTrack)
         {
-            UpdateBlendBone(child, animator, controller,parentTransform, time, nextanitime);
+            globals[boneIndex] = parentTransform;
+            continue;
         }
-        return;
-    }
 
-    NodeAnimation& nodeAnim = animation->m_nodeAnimations[boneName];
-    NodeAnimation& nextnodeAnim = nextanimation->m_nodeAnimations[boneName];
-    
-    XMMATRIX nodeTransform = calculAni(nodeAnim, time, &animation->curKey);
-    
-    XMMATRIX nextnodeTransform = calculAni(nextnodeAnim, nextanitime, &nextanimation->curKey);
-    XMMATRIX blendTransform = BlendAni(nodeTransform, nextnodeTransform, animator.blendT);
-    animator.blendtransform = blendTransform;
-    XMMATRIX globalTransform = blendTransform * parentTransform;
-
-    
-    animator.m_FinalTransforms[bone->m_index] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
-    bone->m_globalTransform = globalTransform;
-    bone->m_localTransform = blendTransform;
-    animator.m_localTransforms[bone->m_index] = bone->m_localTransform;
-    if (skeleton->HasSocket())
-    {
-        for (auto& socket : skeleton->m_sockets)
+        Bone* bone = skeleton->m_bones[boneIndex];
+        XMMATRIX nodeTransform = clip.Sample(track, time, *cursor);
+
+        const int32 nextTrack = nextClip.GetTrack(boneIndex);
+        XMMATRIX nextnodeTransform = nextTrack != BakedAnimation::NullTrack ?
+            nextClip.Sample(nextTrack, nextanitime, *nextCursor) : nodeTransform;
+        XMMATRIX blendTransform = BlendAni(nodeTransform, nextnodeTransform, animator.blendT);
+        animator.blendtransform = blendTransform;
+        XMMATRIX globalTransform = blendTransform * parentTransform;
+        globals[boneIndex] = globalTransform;
+
+        animator.m_FinalTransforms[boneIndex] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
+        bone->m_globalTransform = globalTransform;
+        bone->m_localTransform = blendTransform;
+        animator.m_localTransforms[boneIndex] = blendTransform;
+        if (skeleton->HasSocket())
         {
-            if (bone->m_name == socket->m_ObjectName)
+            for (auto& socket : skeleton->m_sockets)
             {
-                socket->m_boneMatrix = bone->m_globalTransform * socket->m_offset;
-                socket->m_boneMatrix = socket->m_boneMatrix * animator.GetOwner()->m_transform.GetWorldMatrix();
+                if (bone->m_name == socket->m_ObjectName)
+                {
+                    socket->m_boneMatrix = globalTransform * socket->m_offset;
+                    socket->m_boneMatrix = socket->m_boneMatrix * animator.GetOwner()->m_transform.GetWorldMatrix();
+                }
             }
         }
-    }
-    if (controller)
-    {
-        controller->m_LocalTransforms[bone->m_index] = blendTransform;
-        controller->m_FinalTransforms[bone->m_index] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
-    }
-    for (Bone* child : bone->m_children)
-    {
-        UpdateBlendBone(child, animator, controller,globalTransform, time, nextanitime);
+        if (controller)
+        {
+            controller->m_LocalTransforms[boneIndex] = blendTransform;
+            controller->m_FinalTransforms[boneIndex] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
+        }
     }
 }
 
-void AnimationJob::UpdateBone(Bone* bone, Animator& animator, AnimationController* controller,const XMMATRIX& parentTransform, float time)
+void AnimationJob::UpdateBone(Animator& animator, AnimationController* controller, const XMMATRIX& rootTransform, float time)
 {
     Skeleton* skeleton = animator.m_Skeleton;
-    std::string& boneName = bone->m_name;
     Animation* animation;
+    AnimationKeyCursor* cursor;
     if (controller)
     {
         animation = &skeleton->m_animations[controller->GetAnimationIndex()];
-        auto mask = controller->GetAvatarMask();
+        cursor = &controller->m_keyCursor;
     }
     else
     {
         animation = &skeleton->m_animations[animator.m_AnimIndexChosen];
+        cursor = &animator.m_keyCursor;
     }
-    auto it = animation->m_nodeAnimations.find(boneName);
-    if (it == animation->m_nodeAnimations.end())
+
+    const BakedAnimation& clip = animation->m_baked;
+    cursor->Bind(&clip, time);
+
+    const bool updateSocket = animator.HasSocket() && SceneManagers->m_isGameStart && animator.GetOwner() != nullptr;
+
+    std::vector<XMMATRIX>& globals = BoneGlobalScratch(skeleton);
+    const size_t boneCount = skeleton->m_boneOrder.size();
+    for (size_t i = 0; i < boneCount; ++i)
     {
-        for (Bone* child : bone->m_children)
+        const int boneIndex = skeleton->m_boneOrder[i];
+        const int parentIndex = skeleton->m_boneOrderParent[i];
+        const XMMATRIX parentTransform = parentIndex < 0 ? rootTransform : globals[parentIndex];
+
+        const int32 track = clip.GetTrack(boneIndex);
+        if (track == BakedAnimation::NullTrack)
         {
-            UpdateBone(child, animator, controller,parentTransform, time);
+            globals[boneIndex] = parentTransform;
+            continue;
         }
-        return;
-    }
-    NodeAnimation& nodeAnim = animation->m_nodeAnimations[boneName];
-    XMMATRIX nodeTransform = calculAni(nodeAnim, time, &animation->curKey);
-    XMMATRIX globalTransform = nodeTransform * parentTransform;
-    
-    bone->m_globalTransform = globalTransform;
-    bone->m_localTransform = nodeTransform;
-    animator.m_localTransforms[bone->m_index] = bone->m_localTransform;
-    animator.m_FinalTransforms[bone->m_index] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
- 
-
-    if (animator.HasSocket())
-    {
-        if (SceneManagers->m_isGameStart == false || animator.GetOwner() == nullptr)
-        {
 
-        }
-        else
+        Bone* bone = skeleton->m_bones[boneIndex];
+        XMMATRIX nodeTransform = clip.Sample(track, time, *cursor);
+        XMMATRIX globalTransform = nodeTransform * parentTransform;
+        globals[boneIndex] = globalTransform;
+
+        bone->m_globalTransform = globalTransform;
+        bone->m_localTransform = nodeTransform;
+        animator.m_localTransforms[boneIndex] = nodeTransform;
+        animator.m_FinalTransforms[boneIndex] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
+
+        if (updateSocket)
         {
             for (auto& socket : animator.socketvec)
             {
@@ -449,170 +466,85 @@ void AnimationJob::UpdateBone(Bone* bone, Animator& animator, AnimationControlle
                 }
             }
         }
-    }
 
-
-    if (controller)
-    {
-        controller->m_LocalTransforms[bone->m_index] = nodeTransform;
-        controller->m_FinalTransforms[bone->m_index] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
-    }
-    for (Bone* child : bone->m_children)
-    {
-        UpdateBone(child, animator, controller,globalTransform, time);
+        if (controller)
+        {
+            controller->m_LocalTransforms[boneIndex] = nodeTransform;
+            controller->m_FinalTransforms[boneIndex] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
+        }
     }
 }
 
 
-void AnimationJob::UpdateBoneLayer(Bone* bone, Animator& animator,const DirectX::XMMATRIX& parentTransform)
+void AnimationJob::UpdateBoneLayer(Animator& animator, const DirectX::XMMATRIX& rootTransform)
 {
     Skeleton* skeleton = animator.m_Skeleton;
-    std::string& boneName = bone->m_name;
-    bool isCalculAnimate = true;
-    XMMATRIX globalTransform{};
-    
-    Animation* animation;
+    const bool updateSocket = animator.HasSocket() && SceneManagers->m_isGameStart && animator.GetOwner() != nullptr;
 
-    bool hasAnyAnimation = false;
-    for (auto& precontroller : animator.m_animationControllers)
+    std::vector<XMMATRIX>& globals = BoneGlobalScratch(skeleton);
+    const size_t boneCount = skeleton->m_boneOrder.size();
+    for (size_t i = 0; i < boneCount; ++i)
     {
-        animation = &skeleton->m_animations[precontroller->GetAnimationIndex()];
-        auto it = animation->m_nodeAnimations.find(boneName);
-        if (it != animation->m_nodeAnimations.end())
+        const int boneIndex = skeleton->m_boneOrder[i];
+        const int parentIndex = skeleton->m_boneOrderParent[i];
+        const XMMATRIX parentTransform = parentIndex < 0 ? rootTransform : globals[parentIndex];
+
+        bool hasAnyAnimation = false;
+        for (auto& precontroller : animator.m_animationControllers)
         {
-            hasAnyAnimation = true;
-            break;
+            const Animation& animation = skeleton->m_animations[precontroller->GetAnimationIndex()];
+            if (animation.m_baked.GetTrack(boneIndex) != BakedAnimation::NullTrack)
+            {
+                hasAnyAnimation = true;
+                break;
+            }
         }
-    }
 
-    if (!hasAnyAnimation)
-    {
-        for (Bone* child : bone->m_children)
-            UpdateBoneLayer(child, animator, parentTransform);
-        return;
-    }
+        if (!hasAnyAnimation)
+        {
+            globals[boneIndex] = parentTransform;
+            continue;
+        }
 
-    for (auto& controller : animator.m_animationControllers)
-    {
-        if (controller->m_isBlend == false)
+        Bone* bone = skeleton->m_bones[boneIndex];
+        XMMATRIX globalTransform{};
+        for (auto& controller : animator.m_animationControllers)
         {
-            if (controller->IsUseLayer() == true)
+            //   ƴϸ ̾ ϴ Ʈѷ ݿ
+            if (controller->m_isBlend == false && controller->IsUseLayer() == false)
             {
-                auto mask = controller->GetAvatarMask();
-
-
-                if (mask != nullptr) //ũ 
-                {
-
-                    if (mask->isHumanoid)
-                    {
-                        if (mask->IsBoneEnabled(bone->m_region) == true) //&&&&& region̾ƴ϶  mask->IsBoneEnabled();  Ұ
-                        {
-                            //animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                            globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-                        }
-                        else
-                        {
-                            // globalTransform = parentTransform;
-                        }
-                    }
-                    else
-                    {
-                        if (mask->IsBoneEnabled(bone->m_name) == true)
-                        {
-                            animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                            globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-
-                        }
-                        else
-                        {
-                            //globalTransform = parentTransform;
-                        }
-                    }
-                }
-                else
-                {
-                    //animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                    globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-                }
+                continue;
             }
-        }
-        else
-        {
+
             auto mask = controller->GetAvatarMask();
             if (mask != nullptr) //ũ 
             {
-
                 if (mask->isHumanoid)
                 {
                     if (mask->IsBoneEnabled(bone->m_region) == true) //&&&&& region̾ƴ϶  mask->IsBoneEnabled();  Ұ
                     {
-                        //animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                        globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
+                        globalTransform = controller->m_LocalTransforms[boneIndex] * parentTransform;
                     }
                 }
                 else
                 {
                     if (mask->IsBoneEnabled(bone->m_name) == true)
                     {
-                        animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                        globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-
+                        animator.m_localTransforms[boneIndex] = controller->m_LocalTransforms[boneIndex];
+                        globalTransform = controller->m_LocalTransforms[boneIndex] * parentTransform;
                     }
                 }
             }
             else
             {
-                //animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-                globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
+                globalTransform = controller->m_LocalTransforms[boneIndex] * parentTransform;
             }
         }
-    }
 
-    //int controllerSize = animator.m_animationControllers.size();
-    //for (int i = controllerSize - 1; i >= 0; --i)
-    //{
-    //    auto& controller = animator.m_animationControllers[i];
-
-    //    if (controller->IsUseLayer())
-    //    {
-    //        auto mask = controller->GetAvatarMask();
-
-    //        if (mask != nullptr) // ũ 
-    //        {
-    //            if (mask->isHumanoid)
-    //            {
-    //                if (mask->IsBoneEnabled(bone->m_region))
-    //                {
-    //                    globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-    //                }
-    //            }
-    //            else
-    //            {
-    //                if (mask->IsBoneEnabled(bone->m_name))
-    //                {
-    //                    animator.m_localTransforms[bone->m_index] = controller->m_LocalTransforms[bone->m_index];
-    //                    globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-    //                }
-    //            }
-    //        }
-    //        else
-    //        {
-    //            globalTransform = controller->m_LocalTransforms[bone->m_index] * parentTransform;
-    //        }
-    //    }
-    //}
-
-    //bone->m_globalTransform = globalTransform;
-    animator.m_FinalTransforms[bone->m_index] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
-    
-    if (animator.HasSocket())
-    {
-        if (SceneManagers->m_isGameStart == false || animator.GetOwner() == nullptr)
-        {
+        globals[boneIndex] = globalTransform;
+        animator.m_FinalTransforms[boneIndex] = bone->m_offset * globalTransform * skeleton->m_globalInverseTransform;
 
-        }
-        else
+        if (updateSocket)
         {
             for (auto& socket : animator.socketvec)
             {
@@ -624,12 +556,6 @@ void AnimationJob::UpdateBoneLayer(Bone* bone, Animator& animator,const DirectX:
             }
         }
     }
-
-    for (Bone* child : bone->m_children)
-    {
-        UpdateBoneLayer(child, animator,globalTransform);
-    }
-    
 }
 
 XMMATRIX AnimationJob::BlendAni(XMMATRIX curAni, XMMATRIX nextAni, float t)
@@ -651,59 +577,4 @@ XMMATRIX AnimationJob::BlendAni(XMMATRIX curAni, XMMATRIX nextAni, float t)
     return blendedNodeTransform;
 }
 
-XMMATRIX AnimationJob::calculAni(NodeAnimation& nodeAnim, float time ,int* _key)
-{
-    float t = 0;
-    // Translation
-    XMVECTOR interpPos = nodeAnim.m_positionKeys[0].m_position;
-    if (nodeAnim.m_positionKeys.size() > 1)
-    {
-        int posKeyIdx = CurrentKeyIndex<NodeAnimation::PositionKey>(nodeAnim.m_positionKeys, time);
-        int nPosKeyIdx = posKeyIdx + 1;
-
-        if (_key)
-            *_key = posKeyIdx;
-        NodeAnimation::PositionKey posKey = nodeAnim.m_positionKeys[posKeyIdx];
-        NodeAnimation::PositionKey nPosKey = nodeAnim.m_positionKeys[nPosKeyIdx];
-
-        t = (time - posKey.m_time) / (nPosKey.m_time - posKey.m_time);
-        interpPos = XMVectorLerp(posKey.m_position, nPosKey.m_position, t);
-    }
-    XMMATRIX translation = XMMatrixTranslationFromVector(interpPos);
-
-    // Rotation
-    XMVECTOR interpQuat = nodeAnim.m_rotationKeys[0].m_rotation;
-    if (nodeAnim.m_rotationKeys.size() > 1)
-    {
-        int rotKeyIdx = CurrentKeyIndex<NodeAnimation::RotationKey>(nodeAnim.m_rotationKeys, time);
-        int nRotKeyIdx = rotKeyIdx + 1;
-
-        NodeAnimation::RotationKey rotKey = nodeAnim.m_rotationKeys[rotKeyIdx];
-        NodeAnimation::RotationKey nRotKey = nodeAnim.m_rotationKeys[nRotKeyIdx];
-
-        t = (time - rotKey.m_time) / (nRotKey.m_time - rotKey.m_time);
-        interpQuat = XMQuaternionSlerp(rotKey.m_rotation, nRotKey.m_rotation, t);
-
-    }
-    XMMATRIX rotation = XMMatrixRotationQuaternion(interpQuat);
-
-    // Scaling
-    float interpScale = nodeAnim.m_scaleKeys[0].m_scale.x;
-
-    if (nodeAnim.m_scaleKeys.size() > 1)
-    {
-        int scalKeyIdx = CurrentKeyIndex<NodeAnimation::ScaleKey>(nodeAnim.m_scaleKeys, time);
-        int nScalKeyIdx = scalKeyIdx + 1;
-
-        NodeAnimation::ScaleKey scalKey = nodeAnim.m_scaleKeys[scalKeyIdx];
-        NodeAnimation::ScaleKey nScalKey = nodeAnim.m_scaleKeys[nScalKeyIdx];
-
-        t = (time - scalKey.m_time) / (nScalKey.m_time - scalKey.m_time);
-        interpScale = lerp(scalKey.m_scale.x, nScalKey.m_scale.x, t);
-    }
-
-    XMMATRIX scale = XMMatrixScaling(interpScale, interpScale, interpScale);
-    XMMATRIX nodeTransform = scale * rotation * translation;
-    return nodeTransform;
-}
 #endif // !DYNAMICCPP_EXPORTS
@@ -1,13 +1,12 @@
 #pragma once
 #ifndef DYNAMICCPP_EXPORTS
 #include "../Utility_Framework/Core.Minimal.h"
-#include "../Utility_Framework/Core.Thread.hpp"
+#include "../Utility_Framework/Core.JobSystem.h"
 
 class RenderScene;
 class Bone;
 class Animator;
 class Animation;
-class NodeAnimation;
 class AnimationController;
 class AnimationJob
 {
@@ -24,15 +23,14 @@ private:
     void UpdateBones(Animator& animator);
 
     // ִε, ִε, ӽð,
-    void UpdateBlendBone(Bone* bone, Animator& animator, AnimationController* controller, const DirectX::XMMATRIX& Transform, float time ,float nextanitime);
-    void UpdateBone(Bone* bone, Animator& animator, AnimationController* controller, const DirectX::XMMATRIX& Transform, float time);
-    void UpdateBoneLayer(Bone* bone, Animator& animator,  const DirectX::XMMATRIX& Transform);
+    // Skeleton::m_boneOrder (θ )  źϰ ȸѴ
+    void UpdateBlendBone(Animator& animator, AnimationController* controller, const DirectX::XMMATRIX& rootTransform, float time ,float nextanitime);
+    void UpdateBone(Animator& animator, AnimationController* controller, const DirectX::XMMATRIX& rootTransform, float time);
+    void UpdateBoneLayer(Animator& animator,  const DirectX::XMMATRIX& rootTransform);
     XMMATRIX BlendAni(XMMATRIX curAni, XMMATRIX nextAni, float t);
-    XMMATRIX calculAni(NodeAnimation& nodeAnim, float time, int* _key = nullptr);
 	Core::DelegateHandle m_sceneLoadedHandle;
 	Core::DelegateHandle m_sceneUnloadedHandle;
     Core::DelegateHandle m_AnimationUpdateHandle;
-    ThreadPool<std::function<void()>>* m_UpdateThreadPool;
     uint32 m_objectSize{};
 	RenderScene* m_renderScene{ nullptr };
 };
@@ -1,9 +0,0 @@
-#include "AssetJob.h"
-
-AssetLoadJob::AssetLoadJob() : m_AssetLoadThreadPool(16)
-{
-}
-
-AssetLoadJob::~AssetLoadJob()
-{
-}
@@ -0,0 +1,174 @@
+#include "BakedAnimation.h"
+#include "Animation.h"
+#include "Skeleton.h"
+
+using namespace DirectX;
+
+namespace
+{
+	// times[key] <= time <= times[key + 1] 이 되는 위치까지 앞으로 전진
+	inline uint32 AdvanceKey(const float* times, uint32 count, uint32 key, float time)
+	{
+		while (key + 2 < count && time > times[key + 1])
+		{
+			++key;
+		}
+		return key;
+	}
+
+	inline float KeyFactor(const float* times, uint32 key, float time)
+	{
+		const float span = times[key + 1] - times[key];
+		if (span <= 0.f)
+		{
+			return 0.f;
+		}
+		return std::clamp((time - times[key]) / span, 0.f, 1.f);
+	}
+}
+
+void BakedAnimation::Build(const Animation& animation, const Skeleton& skeleton)
+{
+	Clear();
+
+	m_trackByBone.assign(skeleton.m_bones.size(), NullTrack);
+	m_tracks.reserve(skeleton.m_bones.size());
+
+	for (const Bone* bone : skeleton.m_bones)
+	{
+		auto it = animation.m_nodeAnimations.find(bone->m_name);
+		if (it == animation.m_nodeAnimations.end())
+		{
+			continue;
+		}
+
+		const NodeAnimation& nodeAnim = it->second;
+		if (nodeAnim.m_positionKeys.empty() || nodeAnim.m_rotationKeys.empty() || nodeAnim.m_scaleKeys.empty())
+		{
+			continue;
+		}
+
+		Track track{};
+		track.posOffset = static_cast<uint32>(m_posTimes.size());
+		track.posCount = static_cast<uint32>(nodeAnim.m_positionKeys.size());
+		for (const auto& key : nodeAnim.m_positionKeys)
+		{
+			XMFLOAT3 pos;
+			XMStoreFloat3(&pos, key.m_position);
+			m_posTimes.push_back(static_cast<float>(key.m_time));
+			m_posX.push_back(pos.x);
+			m_posY.push_back(pos.y);
+			m_posZ.push_back(pos.z);
+		}
+
+		track.rotOffset = static_cast<uint32>(m_rotTimes.size());
+		track.rotCount = static_cast<uint32>(nodeAnim.m_rotationKeys.size());
+		for (const auto& key : nodeAnim.m_rotationKeys)
+		{
+			XMFLOAT4 rot;
+			XMStoreFloat4(&rot, key.m_rotation);
+			m_rotTimes.push_back(static_cast<float>(key.m_time));
+			m_rotX.push_back(rot.x);
+			m_rotY.push_back(rot.y);
+			m_rotZ.push_back(rot.z);
+			m_rotW.push_back(rot.w);
+		}
+
+		// 기존 샘플링과 동일하게 균등 스케일(x)만 사용
+		track.scaleOffset = static_cast<uint32>(m_scaleTimes.size());
+		track.scaleCount = static_cast<uint32>(nodeAnim.m_scaleKeys.size());
+		for (const auto& key : nodeAnim.m_scaleKeys)
+		{
+			m_scaleTimes.push_back(static_cast<float>(key.m_time));
+			m_scale.push_back(key.m_scale.x);
+		}
+
+		m_trackByBone[bone->m_index] = static_cast<int32>(m_tracks.size());
+		m_tracks.push_back(track);
+	}
+
+	m_built = true;
+}
+
+void BakedAnimation::Clear()
+{
+	m_trackByBone.clear();
+	m_tracks.clear();
+	m_posTimes.clear();
+	m_posX.clear();
+	m_posY.clear();
+	m_posZ.clear();
+	m_rotTimes.clear();
+	m_rotX.clear();
+	m_rotY.clear();
+	m_rotZ.clear();
+	m_rotW.clear();
+	m_scaleTimes.clear();
+	m_scale.clear();
+	m_built = false;
+}
+
+XMMATRIX BakedAnimation::Sample(int32 trackIndex, float time, AnimationKeyCursor& cursor) const
+{
+	const Track& track = m_tracks[trackIndex];
+	AnimationKeyCursor::Keys& keys = cursor.m_keys[trackIndex];
+
+	// Translation
+	XMVECTOR interpPos;
+	{
+		const uint32 base = track.posOffset;
+		if (track.posCount > 1)
+		{
+			keys.pos = AdvanceKey(&m_posTimes[base], track.posCount, keys.pos, time);
+			const uint32 k0 = base + keys.pos;
+			const float t = KeyFactor(&m_posTimes[base], keys.pos, time);
+			interpPos = XMVectorLerp(
+				XMVectorSet(m_posX[k0], m_posY[k0], m_posZ[k0], 1.f),
+				XMVectorSet(m_posX[k0 + 1], m_posY[k0 + 1], m_posZ[k0 + 1], 1.f), t);
+		}
+		else
+		{
+			interpPos = XMVectorSet(m_posX[base], m_posY[base], m_posZ[base], 1.f);
+		}
+	}
+
+	// Rotation
+	XMVECTOR interpQuat;
+	{
+		const uint32 base = track.rotOffset;
+		if (track.rotCount > 1)
+		{
+			keys.rot = AdvanceKey(&m_rotTimes[base], track.rotCount, keys.rot, time);
+			const uint32 k0 = base + keys.rot;
+			const float t = KeyFactor(&m_rotTimes[base], keys.rot, time);
+			interpQuat = XMQuaternionSlerp(
+				XMVectorSet(m_rotX[k0], m_rotY[k0], m_rotZ[k0], m_rotW[k0]),
+				XMVectorSet(m_rotX[k0 + 1], m_rotY[k0 + 1], m_rotZ[k0 + 1], m_rotW[k0 + 1]), t);
+		}
+		else
+		{
+			interpQuat = XMVectorSet(m_rotX[base], m_rotY[base], m_rotZ[base], m_rotW[base]);
+		}
+	}
+
+	// Scaling
+	float interpScale;
+	{
+		const uint32 base = track.scaleOffset;
+		if (track.scaleCount > 1)
+		{
+			keys.scale = AdvanceKey(&m_scaleTimes[base], track.scaleCount, keys.scale, time);
+			const uint32 k0 = base + keys.scale;
+			const float t = KeyFactor(&m_scaleTimes[base], keys.scale, time);
+			interpScale = m_scale[k0] + t * (m_scale[k0 + 1] - m_scale[k0]);
+		}
+		else
+		{
+			interpScale = m_scale[base];
+		}
+	}
+
+	return XMMatrixScaling(interpScale, interpScale, interpScale) *
+		XMMatrixRotationQuaternion(interpQuat) *
+		XMMatrixTranslationFromVector(interpPos);
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Core.Minimal.h"
+
+class Animation;
+class Skeleton;
+struct AnimationKeyCursor;
+// Animation 을 Skeleton 의 Bone::m_index 기준으로 재배치한 샘플링 전용 클립.
+// 키는 float 시간/성분별 SoA 배열에 트랙 단위로 연속 저장된다.
+class BakedAnimation
+{
+public:
+	static constexpr int32 NullTrack = -1;
+
+	struct Track
+	{
+		uint32 posOffset{};
+		uint32 posCount{};
+		uint32 rotOffset{};
+		uint32 rotCount{};
+		uint32 scaleOffset{};
+		uint32 scaleCount{};
+	};
+
+	void Build(const Animation& animation, const Skeleton& skeleton);
+	void Clear();
+
+	bool IsBuilt() const { return m_built; }
+	int32 GetTrack(int boneIndex) const
+	{
+		return (boneIndex >= 0 && boneIndex < static_cast<int>(m_trackByBone.size())) ? m_trackByBone[boneIndex] : NullTrack;
+	}
+	size_t GetTrackCount() const { return m_tracks.size(); }
+
+	// cursor 에 남은 키 위치부터 앞으로만 탐색한다 (시간이 되돌아가면 처음부터)
+	DirectX::XMMATRIX Sample(int32 track, float time, AnimationKeyCursor& cursor) const;
+
+private:
+	std::vector<int32>	m_trackByBone;
+	std::vector<Track>	m_tracks;
+
+	std::vector<float>	m_posTimes;
+	std::vector<float>	m_posX;
+	std::vector<float>	m_posY;
+	std::vector<float>	m_posZ;
+
+	std::vector<float>	m_rotTimes;
+	std::vector<float>	m_rotX;
+	std::vector<float>	m_rotY;
+	std::vector<float>	m_rotZ;
+	std::vector<float>	m_rotW;
+
+	std::vector<float>	m_scaleTimes;
+	std::vector<float>	m_scale;
+
+	bool				m_built{ false };
+};
+
+// 컨트롤러(또는 애니메이터)별 트랙 키 위치 캐시
+struct AnimationKeyCursor
+{
+	struct Keys
+	{
+		uint32 pos{};
+		uint32 rot{};
+		uint32 scale{};
+	};
+
+	// 클립이 바뀌었거나 시간이 되돌아갔으면(루프, 전환) 키 위치를 초기화한다
+	void Bind(const BakedAnimation* clip, float time)
+	{
+		if (m_clip != clip || time < m_lastTime)
+		{
+			m_clip = clip;
+			m_keys.assign(clip ? clip->GetTrackCount() : 0, Keys{});
+		}
+		m_lastTime = time;
+	}
+
+	void Reset()
+	{
+		m_clip = nullptr;
+		m_lastTime = 0.f;
+		m_keys.clear();
+	}
+
+	const BakedAnimation*	m_clip{ nullptr };
+	float					m_lastTime{};
+	std::vector<Keys>		m_keys;
+};
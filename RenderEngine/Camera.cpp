@@ -20,15 +20,19 @@ Camera::Camera() : m_isLinkRenderData(true)
 		renderScene->AddRenderPassData(m_cameraIndex);
 	}
 
-	XMMATRIX identity = XMMatrixIdentity();
+	// 헤드리스 러너는 디바이스 없이 카메라를 만든다 (상수 버퍼는 그릴 때만 쓴다)
+	if (DirectX11::DeviceStates->g_pDevice)
+	{
+		XMMATRIX identity = XMMatrixIdentity();
 
-	std::string viewBufferName = "Camera(" + std::to_string(m_cameraIndex) + ")ViewBuffer";
-	std::string projBufferName = "Camera(" + std::to_string(m_cameraIndex) + ")ProjBuffer";
+		std::string viewBufferName = "Camera(" + std::to_string(m_cameraIndex) + ")ViewBuffer";
+		std::string projBufferName = "Camera(" + std::to_string(m_cameraIndex) + ")ProjBuffer";
 
-	m_ViewBuffer = DirectX11::CreateBuffer(sizeof(Mathf::xMatrix), D3D11_BIND_FLAG::D3D11_BIND_CONSTANT_BUFFER, &identity);
-	DirectX::SetName(m_ViewBuffer.Get(), viewBufferName.c_str());
-	m_ProjBuffer = DirectX11::CreateBuffer(sizeof(Mathf::xMatrix), D3D11_BIND_FLAG::D3D11_BIND_CONSTANT_BUFFER, &identity);
-	DirectX::SetName(m_ProjBuffer.Get(), projBufferName.c_str());
+		m_ViewBuffer = DirectX11::CreateBuffer(sizeof(Mathf::xMatrix), D3D11_BIND_FLAG::D3D11_BIND_CONSTANT_BUFFER, &identity);
+		DirectX::SetName(m_ViewBuffer.Get(), viewBufferName.c_str());
+		m_ProjBuffer = DirectX11::CreateBuffer(sizeof(Mathf::xMatrix), D3D11_BIND_FLAG::D3D11_BIND_CONSTANT_BUFFER, &identity);
+		DirectX::SetName(m_ProjBuffer.Get(), projBufferName.c_str());
+	}
 
 	m_cascadeinfo.resize(cascadeCount);
 }
@@ -50,6 +54,7 @@ Camera::Camera(bool isTemperary) : m_isLinkRenderData(false)
 		m_aspectRatio = DirectX11::DeviceStates->g_aspectRatio;
 
 		m_cameraIndex = CameraManagement->GetCameraCount();
+		if (nullptr == DirectX11::DeviceStates->g_pDevice) return;
 
 		XMMATRIX identity = XMMatrixIdentity();
 
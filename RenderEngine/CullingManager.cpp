@@ -1,292 +1,158 @@
 #include "CullingManager.h"
-#include "Core.OctreeNode.h"
 #include "MeshRenderer.h"
 #include "Component.h"
 #include "GameObject.h"
-#include "SceneManager.h"
 
 using namespace DirectX;
 
-BoundingBox CalculateSceneWorldBounds(const std::vector<MeshRenderer*>& sceneMeshes)
+CullingManager::~CullingManager()
 {
-    BoundingBox bounds = {};
-    bool initialized = false;
-
-    for (MeshRenderer* mesh : sceneMeshes)
-    {
-        if (!mesh) continue;
-
-        const BoundingBox& meshBox = mesh->GetBoundingBox();
-
-        if (!initialized)
-        {
-            bounds = meshBox;
-            initialized = true;
-        }
-        else
-        {
-            BoundingBox::CreateMerged(bounds, bounds, meshBox);
-        }
-    }
-
-    // 최소 크기 또는 메쉬 없음 보정
-    if (!initialized)
-    {
-        // 메쉬가 하나도 없으면 고정 박스 사용
-        return BoundingBox({ 0.0f, 0.0f, 0.0f }, { 2000.f, 2000.f, 2000.f });
-    }
-
-    const float minExtentThreshold = 2000.f;
-
-    // 각 축의 extents가 최소 기준보다 작은 경우, 고정 박스 사용
-    if (bounds.Extents.x < minExtentThreshold * 0.5f ||
-        bounds.Extents.y < minExtentThreshold * 0.5f ||
-        bounds.Extents.z < minExtentThreshold * 0.5f)
-    {
-        return BoundingBox({ 0.0f, 0.0f, 0.0f }, { 2000.f, 2000.f, 2000.f });
-    }
-
-    return bounds;
+    // 종료 시점에는 메쉬가 먼저 해제됐을 수 있으므로 메쉬는 건드리지 않는다
+    m_bvh.Clear();
 }
 
-CullingManager::~CullingManager()
+void CullingManager::Initialize()
 {
     Clear();
 }
 
-void CullingManager::Initialize(const BoundingBox& worldBounds, int maxDepth, int maxMeshesPerNode)
+void CullingManager::Insert(MeshRenderer* mesh)
 {
- //   Clear();
- //   m_maxDepth = maxDepth;
- //   m_maxMeshesPerNode = maxMeshesPerNode;
-
-	//void* voidPtr = malloc(sizeof(OctreeNode));
-	//m_root = new (voidPtr) OctreeNode(worldBounds, 0);
-
-	//m_threadPool = new ThreadPool;
-
- //   SceneManagers->activeSceneChangedEvent.AddLambda([&]()
- //   {
-	//	std::vector<MeshRenderer*> sceneMeshes = SceneManagers->GetAllMeshRenderers();
-	//	BoundingBox newWorldBounds = CalculateSceneWorldBounds(sceneMeshes);
+    if (!mesh)
+        return;
 
-	//	Rebuild(sceneMeshes, newWorldBounds);
- //   });
+    std::scoped_lock lock(m_mutex);
+    const DynamicBVH::ProxyID proxyId = mesh->GetCullingProxyID();
+    // 지금 바운딩 박스로 넣으므로 그 전에 세워진 갱신 플래그는 필요 없다
+    mesh->SetNeedUpdateCulling(false);
+    if (m_bvh.GetUserData(proxyId) == mesh)
+    {
+        m_bvh.MoveProxy(proxyId, mesh->GetBoundingBox());
+        return;
+    }
 
+    mesh->SetCullingProxyID(m_bvh.CreateProxy(mesh->GetBoundingBox(), mesh));
 }
 
-void CullingManager::Rebuild(const std::vector<MeshRenderer*>& sceneMeshes, const DirectX::BoundingBox& newWorldBounds)
+bool CullingManager::Remove(MeshRenderer* mesh)
 {
-    Clear(); // 기존 옥트리 제거
+    if (!mesh)
+        return false;
 
-    // 새로운 옥트리 루트 생성
-    void* voidPtr = malloc(sizeof(OctreeNode));
-    m_root = new (voidPtr) OctreeNode(newWorldBounds, 0);
+    std::scoped_lock lock(m_mutex);
+    const DynamicBVH::ProxyID proxyId = mesh->GetCullingProxyID();
+    if (DynamicBVH::NullNode == proxyId || m_bvh.GetUserData(proxyId) != mesh)
+        return false;
 
-    // 모든 메쉬에 대해 재삽입
-    for (MeshRenderer* mesh : sceneMeshes)
-    {
-        if (mesh)
-        {
-            mesh->CullGroupClear(); // 이전 정보 제거 (안전성 보장)
-            Insert(mesh);
-        }
-    }
+    m_bvh.DestroyProxy(proxyId);
+    mesh->SetCullingProxyID(DynamicBVH::NullNode);
+    // 다시 Insert 될 때까지 플래그가 true 로 남으면 그 뒤의 MarkDirty 가 막힌다
+    mesh->SetNeedUpdateCulling(false);
+    return true;
 }
 
-void CullingManager::Insert(MeshRenderer* mesh)
+bool CullingManager::MarkDirty(MeshRenderer* mesh)
 {
-    if (m_root)
-        m_root->Insert(mesh, m_maxDepth, m_maxMeshesPerNode);
+    if (!mesh || DynamicBVH::NullNode == mesh->GetCullingProxyID())
+        return false;
+
+    m_dirtyQueue.push({ mesh->GetCullingProxyID(), mesh });
+    return true;
 }
 
-void CullingManager::SmartCullMeshes(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const
+void CullingManager::UpdateDirtyMeshes()
 {
-    if (!m_root)
-        return;
-
-    constexpr int ParallelThreshold = 3;
+    std::scoped_lock lock(m_mutex);
 
-    const int actualDepth = m_root->GetMaxDepth();
-    if (actualDepth >= ParallelThreshold)
-    {
-        CullMeshesMultithread(frustum, outVisibleMeshes);
-    }
-    else
+    DirtyEntry entry{};
+    while (m_dirtyQueue.try_pop(entry))
     {
-        CullMeshes(frustum, outVisibleMeshes);
+        // 큐에 들어간 뒤 제거된 메쉬는 프록시가 해제되었거나 다른 메쉬로 재사용되었다
+        if (m_bvh.GetUserData(entry.proxyId) != entry.mesh)
+            continue;
+
+        m_bvh.MoveProxy(entry.proxyId, entry.mesh->GetBoundingBox());
+        entry.mesh->SetNeedUpdateCulling(false);
     }
 }
 
-void CullingManager::CullMeshes(const BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const
+void CullingManager::UpdateMesh(MeshRenderer* mesh)
 {
-	std::vector<MeshRenderer*> visibleMeshes;
+    if (!mesh || !mesh->IsNeedUpdateCulling())
+        return;
 
-    if (m_root)
-        CullRecursive(frustum, m_root, visibleMeshes);
+    std::scoped_lock lock(m_mutex);
+    const DynamicBVH::ProxyID proxyId = mesh->GetCullingProxyID();
+    if (m_bvh.GetUserData(proxyId) != mesh)
+        return;
 
-	// 중복 제거
-	std::set<MeshRenderer*> uniqueMeshes(visibleMeshes.begin(), visibleMeshes.end());
-	for (const auto& result : uniqueMeshes)
-	{
-		if (result)
-		{
-			outVisibleMeshes.push_back(result);
-		}
-	}
+    m_bvh.MoveProxy(proxyId, mesh->GetBoundingBox());
+    mesh->SetNeedUpdateCulling(false);
 }
 
-void CullingManager::CullMeshesMultithread(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const
+void CullingManager::CullMeshes(const std::vector<BoundingFrustum>& frustums, std::vector<std::vector<MeshRenderer*>>& outVisibleMeshes)
 {
-    if (!m_root)
-        return;
-
-	std::vector<std::vector<MeshRenderer*>> results(m_threadPool->GetThreadCount());
-	std::atomic<uint32> jobIndex{ 0 };
-
-	std::array<OctreeNode*, 8> rootChildren = m_root->children;
+    UpdateDirtyMeshes();
 
-	for (DWORD i = 0; i < m_threadPool->GetThreadCount(); ++i)
-	{
-        uint32_t index = jobIndex.fetch_add(1);
-        if (index >= rootChildren.size())
-            break;
+    std::scoped_lock lock(m_mutex);
 
-        OctreeNode* child = rootChildren[index];
-        if (!child)
-            continue;
-
-		m_threadPool->Enqueue([&, i]()
-		{
-            CullRecursive(frustum, child, results[i]);
-		});
-	}
+    const size_t frustumCount = frustums.size();
+    outVisibleMeshes.resize(frustumCount);
 
-    // 루트 노드 자체 검사
-    ContainmentType rootContainment = frustum.Contains(m_root->boundingBox);
-    if (rootContainment != DISJOINT)
+    m_planes.resize(frustumCount);
+    for (size_t i = 0; i < frustumCount; ++i)
     {
-        CullRoot(frustum, outVisibleMeshes);
+        m_planes[i] = Core::SIMDCulling::MakePlanes(frustums[i]);
     }
 
-    m_threadPool->NotifyAllAndWait();
-
-	std::set<MeshRenderer*> uniqueMeshes;
-    for (const auto& result : results)
+    // 카메라 마스크가 32bit 이므로 32개씩 나눠서 순회
+    for (size_t base = 0; base < frustumCount; base += DynamicBVH::MaxFrustumCount)
     {
-		uniqueMeshes.insert(result.begin(), result.end());
-    }
+        const uint32_t count = static_cast<uint32_t>(std::min<size_t>(DynamicBVH::MaxFrustumCount, frustumCount - base));
 
-    for (const auto& result : uniqueMeshes)
-    {
-        if (result)
+        m_visibleProxies.resize(count);
+        for (auto& visible : m_visibleProxies)
         {
-            outVisibleMeshes.push_back(result);
+            visible.clear();
         }
-    }
-}
-
-void CullingManager::CullRoot(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& out) const
-{
-    ContainmentType result = frustum.Contains(m_root->boundingBox);
 
-	if (result == DISJOINT)
-		return;
+        m_bvh.CullFrustums(&m_planes[base], count, m_visibleProxies.data());
 
-	if (result == CONTAINS)
-	{
-		out.insert(out.end(), m_root->objects.begin(), m_root->objects.end());
-	}
-	else
-	{
-		for (MeshRenderer* renderer : m_root->objects)
-		{
-			if (frustum.Intersects(renderer->GetBoundingBox()) && !renderer->m_isSkinnedMesh)
-            {
-                out.push_back(renderer);
-            }
-		}
-	}
-}
-
-void CullingManager::CullRecursive(const BoundingFrustum& frustum, OctreeNode* node, std::vector<MeshRenderer*>& out) const
-{
-    ContainmentType result = frustum.Contains(node->boundingBox);
-
-    if (result == DISJOINT)
-        return;
-
-    if (result == CONTAINS)
-    {
-        if (node->isLeaf)
+        for (uint32_t i = 0; i < count; ++i)
         {
-            out.insert(out.end(), node->objects.begin(), node->objects.end());
-        }
-        else
-        {
-            for (OctreeNode* child : node->children)
-                if (child)
-                    CullRecursive(frustum, child, out);
-        }
-    }
-    else
-    {
-        if (node->isLeaf)
-        {
-            for (MeshRenderer* renderer : node->objects)
+            auto& out = outVisibleMeshes[base + i];
+            out.clear();
+            out.reserve(m_visibleProxies[i].size());
+            for (void* userData : m_visibleProxies[i])
             {
-                if (frustum.Intersects(renderer->GetBoundingBox()) && !renderer->m_isSkinnedMesh)
-                    out.push_back(renderer);
+                out.push_back(static_cast<MeshRenderer*>(userData));
             }
         }
-        else
-        {
-            for (OctreeNode* child : node->children)
-                if (child)
-                    CullRecursive(frustum, child, out);
-        }
     }
 }
 
-void CullingManager::Clear()
-{
-	if (m_root)
-	{
-		m_root->~OctreeNode();
-		free(m_root);
-		m_root = nullptr;
-	}
-    m_root = nullptr;
-}
-
-void CullingManager::UpdateMesh(MeshRenderer* mesh)
+void CullingManager::CullMeshes(const BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes)
 {
-    if(!mesh->IsNeedUpdateCulling())
-		return;
-
-    if (!Remove(mesh))
-        return;
+    std::vector<BoundingFrustum> frustums{ frustum };
+    std::vector<std::vector<MeshRenderer*>> results;
+    CullMeshes(frustums, results);
 
-    Insert(mesh); // 현재 바운딩박스로 재삽입
-	mesh->SetNeedUpdateCulling(false); // 업데이트 완료
+    outVisibleMeshes.insert(outVisibleMeshes.end(), results[0].begin(), results[0].end());
 }
 
-bool CullingManager::Remove(MeshRenderer* mesh)
+void CullingManager::Clear()
 {
-    if (!m_root)
-        return false;
+    std::scoped_lock lock(m_mutex);
 
-    for (OctreeNode* node : mesh->GetCullGroup())
-    {
-        auto& vec = node->objects;
-        vec.erase(std::remove(vec.begin(), vec.end(), mesh), vec.end());
-    }
-
-    mesh->CullGroupClear();
-    return true;
-}
-
-void CullingManager::RemoveAll()
-{
+    DirtyEntry entry{};
+    while (m_dirtyQueue.try_pop(entry)) {}
 
+    // 메쉬에 남은 프록시 ID 와 갱신 플래그를 지워야 다음 Insert/MarkDirty 가 다시 동작한다
+    m_bvh.ForEachProxy([](DynamicBVH::ProxyID, void* userData)
+    {
+        auto* mesh = static_cast<MeshRenderer*>(userData);
+        mesh->SetCullingProxyID(DynamicBVH::NullNode);
+        mesh->SetNeedUpdateCulling(false);
+    });
+    m_bvh.Clear();
 }
@@ -1,13 +1,15 @@
 #pragma once
 #include "ClassProperty.h"
-#include "Core.Thread.hpp"
+#include "Core.DynamicBVH.h"
 #include <vector>
+#include <mutex>
 #include <DirectXCollision.h>
-#include <set>
+#include <concurrent_queue.h>
 
 class MeshRenderer;
-class OctreeNode;
 
+// MeshRenderer 의 월드 AABB 를 동적 BVH 로 관리하고,
+// 한 번의 트리 순회로 여러 카메라의 절두체 컬링을 처리한다.
 class CullingManager : public Singleton<CullingManager>
 {
 private:
@@ -16,27 +18,36 @@ private:
     ~CullingManager();
 
 public:
-    void Initialize(const DirectX::BoundingBox& worldBounds, int maxDepth = 5, int maxMeshesPerNode = 10);
-    void Rebuild(const std::vector<MeshRenderer*>& sceneMeshes, const DirectX::BoundingBox& newWorldBounds);
+    void Initialize();
     void Insert(MeshRenderer* mesh);
-    void SmartCullMeshes(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const;
-    void CullMeshes(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const;
-	void CullMeshesMultithread(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes) const;
     bool Remove(MeshRenderer* mesh);
-	void RemoveAll();
+    // SetNeedUpdateCulling(true) 에서 호출된다. 여러 스레드에서 호출 가능
+    // BVH 에 없는 메쉬(Insert 전/Remove 후)는 큐에 넣지 않고 false 를 돌려준다
+    bool MarkDirty(MeshRenderer* mesh);
+    // 더러워진 메쉬만 BVH 에 다시 맞춘다 (fat AABB 를 벗어난 경우에만 재삽입)
+    void UpdateDirtyMeshes();
     void UpdateMesh(MeshRenderer* mesh);
+
+    // frustums[i] 에 보이는 메쉬가 outVisibleMeshes[i] 에 담긴다.
+    void CullMeshes(const std::vector<DirectX::BoundingFrustum>& frustums, std::vector<std::vector<MeshRenderer*>>& outVisibleMeshes);
+    void CullMeshes(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& outVisibleMeshes);
     void Clear();
 
+    size_t GetProxyCount() const { return m_bvh.GetProxyCount(); }
+
 private:
-    ThreadPool<std::function<void()>>* m_threadPool{ nullptr };
-    OctreeNode* m_root{ nullptr };
-    int m_maxDepth = 5;
-    int m_maxMeshesPerNode = 10;
+    struct DirtyEntry
+    {
+        DynamicBVH::ProxyID proxyId;
+        MeshRenderer*       mesh;
+    };
 
-    std::set<MeshRenderer*> m_uniqueMeshes;
+    DynamicBVH                                      m_bvh;
+    concurrency::concurrent_queue<DirtyEntry>       m_dirtyQueue;
+    std::mutex                                      m_mutex;
 
-	void CullRoot(const DirectX::BoundingFrustum& frustum, std::vector<MeshRenderer*>& out) const;
-    void CullRecursive(const DirectX::BoundingFrustum& frustum, OctreeNode* node, std::vector<MeshRenderer*>& out) const;
+    std::vector<Core::SIMDCulling::FrustumPlanesSoA> m_planes;
+    std::vector<std::vector<void*>>                 m_visibleProxies;
 };
 
-static auto& CullingManagers = CullingManager::GetInstance();
\ No newline at end of file
+static auto& CullingManagers = CullingManager::GetInstance();
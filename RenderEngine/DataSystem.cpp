@@ -12,6 +12,9 @@
 #include "VolumeProfile.h"
 #include "Benchmark.hpp"
 #include "SceneManager.h"
+#include "Core.JobSystem.h"
+#include "Core.PakFileSystem.h"
+#include "TextureCache.h"
 #include "PrefabUtility.h"
 #include "FileDialog.h"
 #include "IconsFontAwesome6.h"
@@ -177,12 +180,35 @@ void DataSystem::Initialize()
 	m_watcher			= new efsw::FileWatcher();
 	m_assetMetaRegistry = std::make_shared<AssetMetaRegistry>();
 	m_assetMetaWatcher	= std::make_shared<AssetMetaWatcher>(m_assetMetaRegistry.get());
+#ifdef BUILD_FLAG
+	// 게임 빌드는 마운트된 pak 의 .meta 로 GUID 만 등록한다 (meta 생성, 폴더 감시 없음)
+	PakFileSystems->ForEachFile(PathFinder::Relative(), true, [this](const file::path& metaPath)
+	{
+		if (metaPath.extension() != ".meta")
+			return;
+
+		file::path assetPath = metaPath;
+		assetPath.replace_extension();
+		if (!m_assetMetaWatcher->IsRegisteredFile(assetPath.extension().string()))
+			return;
+
+		AssetStream metaFile(metaPath);
+		MetaYml::Node node = MetaYml::Load(metaFile);
+		if (!node["guid"])
+			return;
+
+		FileGuid guid(node["guid"].as<std::string>());
+		if (!m_assetMetaRegistry->Contains(guid))
+		{
+			m_assetMetaRegistry->Register(guid, assetPath);
+		}
+	});
+#else
 	m_assetMetaWatcher->ScanAndGenerateMissingMeta(PathFinder::Relative());
-#ifndef BUILD_FLAG
 	m_assetMetaWatcher->ScanAndCleanupInvalidMeta(PathFinder::Relative());
-#endif
 	m_watcher->addWatch(PathFinder::Relative().string(), m_assetMetaWatcher.get(), true);
 	m_watcher->watch();
+#endif
 }
 
 void DataSystem::Finalize()
@@ -206,6 +232,9 @@ void DataSystem::Finalize()
     Textures.clear();
     Materials.clear();
 
+	// 에디터에서 캐시 미스로 쿠킹한 텍스처를 다음 실행에서 쓰도록 인덱스를 남긴다
+	TextureCaches->Save();
+
 	delete m_watcher;
 }
 
@@ -923,6 +952,9 @@ Material* DataSystem::CreateMaterial()
 
 SpriteFont* DataSystem::LoadSFont(const std::wstring_view& filePath)
 {
+	// SpriteFont 는 생성하면서 텍스처를 만든다 (헤드리스는 디바이스가 없다)
+	if (nullptr == DirectX11::DeviceStates->g_pDevice) return nullptr;
+
 	file::path destination = PathFinder::Relative("Font\\") / file::path(filePath).filename();
 	std::string name = file::path(filePath).stem().string();
 
@@ -935,7 +967,15 @@ SpriteFont* DataSystem::LoadSFont(const std::wstring_view& filePath)
 		}
 	}
 
-	SFonts.emplace(name, std::make_shared<SpriteFont>(DirectX11::DeviceStates->g_pDevice, destination.c_str()));
+	std::vector<std::byte> fontData;
+	if (PakFileSystems->Contains(destination) && PakFileSystems->Read(destination, fontData))
+	{
+		SFonts.emplace(name, std::make_shared<SpriteFont>(DirectX11::DeviceStates->g_pDevice, reinterpret_cast<const uint8_t*>(fontData.data()), fontData.size()));
+	}
+	else
+	{
+		SFonts.emplace(name, std::make_shared<SpriteFont>(DirectX11::DeviceStates->g_pDevice, destination.c_str()));
+	}
 	
 	return SFonts[name].get();
 }
@@ -1644,12 +1684,13 @@ void DataSystem::AddModel(const file::path& filepath, const file::path& dir)
 
 void DataSystem::LoadAssetBundle(const AssetBundle& bundle)
 {
+	JobHandle loadGroup = JobSystems->CreateGroup();
 	for (const auto& entry : bundle.assets)
 	{
 		auto type = static_cast<ManagedAssetType>(entry.assetTypeID);
 		file::path name = entry.assetName;
 
-		SceneManagers->m_threadPool->Enqueue([this, type, name]
+		JobSystems->Schedule(loadGroup, [this, type, name]
 		{
 			switch (type)
 			{
@@ -1671,7 +1712,7 @@ void DataSystem::LoadAssetBundle(const AssetBundle& bundle)
 		});
 	}
 
-	SceneManagers->m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(loadGroup);
 }
 
 void DataSystem::RetainAssets(const AssetBundle& bundle)
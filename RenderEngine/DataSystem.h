@@ -7,7 +7,6 @@
 #include <DirectXTK/SpriteFont.h>
 #include <DirectXTK/SpriteBatch.h>
 #include "concurrent_queue.h"
-#include "AssetJob.h"
 #include "DLLAcrossSingleton.h"
 #include "EngineSetting.h"
 #include "AssetBundle.h"
@@ -5,28 +5,28 @@
 #include "EffectProxyController.h"
 #include "EffectSerializer.h"
 #include "Profiler.h"
+#include "Core.PakFileSystem.h"
 
 void EffectManager::Initialize()
 {
 	std::filesystem::path effectPath = PathFinder::Relative("Effect\\");
 
 	// 丮 翩
-	if (!std::filesystem::exists(effectPath) || !std::filesystem::is_directory(effectPath)) {
+	if (!PakFileSystems->IsMounted() && (!std::filesystem::exists(effectPath) || !std::filesystem::is_directory(effectPath))) {
 		std::cout << "Effect folder does not exist" << '\n';
 		return;
 	}
 
 	try {
-		for (const auto& entry : std::filesystem::directory_iterator(effectPath)) {
-			if (entry.is_regular_file() && entry.path().extension() == ".json") {
+		PakFileSystems->ForEachFile(effectPath, false, [&](const std::filesystem::path& entryPath) {
+			if (entryPath.extension() == ".json") {
 				try {
-					std::ifstream file(entry.path());
+					AssetStream file(entryPath);
 					if (file.is_open()) {
 						nlohmann::json effectJson;
 						file >> effectJson;
-						file.close();
 
-						std::string effectName = entry.path().stem().string();
+						std::string effectName = entryPath.stem().string();
 						UniversalEffectTemplate templateConfig;
 						templateConfig.LoadConfigFromJSON(effectJson);
 						templates[effectName] = templateConfig;
@@ -35,10 +35,10 @@ void EffectManager::Initialize()
 					}
 				}
 				catch (const std::exception& e) {
-					std::cerr << "Error loading effect: " << entry.path() << " - " << e.what() << std::endl;
+					std::cerr << "Error loading effect: " << entryPath << " - " << e.what() << std::endl;
 				}
 			}
-		}
+		});
 	}
 	catch (const std::filesystem::filesystem_error& e) {
 		std::cout << "Effect json does not exist" << '\n';
@@ -40,6 +40,15 @@ public:
 		m_frame.fetch_add(1, std::memory_order_relaxed);
 	}
 
+	//    (帮)    ʰ .  忡 ȣ
+	void DiscardEffectCommands()
+	{
+		for (auto& queue : m_effectFrameCommands)
+		{
+			queue.clear();
+		}
+	}
+
 	//     Ȯ
 	size_t GetPendingCommandCount() const
 	{
@@ -616,12 +616,14 @@ void ForwardPass::CreateFoliageCommandList(ID3D11DeviceContext* deferredContext,
 	{
 		if (!proxy || (int)proxy->m_proxyType != (int)PrimitiveProxyType::FoliageComponent) continue;
 
-		for(auto& [key, instances] : proxy->instanceMap)
+		if (!proxy->m_foliageMatrices) continue;
+		const auto& foliageMatrices = *proxy->m_foliageMatrices;
+
+		const uint32 typeCount = static_cast<uint32>((std::min)(proxy->m_foliageVisibleIndices.size(), proxy->m_foliageTypes.size()));
+		for (uint32 key = 0; key < typeCount; ++key)
 		{
+			const auto& instances = proxy->m_foliageVisibleIndices[key];
 			if (instances.empty()) continue;
-			auto& firstInstance = instances.front();
-
-			if (proxy->m_foliageTypes.empty()) continue;
 
 			auto& foliageType = proxy->m_foliageTypes[key];
 			Mesh* mesh		= foliageType.m_mesh;
@@ -658,8 +660,7 @@ void ForwardPass::CreateFoliageCommandList(ID3D11DeviceContext* deferredContext,
 				instanceMatrices.resize(count);
 				for (size_t i = 0; i < count; ++i)
 				{
-					const auto* inst = instances[base + i];
-					instanceMatrices[i] = inst->m_worldMatrix * proxy->m_worldMatrix;
+					instanceMatrices[i] = foliageMatrices[instances[base + i]] * proxy->m_worldMatrix;
 				}
 
 				//  Ʈ (Ʈ )
@@ -115,7 +115,7 @@ GBufferPass::GBufferPass()
 
 	// Create a dynamic structured buffer for instance data (world matrices)
    // This buffer is created once and updated each frame.
-	constexpr uint32 MAX_INSTANCES = 16'384; // Max number of instances per draw call
+	constexpr uint32 MAX_INSTANCES = RenderQueueSorter::MaxInstancesPerBatch; // Max number of instances per draw call
 	m_maxInstanceCount = MAX_INSTANCES;
 
 	D3D11_BUFFER_DESC instanceBufferDesc{};
@@ -167,13 +167,11 @@ void GBufferPass::CreateRenderCommandList(ID3D11DeviceContext* deferredContext,
 	ID3D11DeviceContext* deferredPtr = deferredContext;
 
 	// --- 1. CLASSIFY RENDER PROXIES ---
-	// Grouping key is now a pair of (Material GUID, Mesh GUID) to ensure
-	// that only objects with the exact same mesh and material are instanced together.
-	using InstanceGroupKey = PrimitiveRenderProxy::ProxyFilter;
+	// Static proxies were already merged into instance batches by RenderPassData::SortRenderQueue
+	// (same mesh, material, LOD and bitflag), so only animated and custom PSO proxies are grouped here.
 	std::vector<PrimitiveRenderProxy*> animatedProxies;
 	std::map<std::string, std::vector<PrimitiveRenderProxy*>> shaderPSOGroups;
 	std::map<std::string, std::vector<PrimitiveRenderProxy*>> animatedShaderPSOGroups;
-	std::map<InstanceGroupKey, std::vector<PrimitiveRenderProxy*>> instanceGroups;
 
 	for (auto& proxy : data->m_deferredQueue)
 	{
@@ -192,20 +190,6 @@ void GBufferPass::CreateRenderCommandList(ID3D11DeviceContext* deferredContext,
 		{
 			shaderPSOGroups[proxy->m_Material->m_shaderPSO->m_shaderPSOName].push_back(proxy);
 		}
-		else
-		{
-			// Assuming PrimitiveRenderProxy has a pointer to a Mesh object which contains the hashingMesh GUID.
-			// Based on operator==, the mesh guid is proxy->m_mesh->m_hashingMesh.
-			InstanceGroupKey key
-			{ 
-				proxy->m_materialGuid, 
-				proxy->m_Mesh->m_hashingMesh,
-				proxy->m_EnableLOD,
-				proxy->GetLODLevel(&camera),
-				proxy->m_bitflag
-			};
-			instanceGroups[key].push_back(std::move(proxy));
-		}
 	}
 
 	// --- INITIAL PSO AND RENDER TARGET SETUP ---
@@ -280,18 +264,14 @@ void GBufferPass::CreateRenderCommandList(ID3D11DeviceContext* deferredContext,
 	// Bind the pre-created instance buffer SRV to the vertex shader once.
 	DirectX11::VSSetShaderResources(deferredPtr, 0, 1, m_instanceBufferSRV.GetAddressOf());
 
-	for (auto const& [groupKey, proxies] : instanceGroups)
+	for (const InstanceBatch& batch : data->m_deferredBatches)
 	{
-		if (proxies.empty()) continue;
-		assert(proxies.size() <= m_maxInstanceCount && "Exceeded maximum instance count!");
-
-		const auto& groupMaterialGuid = groupKey.materialGuid;
-		auto firstProxy = proxies.front();
+		auto firstProxy = batch.first;
+		if (0 == batch.instanceCount || !firstProxy || (int)firstProxy->m_proxyType == (int)PrimitiveProxyType::Expired) continue;
+		assert(batch.instanceCount <= m_maxInstanceCount && "Exceeded maximum instance count!");
 
-		if (!firstProxy || (int)firstProxy->m_proxyType == (int)PrimitiveProxyType::Expired) continue;
-		// *** THE KEY OPTIMIZATION IS HERE ***
-		// --- Set material once per group ---
-		// Only update material state if it has changed from the previous group.
+		// --- Set material once per batch ---
+		// Batches are sorted by material, so material state only changes between runs.
 		Material* mat = firstProxy->m_Material;
 		auto matinfo = mat->m_materialInfo;
 		firstProxy->m_bitflag |= firstProxy->m_isShadowRecive ? MaterialInfomation::USE_SHADOW_RECIVE : 0;
@@ -300,7 +280,7 @@ void GBufferPass::CreateRenderCommandList(ID3D11DeviceContext* deferredContext,
 		mbuffer.bitflag = firstProxy->m_bitflag;
 		DirectX11::UpdateBuffer(deferredPtr, m_meshRendererBuffer.Get(), &mbuffer);
 
-		if (groupMaterialGuid != currentMaterialGuid)
+		if (firstProxy->m_materialGuid != currentMaterialGuid)
 		{
 			DirectX11::UpdateBuffer(deferredPtr, m_materialBuffer.Get(), &matinfo);
 			if (mat->m_pBaseColor) DirectX11::PSSetShaderResources(deferredPtr, 0, 1, &mat->m_pBaseColor->m_pSRV);
@@ -308,33 +288,24 @@ void GBufferPass::CreateRenderCommandList(ID3D11DeviceContext* deferredContext,
 			if (mat->m_pOccRoughMetal) DirectX11::PSSetShaderResources(deferredPtr, 2, 1, &mat->m_pOccRoughMetal->m_pSRV);
 			if (mat->m_AOMap) DirectX11::PSSetShaderResources(deferredPtr, 3, 1, &mat->m_AOMap->m_pSRV);
 			if (mat->m_pEmissive) DirectX11::PSSetShaderResources(deferredPtr, 5, 1, &mat->m_pEmissive->m_pSRV);
+			currentMaterialGuid = firstProxy->m_materialGuid;
 		}
 
 		// --- Update the instance data buffer using UpdateSubresource ---
+		// The world matrices of the batch are contiguous in m_deferredInstanceMatrices.
 		// This is safer for deferred contexts than Map/Unmap.
-		std::vector<Mathf::xMatrix> instanceMatrices;
-		instanceMatrices.reserve(proxies.size());
-		for (const auto& proxy : proxies)
-		{
-			if (!proxy || (int)proxy->m_proxyType == (int)PrimitiveProxyType::Expired) continue;
-
-			instanceMatrices.push_back(proxy->m_worldMatrix);
-		}
-
-		// Define the destination box to specify the exact region to update.
-		// This prevents reading past the end of the source data.
 		D3D11_BOX destBox;
 		destBox.left = 0;
-		destBox.right = proxies.size() * sizeof(Mathf::xMatrix);
+		destBox.right = batch.instanceCount * sizeof(Mathf::xMatrix);
 		destBox.top = 0;
 		destBox.bottom = 1;
 		destBox.front = 0;
 		destBox.back = 1;
 
-		deferredPtr->UpdateSubresource(m_instanceBuffer.Get(), 0, &destBox, instanceMatrices.data(), 0, 0);
+		deferredPtr->UpdateSubresource(m_instanceBuffer.Get(), 0, &destBox, data->m_deferredInstanceMatrices.data() + batch.instanceOffset, 0, 0);
 
 		// --- Draw all instances in one call ---
-		firstProxy->DrawInstanced(deferredPtr, proxies.size());
+		firstProxy->DrawInstanced(deferredPtr, batch.instanceCount);
 	}
 
 	// --- 3.5 RENDER OBJECTS WITH CUSTOM SHADER PSO (INDIVIDUALLY) ---
@@ -76,6 +76,7 @@ Mesh::Mesh(std::string_view _name, const std::vector<Vertex>& _vertices, const s
 	DirectX::SetName(m_vertexBuffer.Get(), m_name + "VertexBuffer");
 	m_indexBuffer = DirectX11::CreateBuffer(sizeof(uint32) * m_indices.size(), D3D11_BIND_INDEX_BUFFER, m_indices.data());
 	DirectX::SetName(m_indexBuffer.Get(), m_name + "IndexBuffer");
+	m_indexCount = static_cast<uint32>(m_indices.size());
 }
 
 Mesh::Mesh(std::string_view _name, std::vector<Vertex>&& _vertices, std::vector<uint32>&& _indices) :
@@ -85,11 +86,14 @@ Mesh::Mesh(std::string_view _name, std::vector<Vertex>&& _vertices, std::vector<
 	DirectX::SetName(m_vertexBuffer.Get(), m_name + "VertexBuffer");
 	m_indexBuffer = DirectX11::CreateBuffer(sizeof(uint32) * m_indices.size(), D3D11_BIND_INDEX_BUFFER, m_indices.data());
 	DirectX::SetName(m_indexBuffer.Get(), m_name + "IndexBuffer");
+	m_indexCount = static_cast<uint32>(m_indices.size());
 }
 
 Mesh::Mesh(Mesh&& _other) noexcept :
 	m_vertices(std::move(_other.m_vertices)),
 	m_indices(std::move(_other.m_indices)),
+	m_indexCount(_other.m_indexCount),
+	m_cookedLODs(std::move(_other.m_cookedLODs)),
 	m_vertexBuffer(std::move(_other.m_vertexBuffer)),
 	m_indexBuffer(std::move(_other.m_indexBuffer)),
 	m_name(std::move(_other.m_name)),
@@ -116,6 +120,7 @@ void Mesh::AssetInit()
 	DirectX::SetName(m_vertexBuffer.Get(), m_name + "VertexBuffer");
 	m_indexBuffer = DirectX11::CreateBuffer(sizeof(uint32) * m_indices.size(), D3D11_BIND_INDEX_BUFFER, m_indices.data());
 	DirectX::SetName(m_indexBuffer.Get(), m_name + "IndexBuffer");
+	m_indexCount = static_cast<uint32>(m_indices.size());
 }
 
 // [NEW] Check if LODs have been generated
@@ -127,7 +132,7 @@ bool Mesh::HasLODs() const
 // [NEW] Generate LODs
 void Mesh::GenerateLODs(const std::vector<float>&lodThresholds)
 {
-	if (m_vertices.empty() || m_indices.empty())
+	if (0 == m_indexCount)
 	{
 		std::cerr << "Mesh::GenerateLODs: Original mesh data is empty. Cannot generate LODs." << std::endl;
 		return;
@@ -138,38 +143,77 @@ void Mesh::GenerateLODs(const std::vector<float>&lodThresholds)
 
 	// Clear existing LODs (if any) before generating new ones
 	m_LODs.clear();
-	m_LODs.reserve(1 + lodThresholds.size()); // LOD 0 + generated LODs
+	m_LODs.resize(1 + lodThresholds.size()); // LOD 0 + generated LODs
 
 	// Add LOD 0 (original mesh) as the first LOD resource
-	LODResource lod0_resource;
+	LODResource& lod0_resource = m_LODs[0];
 	lod0_resource.vertexBuffer = m_vertexBuffer; // Use existing LOD 0 buffer
 	lod0_resource.indexBuffer = m_indexBuffer;   // Use existing LOD 0 buffer
-	lod0_resource.indexCount = static_cast<uint32>(m_indices.size());
-	m_LODs.push_back(lod0_resource);
+	lod0_resource.indexCount = m_indexCount;
 
-	// Generate simplified LODs using MeshOptimizer
-	std::optional<std::vector<MeshOptimizer::LOD>> generatedLODs =
-		MeshOptimizer::GenerateLODs(
-			*this, // Pass the current Mesh object (which has GetVertices/GetIndices)
-			lodThresholds);
+	// Use cooked LODs for matching thresholds and only simplify the rest at runtime
+	std::vector<float> missingThresholds;
+	std::vector<uint32_t> missingSlots;
+	for (uint32_t i = 0; i < lodThresholds.size(); ++i)
+	{
+		auto cooked = std::find_if(m_cookedLODs.begin(), m_cookedLODs.end(), [&](const auto& lod)
+		{
+			return std::abs(lod.first - lodThresholds[i]) < 1e-4f;
+		});
+
+		if (cooked != m_cookedLODs.end())
+		{
+			m_LODs[i + 1] = cooked->second;
+		}
+		else
+		{
+			missingThresholds.push_back(lodThresholds[i]);
+			missingSlots.push_back(i + 1);
+		}
+	}
+
+	if (missingThresholds.empty())
+	{
+		return;
+	}
+
+	// Generate simplified LODs using MeshOptimizer (needs the CPU copy of the mesh)
+	std::optional<std::vector<MeshOptimizer::LOD>> generatedLODs = HasCPUData()
+		? MeshOptimizer::GenerateLODs(*this, missingThresholds)
+		: std::nullopt;
 
 	if (generatedLODs.has_value())
 	{
 		for (uint32_t i = 0; i < generatedLODs->size(); ++i)
 		{
 			const auto& lod_data = generatedLODs->at(i);
-			LODResource lod_resource;
-			CreateLODBuffers(lod_data.vertices, lod_data.indices, lod_resource, m_name, i + 1); // i+1 for LOD index
-			m_LODs.push_back(lod_resource);
+			CreateLODBuffers(lod_data.vertices, lod_data.indices, m_LODs[missingSlots[i]], m_name, missingSlots[i]);
 		}
 	}
 	else
 	{
 		std::cerr << "Mesh::GenerateLODs: MeshOptimizer failed to generate LODs." << std::endl;
-		// If generation fails, m_LODs will only contain LOD 0.
+		// If generation fails, the missing levels fall back to LOD 0.
+		for (uint32_t slot : missingSlots)
+		{
+			m_LODs[slot] = m_LODs[0];
+		}
 	}
 }
 
+void Mesh::AddCookedLOD(float threshold, const std::vector<Vertex>& vertices, const std::vector<uint32>& indices)
+{
+	LODResource lod_resource;
+	CreateLODBuffers(vertices, indices, lod_resource, m_name, static_cast<uint32_t>(m_cookedLODs.size() + 1));
+	m_cookedLODs.emplace_back(threshold, lod_resource);
+}
+
+void Mesh::ReleaseCPUData()
+{
+	std::vector<Vertex>().swap(m_vertices);
+	std::vector<uint32>().swap(m_indices);
+}
+
 uint32_t Mesh::SelectLOD(Camera* camera, const Mathf::Matrix& worldMatrix) const
 {
 	if (m_LODs.empty() || m_LODThresholds.empty() || nullptr == camera)
@@ -252,7 +296,7 @@ void Mesh::Draw()
 	DirectX11::IASetVertexBuffers(0, 1, m_vertexBuffer.GetAddressOf(), &m_stride, &offset);
 	DirectX11::IASetIndexBuffer(m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 	DirectX11::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	DirectX11::DrawIndexed(m_indices.size(), 0, 0);
+	DirectX11::DrawIndexed(m_indexCount, 0, 0);
 }
 
 void Mesh::Draw(ID3D11DeviceContext* _deferredContext)
@@ -261,7 +305,7 @@ void Mesh::Draw(ID3D11DeviceContext* _deferredContext)
 	DirectX11::IASetVertexBuffers(_deferredContext, 0, 1, m_vertexBuffer.GetAddressOf(), &m_stride, &offset);
 	DirectX11::IASetIndexBuffer(_deferredContext, m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 	DirectX11::IASetPrimitiveTopology(_deferredContext, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	DirectX11::DrawIndexed(_deferredContext, m_indices.size(), 0, 0);
+	DirectX11::DrawIndexed(_deferredContext, m_indexCount, 0, 0);
 }
 
 void Mesh::DrawShadow()
@@ -288,7 +332,7 @@ void Mesh::DrawInstanced(ID3D11DeviceContext* _deferredContext, size_t instanceC
 	DirectX11::IASetVertexBuffers(_deferredContext, 0, 1, m_vertexBuffer.GetAddressOf(), &m_stride, &offset);
 	DirectX11::IASetIndexBuffer(_deferredContext, m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 	DirectX11::IASetPrimitiveTopology(_deferredContext, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	DirectX11::DrawIndexedInstanced(_deferredContext, m_indices.size(), static_cast<UINT>(instanceCount), 0, 0, 0);
+	DirectX11::DrawIndexedInstanced(_deferredContext, m_indexCount, static_cast<UINT>(instanceCount), 0, 0, 0);
 }
 
 void Mesh::MakeShadowOptimizedBuffer()
@@ -344,7 +388,7 @@ void Mesh::DrawShadowLOD(ID3D11DeviceContext* context, uint32_t lodIndex)
 		DirectX11::IASetVertexBuffers(context, 0, 1, m_vertexBuffer.GetAddressOf(), &m_stride, &offset);
 		DirectX11::IASetIndexBuffer(context, m_indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 		DirectX11::IASetPrimitiveTopology(context, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		DirectX11::DrawIndexed(context, static_cast<uint32_t>(m_indices.size()), 0, 0);
+		DirectX11::DrawIndexed(context, m_indexCount, 0, 0);
 	}
 }
 
@@ -95,6 +95,7 @@ class Texture;
 class Material;
 class ModelLoader;
 class MeshOptimizer;
+class MeshCooker;
 class Camera;
 class Mesh : public Managed::HeapObject, public std::enable_shared_from_this<Mesh>
 {
@@ -144,6 +145,11 @@ public:
 
 	const std::vector<Vertex>& GetVertices() { return m_vertices; }
 	const std::vector<uint32>& GetIndices() { return m_indices; }
+	uint32 GetIndexCount() const { return m_indexCount; }
+
+	// GPU 에 올린 뒤 CPU 쪽 버텍스/인덱스 사본을 버린다 (개수와 바운딩은 남는다)
+	void ReleaseCPUData();
+	bool HasCPUData() const { return !m_indices.empty(); }
 
 	BoundingBox GetBoundingBox() const { return m_boundingBox; }
 	BoundingSphere GetBoundingSphere() const { return m_boundingSphere; }
@@ -166,6 +172,10 @@ public:
 private:
 	friend class ModelLoader;
 	friend class MeshOptimizer;
+	friend class MeshCooker;
+
+	// 쿠킹 때 만든 LOD 를 올려 둔다 (GenerateLODs 가 임계값이 같으면 단순화 없이 쓴다)
+	void AddCookedLOD(float threshold, const std::vector<Vertex>& vertices, const std::vector<uint32>& indices);
 
     [[Property]]
 	std::string m_name;
@@ -179,6 +189,7 @@ private:
 
 	std::vector<Vertex> m_vertices;
 	std::vector<uint32> m_indices;
+	uint32 m_indexCount{};
 
 	std::vector<Vertex> m_shadowVertices;
 	std::vector<uint32> m_shadowIndices;
@@ -192,6 +203,8 @@ private:
 	// 화면 공간 크기 기반의 LOD 전환 임계값
 	[[Property]]
 	std::vector<float> m_LODThresholds;
+	// 쿠킹된 LOD (임계값, GPU 리소스)
+	std::vector<std::pair<float, LODResource>> m_cookedLODs;
 	// ---
 
 	ComPtr<ID3D11Buffer> m_vertexBuffer{};
@@ -0,0 +1,455 @@
+#include "MeshCooker.h"
+#include "MeshOptimizer.h"
+#include "Core.JobSystem.h"
+#include <meshoptimizer.h>
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	constexpr uint32 MeshBlobMagic = 0x3148534D; // "MSH1"
+	constexpr uint32 MeshBlobVersion = 1;
+	constexpr uint32 MeshFlagSkinned = 1u << 0;
+	constexpr size_t StreamAlignment = 16;
+
+	struct BlobHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 meshCount;
+		uint32 lodCount;
+	};
+
+	struct MeshRecord
+	{
+		uint32					nameOffset;
+		uint32					nameLength;
+		uint32					materialIndex;
+		uint32					flags;
+		uint32					firstLod;
+		uint32					lodCount;
+		DirectX::BoundingBox	boundingBox;
+		DirectX::BoundingSphere	boundingSphere;
+	};
+
+	struct LodRecord
+	{
+		float	threshold;		// LOD0 은 1
+		uint32	vertexCount;
+		uint32	indexCount;
+		uint32	indexStride;	// 2 또는 4
+		uint64	vertexOffset;
+		uint64	skinOffset;		// 스키닝 메쉬가 아니면 0
+		uint64	indexOffset;
+	};
+
+	struct PackedVertex
+	{
+		float	position[3];
+		int16	normal[2];		// 옥타헤드럴 snorm16
+		int16	tangent[2];		// 옥타헤드럴 snorm16, tangent[0] 의 최하위 비트 = 바이탄젠트 부호
+		uint16	uv0[2];			// half
+		uint16	uv1[2];			// half
+	};
+	static_assert(sizeof(PackedVertex) == 28);
+
+	struct PackedSkin
+	{
+		uint16	boneIndices[4];
+		uint8	boneWeights[4];	// unorm8, 합이 255
+	};
+	static_assert(sizeof(PackedSkin) == 12);
+
+	int16 ToSnorm16(float value)
+	{
+		return static_cast<int16>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+	}
+
+	float FromSnorm16(int16 value)
+	{
+		return (std::max)(static_cast<float>(value) / 32767.0f, -1.0f);
+	}
+
+	void OctEncode(const Mathf::Vector3& n, int16 out[2])
+	{
+		const float sum = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+		if (sum < 1e-8f)
+		{
+			out[0] = 0;
+			out[1] = 0;
+			return;
+		}
+
+		float x = n.x / sum;
+		float y = n.y / sum;
+		if (n.z < 0.0f)
+		{
+			const float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			const float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+			x = foldedX;
+			y = foldedY;
+		}
+
+		out[0] = ToSnorm16(x);
+		out[1] = ToSnorm16(y);
+	}
+
+	Mathf::Vector3 OctDecode(const int16 in[2])
+	{
+		const float x = FromSnorm16(in[0]);
+		const float y = FromSnorm16(in[1]);
+		Mathf::Vector3 n{ x, y, 1.0f - std::abs(x) - std::abs(y) };
+		const float t = (std::max)(-n.z, 0.0f);
+		n.x += n.x >= 0.0f ? -t : t;
+		n.y += n.y >= 0.0f ? -t : t;
+		n.Normalize();
+		return n;
+	}
+
+	PackedVertex PackVertex(const Vertex& vertex)
+	{
+		using namespace DirectX::PackedVector;
+
+		PackedVertex packed{};
+		packed.position[0] = vertex.position.x;
+		packed.position[1] = vertex.position.y;
+		packed.position[2] = vertex.position.z;
+		OctEncode(vertex.normal, packed.normal);
+		OctEncode(vertex.tangent, packed.tangent);
+
+		const bool isMirrored = vertex.normal.Cross(vertex.tangent).Dot(vertex.bitangent) < 0.0f;
+		packed.tangent[0] = static_cast<int16>((static_cast<uint16>(packed.tangent[0]) & 0xFFFEu) | (isMirrored ? 1u : 0u));
+
+		packed.uv0[0] = XMConvertFloatToHalf(vertex.uv0.x);
+		packed.uv0[1] = XMConvertFloatToHalf(vertex.uv0.y);
+		packed.uv1[0] = XMConvertFloatToHalf(vertex.uv1.x);
+		packed.uv1[1] = XMConvertFloatToHalf(vertex.uv1.y);
+		return packed;
+	}
+
+	void UnpackVertex(const PackedVertex& packed, Vertex& vertex)
+	{
+		using namespace DirectX::PackedVector;
+
+		vertex.position = { packed.position[0], packed.position[1], packed.position[2] };
+		vertex.normal = OctDecode(packed.normal);
+		vertex.tangent = OctDecode(packed.tangent);
+
+		const float handedness = (static_cast<uint16>(packed.tangent[0]) & 1u) ? -1.0f : 1.0f;
+		vertex.bitangent = vertex.normal.Cross(vertex.tangent) * handedness;
+
+		vertex.uv0 = { XMConvertHalfToFloat(packed.uv0[0]), XMConvertHalfToFloat(packed.uv0[1]) };
+		vertex.uv1 = { XMConvertHalfToFloat(packed.uv1[0]), XMConvertHalfToFloat(packed.uv1[1]) };
+	}
+
+	PackedSkin PackSkin(const Vertex& vertex)
+	{
+		PackedSkin packed{};
+		const float weights[4]{ vertex.boneWeights.x, vertex.boneWeights.y, vertex.boneWeights.z, vertex.boneWeights.w };
+		const float indices[4]{ vertex.boneIndices.x, vertex.boneIndices.y, vertex.boneIndices.z, vertex.boneIndices.w };
+
+		int total = 0;
+		int heaviest = 0;
+		for (int k = 0; k < 4; ++k)
+		{
+			packed.boneIndices[k] = static_cast<uint16>(std::clamp(indices[k], 0.0f, 65535.0f));
+			packed.boneWeights[k] = static_cast<uint8>(std::lround(std::clamp(weights[k], 0.0f, 1.0f) * 255.0f));
+			total += packed.boneWeights[k];
+			if (weights[k] > weights[heaviest])
+			{
+				heaviest = k;
+			}
+		}
+
+		// 반올림 오차는 가장 큰 가중치에 몰아 합을 255 로 맞춘다
+		if (0 < total)
+		{
+			packed.boneWeights[heaviest] = static_cast<uint8>(std::clamp(packed.boneWeights[heaviest] + (255 - total), 0, 255));
+		}
+		return packed;
+	}
+
+	void UnpackSkin(const PackedSkin& packed, Vertex& vertex)
+	{
+		vertex.boneIndices = { float(packed.boneIndices[0]), float(packed.boneIndices[1]), float(packed.boneIndices[2]), float(packed.boneIndices[3]) };
+		vertex.boneWeights =
+		{
+			packed.boneWeights[0] / 255.0f,
+			packed.boneWeights[1] / 255.0f,
+			packed.boneWeights[2] / 255.0f,
+			packed.boneWeights[3] / 255.0f
+		};
+	}
+
+	bool InRange(std::span<const std::byte> blob, uint64 offset, uint64 size)
+	{
+		return offset <= blob.size() && size <= blob.size() - offset;
+	}
+}
+
+std::vector<MeshCooker::CookedLOD> MeshCooker::BuildLODs(const Mesh& mesh, bool isSkinned, const MeshCookSettings& settings)
+{
+	std::vector<CookedLOD> lods(1);
+	lods[0].vertices = mesh.m_vertices;
+	lods[0].indices = mesh.m_indices;
+
+	// 스키닝 메쉬는 LOD 를 만들지 않는다 (PrimitiveRenderProxy 와 같은 규칙)
+	if (!isSkinned && !settings.lodThresholds.empty())
+	{
+		if (auto generated = MeshOptimizer::GenerateLODs(mesh, settings.lodThresholds))
+		{
+			for (auto& lod : *generated)
+			{
+				lods.push_back({ lod.threshold, std::move(lod.vertices), std::move(lod.indices) });
+			}
+		}
+	}
+
+	for (CookedLOD& lod : lods)
+	{
+		if (lod.vertices.empty() || lod.indices.empty() || 0 != lod.indices.size() % 3)
+		{
+			continue;
+		}
+
+		meshopt_optimizeVertexCache(lod.indices.data(), lod.indices.data(), lod.indices.size(), lod.vertices.size());
+		const size_t vertexCount = meshopt_optimizeVertexFetch(
+			lod.vertices.data(), lod.indices.data(), lod.indices.size(),
+			lod.vertices.data(), lod.vertices.size(), sizeof(Vertex));
+		lod.vertices.resize(vertexCount);
+	}
+
+	return lods;
+}
+
+std::vector<std::byte> MeshCooker::Cook(const std::vector<Mesh*>& meshes, const MeshCookSettings& settings)
+{
+	const uint32 meshCount = static_cast<uint32>(meshes.size());
+
+	// 단순화/최적화는 메쉬마다 나눠 돌린다
+	std::vector<std::vector<CookedLOD>> cooked(meshCount);
+	std::vector<uint8> skinned(meshCount);
+	auto handle = JobSystems->ParallelFor(meshCount, 1, [&](uint32 begin, uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+		{
+			const Mesh& mesh = *meshes[i];
+			skinned[i] = std::any_of(mesh.m_vertices.begin(), mesh.m_vertices.end(), [](const Vertex& vertex)
+			{
+				return 0.0f < vertex.boneWeights.x + vertex.boneWeights.y + vertex.boneWeights.z + vertex.boneWeights.w;
+			});
+			cooked[i] = BuildLODs(mesh, 0 != skinned[i], settings);
+		}
+	});
+	JobSystems->Wait(handle);
+
+	uint32 lodCount = 0;
+	for (const auto& lods : cooked)
+	{
+		lodCount += static_cast<uint32>(lods.size());
+	}
+
+	std::vector<MeshRecord> meshRecords(meshCount);
+	std::vector<LodRecord> lodRecords;
+	lodRecords.reserve(lodCount);
+
+	const size_t tableSize = sizeof(BlobHeader) + sizeof(MeshRecord) * meshCount + sizeof(LodRecord) * lodCount;
+	std::vector<std::byte> blob(tableSize);
+
+	auto append = [&blob](const void* data, size_t size, size_t alignment) -> uint64
+	{
+		const size_t offset = (blob.size() + alignment - 1) / alignment * alignment;
+		blob.resize(offset + size);
+		if (0 < size)
+		{
+			std::memcpy(blob.data() + offset, data, size);
+		}
+		return offset;
+	};
+
+	for (uint32 i = 0; i < meshCount; ++i)
+	{
+		const Mesh& mesh = *meshes[i];
+		MeshRecord& record = meshRecords[i];
+		record.nameOffset = static_cast<uint32>(append(mesh.m_name.data(), mesh.m_name.size(), 1));
+		record.nameLength = static_cast<uint32>(mesh.m_name.size());
+		record.materialIndex = mesh.m_materialIndex;
+		record.flags = skinned[i] ? MeshFlagSkinned : 0u;
+		record.firstLod = static_cast<uint32>(lodRecords.size());
+		record.lodCount = static_cast<uint32>(cooked[i].size());
+		record.boundingBox = mesh.m_boundingBox;
+		record.boundingSphere = mesh.m_boundingSphere;
+	}
+
+	for (uint32 i = 0; i < meshCount; ++i)
+	{
+		for (const CookedLOD& lod : cooked[i])
+		{
+			LodRecord record{};
+			record.threshold = lod.threshold;
+			record.vertexCount = static_cast<uint32>(lod.vertices.size());
+			record.indexCount = static_cast<uint32>(lod.indices.size());
+			record.indexStride = lod.vertices.size() <= 0xFFFF ? sizeof(uint16) : sizeof(uint32);
+
+			std::vector<PackedVertex> packedVertices(lod.vertices.size());
+			std::transform(lod.vertices.begin(), lod.vertices.end(), packedVertices.begin(), PackVertex);
+			record.vertexOffset = append(packedVertices.data(), packedVertices.size() * sizeof(PackedVertex), StreamAlignment);
+
+			if (skinned[i])
+			{
+				std::vector<PackedSkin> packedSkins(lod.vertices.size());
+				std::transform(lod.vertices.begin(), lod.vertices.end(), packedSkins.begin(), PackSkin);
+				record.skinOffset = append(packedSkins.data(), packedSkins.size() * sizeof(PackedSkin), StreamAlignment);
+			}
+
+			if (sizeof(uint16) == record.indexStride)
+			{
+				std::vector<uint16> narrowIndices(lod.indices.begin(), lod.indices.end());
+				record.indexOffset = append(narrowIndices.data(), narrowIndices.size() * sizeof(uint16), StreamAlignment);
+			}
+			else
+			{
+				record.indexOffset = append(lod.indices.data(), lod.indices.size() * sizeof(uint32), StreamAlignment);
+			}
+
+			lodRecords.push_back(record);
+		}
+	}
+
+	const BlobHeader header{ MeshBlobMagic, MeshBlobVersion, meshCount, lodCount };
+	std::byte* table = blob.data();
+	std::memcpy(table, &header, sizeof(header));
+	table += sizeof(header);
+	if (0 < meshCount)
+	{
+		std::memcpy(table, meshRecords.data(), sizeof(MeshRecord) * meshCount);
+		table += sizeof(MeshRecord) * meshCount;
+	}
+	if (0 < lodCount)
+	{
+		std::memcpy(table, lodRecords.data(), sizeof(LodRecord) * lodCount);
+	}
+
+	return blob;
+}
+
+bool MeshCooker::Load(std::span<const std::byte> blob, std::vector<Mesh*>& outMeshes, bool releaseCPUData)
+{
+	BlobHeader header{};
+	if (!InRange(blob, 0, sizeof(header)))
+	{
+		return false;
+	}
+	std::memcpy(&header, blob.data(), sizeof(header));
+
+	const uint64 meshTableOffset = sizeof(BlobHeader);
+	const uint64 lodTableOffset = meshTableOffset + uint64(sizeof(MeshRecord)) * header.meshCount;
+	if (MeshBlobMagic != header.magic || MeshBlobVersion != header.version
+		|| !InRange(blob, lodTableOffset, uint64(sizeof(LodRecord)) * header.lodCount))
+	{
+		return false;
+	}
+
+	const size_t firstNewMesh = outMeshes.size();
+	auto fail = [&]()
+	{
+		for (size_t i = firstNewMesh; i < outMeshes.size(); ++i)
+		{
+			delete outMeshes[i];
+		}
+		outMeshes.resize(firstNewMesh);
+		return false;
+	};
+
+	outMeshes.reserve(outMeshes.size() + header.meshCount);
+	std::vector<Vertex> vertices;
+	std::vector<uint32> indices;
+	for (uint32 i = 0; i < header.meshCount; ++i)
+	{
+		MeshRecord record{};
+		std::memcpy(&record, blob.data() + meshTableOffset + sizeof(MeshRecord) * i, sizeof(record));
+		if (!InRange(blob, record.nameOffset, record.nameLength)
+			|| 0 == record.lodCount || uint64(record.firstLod) + record.lodCount > header.lodCount)
+		{
+			return fail();
+		}
+
+		auto* mesh = new Mesh();
+		outMeshes.push_back(mesh);
+		mesh->m_name.assign(reinterpret_cast<const char*>(blob.data() + record.nameOffset), record.nameLength);
+		mesh->m_materialIndex = record.materialIndex;
+		mesh->m_boundingBox = record.boundingBox;
+		mesh->m_boundingSphere = record.boundingSphere;
+
+		const bool isSkinned = 0 != (record.flags & MeshFlagSkinned);
+		for (uint32 l = 0; l < record.lodCount; ++l)
+		{
+			LodRecord lod{};
+			std::memcpy(&lod, blob.data() + lodTableOffset + sizeof(LodRecord) * (record.firstLod + l), sizeof(lod));
+			if ((sizeof(uint16) != lod.indexStride && sizeof(uint32) != lod.indexStride)
+				|| !InRange(blob, lod.vertexOffset, uint64(sizeof(PackedVertex)) * lod.vertexCount)
+				|| !InRange(blob, lod.indexOffset, uint64(lod.indexStride) * lod.indexCount)
+				|| (isSkinned && !InRange(blob, lod.skinOffset, uint64(sizeof(PackedSkin)) * lod.vertexCount)))
+			{
+				return fail();
+			}
+
+			vertices.assign(lod.vertexCount, Vertex{});
+			const std::byte* packedVertices = blob.data() + lod.vertexOffset;
+			for (uint32 v = 0; v < lod.vertexCount; ++v)
+			{
+				PackedVertex packed;
+				std::memcpy(&packed, packedVertices + sizeof(PackedVertex) * v, sizeof(packed));
+				UnpackVertex(packed, vertices[v]);
+			}
+
+			if (isSkinned)
+			{
+				const std::byte* packedSkins = blob.data() + lod.skinOffset;
+				for (uint32 v = 0; v < lod.vertexCount; ++v)
+				{
+					PackedSkin packed;
+					std::memcpy(&packed, packedSkins + sizeof(PackedSkin) * v, sizeof(packed));
+					UnpackSkin(packed, vertices[v]);
+				}
+			}
+
+			indices.resize(lod.indexCount);
+			const std::byte* indexData = blob.data() + lod.indexOffset;
+			if (sizeof(uint16) == lod.indexStride)
+			{
+				for (uint32 n = 0; n < lod.indexCount; ++n)
+				{
+					uint16 index;
+					std::memcpy(&index, indexData + sizeof(uint16) * n, sizeof(index));
+					indices[n] = index;
+				}
+			}
+			else if (0 < lod.indexCount)
+			{
+				std::memcpy(indices.data(), indexData, sizeof(uint32) * lod.indexCount);
+			}
+
+			if (0 == l)
+			{
+				mesh->m_vertices = std::move(vertices);
+				mesh->m_indices = std::move(indices);
+				mesh->AssetInit();
+				vertices.clear();
+				indices.clear();
+			}
+			else
+			{
+				mesh->AddCookedLOD(lod.threshold, vertices, indices);
+			}
+		}
+
+		if (releaseCPUData)
+		{
+			mesh->ReleaseCPUData();
+		}
+	}
+
+	return true;
+}
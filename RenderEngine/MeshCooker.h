@@ -0,0 +1,34 @@
+#pragma once
+#include "Mesh.h"
+#include <span>
+
+// 메쉬 쿠킹 설정
+struct MeshCookSettings
+{
+	// 스키닝하지 않는 메쉬에 미리 만들어 둘 LOD 임계값 (Mesh::GenerateLODs 에 같은 값이 오면 단순화 없이 쓴다)
+	std::vector<float> lodThresholds{ 0.5f, 0.25f, 0.1f };
+};
+
+// 여러 메쉬를 한 덩어리 블롭으로 굽고, 한 번 읽은 메모리에서 바로 메쉬를 만든다 (.asset 의 메쉬 구역)
+// - 버텍스는 위치 float3 + 옥타헤드럴 노멀/탄젠트(snorm16x2) + half UV 두 벌 = 28 바이트로 담는다.
+//   스키닝 메쉬만 본 스트림(uint16x4 인덱스 + unorm8x4 가중치)을 따로 둔다.
+// - 인덱스는 버텍스 캐시 순서로 정렬하고, 버텍스가 65536 개 미만이면 16비트로 담는다.
+// - 블롭 앞쪽 테이블의 오프셋으로 스트림을 찾으므로 파싱 없이 풀어서 바로 GPU 에 올린다.
+class MeshCooker
+{
+public:
+	static std::vector<std::byte> Cook(const std::vector<Mesh*>& meshes, const MeshCookSettings& settings);
+
+	// releaseCPUData 면 업로드 뒤 CPU 쪽 버텍스/인덱스 사본을 남기지 않는다
+	static bool Load(std::span<const std::byte> blob, std::vector<Mesh*>& outMeshes, bool releaseCPUData);
+
+private:
+	struct CookedLOD
+	{
+		float				threshold{ 1.0f };
+		std::vector<Vertex>	vertices;
+		std::vector<uint32>	indices;
+	};
+
+	static std::vector<CookedLOD> BuildLODs(const Mesh& mesh, bool isSkinned, const MeshCookSettings& settings);
+};
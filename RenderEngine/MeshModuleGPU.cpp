@@ -177,8 +177,7 @@ void MeshModuleGPU::Render(Mathf::Matrix world, Mathf::Matrix view, Mathf::Matri
     deviceContext->IASetIndexBuffer(indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 
     // 인스턴싱 렌더링
-    const auto& indices = currentMesh->GetIndices();
-    deviceContext->DrawIndexedInstanced(indices.size(), m_instanceCount, 0, 0, 0);
+    deviceContext->DrawIndexedInstanced(currentMesh->GetIndexCount(), m_instanceCount, 0, 0, 0);
 
     if (IsPolarClippingEnabled()) {
         ID3D11Buffer* nullBuffer[1] = { nullptr };
@@ -5,7 +5,6 @@
 #include "Material.h"
 #include "Camera.h" // [NEW] Camera 정의 포함
 #include "FoliageComponent.h"
-#include "Core.OctreeNode.h"
 #include "CullingManager.h"
 #include "Terrain.h"
 #include "DecalComponent.h"
@@ -20,8 +19,8 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(MeshRenderer* component) :
     m_Mesh(component->m_Mesh),
     m_LightMapping(component->m_LightMapping),
     m_isSkinnedMesh(component->m_isSkinnedMesh),
-    m_worldMatrix(component->GetOwner()->m_transform.GetWorldMatrix()),
-	m_worldPosition(component->GetOwner()->m_transform.GetWorldPosition())
+    m_worldMatrix(component->GetOwner()->m_transform.GetRenderWorldMatrix()),
+	m_worldPosition(component->GetOwner()->m_transform.GetRenderWorldPosition())
 {
     GameObject::Index animatorOwnerIndex = component->GetOwner()->m_parentIndex;
     while(animatorOwnerIndex != GameObject::INVALID_INDEX)
@@ -59,8 +58,8 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(TerrainComponent* component) :
     m_terrainMaterial(component->GetMaterial()),
     m_terrainMesh(component->GetMesh()),
     m_isSkinnedMesh(false),
-    m_worldMatrix(component->GetOwner()->m_transform.GetWorldMatrix()),
-    m_worldPosition(component->GetOwner()->m_transform.GetWorldPosition())
+    m_worldMatrix(component->GetOwner()->m_transform.GetRenderWorldMatrix()),
+    m_worldPosition(component->GetOwner()->m_transform.GetRenderWorldPosition())
 {
     GameObject* owner = component->GetOwner();
     if (owner)
@@ -113,10 +112,11 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(SpriteRenderer* component) :
 
 PrimitiveRenderProxy::PrimitiveRenderProxy(FoliageComponent* component) :
     m_isSkinnedMesh(false),
-	m_foliageInstances(component->GetFoliageInstances()),
 	m_foliageTypes(component->GetFoliageTypes()),
-    m_worldMatrix(component->GetOwner()->m_transform.GetWorldMatrix()),
-    m_worldPosition(component->GetOwner()->m_transform.GetWorldPosition())
+	m_foliageMatrices(component->GetInstanceMatrices()),
+	m_foliageVisibleIndices(component->GetVisibleInstances()),
+    m_worldMatrix(component->GetOwner()->m_transform.GetRenderWorldMatrix()),
+    m_worldPosition(component->GetOwner()->m_transform.GetRenderWorldPosition())
 {
     GameObject* owner = component->GetOwner();
     if (owner)
@@ -125,14 +125,6 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(FoliageComponent* component) :
         m_instancedID = component->GetInstanceID();
     }
     m_proxyType = PrimitiveProxyType::FoliageComponent;
-    for (auto& instance : m_foliageInstances)
-    {
-        uint32 key = instance.m_foliageTypeID;
-        if (!instance.m_isCulled)
-        {
-            instanceMap[key].push_back(&instance);
-        }
-    }
 }
 
 PrimitiveRenderProxy::~PrimitiveRenderProxy()
@@ -175,7 +167,8 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(const PrimitiveRenderProxy& other) :
     m_customPSO(other.m_customPSO),
     m_billboardType(other.m_billboardType),
     m_billboardAxis(other.m_billboardAxis),
-    m_foliageInstances(other.m_foliageInstances)
+    m_foliageMatrices(other.m_foliageMatrices),
+    m_foliageVisibleIndices(other.m_foliageVisibleIndices)
 {
 }
 
@@ -215,7 +208,8 @@ PrimitiveRenderProxy::PrimitiveRenderProxy(PrimitiveRenderProxy&& other) noexcep
     m_customPSO(std::move(other.m_customPSO)),
     m_billboardType(other.m_billboardType),
     m_billboardAxis(other.m_billboardAxis),
-    m_foliageInstances(std::move(other.m_foliageInstances))
+    m_foliageMatrices(std::move(other.m_foliageMatrices)),
+    m_foliageVisibleIndices(std::move(other.m_foliageVisibleIndices))
 {
 }
 
@@ -70,8 +70,6 @@ public:
 	void DrawShadow(ID3D11DeviceContext* _deferredContext);
 	void DrawInstanced(ID3D11DeviceContext* _deferredContext, size_t instanceCount);
 
-	friend bool SortByAnimationAndMaterialGuid(PrimitiveRenderProxy* a, PrimitiveRenderProxy* b);
-
 	void DestroyProxy();
 
 	void InitializeLODs(const std::vector<float>& lodScreenSpaceThresholds);
@@ -106,6 +104,19 @@ public:
 	bool							m_isInstanced{ false };
 	bool							m_EnableLOD{ false };
 
+	// 게임 스레드가 마지막으로 보낸 상태 (ProxyUpdateStream 변경 감지용, 렌더 스레드는 사용하지 않음)
+	struct SubmittedState
+	{
+		Material*					material{ nullptr };
+		Mathf::xMatrix*				palette{ nullptr };
+		uint32						worldVersion{};
+		uint32						stateBits{};
+		uint32						bitflag{};
+		int							lightmapIndex{ -1 };
+		bool						isValid{ false };
+	};
+	SubmittedState					m_submitted{};
+
 public:
 	//terrain type
 	std::shared_ptr<TerrainMesh>	m_terrainMesh{ nullptr };
@@ -115,9 +126,10 @@ public:
 
 public:
 	//foliage type
-	std::vector<FoliageInstance>	m_foliageInstances{};
 	std::vector<FoliageType>		m_foliageTypes{};
-	std::unordered_map<uint32, std::vector<FoliageInstance*>> instanceMap;
+	// 편집할 때만 다시 만드는 인스턴스 행렬 (컴포넌트와 공유) + 타입별 보이는 인스턴스 인덱스
+	std::shared_ptr<const std::vector<Mathf::xMatrix>> m_foliageMatrices{};
+	std::vector<std::vector<uint32>> m_foliageVisibleIndices{};
 
 public:
 	//decal type
@@ -142,12 +154,4 @@ private:
 	bool							m_isNeedUpdateCulling{ false };
 };
 
-inline bool SortByAnimationAndMaterialGuid(PrimitiveRenderProxy* a, PrimitiveRenderProxy* b)
-{
-	if (a->m_animatorGuid == b->m_animatorGuid)
-	{
-		return a->m_materialGuid < b->m_materialGuid;
-	}
-	return a->m_animatorGuid < b->m_animatorGuid;
-}
 #endif // !DYNAMICCPP_EXPORTS
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Material.h"
 #include "Texture.h"
 #include "SceneManager.h"
+#include "Core.PakFileSystem.h"
 #include <assimp/Exporter.hpp>
 
 namespace anim
@@ -14,6 +15,21 @@ namespace anim
 	constexpr uint32_t empty = 0;
 }
 
+namespace
+{
+	// pak 에 있으면 풀어 둔 메모리에서, 없으면 디스크 경로로 읽는다
+	const aiScene* ReadAssimpScene(Assimp::Importer& importer, const file::path& path, flag settings)
+	{
+		std::vector<std::byte> bytes;
+		if (PakFileSystems->Contains(path) && PakFileSystems->Read(path, bytes))
+		{
+			const std::string hint = path.extension().string().substr(1);
+			return importer.ReadFileFromMemory(bytes.data(), bytes.size(), settings, hint.c_str());
+		}
+		return importer.ReadFile(path.string(), settings);
+	}
+}
+
 Model::Model()
 {
 }
@@ -48,7 +64,7 @@ Model* Model::LoadModel(std::string_view filePath)
 	{
 		file::path assetPath = filePath.data();
 		assetPath = assetPath.replace_extension(".asset");
-		if (file::exists(assetPath))
+		if (PakFileSystems->Exists(assetPath))
 		{
 			Benchmark asset;
 			ModelLoader loader = ModelLoader(nullptr, assetPath.string());
@@ -73,9 +89,10 @@ Model* Model::LoadModel(std::string_view filePath)
 			bool isCreateMeshCollider{ false };
 
 			file::path metaPath = path_.string() + ".meta";
-			if (file::exists(metaPath))
+			if (PakFileSystems->Exists(metaPath))
 			{
-				auto node = MetaYml::LoadFile(metaPath.string());
+				AssetStream metaFile(metaPath);
+				auto node = MetaYml::Load(metaFile);
 				if (node["ModelImporter"])
 				{
 					const MetaYml::Node& modelImporterNode = node["ModelImporter"];
@@ -109,7 +126,7 @@ Model* Model::LoadModel(std::string_view filePath)
 			importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, false);
 			importer.SetPropertyInteger(AI_CONFIG_PP_LBW_MAX_WEIGHTS, 4);
 
-			const aiScene* assimpScene = importer.ReadFile(filePath.data(), settings);
+			const aiScene* assimpScene = ReadAssimpScene(importer, path_, settings);
 			if (nullptr == assimpScene)
 			{
 				throw std::exception("ModelLoader::Model file not found");
@@ -146,7 +163,7 @@ Managed::SharedPtr<Model> Model::LoadModelShared(std::string_view filePath)
 	{
 		file::path assetPath = filePath.data();
 		assetPath = assetPath.replace_extension(".asset");
-		if (file::exists(assetPath))
+		if (PakFileSystems->Exists(assetPath))
 		{
 			//Benchmark asset;
 			ModelLoader loader = ModelLoader(nullptr, assetPath.string());
@@ -171,9 +188,10 @@ Managed::SharedPtr<Model> Model::LoadModelShared(std::string_view filePath)
 			bool isCreateMeshCollider{ false };
 
 			file::path metaPath = path_.string() + ".meta";
-			if (file::exists(metaPath))
+			if (PakFileSystems->Exists(metaPath))
 			{
-				auto node = MetaYml::LoadFile(metaPath.string());
+				AssetStream metaFile(metaPath);
+				auto node = MetaYml::Load(metaFile);
 				if (node["ModelImporter"])
 				{
 					const MetaYml::Node& modelImporterNode = node["ModelImporter"];
@@ -207,7 +225,7 @@ Managed::SharedPtr<Model> Model::LoadModelShared(std::string_view filePath)
 			importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, false);
 			importer.SetPropertyInteger(AI_CONFIG_PP_LBW_MAX_WEIGHTS, 4);
 
-			const aiScene* assimpScene = importer.ReadFile(filePath.data(), settings);
+			const aiScene* assimpScene = ReadAssimpScene(importer, path_, settings);
 			if (nullptr == assimpScene)
 			{
 				throw std::exception("ModelLoader::Model file not found");
@@ -317,7 +335,7 @@ Model* Model::LoadModelToScene(Model* model, Scene& Scene)
 		loader.GenerateSkeletonToSceneObjectHierarchy(model->m_nodes[0], model->m_Skeleton->m_rootBone, true, 0);
 	}
 
-	SceneManagers->m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(loader.m_componentJobs);
 
 	return model;
 }
@@ -338,7 +356,7 @@ GameObject* Model::LoadModelToSceneObj(Model* model, Scene& Scene)
 		rootObj = loader.GenerateSkeletonToSceneObjectHierarchyObj(model->m_nodes[0], model->m_Skeleton->m_rootBone, true, 0);
 	}
 
-	SceneManagers->m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(loader.m_componentJobs);
 
 	return rootObj;
 }
\ No newline at end of file
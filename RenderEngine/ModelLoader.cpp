@@ -5,10 +5,12 @@
 #include "assimp/material.h"
 #include "assimp/Gltfmaterial.h"
 #include "ReflectionYml.h"
+#include "Core.PakFileSystem.h"
 #include "SceneManager.h"
 #include "meshoptimizer.h"
 #include "RigidBodyComponent.h"
 #include "MeshCollider.h"
+#include "MeshCooker.h"
 
 #include <algorithm>
 #include <execution>
@@ -62,7 +64,9 @@ ModelLoader::ModelLoader(const aiScene* assimpScene, std::string_view fileName)
 	{
 		m_model->loadType = ModelLoadType::FormAsset;
 	}
-	m_model->lastWriteTime = file::last_write_time(filepath);
+	// pak 에서 읽는 경우 디스크에 파일이 없으므로 예외 없이 넘긴다
+	std::error_code ec;
+	m_model->lastWriteTime = file::last_write_time(filepath, ec);
 
 	m_fileGuid = DataSystems->GetStemToGuid(filepath.stem().string());
 	m_model->guid = m_fileGuid;
@@ -263,7 +267,8 @@ Material* ModelLoader::GenerateMaterial(int index)
         baseName = "DefaultMaterial";
     }
 
-	MetaYml::Node modelFileNode = MetaYml::LoadFile(m_metaDirectory);
+	AssetStream metaFile(m_metaDirectory);
+	MetaYml::Node modelFileNode = MetaYml::Load(metaFile);
 	m_fileGuid = modelFileNode["guid"].as<std::string>();
     std::string uniqueName = baseName;
     int suffix = 1;
@@ -405,6 +410,8 @@ void ModelLoader::ParseModel()
     uint32_t meshCount   = static_cast<uint32_t>(m_model->m_Meshes.size());
     uint32_t materialCnt = static_cast<uint32_t>(m_model->m_Materials.size());
 
+    file.write(reinterpret_cast<const char*>(&AssetMagic), sizeof(AssetMagic));
+    file.write(reinterpret_cast<const char*>(&AssetVersion), sizeof(AssetVersion));
     file.write(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
     file.write(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
     file.write(reinterpret_cast<char*>(&materialCnt), sizeof(materialCnt));
@@ -446,25 +453,36 @@ void ModelLoader::ParseNode(std::ofstream& outfile, const ModelNode* node)
 
 void ModelLoader::ParseMeshes(std::ofstream& outfile)
 {
-    for (const Mesh* mesh : m_model->m_Meshes)
-    {
-        uint32_t nameSize = static_cast<uint32_t>(mesh->m_name.size());
-        outfile.write(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
-        outfile.write(mesh->m_name.data(), nameSize);
-        outfile.write(reinterpret_cast<const char*>(&mesh->m_materialIndex), sizeof(mesh->m_materialIndex));
+    // 패킹된 버텍스 + 미리 만든 LOD 를 한 블롭으로 굽는다
+    std::vector<std::byte> blob = MeshCooker::Cook(m_model->m_Meshes, MeshCookSettings{});
+    uint64_t blobSize = blob.size();
+    outfile.write(reinterpret_cast<char*>(&blobSize), sizeof(blobSize));
+    outfile.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+}
 
-        uint32_t vertexCount = static_cast<uint32_t>(mesh->m_vertices.size());
-        outfile.write(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
-        if (vertexCount)
-            outfile.write(reinterpret_cast<const char*>(mesh->m_vertices.data()), vertexCount * sizeof(Vertex));
+void ModelLoader::LoadCookedMesh(AssetStream& infile, uint64_t blobSize)
+{
+    const bool releaseCPUData = EngineSettingInstance->IsReleaseMeshCPUData();
 
-        uint32_t indexCount = static_cast<uint32_t>(mesh->m_indices.size());
-        outfile.write(reinterpret_cast<char*>(&indexCount), sizeof(indexCount));
-        if (indexCount)
-            outfile.write(reinterpret_cast<const char*>(mesh->m_indices.data()), indexCount * sizeof(uint32_t));
+    // pak 에서 열었으면 풀어 둔 메모리를 그대로 쓰고, 디스크면 블롭을 한 번에 읽는다
+    std::span<const std::byte> bytes = infile.Bytes();
+    const auto offset = static_cast<uint64_t>(infile.tellg());
+    bool isLoaded{ false };
+    if (!bytes.empty() && offset <= bytes.size() && blobSize <= bytes.size() - offset)
+    {
+        isLoaded = MeshCooker::Load(bytes.subspan(offset, blobSize), m_model->m_Meshes, releaseCPUData);
+        infile.seekg(offset + blobSize);
+    }
+    else
+    {
+        std::vector<std::byte> blob(blobSize);
+        infile.read(reinterpret_cast<char*>(blob.data()), blobSize);
+        isLoaded = infile && MeshCooker::Load(blob, m_model->m_Meshes, releaseCPUData);
+    }
 
-        outfile.write(reinterpret_cast<const char*>(&mesh->m_boundingBox), sizeof(DirectX::BoundingBox));
-        outfile.write(reinterpret_cast<const char*>(&mesh->m_boundingSphere), sizeof(DirectX::BoundingSphere));
+    if (!isLoaded)
+    {
+        Debug->LogWarning("ModelLoader::LoadCookedMesh : broken mesh blob in " + m_model->name + ".asset");
     }
 }
 
@@ -590,25 +608,47 @@ void ModelLoader::ParseSkeleton(std::ofstream& outfile)
 void ModelLoader::LoadModelFromAsset()
 {
     file::path filepath = PathFinder::Relative("Models\\") / (m_model->name + ".asset");
-    std::ifstream file(filepath, std::ios::binary);
+    AssetStream file(filepath, std::ios::binary);
     if (!file)
         return;
 
+    uint32_t magic{};
+    uint32_t version{};
     uint32_t nodeCount{};
     uint32_t meshCount{};
     uint32_t materialCount{};
 
-    file.read(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
+    // 이전 형식은 식별자 없이 nodeCount 로 시작한다
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    const bool isCooked = AssetMagic == magic;
+    if (isCooked)
+    {
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
+    }
+    else
+    {
+        nodeCount = magic;
+    }
     file.read(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
     file.read(reinterpret_cast<char*>(&materialCount), sizeof(materialCount));
 
     LoadSkeleton(file);
     LoadNodes(file, nodeCount);
-    LoadMesh(file, meshCount);
+    if (isCooked)
+    {
+        uint64_t blobSize{};
+        file.read(reinterpret_cast<char*>(&blobSize), sizeof(blobSize));
+        LoadCookedMesh(file, blobSize);
+    }
+    else
+    {
+        LoadMesh(file, meshCount);
+    }
     LoadMaterial(file, materialCount);
 }
 
-void ModelLoader::LoadNodes(std::ifstream& infile, uint32_t size)
+void ModelLoader::LoadNodes(std::istream& infile, uint32_t size)
 {
     m_model->m_nodes.reserve(size);
     for (uint32_t i = 0; i < size; ++i)
@@ -619,7 +659,7 @@ void ModelLoader::LoadNodes(std::ifstream& infile, uint32_t size)
     }
 }
 
-void ModelLoader::LoadNode(std::ifstream& infile, ModelNode*& node)
+void ModelLoader::LoadNode(std::istream& infile, ModelNode*& node)
 {
     uint32_t nameSize{};
     infile.read(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
@@ -647,7 +687,7 @@ void ModelLoader::LoadNode(std::ifstream& infile, ModelNode*& node)
     }
 }
 
-void ModelLoader::LoadMesh(std::ifstream& infile, uint32_t size)
+void ModelLoader::LoadMesh(std::istream& infile, uint32_t size)
 {
     //Benchmark asset;
     m_model->m_Meshes.reserve(size);
@@ -685,7 +725,7 @@ void ModelLoader::LoadMesh(std::ifstream& infile, uint32_t size)
     //std::cout << "LoadMesh base : " << asset.GetElapsedTime() << std::endl;
 }
 
-void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
+void ModelLoader::LoadMaterial(std::istream& infile, uint32_t size)
 {
     //Benchmark asset;
     double stringTime{};
@@ -764,16 +804,15 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
         //        mat->UseEmissiveMap(tex);
         //}
 
-        std::vector<std::future<void>> futs;
-        futs.reserve(5);
+        JobHandle textureGroup = JobSystems->CreateGroup();
 
-        futs.emplace_back(std::async(std::launch::async, [mat, this] {
+        JobSystems->Schedule(textureGroup, [mat, this] {
             if (mat->m_materialInfo.m_useBaseColor)
                 if (Texture* t = GenerateTexture(mat->m_baseColorTexName))
                     mat->UseBaseColorMap(t);
-        }));
+        });
 
-        futs.emplace_back(std::async(std::launch::async, [mat, this] {
+        JobSystems->Schedule(textureGroup, [mat, this] {
             if (mat->m_materialInfo.m_useNormalMap)
             {
                 if (Texture* t = GenerateTexture(mat->m_normalTexName))
@@ -781,9 +820,9 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
                     mat->UseNormalMap(t);
                 }
             }
-        }));
+        });
 
-        futs.emplace_back(std::async(std::launch::async, [mat, this] 
+        JobSystems->Schedule(textureGroup, [mat, this] 
         {
             if (mat->m_materialInfo.m_useOccRoughMetal)
             {
@@ -792,9 +831,9 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
                     mat->UseOccRoughMetalMap(t);
                 }
             }
-        }));
+        });
 
-        futs.emplace_back(std::async(std::launch::async, [mat, this] {
+        JobSystems->Schedule(textureGroup, [mat, this] {
             if (mat->m_materialInfo.m_useAOMap)
             {
                 if (Texture* t = GenerateTexture(mat->m_AO_TexName))
@@ -802,9 +841,9 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
                     mat->UseAOMap(t);
                 }
             }
-        }));
+        });
 
-        futs.emplace_back(std::async(std::launch::async, [mat, this] {
+        JobSystems->Schedule(textureGroup, [mat, this] {
             if (mat->m_materialInfo.m_useEmissive)
             {
                 if (Texture* t = GenerateTexture(mat->m_EmissiveTexName))
@@ -812,9 +851,9 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
                     mat->UseEmissiveMap(t);
                 }
             }
-        }));
+        });
 
-        for (auto& f : futs) f.get();
+        JobSystems->Wait(textureGroup);
 
         stringTime = sasset.GetElapsedTime();
 
@@ -828,7 +867,7 @@ void ModelLoader::LoadMaterial(std::ifstream& infile, uint32_t size)
     //std::cout << "LoadMaterial base : " << asset.GetElapsedTime() << std::endl;
 }
 
-void ModelLoader::LoadSkeleton(std::ifstream& infile)
+void ModelLoader::LoadSkeleton(std::istream& infile)
 {
     //Benchmark asset;
     bool hasSkeleton{};
@@ -950,6 +989,8 @@ void ModelLoader::LoadSkeleton(std::ifstream& infile)
         skeleton->m_animations.push_back(std::move(anim));
     }
 
+    skeleton->BakeAnimations();
+
 	boost::uuids::uuid guid;
 	infile.read(reinterpret_cast<char*>(&guid), sizeof(boost::uuids::uuid));
 
@@ -1052,7 +1093,7 @@ void ModelLoader::GenerateSceneObjectHierarchy(ModelNode* node, bool isRoot, int
 		Mathf::Matrix transform = node->m_transform;
 		Model* model = m_model;
 
-		SceneManagers->m_threadPool->Enqueue([=]
+		JobSystems->Schedule(m_componentJobs, [=]
 		{
 			MeshRenderer* meshRenderer = object->AddComponent<MeshRenderer>();
 
@@ -1190,7 +1231,7 @@ GameObject* ModelLoader::GenerateSceneObjectHierarchyObj(ModelNode* node, bool i
 
 		Mathf::Matrix transform = node->m_transform;
 
-		SceneManagers->m_threadPool->Enqueue([=]
+		JobSystems->Schedule(m_componentJobs, [=]
 		{
 			MeshRenderer* meshRenderer = object->AddComponent<MeshRenderer>();
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "../Utility_Framework/Core.Minimal.h"
+#include "../Utility_Framework/Core.JobSystem.h"
 #include "Mesh.h"
 #include "Texture.h"
 #include "Model.h"
@@ -37,6 +38,10 @@ private:
 	void ProcessMaterials();
 	Material* GenerateMaterial(int index = -1);
 
+	// .asset 앞에 붙는 식별자 (없으면 메쉬를 Vertex 배열 그대로 담던 이전 형식)
+	static constexpr uint32_t AssetMagic = 0x324C444D; // "MDL2"
+	static constexpr uint32_t AssetVersion = 1;
+
 	//Save To InHouse Format
 	void ParseModel();
 	void ParseNodes(std::ofstream& outfile);
@@ -46,11 +51,12 @@ private:
     void ParseSkeleton(std::ofstream& outfile);
 
     void LoadModelFromAsset();
-    void LoadNodes(std::ifstream& infile, uint32_t size);
-    void LoadNode(std::ifstream& infile, ModelNode*& node);
-    void LoadMesh(std::ifstream& infile, uint32_t size);
-    void LoadMaterial(std::ifstream& infile, uint32_t size);
-    void LoadSkeleton(std::ifstream& infile);
+    void LoadNodes(std::istream& infile, uint32_t size);
+    void LoadNode(std::istream& infile, ModelNode*& node);
+    void LoadMesh(std::istream& infile, uint32_t size);
+    void LoadCookedMesh(AssetStream& infile, uint64_t blobSize);
+    void LoadMaterial(std::istream& infile, uint32_t size);
+    void LoadSkeleton(std::istream& infile);
 
 	Model* LoadModel(bool isCreateMeshCollider = false);
 	void GenerateSceneObjectHierarchy(ModelNode* node, bool isRoot, int parentIndex);
@@ -75,6 +81,9 @@ private:
 	SkeletonLoader m_skeletonLoader;
 	std::mutex m_modelMutex;
 
+	// 계층 생성 중 예약한 컴포넌트 추가 작업 (Model::LoadModelToScene 에서 기다린다)
+	JobHandle m_componentJobs{ JobSystems->CreateGroup() };
+
 	std::vector<std::shared_ptr<GameObject>> m_gameObjects{};
 	std::vector<std::string> m_cashedObjectName{};
 
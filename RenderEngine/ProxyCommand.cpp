@@ -13,112 +13,6 @@
 #include "ShaderSystem.h"
 #include <execution>
 
-constexpr size_t TRANSFORM_SIZE = sizeof(Mathf::xMatrix) * MAX_BONES;
-
-ProxyCommand::ProxyCommand(MeshRenderer* pComponent) :
-	m_proxyGUID(pComponent->GetInstanceID())
-{
-	auto renderScene				= SceneManagers->GetRenderScene();
-	auto componentPtr				= pComponent;
-	auto owner						= componentPtr->GetOwner();
-	bool isStatic					= owner->IsStatic();
-	bool isEnabled					= owner->IsEnabled();
-	bool isShadowCast				= pComponent->m_shadowCast;
-	bool isShadowRecive				= pComponent->m_shadowRecive;
-	Mathf::xMatrix worldMatrix		= owner->m_transform.GetWorldMatrix();
-	Mathf::Vector3 worldPosition	= owner->m_transform.GetWorldPosition();
-	Material* originMat				= pComponent->m_Material;
-
-	if (!owner || owner->IsDestroyMark() || pComponent->IsDestroyMark()) return;
-
-	if (nullptr == originMat) 
-	{
-		m_updateFunction = [=]
-		{
-			// If the material is null, we do not need to update anything.
-		};
-		return;
-	}
-
-	auto& proxyObject				= renderScene->m_proxyMap[m_proxyGUID];
-	HashedGuid aniGuid				= proxyObject->m_animatorGuid;
-	HashedGuid matGuid				= proxyObject->m_materialGuid;
-	HashedGuid originMatGuid		= pComponent->m_Material->m_materialGuid;
-	bool isEnableLOD				= pComponent->m_isEnableLOD;
-	uint32 bitflag					= pComponent->m_bitflag;
-
-	Mathf::xMatrix* palletePtr{ nullptr };
-	bool isAnimationUpdate{ false };
-	bool isMatChange{ false };
-
-	if (matGuid != originMatGuid && originMat)
-	{
-		isMatChange = true;
-	}
-
-	if (renderScene->m_animatorMap.find(aniGuid) != renderScene->m_animatorMap.end()
-		&& proxyObject->IsSkinnedMesh())
-	{
-		palletePtr = renderScene->m_palleteMap[aniGuid].second;
-		if (!proxyObject->m_finalTransforms)
-		{
-			proxyObject->m_finalTransforms = palletePtr;
-		}
-
-		if (false == renderScene->m_palleteMap[aniGuid].first)
-		{
-			auto* srcPalete = &renderScene->m_animatorMap[aniGuid]->m_FinalTransforms;
-
-			memcpy(palletePtr, srcPalete, TRANSFORM_SIZE);
-		}
-
-		renderScene->m_palleteMap[aniGuid].first = true;
-		isAnimationUpdate = true;
-	}
-
-	constexpr int INVAILD_INDEX = -1;
-
-	bool isLightMappingUpdatable{ false };
-	LightMapping copyLightMapping{};
-	int& lightMapIndex = pComponent->m_LightMapping.lightmapIndex;
-	int& proxyLightMapIndex = proxyObject->m_LightMapping.lightmapIndex;
-
-	if (INVAILD_INDEX != lightMapIndex && proxyLightMapIndex != lightMapIndex)
-	{
-		copyLightMapping = pComponent->m_LightMapping;
-		isLightMappingUpdatable = true;
-	}
-
-	m_updateFunction = [=]
-	{
-		if(isAnimationUpdate && palletePtr)
-		{
-			proxyObject->m_finalTransforms = palletePtr;
-		}
-
-		proxyObject->m_worldMatrix		= worldMatrix;
-		proxyObject->m_worldPosition	= worldPosition;
-		proxyObject->m_isStatic			= isStatic;
-		proxyObject->m_isEnableShadow	= isEnabled;
-		proxyObject->m_isShadowCast		= isShadowCast;
-		proxyObject->m_isShadowRecive	= isShadowRecive;
-		proxyObject->m_EnableLOD		= isEnableLOD;
-		proxyObject->m_bitflag			= bitflag;
-
-		if(isLightMappingUpdatable)
-		{
-			proxyObject->m_LightMapping = copyLightMapping;
-		}
-
-		if (isMatChange)
-		{
-			proxyObject->m_Material = originMat;
-			proxyObject->m_materialGuid = originMatGuid;
-		}
-		//proxyObject->m_Material->UpdateCBufferView();
-	};
-}
-
 ProxyCommand::ProxyCommand(SpriteRenderer* pComponent)
 {
 	m_proxyGUID = pComponent->GetInstanceID();
@@ -127,8 +21,8 @@ ProxyCommand::ProxyCommand(SpriteRenderer* pComponent)
 	auto owner = componentPtr->GetOwner();
 	bool isStatic = owner->IsStatic();
 	bool isEnabled = owner->IsEnabled();
-	Mathf::xMatrix worldMatrix = owner->m_transform.GetWorldMatrix();
-	Mathf::Vector3 worldPosition = owner->m_transform.GetWorldPosition();
+	Mathf::xMatrix worldMatrix = owner->m_transform.GetRenderWorldMatrix();
+	Mathf::Vector3 worldPosition = owner->m_transform.GetRenderWorldPosition();
     std::string customPSOName = componentPtr->GetCustomPSOName();
     BillboardType billboardType = componentPtr->GetBillboardType();
     auto billboardAxis = componentPtr->GetBillboardAxis();
@@ -202,23 +96,18 @@ ProxyCommand::ProxyCommand(FoliageComponent* pComponent) :
 	auto& proxyObject = renderScene->m_proxyMap[m_proxyGUID];
 	if (!proxyObject) return;
 
+	// 행렬은 편집 때만 바뀌므로 공유 포인터로 넘기고, 매 프레임은 보이는 인덱스만 복사한다
 	std::vector<FoliageType> foliageTypes = pComponent->GetFoliageTypes();
-	std::vector<FoliageInstance> foliageInstances = pComponent->GetFoliageInstances();
+	auto foliageMatrices = pComponent->GetInstanceMatrices();
+	std::vector<std::vector<uint32>> visibleIndices = pComponent->GetVisibleInstances();
 
 	m_updateFunction = [=]()
 	{
 		proxyObject->m_foliageTypes = foliageTypes;
-		proxyObject->m_foliageInstances = foliageInstances;
+		proxyObject->m_foliageMatrices = foliageMatrices;
+		proxyObject->m_foliageVisibleIndices = visibleIndices;
 		proxyObject->m_worldMatrix = worldMatrix;
 		proxyObject->m_worldPosition = worldPosition;
-
-		proxyObject->instanceMap.clear();
-
-		for (auto& inst : proxyObject->m_foliageInstances)
-		{
-			if (inst.m_isCulled) continue;
-			proxyObject->instanceMap[inst.m_foliageTypeID].push_back(&inst);
-		}
 	};
 }
 
@@ -228,7 +117,7 @@ ProxyCommand::ProxyCommand(DecalComponent* pComponent):
 	auto renderScene = SceneManagers->GetRenderScene();
 	auto owner = pComponent->GetOwner();
 	if (!owner || owner->IsDestroyMark() || pComponent->IsDestroyMark()) return;
-	Mathf::xMatrix worldMatrix = owner->m_transform.GetWorldMatrix();
+	Mathf::xMatrix worldMatrix = owner->m_transform.GetRenderWorldMatrix();
 	auto& proxyObject = renderScene->m_proxyMap[m_proxyGUID];
 
 	if (!proxyObject) return;
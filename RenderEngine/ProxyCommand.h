@@ -17,7 +17,6 @@ public:
     ProxyCommand() = default;
     ~ProxyCommand() = default;
 
-    ProxyCommand(MeshRenderer* pComponent);
 	ProxyCommand(TerrainComponent* pComponent);
     ProxyCommand(FoliageComponent* pComponent);
 	ProxyCommand(ImageComponent* pComponent);
@@ -38,16 +38,20 @@ public:
 			}
 		}*/
 
-		const auto frameIndex = m_frame.load(std::memory_order_relaxed);
-		const std::array<size_t, 3> queueOrder{
-				(frameIndex + 1) % m_proxyFrameCommands.size(),
-				frameIndex % m_proxyFrameCommands.size(),
-				(frameIndex + 2) % m_proxyFrameCommands.size()
-		};
+		ExecuteThrough(m_frame.load(std::memory_order_relaxed));
+	}
+
+	// Drains the queued frames up to and including lastFrame, oldest first.
+	// ProxyUpdateStream calls this before applying the update records published for lastFrame.
+	void ExecuteThrough(uint64_t lastFrame)
+	{
+		const uint64_t currFrame = m_frame.load(std::memory_order_relaxed);
+		const uint64_t queueCount = m_proxyFrameCommands.size();
+		const uint64_t oldestFrame = currFrame >= queueCount - 1 ? currFrame - (queueCount - 1) : 0;
 
-		for (const size_t queueIndex : queueOrder)
+		for (uint64_t frame = oldestFrame; frame <= lastFrame && frame <= currFrame; ++frame)
 		{
-			DrainQueue(m_proxyFrameCommands[queueIndex]);
+			DrainQueue(m_proxyFrameCommands[frame % queueCount]);
 		}
 	}
 
@@ -57,9 +61,10 @@ public:
 		m_proxyFrameCommands[currFrame].push(std::move(proxyCommand));
 	}
 
-	void AddFrame()
+	// Returns the frame that was just closed (pass it to ProxyUpdateStream->PublishFrame)
+	uint64_t AddFrame()
 	{
-		m_frame.fetch_add(1, std::memory_order_relaxed);
+		return m_frame.fetch_add(1, std::memory_order_relaxed);
 	}
 
 private:
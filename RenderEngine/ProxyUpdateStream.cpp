@@ -0,0 +1,209 @@
+#include "ProxyUpdateStream.h"
+#include "MeshRendererProxy.h"
+#include "ProxyCommandQueue.h"
+
+namespace
+{
+	constexpr uint32 InvalidLane = 0xFFFFFFFF;
+	thread_local uint32 t_proxyLane = InvalidLane;
+}
+
+size_t ProxyUpdateStreamController::Frame::RecordCount() const
+{
+	size_t count{};
+	for (const Lane& lane : lanes)
+	{
+		count += lane.records.size();
+	}
+	return count;
+}
+
+void ProxyUpdateStreamController::Frame::Clear()
+{
+	// clear 는 용량을 유지한다
+	for (Lane& lane : lanes)
+	{
+		lane.records.clear();
+		lane.owners.clear();
+	}
+}
+
+ProxyUpdateStreamController::ProxyUpdateStreamController()
+{
+	m_frames.reserve(MaxFrames);
+	m_freeFrames.reserve(MaxFrames);
+
+	// 기록 중 / 적용 중 / 대기 1 프레임은 미리 만들어 둔다
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		m_frames.push_back(std::make_unique<Frame>());
+		m_freeFrames.push_back(m_frames.back().get());
+	}
+
+	m_writeFrame = m_freeFrames.back();
+	m_freeFrames.pop_back();
+}
+
+void ProxyUpdateStreamController::Push(const MeshProxyUpdate& update, const std::shared_ptr<PrimitiveRenderProxy>& owner)
+{
+	if (t_proxyLane == InvalidLane)
+	{
+		t_proxyLane = (std::min)(m_nextLane.fetch_add(1, std::memory_order_relaxed), MaxLanes);
+	}
+
+	auto write = [this, &update, &owner](Lane& lane)
+	{
+		const size_t recordCapacity = lane.records.capacity();
+		const size_t ownerCapacity = lane.owners.capacity();
+
+		lane.records.push_back(update);
+		lane.owners.push_back(owner);
+
+		if (recordCapacity != lane.records.capacity() || ownerCapacity != lane.owners.capacity())
+		{
+			CountAllocated((lane.records.capacity() - recordCapacity) * sizeof(MeshProxyUpdate) +
+				(lane.owners.capacity() - ownerCapacity) * sizeof(std::shared_ptr<PrimitiveRenderProxy>));
+		}
+	};
+
+	Frame& frame = *m_writeFrame;
+	if (t_proxyLane < MaxLanes)
+	{
+		write(frame.lanes[t_proxyLane]);
+	}
+	else
+	{
+		SpinLock lock(frame.overflowFlag);
+		write(frame.lanes[MaxLanes]);
+	}
+}
+
+void ProxyUpdateStreamController::PublishFrame(uint64 commandFrame)
+{
+	const size_t recordCount = m_writeFrame->RecordCount();
+	{
+		SpinLock lock(m_queueFlag);
+		// 발행하지 못해 다음 프레임과 이어 붙는 경우에도 마지막 프레임 번호를 따른다
+		m_writeFrame->commandFrame = commandFrame;
+		// 렌더가 밀려 대기열이 가득 차면 발행하지 않고 다음 프레임 기록을 같은 버퍼 뒤에 이어 붙인다 (적용 순서 유지)
+		if (0 < recordCount && m_pendingCount < MaxPendingFrames)
+		{
+			m_pending[(m_pendingHead + m_pendingCount) % MaxPendingFrames] = m_writeFrame;
+			++m_pendingCount;
+			m_writeFrame = AcquireFrame();
+		}
+	}
+
+	Stats stats{};
+	stats.records = recordCount;
+	stats.skipped = m_frameSkipped.exchange(0, std::memory_order_relaxed);
+	stats.allocatedBytes = m_frameAllocatedBytes.exchange(0, std::memory_order_relaxed);
+
+	SpinLock statsLock(m_statsFlag);
+	m_lastStats = stats;
+}
+
+void ProxyUpdateStreamController::Execute()
+{
+	while (Frame* frame = PopPending())
+	{
+		// 같은 프레임에 만들어진 프록시가 먼저 있어야 하므로 명령을 먼저 비운다
+		ProxyCommandQueue->ExecuteThrough(frame->commandFrame);
+
+		for (const Lane& lane : frame->lanes)
+		{
+			for (const MeshProxyUpdate& update : lane.records)
+			{
+				Apply(update);
+			}
+		}
+
+		frame->Clear();
+
+		SpinLock lock(m_queueFlag);
+		m_freeFrames.push_back(frame);
+	}
+
+	// 갱신 레코드가 없던 프레임과 기록 중인 프레임의 명령
+	ProxyCommandQueue->Execute();
+}
+
+ProxyUpdateStreamController::Stats ProxyUpdateStreamController::GetLastFrameStats() const
+{
+	SpinLock lock(m_statsFlag);
+	return m_lastStats;
+}
+
+void ProxyUpdateStreamController::Apply(const MeshProxyUpdate& update)
+{
+	PrimitiveRenderProxy* proxy = update.proxy;
+	const uint32 mask = update.fieldMask;
+
+	if (mask & PROXY_UPDATE_PALETTE)
+	{
+		proxy->m_finalTransforms = update.palette;
+	}
+
+	if (mask & PROXY_UPDATE_TRANSFORM)
+	{
+		proxy->m_worldMatrix = update.worldMatrix;
+		proxy->m_worldPosition = update.worldPosition;
+	}
+
+	if (mask & PROXY_UPDATE_STATE)
+	{
+		proxy->m_isStatic = update.isStatic;
+		proxy->m_isEnableShadow = update.isEnableShadow;
+		proxy->m_isShadowCast = update.isShadowCast;
+		proxy->m_isShadowRecive = update.isShadowRecive;
+		proxy->m_EnableLOD = update.isEnableLOD;
+		proxy->m_bitflag = update.bitflag;
+	}
+
+	if (mask & PROXY_UPDATE_LIGHTMAP)
+	{
+		proxy->m_LightMapping = update.lightMapping;
+	}
+
+	if (mask & PROXY_UPDATE_MATERIAL)
+	{
+		proxy->m_Material = update.material;
+		proxy->m_materialGuid = update.materialGuid;
+	}
+}
+
+ProxyUpdateStreamController::Frame* ProxyUpdateStreamController::AcquireFrame()
+{
+	// m_queueFlag 를 잡은 상태에서 호출
+	if (!m_freeFrames.empty())
+	{
+		Frame* frame = m_freeFrames.back();
+		m_freeFrames.pop_back();
+		return frame;
+	}
+
+	// 렌더가 밀린 경우에만 도달한다 (최대 MaxFrames 개)
+	m_frames.push_back(std::make_unique<Frame>());
+	CountAllocated(sizeof(Frame));
+	return m_frames.back().get();
+}
+
+ProxyUpdateStreamController::Frame* ProxyUpdateStreamController::PopPending()
+{
+	SpinLock lock(m_queueFlag);
+	if (0 == m_pendingCount)
+	{
+		return nullptr;
+	}
+
+	Frame* frame = m_pending[m_pendingHead];
+	m_pendingHead = (m_pendingHead + 1) % MaxPendingFrames;
+	--m_pendingCount;
+	return frame;
+}
+
+void ProxyUpdateStreamController::CountAllocated(size_t bytes)
+{
+	m_frameAllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+	m_totalAllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
@@ -0,0 +1,118 @@
+#pragma once
+#ifndef DYNAMICCPP_EXPORTS
+#include "Core.Minimal.h"
+#include "LightMapping.h"
+#include "SpinLock.h"
+
+class PrimitiveRenderProxy;
+class Material;
+
+enum ProxyUpdateField : uint32
+{
+	PROXY_UPDATE_TRANSFORM	= 1 << 0,	// m_worldMatrix, m_worldPosition
+	PROXY_UPDATE_STATE		= 1 << 1,	// static/shadow/LOD 플래그, bitflag
+	PROXY_UPDATE_MATERIAL	= 1 << 2,
+	PROXY_UPDATE_LIGHTMAP	= 1 << 3,
+	PROXY_UPDATE_PALETTE	= 1 << 4,
+};
+
+// 메시 렌더러 프록시 갱신 레코드. 바뀐 필드 마스크와 값만 담는 고정 레이아웃이다.
+struct alignas(16) MeshProxyUpdate
+{
+	Mathf::xMatrix			worldMatrix{};
+	PrimitiveRenderProxy*	proxy{ nullptr };
+	Material*				material{ nullptr };
+	Mathf::xMatrix*			palette{ nullptr };
+	HashedGuid				materialGuid{};
+	LightMapping			lightMapping{};
+	Mathf::Vector3			worldPosition{};
+	uint32					bitflag{};
+	uint32					fieldMask{};
+	bool					isStatic{};
+	bool					isEnableShadow{};
+	bool					isShadowCast{};
+	bool					isShadowRecive{};
+	bool					isEnableLOD{};
+};
+static_assert(std::is_trivially_copyable_v<MeshProxyUpdate>, "MeshProxyUpdate must stay POD");
+
+// 게임 -> 렌더 프록시 갱신 스트림
+// 워커 스레드별, 프레임별 선형 버퍼에 레코드를 값으로 쌓고, 렌더 스레드가 발행 순서대로 한 번에 적용한다.
+// 버퍼는 비운 뒤에도 용량을 유지하므로 정상 상태에서는 할당이 없다 (GetLastFrameStats 로 확인).
+class ProxyUpdateStreamController : public Singleton<ProxyUpdateStreamController>
+{
+private:
+	friend class Singleton;
+
+	static constexpr uint32 MaxLanes = 64;				// 초과한 스레드는 공유 레인을 잠금으로 사용
+	static constexpr uint32 MaxPendingFrames = 8;		// 렌더가 이만큼 밀리면 다음 프레임을 이어 붙인다
+	static constexpr uint32 MaxFrames = MaxPendingFrames + 2;
+
+	struct Lane
+	{
+		std::vector<MeshProxyUpdate>						records;
+		// 적용 전까지 프록시가 해제되지 않도록 잡아 둔다 (기존 람다 캡처와 동일한 수명)
+		std::vector<std::shared_ptr<PrimitiveRenderProxy>>	owners;
+	};
+
+	struct Frame
+	{
+		std::array<Lane, MaxLanes + 1>	lanes;
+		std::atomic_flag				overflowFlag{};
+		uint64							commandFrame{};	// 이 레코드들과 같은 게임 프레임의 ProxyCommandQueue 프레임
+
+		size_t RecordCount() const;
+		void Clear();
+	};
+
+public:
+	struct Stats
+	{
+		uint64 records{};
+		uint64 skipped{};
+		uint64 allocatedBytes{};
+	};
+
+private:
+	ProxyUpdateStreamController();
+	~ProxyUpdateStreamController() = default;
+
+public:
+	// 워커 스레드에서 호출. 렌더러 하나당 프레임에 한 번만 기록한다.
+	void Push(const MeshProxyUpdate& update, const std::shared_ptr<PrimitiveRenderProxy>& owner);
+	void CountSkipped() { m_frameSkipped.fetch_add(1, std::memory_order_relaxed); }
+
+	// 게임 스레드에서 이번 프레임의 기록 작업이 모두 끝난 뒤 호출. commandFrame 은 ProxyCommandQueue->AddFrame() 의 반환값
+	void PublishFrame(uint64 commandFrame);
+	// 렌더 스레드에서 호출. 발행된 프레임마다 그 프레임까지의 ProxyCommandQueue 명령을 먼저 적용하고 레코드를 적용한다
+	void Execute();
+
+	Stats GetLastFrameStats() const;
+	uint64 GetTotalAllocatedBytes() const { return m_totalAllocatedBytes.load(std::memory_order_relaxed); }
+
+private:
+	static void Apply(const MeshProxyUpdate& update);
+	Frame* AcquireFrame();
+	Frame* PopPending();
+	void CountAllocated(size_t bytes);
+
+private:
+	std::vector<std::unique_ptr<Frame>>		m_frames;
+	std::vector<Frame*>						m_freeFrames;
+	std::array<Frame*, MaxPendingFrames>	m_pending{};
+	uint32									m_pendingHead{};
+	uint32									m_pendingCount{};
+	std::atomic_flag						m_queueFlag{};
+
+	Frame*									m_writeFrame{ nullptr };
+	std::atomic_uint32_t					m_nextLane{};
+
+	std::atomic_uint64_t					m_frameSkipped{};
+	std::atomic_uint64_t					m_frameAllocatedBytes{};
+	std::atomic_uint64_t					m_totalAllocatedBytes{};
+	Stats									m_lastStats{};
+	mutable std::atomic_flag				m_statsFlag{};
+};
+
+static auto& ProxyUpdateStream = ProxyUpdateStreamController::GetInstance();
+#endif // !DYNAMICCPP_EXPORTS
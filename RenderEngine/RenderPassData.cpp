@@ -88,6 +88,9 @@ void RenderPassData::Initalize(uint32 index)
 	m_deferredQueue.reserve(500);
 	m_forwardQueue.reserve(500);
 	m_shadowRenderQueue.reserve(800);
+	m_deferredKeys.reserve(500);
+	m_forwardKeys.reserve(500);
+	m_shadowKeys.reserve(800);
 
 	ShadowMapRenderDesc& desc = RenderScene::g_shadowMapDesc;
 	auto shadowMapTexture = Texture::CreateManagedArray(
@@ -157,7 +160,7 @@ void RenderPassData::ClearRenderTarget()
 	DirectX11::ClearDepthStencilView(m_depthStencil->m_pDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 }
 
-void RenderPassData::PushRenderQueue(PrimitiveRenderProxy* proxy)
+void RenderPassData::PushRenderQueue(PrimitiveRenderProxy* proxy, Camera* camera)
 {
 	PrimitiveProxyType	proxyType = proxy->m_proxyType;
 	Material*			mat{ nullptr };
@@ -177,10 +180,17 @@ void RenderPassData::PushRenderQueue(PrimitiveRenderProxy* proxy)
 		switch (mat->m_renderingMode)
 		{
 		case MaterialRenderingMode::Opaque:
+		{
+			// LOD 는 여기서 한 번 고르고 (m_currLOD) 키와 배치가 같이 쓴다
+			const uint32 lodLevel = proxy->GetLODLevel(camera);
+			const float viewDepth = RenderQueueSorter::GetViewDepth(*proxy, *camera);
 			m_deferredQueue.push_back(proxy);
+			m_deferredKeys.push_back({ RenderQueueSorter::MakeOpaqueKey(*proxy, lodLevel, viewDepth), proxy });
 			break;
+		}
 		case MaterialRenderingMode::Transparent:
 			m_forwardQueue.push_back(proxy);
+			m_forwardKeys.push_back({ RenderQueueSorter::MakeTranslucentKey(*proxy, RenderQueueSorter::GetViewDepth(*proxy, *camera)), proxy });
 			break;
 		}
 
@@ -213,29 +223,20 @@ void RenderPassData::PushRenderQueue(PrimitiveRenderProxy* proxy)
 
 void RenderPassData::SortRenderQueue()
 {
-	if (!m_deferredQueue.empty())
-	{
-		std::ranges::sort(
-			m_deferredQueue.begin(),
-			m_deferredQueue.end(),
-			SortByAnimationAndMaterialGuid
-		);
-	}
+	SortByKeys(m_deferredQueue, m_deferredKeys);
+	SortByKeys(m_forwardQueue, m_forwardKeys);
 
-	if (!m_forwardQueue.empty())
-	{
-		std::ranges::sort(
-			m_forwardQueue.begin(),
-			m_forwardQueue.end(),
-			SortByAnimationAndMaterialGuid
-		);
-	}
+	RenderQueueSorter::BuildInstanceBatches(m_deferredKeys, m_deferredBatches, m_deferredInstanceMatrices);
 }
 
 void RenderPassData::ClearRenderQueue()
 {
 	m_deferredQueue.clear();
 	m_forwardQueue.clear();
+	m_deferredKeys.clear();
+	m_forwardKeys.clear();
+	m_deferredBatches.clear();
+	m_deferredInstanceMatrices.clear();
 	m_terrainQueue.clear();
 	m_foliageQueue.clear();
 	m_UIRenderQueue.clear();
@@ -243,26 +244,37 @@ void RenderPassData::ClearRenderQueue()
     m_spriteRenderQueue.clear();
 }
 
-void RenderPassData::PushShadowRenderQueue(PrimitiveRenderProxy* proxy)
+void RenderPassData::PushShadowRenderQueue(PrimitiveRenderProxy* proxy, Camera* camera)
 {
 	m_shadowRenderQueue.push_back(proxy);
+	// 그림자는 애니메이터/메쉬끼리 모이면 되므로 LOD 와 깊이는 키에 넣지 않는다
+	m_shadowKeys.push_back({ RenderQueueSorter::MakeOpaqueKey(*proxy, 0, 0.0f), proxy });
 }
 
 void RenderPassData::SortShadowRenderQueue()
 {
-	if (!m_deferredQueue.empty())
-	{
-		std::sort(
-			m_shadowRenderQueue.begin(),
-			m_shadowRenderQueue.end(),
-		SortByAnimationAndMaterialGuid	
-		);
-	}
+	SortByKeys(m_shadowRenderQueue, m_shadowKeys);
 }
 
 void RenderPassData::ClearShadowRenderQueue()
 {
 	m_shadowRenderQueue.clear();
+	m_shadowKeys.clear();
+}
+
+void RenderPassData::SortByKeys(ProxyContainer& queue, std::vector<DrawKeyEntry>& keys)
+{
+	if (keys.size() != queue.size())
+	{
+		// 키 없이 들어온 프록시가 있으면 큐 순서를 그대로 둔다
+		return;
+	}
+
+	RenderQueueSorter::Sort(keys, m_sortScratch);
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		queue[i] = keys[i].proxy;
+	}
 }
 
 void RenderPassData::PushUIRenderQueue(UIRenderProxy* proxy)
@@ -3,6 +3,7 @@
 #include "Camera.h"
 #include "Texture.h"
 #include "concurrent_vector.h"
+#include "RenderQueueSorter.h"
 
 using namespace concurrency;
 class Camera;
@@ -36,6 +37,14 @@ public:
 	UIProxyContainer			m_UIRenderQueue;
 	ProxyContainer			    m_decalQueue;
 	ProxyContainer              m_spriteRenderQueue;
+	// sort keys pushed alongside the queues above (same order until sorted)
+	std::vector<DrawKeyEntry>	m_deferredKeys;
+	std::vector<DrawKeyEntry>	m_forwardKeys;
+	std::vector<DrawKeyEntry>	m_shadowKeys;
+	std::vector<DrawKeyEntry>	m_sortScratch;
+	// instanced draws of m_deferredQueue, built after sorting
+	std::vector<InstanceBatch>	m_deferredBatches;
+	std::vector<Mathf::xMatrix>	m_deferredInstanceMatrices;
 	Camera						m_shadowCamera;
 	//flags
 	std::atomic_bool			m_isInitalized{ false };
@@ -54,11 +63,11 @@ public:
 
 	void Initalize(uint32 index);
 
-	void PushRenderQueue(PrimitiveRenderProxy* proxy);
+	void PushRenderQueue(PrimitiveRenderProxy* proxy, Camera* camera);
 	void SortRenderQueue();
 	void ClearRenderQueue();
 
-	void PushShadowRenderQueue(PrimitiveRenderProxy* proxy);
+	void PushShadowRenderQueue(PrimitiveRenderProxy* proxy, Camera* camera);
 	void SortShadowRenderQueue();
 	void ClearShadowRenderQueue();
 
@@ -92,5 +101,8 @@ public:
 
 	static bool VaildCheck(Camera* pCamera);
 	static RenderPassData* GetData(Camera* pCamera);
+
+private:
+	void SortByKeys(ProxyContainer& queue, std::vector<DrawKeyEntry>& keys);
 };
 #endif // !DYNAMICCPP_EXPORTS
\ No newline at end of file
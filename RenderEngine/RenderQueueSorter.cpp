@@ -0,0 +1,236 @@
+#include "RenderQueueSorter.h"
+#include "MeshRendererProxy.h"
+#include "Material.h"
+#include "Mesh.h"
+#include "Camera.h"
+#include "ShaderPSO.h"
+#include "Core.JobSystem.h"
+#include <array>
+
+namespace
+{
+	constexpr uint32 RadixBits = 8;
+	constexpr uint32 RadixSize = 1u << RadixBits;
+
+	// 해시/포인터를 bits 비트로 접는다 (피보나치 해싱)
+	uint64 Fold(uint64 value, uint32 bits)
+	{
+		return (value * 0x9E3779B97F4A7C15ull) >> (64 - bits);
+	}
+
+	uint64 Quantize(float value01, uint32 bits)
+	{
+		const float maxValue = static_cast<float>((1ull << bits) - 1);
+		return static_cast<uint64>(std::clamp(value01, 0.0f, 1.0f) * maxValue);
+	}
+
+	uint64 Field(uint64 value, uint32 shift, uint32 bits)
+	{
+		return (value & ((1ull << bits) - 1)) << shift;
+	}
+
+	template<typename F>
+	void ForEachChunk(uint32 chunkCount, F&& func)
+	{
+		if (1 == chunkCount)
+		{
+			func(0u);
+			return;
+		}
+
+		auto handle = JobSystems->ParallelFor(chunkCount, 1, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 chunk = begin; chunk < end; ++chunk)
+			{
+				func(chunk);
+			}
+		});
+		JobSystems->Wait(handle);
+	}
+}
+
+RenderQueueSorter::Category RenderQueueSorter::GetCategory(const PrimitiveRenderProxy& proxy)
+{
+	if (proxy.m_isAnimationEnabled && HashedGuid::INVAILD_ID != proxy.m_animatorGuid)
+	{
+		return Category::Animated;
+	}
+
+	if (proxy.m_Material && proxy.m_Material->m_shaderPSO)
+	{
+		return Category::CustomPSO;
+	}
+
+	return Category::Instanced;
+}
+
+float RenderQueueSorter::GetViewDepth(const PrimitiveRenderProxy& proxy, const Camera& camera)
+{
+	const Mathf::xVector toProxy = XMVectorSubtract(XMLoadFloat3(&proxy.m_worldPosition), camera.m_eyePosition);
+	const float distance = XMVectorGetX(XMVector3Dot(toProxy, XMVector3Normalize(camera.m_forward)));
+	const float range = (std::max)(camera.m_farPlane - camera.m_nearPlane, 1e-3f);
+	return (distance - camera.m_nearPlane) / range;
+}
+
+uint64 RenderQueueSorter::MakeOpaqueKey(const PrimitiveRenderProxy& proxy, uint32 lodLevel, float viewDepth)
+{
+	const Category category = GetCategory(proxy);
+
+	uint64 stateId = 0;
+	if (Category::Animated == category)
+	{
+		// 애니메이터끼리 모아 본 버퍼 갱신을 줄인다
+		stateId = Fold(proxy.m_animatorGuid, 12);
+	}
+	else if (Category::CustomPSO == category)
+	{
+		stateId = Fold(reinterpret_cast<uint64>(proxy.m_Material->m_shaderPSO.get()), 12);
+	}
+
+	const uint64 meshId = proxy.m_Mesh ? Fold(proxy.m_Mesh->m_hashingMesh, 17) : 0;
+
+	return Field(static_cast<uint64>(category), 62, 2)
+		| Field(stateId, 50, 12)
+		| Field(Fold(proxy.m_materialGuid, 17), 33, 17)
+		| Field(meshId, 16, 17)
+		| Field((std::min)(lodLevel, 3u), 14, 2)
+		| Field(Quantize(viewDepth, 14), 0, 14);
+}
+
+uint64 RenderQueueSorter::MakeTranslucentKey(const PrimitiveRenderProxy& proxy, float viewDepth)
+{
+	const uint64 meshId = proxy.m_Mesh ? Fold(proxy.m_Mesh->m_hashingMesh, 16) : 0;
+	const uint64 invertedDepth = Quantize(1.0f - viewDepth, 16);
+
+	return Field(static_cast<uint64>(GetCategory(proxy)), 62, 2)
+		| Field(invertedDepth, 46, 16)
+		| Field(Fold(proxy.m_materialGuid, 16), 30, 16)
+		| Field(meshId, 14, 16);
+}
+
+void RenderQueueSorter::Sort(std::vector<DrawKeyEntry>& entries, std::vector<DrawKeyEntry>& scratch)
+{
+	const uint32 count = static_cast<uint32>(entries.size());
+	if (count < 2)
+	{
+		return;
+	}
+
+	// 모든 키에서 같은 자리는 정렬할 필요가 없다
+	uint64 varyingBits = 0;
+	const uint64 firstKey = entries.front().key;
+	for (const DrawKeyEntry& entry : entries)
+	{
+		varyingBits |= entry.key ^ firstKey;
+	}
+
+	if (0 == varyingBits)
+	{
+		return;
+	}
+
+	const uint32 chunkCount = count < ParallelSortThreshold
+		? 1u
+		: std::clamp(JobSystems->GetWorkerCount() + 1, 1u, MaxSortChunks);
+	const uint32 chunkSize = (count + chunkCount - 1) / chunkCount;
+
+	scratch.resize(count);
+	DrawKeyEntry* source = entries.data();
+	DrawKeyEntry* destination = scratch.data();
+	std::vector<std::array<uint32, RadixSize>> histograms(chunkCount);
+
+	for (uint32 shift = 0; shift < 64; shift += RadixBits)
+	{
+		if (0 == ((varyingBits >> shift) & (RadixSize - 1)))
+		{
+			continue;
+		}
+
+		ForEachChunk(chunkCount, [&](uint32 chunk)
+		{
+			auto& histogram = histograms[chunk];
+			histogram.fill(0);
+			const uint32 end = (std::min)(count, (chunk + 1) * chunkSize);
+			for (uint32 i = chunk * chunkSize; i < end; ++i)
+			{
+				++histogram[(source[i].key >> shift) & (RadixSize - 1)];
+			}
+		});
+
+		// 자리값 순서 -> 구간 순서로 시작 위치를 매겨 안정 정렬을 유지한다
+		uint32 offset = 0;
+		for (uint32 digit = 0; digit < RadixSize; ++digit)
+		{
+			for (uint32 chunk = 0; chunk < chunkCount; ++chunk)
+			{
+				const uint32 digitCount = histograms[chunk][digit];
+				histograms[chunk][digit] = offset;
+				offset += digitCount;
+			}
+		}
+
+		ForEachChunk(chunkCount, [&](uint32 chunk)
+		{
+			auto& cursor = histograms[chunk];
+			const uint32 end = (std::min)(count, (chunk + 1) * chunkSize);
+			for (uint32 i = chunk * chunkSize; i < end; ++i)
+			{
+				destination[cursor[(source[i].key >> shift) & (RadixSize - 1)]++] = source[i];
+			}
+		});
+
+		std::swap(source, destination);
+	}
+
+	if (source != entries.data())
+	{
+		entries.swap(scratch);
+	}
+}
+
+void RenderQueueSorter::BuildInstanceBatches(const std::vector<DrawKeyEntry>& sorted,
+	std::vector<InstanceBatch>& outBatches, std::vector<Mathf::xMatrix>& outMatrices)
+{
+	outBatches.clear();
+	outMatrices.clear();
+	outMatrices.reserve(sorted.size());
+
+	using ProxyFilter = PrimitiveRenderProxy::ProxyFilter;
+	auto makeFilter = [](const PrimitiveRenderProxy& proxy)
+	{
+		return ProxyFilter
+		{
+			proxy.m_materialGuid,
+			proxy.m_Mesh->m_hashingMesh,
+			proxy.m_EnableLOD,
+			proxy.m_EnableLOD ? proxy.m_currLOD : 0u,
+			proxy.m_bitflag
+		};
+	};
+
+	std::optional<ProxyFilter> currentFilter;
+	for (const DrawKeyEntry& entry : sorted)
+	{
+		PrimitiveRenderProxy* proxy = entry.proxy;
+		if (static_cast<uint64>(Category::Instanced) != (entry.key >> 62)
+			|| PrimitiveProxyType::Expired == proxy->m_proxyType
+			|| nullptr == proxy->m_Mesh || nullptr == proxy->m_Material)
+		{
+			continue;
+		}
+
+		ProxyFilter filter = makeFilter(*proxy);
+		const bool isSameBatch = currentFilter && *currentFilter == filter
+			&& outBatches.back().first->m_isShadowRecive == proxy->m_isShadowRecive
+			&& outBatches.back().instanceCount < MaxInstancesPerBatch;
+
+		if (!isSameBatch)
+		{
+			outBatches.push_back({ proxy, static_cast<uint32>(outMatrices.size()), 0 });
+			currentFilter = filter;
+		}
+
+		outMatrices.push_back(proxy->m_worldMatrix);
+		++outBatches.back().instanceCount;
+	}
+}
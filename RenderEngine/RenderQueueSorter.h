@@ -0,0 +1,57 @@
+#pragma once
+#ifndef DYNAMICCPP_EXPORTS
+#include "Core.Minimal.h"
+
+class Camera;
+class PrimitiveRenderProxy;
+
+// 큐에 넣을 때 만든 64비트 정렬 키 + 프록시 (정렬은 키만 보고 프록시를 따라가지 않는다)
+struct DrawKeyEntry
+{
+	uint64					key{};
+	PrimitiveRenderProxy*	proxy{};
+};
+
+// 메쉬/머티리얼/LOD/비트플래그가 같은 연속 구간 하나 = 인스턴스 드로우 한 번
+struct InstanceBatch
+{
+	PrimitiveRenderProxy*	first{};
+	uint32					instanceOffset{};	// 인스턴스 월드 행렬 배열에서의 시작 위치
+	uint32					instanceCount{};
+};
+
+// 드로우 키 생성, 기수 정렬, 인스턴스 배치 묶기
+// - 불투명/그림자 키: [63..62] 분류 | [61..50] PSO(애니메이션이면 애니메이터) | [49..33] 머티리얼 | [32..16] 메쉬 | [15..14] LOD | [13..0] 깊이(가까운 순)
+// - 반투명 키: [63..62] 분류 | [61..46] 깊이(먼 순) | [45..30] 머티리얼 | [29..14] 메쉬
+// - 키의 id 는 해시를 접은 값이라 충돌할 수 있다. 배치는 키가 아니라 실제 메쉬/머티리얼을 비교해서 묶는다.
+class RenderQueueSorter
+{
+public:
+	enum class Category : uint64
+	{
+		Instanced	= 0,	// 커스텀 PSO 도 애니메이션도 없는 메쉬 (인스턴싱 대상)
+		CustomPSO	= 1,
+		Animated	= 2,
+	};
+
+	static constexpr uint32 MaxInstancesPerBatch = 16'384;
+
+	static Category GetCategory(const PrimitiveRenderProxy& proxy);
+	// 카메라 앞 방향 거리를 [0, 1] 로 정규화한다
+	static float GetViewDepth(const PrimitiveRenderProxy& proxy, const Camera& camera);
+
+	static uint64 MakeOpaqueKey(const PrimitiveRenderProxy& proxy, uint32 lodLevel, float viewDepth);
+	static uint64 MakeTranslucentKey(const PrimitiveRenderProxy& proxy, float viewDepth);
+
+	// 안정 LSD 기수 정렬 (8비트 8패스, 모든 키가 같은 자리는 건너뛴다). 많으면 잡 시스템에서 구간별로 나눠 돈다.
+	static void Sort(std::vector<DrawKeyEntry>& entries, std::vector<DrawKeyEntry>& scratch);
+
+	// 정렬된 Instanced 구간을 배치로 묶고 배치 순서대로 월드 행렬을 모은다
+	static void BuildInstanceBatches(const std::vector<DrawKeyEntry>& sorted,
+		std::vector<InstanceBatch>& outBatches, std::vector<Mathf::xMatrix>& outMatrices);
+
+private:
+	static constexpr uint32 ParallelSortThreshold = 8'192;
+	static constexpr uint32 MaxSortChunks = 16;
+};
+#endif // !DYNAMICCPP_EXPORTS
@@ -12,6 +12,7 @@
 #include "DataSystem.h"
 #include "SceneManager.h"
 #include "MeshRendererProxy.h"
+#include "Material.h"
 #include "ImageComponent.h"
 #include "TextComponent.h"
 #include "Terrain.h"
@@ -37,6 +38,14 @@ void RenderScene::Initialize()
 	m_animationJob.SetRenderScene(this);
 }
 
+void RenderScene::InitializeHeadless()
+{
+	// 애니메이션 잡이 애니메이터 맵을 돌므로 애니메이터 등록은 그대로 두고 GPU 쪽만 뺀다
+	m_isHeadless = true;
+	m_renderDataMap.resize(10);
+	m_animationJob.SetRenderScene(this);
+}
+
 void RenderScene::Finalize()
 {
 	Memory::SafeDelete(m_LightController);
@@ -46,10 +55,10 @@ void RenderScene::Finalize()
 	m_animatorMap.clear();
 	for (auto& pair : m_palleteMap)
 	{
-		if (pair.second.second)
+		if (pair.second)
 		{
-			std::free(pair.second.second);
-			pair.second.second = nullptr;
+			std::free(pair.second);
+			pair.second = nullptr;
 		}
 	}
 	m_palleteMap.clear();
@@ -104,6 +113,9 @@ void RenderScene::UpdateModel(const Mathf::xMatrix& model, ID3D11DeviceContext*
 
 RenderPassData* RenderScene::AddRenderPassData(size_t cameraIndex)
 {
+	// 렌더 타깃을 만들 디바이스가 없다
+	if (m_isHeadless) return nullptr;
+
 	auto ptr = m_renderDataMap[cameraIndex];
 	if (nullptr != ptr)
 	{
@@ -165,7 +177,7 @@ void RenderScene::RegisterAnimator(const std::shared_ptr<Animator>& animatorPtr)
 	void* voidPtr = std::malloc(TRANSFORM_SIZE);
 	if(voidPtr)
 	{
-		m_palleteMap[animatorGuid].second = (Mathf::xMatrix*)voidPtr;
+		m_palleteMap[animatorGuid] = (Mathf::xMatrix*)voidPtr;
 	}
 }
 
@@ -180,16 +192,29 @@ void RenderScene::UnregisterAnimator(const std::shared_ptr<Animator>& animatorPt
 
 	m_animatorMap.erase(animatorGuid);
 
-	if (m_palleteMap[animatorGuid].second)
+	if (m_palleteMap[animatorGuid])
 	{
-		free(m_palleteMap[animatorGuid].second);
+		free(m_palleteMap[animatorGuid]);
 		m_palleteMap.erase(animatorGuid);
 	}
 }
 
+void RenderScene::PreparePalettes()
+{
+	for (auto& [animatorGuid, palette] : m_palleteMap)
+	{
+		auto it = m_animatorMap.find(animatorGuid);
+		if (it == m_animatorMap.end() || nullptr == palette) continue;
+
+		memcpy(palette, &it->second->m_FinalTransforms, TRANSFORM_SIZE);
+	}
+}
+
 void RenderScene::RegisterCommand(MeshRenderer* meshRendererPtr)
 {
 	if (nullptr == meshRendererPtr) return;
+	// 헤드리스는 프록시를 만들지 않는다 (해제 쪽은 맵에 없으니 그냥 빠진다)
+	if (m_isHeadless) return;
 
 	HashedGuid meshRendererGuid = meshRendererPtr->GetInstanceID();
 
@@ -205,6 +230,7 @@ void RenderScene::RegisterCommand(MeshRenderer* meshRendererPtr)
 void RenderScene::RegisterCommand(FoliageComponent* foliagePtr)
 {
     if (nullptr == foliagePtr) return;
+    if (m_isHeadless) return;
 
     HashedGuid guid = foliagePtr->GetInstanceID();
 
@@ -298,19 +324,29 @@ void RenderScene::OnProxyDestroy()
 			}
 		}
 	}
-
-	for (auto& [guid, pair] : m_palleteMap)
-	{
-		auto& isUpdated = pair.first;
-
-		isUpdated = false;
-	}
 }
 
 void RenderScene::UpdateCommand(MeshRenderer* meshRendererPtr)
 {
-    ProxyCommand moveCommand = MakeProxyCommand(meshRendererPtr);
-    ProxyCommandQueue->PushProxyCommand(std::move(moveCommand));
+	// 파괴 예약된 렌더러는 예외 없이 건너뛴다
+	auto owner = meshRendererPtr->GetOwner();
+	if (!owner || owner->IsDestroyMark() || meshRendererPtr->IsDestroyMark()) return;
+
+	if (!InvaildCheckMeshRenderer(meshRendererPtr))
+	{
+		throw std::runtime_error("InvaildCheckMeshRenderer");
+	}
+
+	std::shared_ptr<PrimitiveRenderProxy> proxyObject;
+	MeshProxyUpdate update{};
+	if (MakeProxyUpdate(meshRendererPtr, proxyObject, update))
+	{
+		ProxyUpdateStream->Push(update, proxyObject);
+	}
+	else
+	{
+		ProxyUpdateStream->CountSkipped();
+	}
 }
 
 void RenderScene::UpdateCommand(FoliageComponent* foliagePtr)
@@ -319,15 +355,90 @@ void RenderScene::UpdateCommand(FoliageComponent* foliagePtr)
     ProxyCommandQueue->PushProxyCommand(std::move(moveCommand));
 }
 
-ProxyCommand RenderScene::MakeProxyCommand(MeshRenderer* meshRendererPtr)
+bool RenderScene::MakeProxyUpdate(MeshRenderer* meshRendererPtr, std::shared_ptr<PrimitiveRenderProxy>& proxyObject, MeshProxyUpdate& update)
 {
-	if (!InvaildCheckMeshRenderer(meshRendererPtr)) 
+	// 머티리얼이 없는 렌더러는 갱신하지 않는다
+	Material* originMat = meshRendererPtr->m_Material;
+	if (nullptr == originMat) return false;
+
 	{
-		throw std::runtime_error("InvaildCheckMeshRenderer");
+		SpinLock lock(m_proxyMapFlag);
+		auto it = m_proxyMap.find(meshRendererPtr->GetInstanceID());
+		if (it == m_proxyMap.end() || nullptr == it->second) return false;
+		proxyObject = it->second;
 	}
 
-    ProxyCommand command(meshRendererPtr);
-    return command;
+	auto owner = meshRendererPtr->GetOwner();
+	auto& submitted = proxyObject->m_submitted;
+	const bool isFirstSubmit = !submitted.isValid;
+	uint32 fieldMask{};
+
+	// 스키닝 팔레트는 PreparePalettes 가 작업 전에 복사해 두었다. 워커는 맵을 읽기만 한다
+	if (proxyObject->IsSkinnedMesh())
+	{
+		auto paletteIt = m_palleteMap.find(proxyObject->m_animatorGuid);
+		Mathf::xMatrix* palletePtr = paletteIt != m_palleteMap.end() ? paletteIt->second : nullptr;
+
+		if (palletePtr && palletePtr != submitted.palette)
+		{
+			fieldMask |= PROXY_UPDATE_PALETTE;
+			update.palette = palletePtr;
+			submitted.palette = palletePtr;
+		}
+	}
+
+	// GetWorldMatrix 가 갱신하면서 버전을 올릴 수 있으므로 행렬을 먼저 읽는다
+	// 물리 보간 중인 오브젝트는 렌더 행렬을 쓴다
+	const Mathf::xMatrix worldMatrix = owner->m_transform.GetRenderWorldMatrix();
+	const uint32 worldVersion = owner->m_transform.GetRenderVersion();
+	if (isFirstSubmit || worldVersion != submitted.worldVersion)
+	{
+		fieldMask |= PROXY_UPDATE_TRANSFORM;
+		update.worldMatrix = worldMatrix;
+		update.worldPosition = owner->m_transform.GetRenderWorldPosition();
+		submitted.worldVersion = worldVersion;
+	}
+
+	update.isStatic = owner->IsStatic();
+	update.isEnableShadow = owner->IsEnabled();
+	update.isShadowCast = meshRendererPtr->m_shadowCast;
+	update.isShadowRecive = meshRendererPtr->m_shadowRecive;
+	update.isEnableLOD = meshRendererPtr->m_isEnableLOD;
+	update.bitflag = meshRendererPtr->m_bitflag;
+	const uint32 stateBits =
+		(update.isStatic ? 1u << 0 : 0u) |
+		(update.isEnableShadow ? 1u << 1 : 0u) |
+		(update.isShadowCast ? 1u << 2 : 0u) |
+		(update.isShadowRecive ? 1u << 3 : 0u) |
+		(update.isEnableLOD ? 1u << 4 : 0u);
+	if (isFirstSubmit || stateBits != submitted.stateBits || update.bitflag != submitted.bitflag)
+	{
+		fieldMask |= PROXY_UPDATE_STATE;
+		submitted.stateBits = stateBits;
+		submitted.bitflag = update.bitflag;
+	}
+
+	constexpr int INVAILD_INDEX = -1;
+	const int lightMapIndex = meshRendererPtr->m_LightMapping.lightmapIndex;
+	if (INVAILD_INDEX != lightMapIndex && lightMapIndex != submitted.lightmapIndex)
+	{
+		fieldMask |= PROXY_UPDATE_LIGHTMAP;
+		update.lightMapping = meshRendererPtr->m_LightMapping;
+		submitted.lightmapIndex = lightMapIndex;
+	}
+
+	if (originMat != submitted.material)
+	{
+		fieldMask |= PROXY_UPDATE_MATERIAL;
+		update.material = originMat;
+		update.materialGuid = originMat->m_materialGuid;
+		submitted.material = originMat;
+	}
+
+	submitted.isValid = true;
+	update.proxy = proxyObject.get();
+	update.fieldMask = fieldMask;
+	return 0 != fieldMask;
 }
 
 ProxyCommand RenderScene::MakeProxyCommand(FoliageComponent* foliagePtr)
@@ -357,6 +468,7 @@ void RenderScene::UnregisterCommand(MeshRenderer* meshRendererPtr)
 void RenderScene::RegisterCommand(TerrainComponent* terrainPtr)
 {
 	if (nullptr == terrainPtr) return;
+	if (m_isHeadless) return;
 	HashedGuid terrainGuid = terrainPtr->GetInstanceID();
 	SpinLock lock(m_proxyMapFlag);
 	if (m_proxyMap.find(terrainGuid) != m_proxyMap.end()) return;
@@ -424,6 +536,7 @@ void RenderScene::UnregisterCommand(FoliageComponent* foliagePtr)
 void RenderScene::RegisterCommand(DecalComponent* decalPtr)
 {
 	if (nullptr == decalPtr) return;
+	if (m_isHeadless) return;
 
 	HashedGuid guid = decalPtr->GetInstanceID();
 
@@ -488,6 +601,7 @@ void RenderScene::UnregisterCommand(DecalComponent* decalPtr)
 void RenderScene::RegisterCommand(ImageComponent* imagePtr)
 {
 	if (nullptr == imagePtr) return;
+	if (m_isHeadless) return;
 	HashedGuid imageGuid = imagePtr->GetInstanceID();
 	SpinLock lock(m_uiProxyMapFlag);
 	if (m_uiProxyMap.find(imageGuid) != m_uiProxyMap.end()) return;
@@ -542,6 +656,7 @@ void RenderScene::UnregisterCommand(ImageComponent* imagePtr)
 void RenderScene::RegisterCommand(TextComponent* textPtr)
 {
 	if (nullptr == textPtr) return;
+	if (m_isHeadless) return;
 	HashedGuid textGuid = textPtr->GetInstanceID();
 	SpinLock lock(m_uiProxyMapFlag);
 	if (m_uiProxyMap.find(textGuid) != m_uiProxyMap.end()) return;
@@ -596,6 +711,7 @@ void RenderScene::UnregisterCommand(TextComponent* textPtr)
 void RenderScene::RegisterCommand(SpriteSheetComponent* spriteSheetPtr)
 {
 	if (nullptr == spriteSheetPtr) return;
+	if (m_isHeadless) return;
 	HashedGuid guid = spriteSheetPtr->GetInstanceID();
 	SpinLock lock(m_uiProxyMapFlag);
 	if (m_uiProxyMap.find(guid) != m_uiProxyMap.end()) return;
@@ -648,6 +764,7 @@ bool RenderScene::InvaildCheckSpriteSheet(SpriteSheetComponent* spriteSheetPtr)
 void RenderScene::RegisterCommand(SpriteRenderer* spriteRendererPtr)
 {
 	if (nullptr == spriteRendererPtr) return;
+	if (m_isHeadless) return;
 	HashedGuid spriteRendererGuid = spriteRendererPtr->GetInstanceID();
 	SpinLock lock(m_proxyMapFlag);
 	if (m_proxyMap.find(spriteRendererGuid) != m_proxyMap.end()) return;
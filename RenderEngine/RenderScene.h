@@ -24,6 +24,7 @@ struct ID3D11DeviceContext;
 #include "UIRenderProxy.h"
 #include "RenderPassData.h"
 #include "ProxyCommandQueue.h"
+#include "ProxyUpdateStream.h"
 #include "concurrent_unordered_map.h"
 
 using namespace concurrency;
@@ -40,6 +41,7 @@ class SpriteRenderer;
 class ImageComponent;
 class TextComponent;
 class ProxyCommand;
+struct MeshProxyUpdate;
 class SpriteSheetComponent;
 class RenderScene
 {
@@ -48,7 +50,7 @@ public:
 	using ProxyMap				= std::unordered_map<size_t, std::shared_ptr<PrimitiveRenderProxy>>;
 	using UIProxyMap			= std::unordered_map<size_t, std::shared_ptr<UIRenderProxy>>;
 	using AnimatorMap			= std::unordered_map<size_t, std::shared_ptr<Animator>>;
-	using AnimationPalleteMap	= std::unordered_map<size_t, std::pair<bool, DirectX::XMMATRIX*>>;
+	using AnimationPalleteMap	= std::unordered_map<size_t, DirectX::XMMATRIX*>;
 	using RenderDataMap			= std::vector<std::shared_ptr<RenderPassData>>;
 public:
 	RenderScene() = default;
@@ -58,6 +60,9 @@ public:
 	static ShadowMapRenderDesc g_shadowMapDesc;
 
 	void Initialize();
+	// No device, no light controller, no render pass data: proxy registration is discarded (headless runner)
+	void InitializeHeadless();
+	bool IsHeadless() const { return m_isHeadless; }
 	void SetScene(Scene* scene) { m_currentScene = scene; }
 	void Finalize();
 
@@ -78,11 +83,14 @@ public:
 
 	void RegisterAnimator(const std::shared_ptr<Animator>& animatorPtr);
 	void UnregisterAnimator(const std::shared_ptr<Animator>& animatorPtr);
+	// Copies each animator's palette once on the game thread, before the proxy update jobs run.
+	// The jobs then only read m_palleteMap.
+	void PreparePalettes();
 
     void RegisterCommand(MeshRenderer* meshRendererPtr);
     bool InvaildCheckMeshRenderer(MeshRenderer* meshRendererPtr);
     void UpdateCommand(MeshRenderer* meshRendererPtr);
-    ProxyCommand MakeProxyCommand(MeshRenderer* meshRendererPtr);
+    bool MakeProxyUpdate(MeshRenderer* meshRendererPtr, std::shared_ptr<PrimitiveRenderProxy>& proxyObject, MeshProxyUpdate& update);
     void UnregisterCommand(MeshRenderer* meshRendererPtr);
 
 	void RegisterCommand(TerrainComponent* terrainPtr);
@@ -156,4 +164,5 @@ private:
 	std::atomic_flag	m_proxyMapFlag{};
 	std::atomic_flag	m_uiProxyMapFlag{};
 	bool				m_isPlaying = false;
+	bool				m_isHeadless = false;
 };
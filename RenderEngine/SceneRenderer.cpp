@@ -6,6 +6,7 @@
 #include "Benchmark.hpp"
 #include "RenderScene.h"
 #include "SceneManager.h"
+#include "Core.JobSystem.h"
 #include "Scene.h"
 #include "RenderableComponents.h"
 #include "ImageComponent.h"
@@ -46,7 +47,6 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
     InitializeDeviceState();
     InitializeShadowMapDesc();
 
-	m_threadPool = new ThreadPool;
 	m_commandThreadPool = std::make_unique<RenderThreadPool>(DirectX11::DeviceStates->g_pDevice);
 	m_renderScene = std::make_shared<RenderScene>();
 	SceneManagers->SetRenderScene(m_renderScene.get());
@@ -87,7 +87,8 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
     //pass 생성
     //shadowMapPass 는 RenderScene의 맴버
     //gBufferPass
-	m_threadPool->Enqueue([this]()
+	JobHandle initGroup = JobSystems->CreateGroup();
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pGBufferPass = std::make_unique<GBufferPass>();
 		ID3D11RenderTargetView* views[]{
@@ -102,7 +103,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
     //ssaoPass
-	m_threadPool->Enqueue([this, ao]()
+	JobSystems->Schedule(initGroup, [this, ao]()
 	{
 		m_pSSAOPass = std::make_unique<SSAOPass>();
 		m_pSSAOPass->Initialize(
@@ -115,7 +116,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
     //deferredPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pDeferredPass = std::make_unique<DeferredPass>();
 		m_pDeferredPass->Initialize(
@@ -129,7 +130,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
 	//forwardPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pForwardPass = std::make_unique<ForwardPass>();
 		m_pForwardPass->SetTexture(m_normalTexture.get());
@@ -137,7 +138,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
 	//skyBoxPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pSkyBoxPass = std::make_unique<SkyBoxPass>();
 		m_currentSkyTextureName = PathFinder::Relative("HDR\\rustig_koppie_puresky_8k.hdr").string();
@@ -145,7 +146,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 	
 	//toneMapPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pToneMapPass = std::make_unique<ToneMapPass>();
 		m_pToneMapPass->Initialize(
@@ -155,20 +156,20 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 		m_pToneMapPass->ApplySettings(EngineSettingInstance->GetRenderPassSettings().toneMap);
 	});
 	//spritePass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pSpritePass = std::make_unique<SpritePass>();
 	});
 	//m_pSpritePass->Initialize(m_toneMappedColourTexture.get());
 
 	//blitPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pBlitPass = std::make_unique<BlitPass>();
 		m_pBlitPass->Initialize(m_deviceResources->GetBackBufferRenderTargetView());
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		//PositionMapPass
 		m_pPositionMapPass = std::make_unique<PositionMapPass>();
@@ -178,7 +179,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 
 
 	//SSR
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pScreenSpaceReflectionPass = std::make_unique<ScreenSpaceReflectionPass>();
 		m_pScreenSpaceReflectionPass->Initialize(m_diffuseTexture.get(),
@@ -190,7 +191,7 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
 	//SSS
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pSubsurfaceScatteringPass = std::make_unique<SubsurfaceScatteringPass>();
 		m_pSubsurfaceScatteringPass->Initialize(m_diffuseTexture.get(),
@@ -199,14 +200,14 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
 	//Vignette
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pVignettePass = std::make_unique<VignettePass>();
 		m_pVignettePass->ApplySettings(EngineSettingInstance->GetRenderPassSettings().vignette);
 	});
 
 	//ColorGrading
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pColorGradingPass = std::make_unique<ColorGradingPass>();
 		m_pColorGradingPass->Initialize();
@@ -215,41 +216,41 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	//m_pColorGradingPass->Initialize(PathFinder::Relative("ColorGrading\\LUT_3.png").string());
 
 	//VolumetricFog
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pVolumetricFogPass = std::make_unique<VolumetricFogPass>();
 		m_pVolumetricFogPass->Initialize(PathFinder::Relative("VolumetricFog\\blueNoise.dds").string());
 		m_pVolumetricFogPass->ApplySettings(EngineSettingInstance->GetRenderPassSettings().volumetricFog);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pUIPass = std::make_unique<UIPass>();
 		m_pUIPass->Initialize(m_toneMappedColourTexture.get());
 	});
 
 	//AAPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pAAPass = std::make_unique<AAPass>();
 		m_pAAPass->ApplySettings(EngineSettingInstance->GetRenderPassSettings().aa);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pPostProcessingPass = std::make_unique<PostProcessingPass>();
 		m_pPostProcessingPass->ApplySettings(EngineSettingInstance->GetRenderPassSettings().bloom);
 	});
 
 	//lightmapPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pLightMapPass = std::make_unique<LightMapPass>();
 	});
 
 
 	//SSGIPass
-	m_threadPool->Enqueue([this, ao]()
+	JobSystems->Schedule(initGroup, [this, ao]()
 	{
 		m_pSSGIPass = std::make_unique<SSGIPass>();
 		m_pSSGIPass->Initialize(m_diffuseTexture.get(), m_normalTexture.get(), m_lightingTexture.get(), m_metalRoughTexture.get(), ao.get());
@@ -257,20 +258,20 @@ SceneRenderer::SceneRenderer(const std::shared_ptr<DirectX11::DeviceResources>&
 	});
 
 	//BitmaskPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pBitMaskPass = std::make_unique<BitMaskPass>();
 		m_pBitMaskPass->Initialize(m_bitmaskTexture.get());
 	});
 
 	//DecalPass
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(initGroup, [this]()
 	{
 		m_pDecalPass = std::make_unique<DecalPass>();
 		m_pDecalPass->Initialize(m_diffuseTexture.get(), m_normalTexture.get(), m_metalRoughTexture.get());
 	});
 
-	m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(initGroup);
 
 	SceneManagers->sceneLoadedEvent.AddLambda([&]() 
 	{
@@ -363,8 +364,6 @@ void SceneRenderer::Finalize()
 
 	m_commandThreadPool.reset();
 
-	delete m_threadPool;
-
 	OnResizeEvent -= m_resizeEventHandle;
 
 	DirectX11::DeviceStates->g_pDevice				= nullptr;
@@ -440,7 +439,8 @@ void SceneRenderer::InitializeShadowMapDesc()
 
 void SceneRenderer::InitializeTextures()
 {
-	m_threadPool->Enqueue([this]()
+	JobHandle textureGroup = JobSystems->CreateGroup();
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto diffuseTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -451,7 +451,7 @@ void SceneRenderer::InitializeTextures()
 		m_diffuseTexture.swap(diffuseTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto metalRoughTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -462,7 +462,7 @@ void SceneRenderer::InitializeTextures()
 		m_metalRoughTexture.swap(metalRoughTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto normalTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -473,7 +473,7 @@ void SceneRenderer::InitializeTextures()
 		m_normalTexture.swap(normalTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto emissiveTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -484,7 +484,7 @@ void SceneRenderer::InitializeTextures()
 		m_emissiveTexture.swap(emissiveTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto bitmaskTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -495,7 +495,7 @@ void SceneRenderer::InitializeTextures()
 		m_bitmaskTexture.swap(bitmaskTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto toneMappedColourTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -506,7 +506,7 @@ void SceneRenderer::InitializeTextures()
 		m_toneMappedColourTexture.swap(toneMappedColourTexture);
 	});
 
-	m_threadPool->Enqueue([this]()
+	JobSystems->Schedule(textureGroup, [this]()
 	{
 		auto lightingTexture = TextureHelper::CreateSharedRenderTexture(
 			DirectX11::DeviceStates->g_ClientRect.width,
@@ -517,7 +517,7 @@ void SceneRenderer::InitializeTextures()
 		m_lightingTexture.swap(lightingTexture);
 	});
 
-	m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(textureGroup);
 }
 
 void SceneRenderer::NewCreateSceneInitialize()
@@ -910,7 +910,8 @@ void SceneRenderer::CreateCommandListPass()
 	};
 	m_pGBufferPass->SetRenderTargetViews(views, ARRAYSIZE(views));
 	PROFILE_CPU_BEGIN("ProxyCommandExecute");
-	ProxyCommandQueue->Execute();
+	// 프레임마다 생성/삭제 명령 다음에 같은 프레임의 갱신 레코드를 적용한다
+	ProxyUpdateStream->Execute();
 	PROFILE_CPU_END();
 
 	if (SceneManagers->IsVolumeProfileApply())
@@ -930,7 +931,7 @@ void SceneRenderer::CreateCommandListPass()
 			auto proxy = renderScene->FindProxy(instanceID);
 			if (nullptr != proxy)
 			{
-				data->PushShadowRenderQueue(proxy);
+				data->PushShadowRenderQueue(proxy, camera.get());
 			}
 		}
 
@@ -939,7 +940,7 @@ void SceneRenderer::CreateCommandListPass()
 			auto proxy = renderScene->FindProxy(instanceID);
 			if(nullptr != proxy)
 			{
-				data->PushRenderQueue(proxy);
+				data->PushRenderQueue(proxy, camera.get());
 			}
 		}
 
@@ -1181,10 +1182,13 @@ void SceneRenderer::PrepareRender()
 	std::vector<DecalComponent*> decalComponents = m_currentScene->GetDecalComponents();
 	PROFILE_CPU_END();
 
+	// 메쉬 갱신 작업이 팔레트 맵을 읽기만 하도록 먼저 복사한다
+	renderScene->PreparePalettes();
+	JobHandle updateGroup = JobSystems->CreateGroup();
 	PROFILE_CPU_BEGIN("UpdateCommand");
 	if (!textComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, texts = std::move(textComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, texts = std::move(textComponents)]
 			{
 				for (auto& text : texts)
 				{
@@ -1209,7 +1213,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!imageComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, images = std::move(imageComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, images = std::move(imageComponents)]
 			{
 				for (auto& image : images)
 				{
@@ -1233,7 +1237,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!spriteComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, sprites = std::move(spriteComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, sprites = std::move(spriteComponents)]
 			{
 				for (auto& sprite : sprites)
 				{
@@ -1258,7 +1262,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!terrainComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, terrains = std::move(terrainComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, terrains = std::move(terrainComponents)]
 			{
 				for (auto& terrain : terrains)
 				{
@@ -1276,7 +1280,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!allMeshes.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, meshes = std::move(allMeshes)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, meshes = std::move(allMeshes)]
 			{
 				for (auto& mesh : meshes)
 				{
@@ -1295,7 +1299,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!foliageComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, foliages = std::move(foliageComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, foliages = std::move(foliageComponents)]
 			{
 				for (auto& foliage : foliages)
 				{
@@ -1313,7 +1317,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!decalComponents.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, decals = std::move(decalComponents)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, decals = std::move(decalComponents)]
 			{
 				for (auto& decal : decals)
 				{
@@ -1331,7 +1335,7 @@ void SceneRenderer::PrepareRender()
 
 	if (!spriteRenderers.empty())
 	{
-		m_threadPool->Enqueue([&, renderScene, sprites = std::move(spriteRenderers)]
+		JobSystems->Schedule(updateGroup, [&, renderScene, sprites = std::move(spriteRenderers)]
 			{
 				for (auto& sprite : sprites)
 				{
@@ -1354,7 +1358,7 @@ void SceneRenderer::PrepareRender()
 			});
 	}
 
-	m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(updateGroup);
 	PROFILE_CPU_END();
 
 	EffectProxyController::GetInstance()->PrepareCommandBehavior();
@@ -1371,7 +1375,7 @@ void SceneRenderer::PrepareRender()
 	}
 
 	SwapEvent();
-	ProxyCommandQueue->AddFrame();
+	ProxyUpdateStream->PublishFrame(ProxyCommandQueue->AddFrame());
 	EffectProxyController::GetInstance()->AddFrame();
 
 	/*auto GameSceneStart = SceneManagers->m_isGameStart && !SceneManagers->m_isEditorSceneLoaded;
@@ -1413,11 +1417,14 @@ void SceneRenderer::PrepareRender()
 	decalComponents.assign(decalSource.begin(), decalSource.end());
 	PROFILE_CPU_END();
 
+	// 메쉬 갱신 작업이 팔레트 맵을 읽기만 하도록 먼저 복사한다
+	renderScene->PreparePalettes();
+	JobHandle updateGroup = JobSystems->CreateGroup();
 	PROFILE_CPU_BEGIN("UpdateCommand");
 	if (!textComponents.empty())
 	{
 		const auto textSpan = std::span<TextComponent* const>{ textComponents.data(), textComponents.size() };
-		m_threadPool->Enqueue([&, renderScene, textSpan]
+		JobSystems->Schedule(updateGroup, [&, renderScene, textSpan]
 		{
 			for (TextComponent* text : textSpan)
 			{
@@ -1443,7 +1450,7 @@ void SceneRenderer::PrepareRender()
 	if (!imageComponents.empty())
 	{
 		const auto imageSpan = std::span<ImageComponent* const>{ imageComponents.data(), imageComponents.size() };
-		m_threadPool->Enqueue([&, renderScene, imageSpan]
+		JobSystems->Schedule(updateGroup, [&, renderScene, imageSpan]
 		{
 			for (ImageComponent* image : imageSpan)
 			{
@@ -1468,7 +1475,7 @@ void SceneRenderer::PrepareRender()
 	if (!spriteComponents.empty())
 	{
 		const auto spriteComponentSpan = std::span<SpriteSheetComponent* const>{ spriteComponents.data(), spriteComponents.size() };
-		m_threadPool->Enqueue([&, renderScene, spriteComponentSpan]
+		JobSystems->Schedule(updateGroup, [&, renderScene, spriteComponentSpan]
 		{
 			for (SpriteSheetComponent* sprite : spriteComponentSpan)
 			{
@@ -1494,7 +1501,7 @@ void SceneRenderer::PrepareRender()
 	if (!terrainComponents.empty())
 	{
 		const auto terrainSpan = std::span<TerrainComponent* const>{ terrainComponents.data(), terrainComponents.size() };
-		m_threadPool->Enqueue([&, renderScene, terrainSpan]
+		JobSystems->Schedule(updateGroup, [&, renderScene, terrainSpan]
 		{
 			for (TerrainComponent* terrain : terrainSpan)
 			{
@@ -1513,7 +1520,7 @@ void SceneRenderer::PrepareRender()
 	if (!allMeshes.empty())
 	{
 		const auto meshSpan = std::span<MeshRenderer* const>{ allMeshes.data(), allMeshes.size() };
-		m_threadPool->Enqueue([&, meshSpan]
+		JobSystems->Schedule(updateGroup, [&, meshSpan]
 		{
 			for (MeshRenderer* mesh : meshSpan)
 			{
@@ -1533,7 +1540,7 @@ void SceneRenderer::PrepareRender()
 	if (!foliageComponents.empty())
 	{
 		const auto foliageSpan = std::span<FoliageComponent* const>{ foliageComponents.data(), foliageComponents.size() };
-		m_threadPool->Enqueue([&, foliageSpan]
+		JobSystems->Schedule(updateGroup, [&, foliageSpan]
 		{
 			for (FoliageComponent* foliage : foliageSpan)
 			{
@@ -1552,7 +1559,7 @@ void SceneRenderer::PrepareRender()
 	if (!decalComponents.empty())
 	{
 		const auto decalSpan = std::span<DecalComponent* const>{ decalComponents.data(), decalComponents.size() };
-		m_threadPool->Enqueue([&, decalSpan]
+		JobSystems->Schedule(updateGroup, [&, decalSpan]
 		{
 			for (DecalComponent* decal : decalSpan)
 			{
@@ -1571,7 +1578,7 @@ void SceneRenderer::PrepareRender()
 	if (!spriteRenderers.empty())
 	{
 		const auto spriteRendererSpan = std::span<SpriteRenderer* const>{ spriteRenderers.data(), spriteRenderers.size() };
-		m_threadPool->Enqueue([&, renderScene, spriteRendererSpan]
+		JobSystems->Schedule(updateGroup, [&, renderScene, spriteRendererSpan]
 		{
 			for (SpriteRenderer* sprite : spriteRendererSpan)
 			{
@@ -1594,7 +1601,7 @@ void SceneRenderer::PrepareRender()
 		});
 	}
 
-	m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(updateGroup);
 	PROFILE_CPU_END();
 
 	EffectProxyController::GetInstance()->PrepareCommandBehavior();
@@ -1611,7 +1618,7 @@ void SceneRenderer::PrepareRender()
 	}
 
 	SwapEvent();
-	ProxyCommandQueue->AddFrame();
+	ProxyUpdateStream->PublishFrame(ProxyCommandQueue->AddFrame());
 	EffectProxyController::GetInstance()->AddFrame();*/
 }
 
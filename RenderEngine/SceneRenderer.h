@@ -134,7 +134,6 @@ private:
 	 Managed::SharedPtr<Texture>				m_toneMappedColourTexture{};
 	 Managed::SharedPtr<Texture>				m_lightingTexture{};
 
-	ThreadPool<std::function<void()>>*			m_threadPool = nullptr;
 	std::unique_ptr<RenderThreadPool>			m_commandThreadPool = nullptr;
 #endif // !DYNAMICCPP_EXPORTS
 	//Editor Camera
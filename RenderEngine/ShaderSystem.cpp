@@ -16,7 +16,6 @@ ShaderResourceSystem::~ShaderResourceSystem()
 
 void ShaderResourceSystem::Initialize()
 {
-	m_shaderReloadThreadPool = new ThreadPool<std::function<void()>>();
 	HLSLIncludeReloadShaders();
 	CSOCleanup();
 	LoadShaders();
@@ -36,6 +35,7 @@ void ShaderResourceSystem::LoadShaders()
 	{
 		file::path shaderpath = PathFinder::RelativeToShader();
 		file::path precompiledpath = PathFinder::RelativeToPrecompiledShader();
+		JobHandle loadGroup = JobSystems->CreateGroup();
 		for (auto& dir : file::recursive_directory_iterator(shaderpath))
 		{
 			if (dir.is_directory() || dir.path().extension() != ".hlsl")
@@ -50,7 +50,7 @@ void ShaderResourceSystem::LoadShaders()
 
 				if (hlslTime > csoTime)
 				{
-					m_shaderReloadThreadPool->Enqueue([this, dir]()
+					JobSystems->Schedule(loadGroup, [this, dir]()
 					{
 						AddShaderFromPath(dir.path());
 					});
@@ -58,7 +58,7 @@ void ShaderResourceSystem::LoadShaders()
 				}
 				else
 				{
-					m_shaderReloadThreadPool->Enqueue([this, cso]()
+					JobSystems->Schedule(loadGroup, [this, cso]()
 					{
 						AddShaderFromPath(cso);
 					});
@@ -67,7 +67,7 @@ void ShaderResourceSystem::LoadShaders()
 			}
 			else
 			{
-				m_shaderReloadThreadPool->Enqueue([this, dir]()
+				JobSystems->Schedule(loadGroup, [this, dir]()
 				{
 					AddShaderFromPath(dir.path());
 				});
@@ -75,7 +75,7 @@ void ShaderResourceSystem::LoadShaders()
 			}
 		}
 
-		m_shaderReloadThreadPool->NotifyAllAndWait();
+		JobSystems->Wait(loadGroup);
 	}
 	catch (const file::filesystem_error& e)
 	{
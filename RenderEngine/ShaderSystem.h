@@ -4,7 +4,7 @@
 #include "Delegate.h"
 #include "DLLAcrossSingleton.h"
 #include "VisualShaderPSO.h"
-#include "Core.Thread.hpp"
+#include "Core.JobSystem.h"
 #include <memory>
 
 //class VisualShaderPSO; // visual shader pipeline
@@ -67,7 +67,6 @@ private:
 	bool m_isReloading = false;
 	Material* m_selectShaderTarget = nullptr;
 	ImageComponent* m_selectImageTarget = nullptr;
-	ThreadPool<std::function<void()>>* m_shaderReloadThreadPool = nullptr;
 	std::mutex m_shaderReloadMutex;
 };
 
@@ -67,6 +67,40 @@ void Skeleton::MarkRegion(Bone* bone, BoneRegion region)
 	}
 }
 
+void Skeleton::BakeAnimations()
+{
+	m_boneOrder.clear();
+	m_boneOrderParent.clear();
+	m_boneOrder.reserve(m_bones.size());
+	m_boneOrderParent.reserve(m_bones.size());
+
+	if (m_rootBone)
+	{
+		std::vector<std::pair<Bone*, int>> stack;
+		stack.emplace_back(m_rootBone, -1);
+		while (!stack.empty())
+		{
+			auto [bone, parentIndex] = stack.back();
+			stack.pop_back();
+
+			m_boneOrder.push_back(bone->m_index);
+			m_boneOrderParent.push_back(parentIndex);
+
+			for (auto it = bone->m_children.rbegin(); it != bone->m_children.rend(); ++it)
+			{
+				stack.emplace_back(*it, bone->m_index);
+			}
+		}
+	}
+
+	for (Animation& animation : m_animations)
+	{
+		animation.m_baked.Build(animation, *this);
+	}
+
+	m_bakedAnimationCount = m_animations.size();
+}
+
 std::string ToLower(std::string boneName)
 {
 	std::string name = boneName;
@@ -35,6 +35,10 @@ public:
 	Mathf::xMatrix m_globalInverseTransform;
 
 
+	// 부모가 항상 자식보다 앞에 오도록 평탄화한 본 순서 (BakeAnimations 에서 생성)
+	std::vector<int> m_boneOrder;
+	std::vector<int> m_boneOrderParent;	// m_boneOrder 와 같은 순서의 부모 본 인덱스 (루트는 -1)
+
 	std::vector<Socket*> m_sockets;
 	static constexpr uint32 MAX_BONES{ 512 };
 
@@ -44,8 +48,15 @@ public:
 	void DeleteSocket(std::string_view socketName);
 	Bone* FindBone(std::string_view _name);
 
+	// 애니메이션을 본 인덱스 기준으로 굽고 본 평탄화 순서를 만든다
+	void BakeAnimations();
+	bool IsAnimationBaked() const { return m_bakedAnimationCount == m_animations.size(); }
+
 	void MarkRegionSkeleton();
 	void MarkRegion(Bone* bone, BoneRegion region);
+
+private:
+	size_t m_bakedAnimationCount{ static_cast<size_t>(-1) };
 };
 
 std::string ToLower(std::string boneName);
@@ -90,6 +90,8 @@ void SkeletonLoader::LoadAnimations(Skeleton* skeleton)
             skeleton->m_animations.push_back(anim.value());
         }
     }
+
+    skeleton->BakeAnimations();
 }
 
 aiNode* SkeletonLoader::FindBoneRoot(aiNode* root)
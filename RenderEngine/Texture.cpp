@@ -2,6 +2,47 @@
 #include "Texture.h"
 #include "DeviceState.h"
 #include "SceneManager.h"
+#include "Core.PakFileSystem.h"
+#include "TextureCache.h"
+
+namespace
+{
+	constexpr TextureCookSettings ImageTextureCookSettings{ DXGI_FORMAT_BC1_UNORM_SRGB, TEX_COMPRESS_PARALLEL, true };
+	constexpr TextureCookSettings ManagedTextureCookSettings{ DXGI_FORMAT_BC1_UNORM, TEX_COMPRESS_PARALLEL, true };
+
+	//  û̸ ŷ ĳø  ,   о ŷѴ (Ϳ  ĳÿ ִ´)
+	HRESULT PrepareImage(const file::path& path, const file::path& preparePath, bool isCompress,
+		const TextureCookSettings& settings, ScratchImage& image, bool& hasAlpha)
+	{
+		if (isCompress && TextureCaches->TryLoad(preparePath, settings, image, hasAlpha))
+		{
+			return S_OK;
+		}
+
+		TexMetadata metadata{};
+		HRESULT hr = TextureCache::LoadSource(path, preparePath, &metadata, image);
+		if (FAILED(hr))
+		{
+			return hr;
+		}
+
+		if (isCompress && TextureCache::IsCookable(path, metadata.format))
+		{
+			hr = TextureCache::Cook(image, settings);
+			if (FAILED(hr))
+			{
+				return hr;
+			}
+
+			hasAlpha = !image.IsAlphaAllOpaque();
+			TextureCaches->Store(preparePath, settings, image, hasAlpha);
+			return S_OK;
+		}
+
+		hasAlpha = !image.IsAlphaAllOpaque();
+		return S_OK;
+	}
+}
 
 //static functions
 Texture* Texture::Create(_In_ uint32 width, _In_ uint32 height, _In_ std::string_view name, _In_ DXGI_FORMAT textureFormat, _In_ uint32 bindFlags, _In_opt_ D3D11_SUBRESOURCE_DATA* data)
@@ -243,13 +284,19 @@ Managed::UniquePtr<Texture> Texture::CreateManagedArray(uint32 width, uint32 hei
 Texture* Texture::LoadFormPath(_In_ const file::path& path, bool isCompress)
 {
 	file::path matPath = PathFinder::RelativeToMaterial(path.string());
-	if (!file::exists(path) && !file::exists(matPath))
+	if (!PakFileSystems->Exists(path) && !PakFileSystems->Exists(matPath))
+	{
+		return nullptr;
+	}
+
+	// ̽   帮 ʴ ڵ  ʰ ؽó   ģ
+	if (nullptr == DirectX11::DeviceStates->g_pDevice)
 	{
 		return nullptr;
 	}
 
 	file::path preparePath{};
-	if (file::exists(matPath))
+	if (PakFileSystems->Exists(matPath))
 	{
 		preparePath = matPath;
 	}
@@ -259,79 +306,9 @@ Texture* Texture::LoadFormPath(_In_ const file::path& path, bool isCompress)
 	}
 
 	ScratchImage image{};
-	TexMetadata metadata{};
-
-    Benchmark banch3;
-	if (path.extension() == ".dds")
-	{
-		//load dds
-		DirectX11::ThrowIfFailed(
-			LoadFromDDSFile(
-				preparePath.c_str(),
-				DDS_FLAGS_FORCE_RGB,
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".tga")
-	{
-		//load tga
-		DirectX11::ThrowIfFailed(
-			LoadFromTGAFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".hdr")
-	{
-		//load hdr
-		DirectX11::ThrowIfFailed(
-			LoadFromHDRFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else
-	{
-		//load wic
-		DirectX11::ThrowIfFailed(
-			LoadFromWICFile(
-				preparePath.c_str(),
-				WIC_FLAGS_IGNORE_SRGB,
-				&metadata,
-				image
-			)
-		);
-	}
-	if(isCompress)
-	{
-		ScratchImage compressedImage{};
-		if (!IsCompressed(metadata.format) && path.extension() != ".hdr" && path.extension() != ".dds")
-		{
-			DirectX::TexMetadata tempMetadata = metadata;
-
-			// DXGI_FORMAT_BC1_UNORM (== DXT1)
-			DirectX11::ThrowIfFailed(
-				DirectX::Compress(
-					image.GetImages(),
-					image.GetImageCount(),
-					metadata,
-					DXGI_FORMAT_BC1_UNORM_SRGB,
-					TEX_COMPRESS_PARALLEL,
-					0.5f,
-					compressedImage
-				)
-			);
-
-			metadata = compressedImage.GetMetadata(); // Ÿ 
-			image = std::move(compressedImage); //  ̹ ü
-		}
-	}
+	bool hasAlpha{};
+	DirectX11::ThrowIfFailed(PrepareImage(path, preparePath, isCompress, ImageTextureCookSettings, image, hasAlpha));
+	const TexMetadata& metadata = image.GetMetadata();
 
     Texture* texture = new Texture();
 	DirectX11::ThrowIfFailed(
@@ -346,7 +323,7 @@ Texture* Texture::LoadFormPath(_In_ const file::path& path, bool isCompress)
 
 	texture->m_textureType = TextureType::ImageTexture;
 	texture->m_size = { float(metadata.width),float(metadata.height) };
-	texture->m_isTextureAlpha = !image.IsAlphaAllOpaque();
+	texture->m_isTextureAlpha = hasAlpha;
 
 	return texture;
 }
@@ -354,13 +331,18 @@ Texture* Texture::LoadFormPath(_In_ const file::path& path, bool isCompress)
 Managed::SharedPtr<Texture> Texture::LoadSharedFromPath(const file::path& path, bool isCompress)
 {
 	file::path matPath = PathFinder::RelativeToMaterial(path.string());
-	if (!file::exists(path) && !file::exists(matPath))
+	if (!PakFileSystems->Exists(path) && !PakFileSystems->Exists(matPath))
+	{
+		return nullptr;
+	}
+
+	if (nullptr == DirectX11::DeviceStates->g_pDevice)
 	{
 		return nullptr;
 	}
 
 	file::path preparePath{};
-	if (file::exists(matPath))
+	if (PakFileSystems->Exists(matPath))
 	{
 		preparePath = matPath;
 	}
@@ -370,80 +352,9 @@ Managed::SharedPtr<Texture> Texture::LoadSharedFromPath(const file::path& path,
 	}
 
 	ScratchImage image{};
-	TexMetadata metadata{};
-
-	Benchmark banch3;
-	if (path.extension() == ".dds")
-	{
-		//load dds
-		DirectX11::ThrowIfFailed(
-			LoadFromDDSFile(
-				preparePath.c_str(),
-				DDS_FLAGS_FORCE_RGB,
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".tga")
-	{
-		//load tga
-		DirectX11::ThrowIfFailed(
-			LoadFromTGAFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".hdr")
-	{
-		//load hdr
-		DirectX11::ThrowIfFailed(
-			LoadFromHDRFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else
-	{
-		//load wic
-		DirectX11::ThrowIfFailed(
-			LoadFromWICFile(
-				preparePath.c_str(),
-				WIC_FLAGS_IGNORE_SRGB,
-				&metadata,
-				image
-			)
-		);
-	}
-
-	if (isCompress)
-	{
-		ScratchImage compressedImage{};
-		if (!IsCompressed(metadata.format) && path.extension() != ".hdr" && path.extension() != ".dds")
-		{
-			DirectX::TexMetadata tempMetadata = metadata;
-
-			// DXGI_FORMAT_BC1_UNORM (== DXT1)
-			DirectX11::ThrowIfFailed(
-				DirectX::Compress(
-					image.GetImages(),
-					image.GetImageCount(),
-					image.GetMetadata(),
-					DXGI_FORMAT_BC1_UNORM,
-					TEX_COMPRESS_SRGB | TEX_COMPRESS_DITHER | TEX_COMPRESS_UNIFORM,
-					0.5f,
-					compressedImage
-				)
-			);
-
-			metadata = compressedImage.GetMetadata(); // Ÿ 
-			image = std::move(compressedImage); //  ̹ ü
-		}
-	}
+	bool hasAlpha{};
+	DirectX11::ThrowIfFailed(PrepareImage(path, preparePath, isCompress, MaterialTextureCookSettings, image, hasAlpha));
+	const TexMetadata& metadata = image.GetMetadata();
 
 	auto texture = shared_alloc<Texture>();
 
@@ -464,7 +375,7 @@ Managed::SharedPtr<Texture> Texture::LoadSharedFromPath(const file::path& path,
 
 	texture->m_textureType = TextureType::ImageTexture;
 	texture->m_size = { float(image.GetMetadata().width),float(image.GetMetadata().height) };
-	texture->m_isTextureAlpha = !image.IsAlphaAllOpaque();
+	texture->m_isTextureAlpha = hasAlpha;
 
 	return texture;
 }
@@ -472,13 +383,18 @@ Managed::SharedPtr<Texture> Texture::LoadSharedFromPath(const file::path& path,
 Managed::UniquePtr<Texture> Texture::LoadManagedFromPath(const file::path& path, bool isCompress)
 {
 	file::path matPath = PathFinder::RelativeToMaterial(path.string());
-	if (!file::exists(path) && !file::exists(matPath))
+	if (!PakFileSystems->Exists(path) && !PakFileSystems->Exists(matPath))
+	{
+		return nullptr;
+	}
+
+	if (nullptr == DirectX11::DeviceStates->g_pDevice)
 	{
 		return nullptr;
 	}
 
 	file::path preparePath{};
-	if (file::exists(matPath))
+	if (PakFileSystems->Exists(matPath))
 	{
 		preparePath = matPath;
 	}
@@ -488,80 +404,9 @@ Managed::UniquePtr<Texture> Texture::LoadManagedFromPath(const file::path& path,
 	}
 
 	ScratchImage image{};
-	TexMetadata metadata{};
-
-	Benchmark banch3;
-	if (path.extension() == ".dds")
-	{
-		//load dds
-		DirectX11::ThrowIfFailed(
-			LoadFromDDSFile(
-				preparePath.c_str(),
-				DDS_FLAGS_FORCE_RGB,
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".tga")
-	{
-		//load tga
-		DirectX11::ThrowIfFailed(
-			LoadFromTGAFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else if (path.extension() == ".hdr")
-	{
-		//load hdr
-		DirectX11::ThrowIfFailed(
-			LoadFromHDRFile(
-				preparePath.c_str(),
-				&metadata,
-				image
-			)
-		);
-	}
-	else
-	{
-		//load wic
-		DirectX11::ThrowIfFailed(
-			LoadFromWICFile(
-				preparePath.c_str(),
-				WIC_FLAGS_IGNORE_SRGB,
-				&metadata,
-				image
-			)
-		);
-	}
-
-	if (isCompress)
-	{
-		ScratchImage compressedImage{};
-		if (!IsCompressed(metadata.format) && path.extension() != ".hdr" && path.extension() != ".dds")
-		{
-			DirectX::TexMetadata tempMetadata = metadata;
-
-			// DXGI_FORMAT_BC1_UNORM (== DXT1)
-			DirectX11::ThrowIfFailed(
-				DirectX::Compress(
-					image.GetImages(),
-					image.GetImageCount(),
-					metadata,
-					DXGI_FORMAT_BC1_UNORM,
-					TEX_COMPRESS_PARALLEL,
-					0.5f,
-					compressedImage
-				)
-			);
-
-			metadata = compressedImage.GetMetadata(); // Ÿ 
-			image = std::move(compressedImage); //  ̹ ü
-		}
-	}
+	bool hasAlpha{};
+	DirectX11::ThrowIfFailed(PrepareImage(path, preparePath, isCompress, ManagedTextureCookSettings, image, hasAlpha));
+	const TexMetadata& metadata = image.GetMetadata();
 
 	auto texture = unique_alloc<Texture>();
 
@@ -582,7 +427,7 @@ Managed::UniquePtr<Texture> Texture::LoadManagedFromPath(const file::path& path,
 
 	texture->m_textureType = TextureType::ImageTexture;
 	texture->m_size = { float(metadata.width),float(metadata.height) };
-	texture->m_isTextureAlpha = !image.IsAlphaAllOpaque();
+	texture->m_isTextureAlpha = hasAlpha;
 
 	return texture;
 }
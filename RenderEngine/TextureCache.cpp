@@ -0,0 +1,516 @@
+#ifndef DYNAMICCPP_EXPORTS
+#include "TextureCache.h"
+#include "Core.PakFileSystem.h"
+#include "Core.JobSystem.h"
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+
+namespace
+{
+	constexpr uint32 TextureCacheMagic = 0x31435854; // "TXC1"
+	// 쿠킹 방식(밉 필터 등)이 바뀌면 올려서 예전 블롭을 쓰지 않게 한다
+	constexpr uint32 TextureCookVersion = 1;
+
+	file::path GetIndexPath()
+	{
+		return PathFinder::CookedPath("Textures\\TextureCache.index");
+	}
+
+	uint64 HashBytes(const std::byte* data, size_t size)
+	{
+		return fnv1a_64(std::string_view(reinterpret_cast<const char*>(data), size));
+	}
+
+	int64 GetWriteTime(const file::path& path)
+	{
+		std::error_code ec;
+		const auto time = file::last_write_time(path, ec);
+		return ec ? 0 : static_cast<int64>(time.time_since_epoch().count());
+	}
+
+	bool IsSourceImage(const file::path& path)
+	{
+		std::string ext = path.extension().string();
+		std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return ext == ".png" || ext == ".tga" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp";
+	}
+
+	template<typename T>
+	void WritePod(std::ostream& out, const T& value)
+	{
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	// 인덱스 읽기용 커서 (범위를 넘으면 실패로 남는다)
+	struct IndexReader
+	{
+		const std::byte*	data{};
+		size_t				size{};
+		size_t				offset{};
+		bool				failed{};
+
+		template<typename T>
+		T Read()
+		{
+			T value{};
+			if (offset + sizeof(T) > size)
+			{
+				failed = true;
+				return value;
+			}
+			std::memcpy(&value, data + offset, sizeof(T));
+			offset += sizeof(T);
+			return value;
+		}
+
+		std::string ReadString()
+		{
+			const uint32 length = Read<uint32>();
+			if (failed || offset + length > size)
+			{
+				failed = true;
+				return {};
+			}
+			std::string value(reinterpret_cast<const char*>(data + offset), length);
+			offset += length;
+			return value;
+		}
+	};
+}
+
+uint64 TextureCookSettings::Hash() const
+{
+	struct
+	{
+		uint32 format;
+		uint32 compressFlags;
+		uint32 generateMips;
+		uint32 version;
+	} key{
+		static_cast<uint32>(format),
+		static_cast<uint32>(compressFlags & ~TEX_COMPRESS_PARALLEL),
+		generateMips ? 1u : 0u,
+		TextureCookVersion
+	};
+	return fnv1a_64(std::string_view(reinterpret_cast<const char*>(&key), sizeof(key)));
+}
+
+HRESULT TextureCache::LoadSource(const file::path& path, const file::path& preparePath, TexMetadata* metadata, ScratchImage& image)
+{
+	std::vector<std::byte> bytes;
+	const bool fromPak = PakFileSystems->Contains(preparePath) && PakFileSystems->Read(preparePath, bytes);
+
+	if (path.extension() == ".dds")
+	{
+		//load dds
+		return fromPak
+			? LoadFromDDSMemory(bytes.data(), bytes.size(), DDS_FLAGS_FORCE_RGB, metadata, image)
+			: LoadFromDDSFile(preparePath.c_str(), DDS_FLAGS_FORCE_RGB, metadata, image);
+	}
+	else if (path.extension() == ".tga")
+	{
+		//load tga
+		return fromPak
+			? LoadFromTGAMemory(bytes.data(), bytes.size(), metadata, image)
+			: LoadFromTGAFile(preparePath.c_str(), metadata, image);
+	}
+	else if (path.extension() == ".hdr")
+	{
+		//load hdr
+		return fromPak
+			? LoadFromHDRMemory(bytes.data(), bytes.size(), metadata, image)
+			: LoadFromHDRFile(preparePath.c_str(), metadata, image);
+	}
+
+	//load wic
+	return fromPak
+		? LoadFromWICMemory(bytes.data(), bytes.size(), WIC_FLAGS_IGNORE_SRGB, metadata, image)
+		: LoadFromWICFile(preparePath.c_str(), WIC_FLAGS_IGNORE_SRGB, metadata, image);
+}
+
+HRESULT TextureCache::Cook(ScratchImage& image, const TextureCookSettings& settings)
+{
+	const TexMetadata& metadata = image.GetMetadata();
+	if (settings.generateMips && metadata.mipLevels <= 1 && (metadata.width > 1 || metadata.height > 1))
+	{
+		ScratchImage mipChain{};
+		HRESULT hr = GenerateMipMaps(image.GetImages(), image.GetImageCount(), metadata, TEX_FILTER_DEFAULT, 0, mipChain);
+		if (FAILED(hr))
+		{
+			return hr;
+		}
+		image = std::move(mipChain);
+	}
+
+	// DXGI_FORMAT_BC1_UNORM (== DXT1)
+	ScratchImage compressedImage{};
+	HRESULT hr = DirectX::Compress(
+		image.GetImages(),
+		image.GetImageCount(),
+		image.GetMetadata(),
+		settings.format,
+		settings.compressFlags,
+		0.5f,
+		compressedImage
+	);
+	if (FAILED(hr))
+	{
+		return hr;
+	}
+
+	image = std::move(compressedImage);
+	return S_OK;
+}
+
+bool TextureCache::IsCookable(const file::path& path, DXGI_FORMAT format)
+{
+	return !IsCompressed(format) && path.extension() != ".hdr" && path.extension() != ".dds";
+}
+
+bool TextureCache::TryLoad(const file::path& source, const TextureCookSettings& settings, ScratchImage& image, bool& hasAlpha)
+{
+	std::call_once(m_loadOnce, [this]() { LoadIndex(); });
+
+	const uint64 settingsHash = settings.Hash();
+	Record record{};
+	{
+		std::shared_lock lock(m_mutex);
+		auto it = m_records.find(ToSourceKey(source) + "|" + std::to_string(settingsHash));
+		if (it == m_records.end())
+		{
+			return false;
+		}
+		record = it->second;
+	}
+
+	if (!IsUpToDate(source, record))
+	{
+		return false;
+	}
+
+	// 압축하지 않은 pak 항목이면 매핑된 메모리에서 바로, 아니면 풀어서 한 번만 복사해 올린다
+	const file::path blobPath = GetBlobPath(record.contentHash, settingsHash);
+	HRESULT hr = E_FAIL;
+	if (auto view = PakFileSystems->View(blobPath); !view.empty())
+	{
+		hr = LoadFromDDSMemory(view.data(), view.size(), DDS_FLAGS_NONE, nullptr, image);
+	}
+	else
+	{
+		std::vector<std::byte> bytes;
+		if (!PakFileSystems->Read(blobPath, bytes))
+		{
+			return false;
+		}
+		hr = LoadFromDDSMemory(bytes.data(), bytes.size(), DDS_FLAGS_NONE, nullptr, image);
+	}
+
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	hasAlpha = record.hasAlpha;
+	return true;
+}
+
+void TextureCache::Store(const file::path& source, const TextureCookSettings& settings, const ScratchImage& image, bool hasAlpha)
+{
+#ifndef BUILD_FLAG
+	std::call_once(m_loadOnce, [this]() { LoadIndex(); });
+
+	std::vector<std::byte> bytes;
+	if (!PakFileSystems->Read(source, bytes))
+	{
+		return;
+	}
+
+	Record record{};
+	record.source = ToSourceKey(source);
+	record.settings = settings;
+	record.sourceSize = bytes.size();
+	record.sourceWriteTime = GetWriteTime(source);
+	record.contentHash = HashBytes(bytes.data(), bytes.size());
+	record.hasAlpha = hasAlpha;
+
+	const uint64 settingsHash = settings.Hash();
+	const file::path blobPath = GetBlobPath(record.contentHash, settingsHash);
+	const std::string blobName = blobPath.filename().string();
+
+	// 같은 내용 + 같은 설정이면 같은 블롭이므로 한 스레드만 기록한다
+	bool isWriter = false;
+	{
+		std::unique_lock lock(m_mutex);
+		isWriter = m_writingBlobs.insert(blobName).second;
+	}
+
+	if (isWriter)
+	{
+		std::error_code ec;
+		if (!file::exists(blobPath, ec))
+		{
+			file::create_directories(blobPath.parent_path(), ec);
+			HRESULT hr = SaveToDDSFile(image.GetImages(), image.GetImageCount(), image.GetMetadata(), DDS_FLAGS_NONE, blobPath.c_str());
+			if (FAILED(hr))
+			{
+				Debug->LogWarning("Failed to write cooked texture: " + blobPath.string());
+				std::unique_lock lock(m_mutex);
+				m_writingBlobs.erase(blobName);
+				return;
+			}
+		}
+	}
+
+	std::unique_lock lock(m_mutex);
+	if (isWriter)
+	{
+		m_writingBlobs.erase(blobName);
+	}
+	m_records[record.source + "|" + std::to_string(settingsHash)] = std::move(record);
+	m_dirty = true;
+#endif // !BUILD_FLAG
+}
+
+uint32 TextureCache::CookAll(const file::path& directory, const TextureCookSettings& settings)
+{
+#ifdef BUILD_FLAG
+	return 0;
+#else
+	std::call_once(m_loadOnce, [this]() { LoadIndex(); });
+
+	struct CookJob
+	{
+		file::path			source;
+		TextureCookSettings	settings;
+	};
+
+	Benchmark benchmark;
+	std::vector<CookJob> jobs;
+	std::unordered_set<std::string> queued;
+
+	std::error_code ec;
+	for (file::recursive_directory_iterator it{ directory, file::directory_options::skip_permission_denied, ec }, end; !ec && it != end; it.increment(ec))
+	{
+		if (!it->is_regular_file(ec) || !IsSourceImage(it->path()))
+		{
+			continue;
+		}
+
+		if (queued.insert(ToSourceKey(it->path()) + "|" + std::to_string(settings.Hash())).second)
+		{
+			jobs.push_back({ it->path(), settings });
+		}
+	}
+
+	// 다른 설정으로 캐시된 항목도 원본이 바뀌었으면 다시 쿠킹한다
+	{
+		std::shared_lock lock(m_mutex);
+		for (const auto& [key, record] : m_records)
+		{
+			if (queued.insert(key).second)
+			{
+				jobs.push_back({ PathFinder::Relative(record.source), record.settings });
+			}
+		}
+	}
+
+	std::atomic<uint32> cookedCount{ 0 };
+	auto handle = JobSystems->ParallelFor(static_cast<uint32>(jobs.size()), 1, [&](uint32 begin, uint32 end)
+	{
+		// WIC 디코더는 COM 초기화가 필요하다 (잡 스레드는 COM 을 초기화하지 않는다)
+		const HRESULT com = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+		for (uint32 i = begin; i < end; ++i)
+		{
+			const CookJob& job = jobs[i];
+			if (!PakFileSystems->Exists(job.source))
+			{
+				continue;
+			}
+
+			const uint64 settingsHash = job.settings.Hash();
+			std::optional<Record> cached;
+			{
+				std::shared_lock lock(m_mutex);
+				auto it = m_records.find(ToSourceKey(job.source) + "|" + std::to_string(settingsHash));
+				if (it != m_records.end())
+				{
+					cached = it->second;
+				}
+			}
+
+			std::error_code existsError;
+			if (cached && IsUpToDate(job.source, *cached) && file::exists(GetBlobPath(cached->contentHash, settingsHash), existsError))
+			{
+				continue;
+			}
+
+			ScratchImage image{};
+			TexMetadata metadata{};
+			if (FAILED(LoadSource(job.source, job.source, &metadata, image)) || !IsCookable(job.source, metadata.format))
+			{
+				continue;
+			}
+
+			// 텍스처 단위로 나눠 돌리므로 한 장 안에서는 병렬 압축하지 않는다
+			TextureCookSettings cookSettings = job.settings;
+			cookSettings.compressFlags = static_cast<TEX_COMPRESS_FLAGS>(cookSettings.compressFlags & ~TEX_COMPRESS_PARALLEL);
+			if (FAILED(Cook(image, cookSettings)))
+			{
+				Debug->LogWarning("Failed to cook texture: " + job.source.string());
+				continue;
+			}
+
+			Store(job.source, job.settings, image, !image.IsAlphaAllOpaque());
+			++cookedCount;
+		}
+		if (SUCCEEDED(com))
+		{
+			CoUninitialize();
+		}
+	});
+	JobSystems->Wait(handle);
+
+	Save();
+
+	std::ostringstream oss;
+	oss << "Cooked " << cookedCount.load() << " / " << jobs.size() << " textures in "
+		<< std::fixed << std::setprecision(1) << benchmark.GetElapsedTime() << " ms";
+	Debug->Log(oss.str());
+	return cookedCount.load();
+#endif // BUILD_FLAG
+}
+
+void TextureCache::Save()
+{
+#ifndef BUILD_FLAG
+	std::unique_lock lock(m_mutex);
+	if (!m_dirty)
+	{
+		return;
+	}
+
+	const file::path indexPath = GetIndexPath();
+	file::path tempPath = indexPath;
+	tempPath += ".tmp";
+
+	std::error_code ec;
+	file::create_directories(indexPath.parent_path(), ec);
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+		{
+			Debug->LogWarning("Failed to save texture cache index: " + indexPath.string());
+			return;
+		}
+
+		WritePod(out, TextureCacheMagic);
+		WritePod(out, TextureCookVersion);
+		WritePod(out, static_cast<uint32>(m_records.size()));
+		for (const auto& [key, record] : m_records)
+		{
+			WritePod(out, static_cast<uint32>(record.source.size()));
+			out.write(record.source.data(), record.source.size());
+			WritePod(out, static_cast<uint32>(record.settings.format));
+			WritePod(out, static_cast<uint32>(record.settings.compressFlags));
+			WritePod(out, static_cast<uint8>(record.settings.generateMips));
+			WritePod(out, record.sourceSize);
+			WritePod(out, record.sourceWriteTime);
+			WritePod(out, record.contentHash);
+			WritePod(out, static_cast<uint8>(record.hasAlpha));
+		}
+	}
+
+	file::rename(tempPath, indexPath, ec);
+	if (ec)
+	{
+		Debug->LogWarning("Failed to save texture cache index: " + ec.message());
+		return;
+	}
+	m_dirty = false;
+#endif // !BUILD_FLAG
+}
+
+void TextureCache::LoadIndex()
+{
+	std::vector<std::byte> bytes;
+	if (!PakFileSystems->Read(GetIndexPath(), bytes))
+	{
+		return;
+	}
+
+	IndexReader reader{ bytes.data(), bytes.size() };
+	if (reader.Read<uint32>() != TextureCacheMagic || reader.Read<uint32>() != TextureCookVersion)
+	{
+		return;
+	}
+
+	const uint32 count = reader.Read<uint32>();
+	std::unordered_map<std::string, Record> records;
+	records.reserve(count);
+	for (uint32 i = 0; i < count && !reader.failed; ++i)
+	{
+		Record record{};
+		record.source = reader.ReadString();
+		record.settings.format = static_cast<DXGI_FORMAT>(reader.Read<uint32>());
+		record.settings.compressFlags = static_cast<TEX_COMPRESS_FLAGS>(reader.Read<uint32>());
+		record.settings.generateMips = 0 != reader.Read<uint8>();
+		record.sourceSize = reader.Read<uint64>();
+		record.sourceWriteTime = reader.Read<int64>();
+		record.contentHash = reader.Read<uint64>();
+		record.hasAlpha = 0 != reader.Read<uint8>();
+
+		std::string key = record.source + "|" + std::to_string(record.settings.Hash());
+		records.emplace(std::move(key), std::move(record));
+	}
+
+	if (reader.failed)
+	{
+		Debug->LogWarning("Texture cache index is corrupted. Ignoring cooked textures.");
+		return;
+	}
+
+	std::unique_lock lock(m_mutex);
+	m_records = std::move(records);
+}
+
+bool TextureCache::IsUpToDate(const file::path& source, const Record& record) const
+{
+	const uint64 size = PakFileSystems->FileSize(source);
+	if (0 == size || size != record.sourceSize)
+	{
+		return false;
+	}
+
+	// pak 안의 원본은 빌드 때 쿠킹한 것과 같이 묶였으므로 크기만 본다
+	if (PakFileSystems->Contains(source))
+	{
+		return true;
+	}
+
+	return GetWriteTime(source) == record.sourceWriteTime;
+}
+
+std::string TextureCache::ToSourceKey(const file::path& source) const
+{
+	std::string key = source.lexically_normal().lexically_relative(PathFinder::Relative()).generic_string();
+	if (key.empty())
+	{
+		key = source.lexically_normal().generic_string();
+	}
+	std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return key;
+}
+
+file::path TextureCache::GetBlobPath(uint64 contentHash, uint64 settingsHash) const
+{
+	std::ostringstream oss;
+	oss << std::hex << std::setfill('0') << std::setw(16) << contentHash << "_" << std::setw(16) << settingsHash << ".dds";
+	return PathFinder::CookedPath("Textures") / oss.str();
+}
+#endif // !DYNAMICCPP_EXPORTS
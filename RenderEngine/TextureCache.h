@@ -0,0 +1,81 @@
+#pragma once
+#ifndef DYNAMICCPP_EXPORTS
+#include "Core.Minimal.h"
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+// 텍스처 쿠킹 설정 (설정이 다르면 다른 캐시 항목이 된다)
+struct TextureCookSettings
+{
+	DXGI_FORMAT			format{ DXGI_FORMAT_BC1_UNORM };
+	TEX_COMPRESS_FLAGS	compressFlags{ TEX_COMPRESS_DEFAULT };	// TEX_COMPRESS_PARALLEL 은 결과에 영향이 없으므로 키에서 뺀다
+	bool				generateMips{ true };
+
+	uint64 Hash() const;
+};
+
+// Texture::LoadSharedFromPath 로 읽는 머티리얼 텍스처 설정
+inline const TextureCookSettings MaterialTextureCookSettings
+{
+	DXGI_FORMAT_BC1_UNORM,
+	static_cast<TEX_COMPRESS_FLAGS>(TEX_COMPRESS_SRGB | TEX_COMPRESS_DITHER | TEX_COMPRESS_UNIFORM),
+	true
+};
+
+// 밉맵 + 블록 압축까지 끝낸 DDS 를 Cooked/Textures 에 두고 로드 때 그대로 올린다
+// - 블롭 이름은 <원본 내용 해시>_<설정 해시>.dds 이고, 인덱스가 원본 경로 + 설정 -> 블롭을 잇는다.
+// - 인덱스에 원본 크기/수정 시간을 같이 남겨 원본이 바뀌면 캐시 미스로 본다 (pak 안의 원본은 크기만 본다).
+// - 빌드 전에 CookAll 로 병렬 쿠킹하고, 에디터에서는 캐시 미스로 압축한 결과도 캐시에 넣는다.
+class TextureCache : public Singleton<TextureCache>
+{
+private:
+	friend class Singleton;
+	TextureCache() = default;
+	~TextureCache() = default;
+
+	struct Record
+	{
+		std::string			source;		// 에셋 루트 기준 경로
+		TextureCookSettings	settings;
+		uint64				sourceSize{};
+		int64				sourceWriteTime{};
+		uint64				contentHash{};
+		bool				hasAlpha{};
+	};
+
+public:
+	// pak 에 있으면 풀어 둔 메모리에서, 없으면 디스크에서 읽는다. 형식은 path 의 확장자로 고른다.
+	static HRESULT LoadSource(const file::path& path, const file::path& preparePath, TexMetadata* metadata, ScratchImage& image);
+	// 밉맵 생성 + 블록 압축 (캐시 미스 경로와 쿠킹이 같이 쓴다)
+	static HRESULT Cook(ScratchImage& image, const TextureCookSettings& settings);
+	// 압축 대상 원본인지 (이미 압축된 형식, hdr, dds 는 그대로 쓴다)
+	static bool IsCookable(const file::path& path, DXGI_FORMAT format);
+
+	// 원본이 바뀌지 않았으면 쿠킹된 데이터를 image 에 채운다
+	bool TryLoad(const file::path& source, const TextureCookSettings& settings, ScratchImage& image, bool& hasAlpha);
+	// 쿠킹된 image 를 캐시에 넣는다 (게임 빌드에서는 아무것도 하지 않는다)
+	void Store(const file::path& source, const TextureCookSettings& settings, const ScratchImage& image, bool hasAlpha);
+
+	// directory 아래 이미지와 원본이 바뀐 인덱스 항목을 잡 시스템에서 병렬로 쿠킹한다. 쿠킹한 개수를 돌려준다.
+	uint32 CookAll(const file::path& directory, const TextureCookSettings& settings);
+	// 바뀐 인덱스를 저장한다
+	void Save();
+
+private:
+	void LoadIndex();
+	bool IsUpToDate(const file::path& source, const Record& record) const;
+	std::string ToSourceKey(const file::path& source) const;
+	file::path GetBlobPath(uint64 contentHash, uint64 settingsHash) const;
+
+private:
+	std::once_flag							m_loadOnce;
+	std::shared_mutex						m_mutex;
+	std::unordered_map<std::string, Record>	m_records;		// "원본 상대 경로|설정 해시" -> 항목
+	std::unordered_set<std::string>			m_writingBlobs;
+	bool									m_dirty{ false };
+};
+
+static auto& TextureCaches = TextureCache::GetInstance();
+#endif // !DYNAMICCPP_EXPORTS
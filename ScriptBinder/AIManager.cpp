@@ -5,7 +5,8 @@
 #include "SceneManager.h"
 #include "MeshRenderer.h"
 #include "Camera.h"
-//#include <execution>
+#include "Core.JobSystem.h"
+#include "Benchmark.hpp"
 
 BlackBoard* AIManager::CreateBlackBoard(const std::string& aiName)
 {
@@ -32,52 +33,169 @@ void AIManager::RemoveBlackBoard(const std::string& aiName)
 
 void AIManager::InternalAIUpdate(float deltaSeconds)
 {
-	std::vector<IAIComponent*> compVec{};
+	++m_frameIndex;
+
+	Scene* activeScene = SceneManagers->GetActiveScene();
+	// ī޶  Ÿ LOD     
 	auto camera = CameraManagement->GetLastCamera();
-	if (!camera) return;
+	const Mathf::xVector viewPosition = camera ? camera->m_eyePosition : DirectX::XMVectorZero();
 
+	m_dueAgents.clear();
 	for (auto& [ptr, comp] : m_aiComponentMap)
 	{
 		auto obj = ptr.lock();
 		if (!obj || !comp) continue;
 
-		if (obj->m_ownerScene != SceneManagers->GetActiveScene()) continue;
+		if (obj->m_ownerScene != activeScene) continue;
 
-		DirectX::BoundingBox objBox{};
-		objBox.Extents = { 3.f, 3.f, 3.f };
+		// ȭ  AI  ֱ⸸ þ   ƽϸ, ǳʶ ð  ƽ   ѱ
+		comp->m_pendingDeltaSecond = (std::min)(comp->m_pendingDeltaSecond + deltaSeconds, MaxPendingDelta);
 
-		auto meshComp = obj->GetComponent<MeshRenderer>();
-		if (meshComp)
-		{
-			objBox = meshComp->GetBoundingBox();
-		}
-		else
+		float distanceSq = 0.f;
+		if (camera)
 		{
-			DirectX::BoundingBox localObjBox{ objBox };
-			auto mat = obj->m_transform.GetWorldMatrix();
-			localObjBox.Transform(objBox, mat);
+			const Mathf::xVector offset = DirectX::XMVectorSubtract(obj->m_transform.GetWorldPosition(), viewPosition);
+			distanceSq = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(offset));
 		}
 
-		auto frustum = camera->GetFrustum();
-		if (frustum.Intersects(objBox))
+		if (m_frameIndex - comp->m_lastTickFrame >= GetTickInterval(comp, distanceSq))
 		{
-			compVec.push_back(comp);
+			m_dueAgents.push_back(comp);
 		}
 	}
 
-	auto updateFunc = [deltaSeconds](IAIComponent* comp)
+	// Critical ,    ٸ  (  и AI   ӿ  ƽѴ)
+	std::stable_sort(m_dueAgents.begin(), m_dueAgents.end(), [](const IAIComponent* lhs, const IAIComponent* rhs)
+	{
+		const bool lhsCritical = lhs->m_tickImportance == AITickImportance::Critical;
+		const bool rhsCritical = rhs->m_tickImportance == AITickImportance::Critical;
+		if (lhsCritical != rhsCritical) return lhsCritical;
+		return lhs->m_lastTickFrame < rhs->m_lastTickFrame;
+	});
+
+	m_parallelAgents.clear();
+	m_serialAgents.clear();
+	uint32 parallelCriticalCount = 0;
+	for (IAIComponent* comp : m_dueAgents)
 	{
-		try
+		if (comp->IsParallelTick())
 		{
-			comp->InternalAIUpdate(deltaSeconds);
+			if (comp->m_tickImportance == AITickImportance::Critical) ++parallelCriticalCount;
+			m_parallelAgents.push_back(comp);
 		}
-		catch (const std::exception& e)
+		else
 		{
-			std::cerr << "InternalAIUpdate Exception : " << e.what() << std::endl;
+			m_serialAgents.push_back(comp);
 		}
-	};
+	}
+
+	Benchmark timer;
+	m_tickedAgents.clear();
 
-	std::ranges::for_each(compVec.begin(), compVec.end(), updateFunc);
+	//  AI:  ƽ   ȿ     ƽѴ
+	if (!m_parallelAgents.empty())
+	{
+		const uint32 laneCount = JobSystems->GetWorkerCount() + 1;
+		const uint32 capacity = (std::max)(1u, static_cast<uint32>(m_tickBudgetMs * laneCount / m_avgTickCostMs));
+		const uint32 tickCount = (std::max)(parallelCriticalCount, (std::min)(capacity, static_cast<uint32>(m_parallelAgents.size())));
+
+		JobHandle tickGroup = JobSystems->ParallelFor(tickCount, 0, [this](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				TickAgent(m_parallelAgents[i]);
+			}
+		});
+		JobSystems->Wait(tickGroup);
+
+		const float elapsed = static_cast<float>(timer.GetElapsedTime());
+		const float sample = elapsed * (std::min)(laneCount, tickCount) / tickCount;
+		m_avgTickCostMs = (std::max)(0.001f, m_avgTickCostMs * 0.9f + sample * 0.1f);
+
+		m_tickedAgents.insert(m_tickedAgents.end(), m_parallelAgents.begin(), m_parallelAgents.begin() + tickCount);
+	}
+
+	//  AI:   ȿ  ƽѴ
+	for (IAIComponent* comp : m_serialAgents)
+	{
+		if (comp->m_tickImportance != AITickImportance::Critical && timer.GetElapsedTime() >= m_tickBudgetMs)
+			break;
+
+		TickAgent(comp);
+		m_tickedAgents.push_back(comp);
+	}
+
+	m_lastTickedCount = static_cast<uint32>(m_tickedAgents.size());
+}
+
+uint32 AIManager::GetTickInterval(const IAIComponent* comp, float distanceSq) const
+{
+	if (comp->m_tickImportance == AITickImportance::Critical)
+		return 1;
+
+	uint32 interval = MaxTickInterval;
+	if (distanceSq <= NearTickDistance * NearTickDistance)
+	{
+		interval = 1;
+	}
+	else if (distanceSq <= MidTickDistance * MidTickDistance)
+	{
+		interval = 4;
+	}
+
+	switch (comp->m_tickImportance)
+	{
+	case AITickImportance::High:
+		return (std::max)(1u, interval / 4);
+	case AITickImportance::Low:
+		return (std::min)(MaxTickInterval, interval * 2);
+	default:
+		return interval;
+	}
+}
+
+void AIManager::TickAgent(IAIComponent* comp)
+{
+	const float deltaSeconds = comp->m_pendingDeltaSecond;
+	comp->m_pendingDeltaSecond = 0.f;
+	comp->m_lastTickFrame = m_frameIndex;
+
+	try
+	{
+		comp->InternalAIUpdate(deltaSeconds);
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "InternalAIUpdate Exception : " << e.what() << std::endl;
+	}
+}
+
+void AIManager::FlushDeferredWrites()
+{
+	uint32 count = 0;
+	std::vector<std::function<void()>> writes;
+	for (IAIComponent* comp : m_tickedAgents)
+	{
+		if (comp->m_deferredWrites.empty()) continue;
+
+		//  ߿ ٽ DeferWrite ص  ƽ Ѿ  Ѵ
+		writes.swap(comp->m_deferredWrites);
+		for (auto& write : writes)
+		{
+			try
+			{
+				write();
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << "AI DeferWrite Exception : " << e.what() << std::endl;
+			}
+		}
+		count += static_cast<uint32>(writes.size());
+		writes.clear();
+	}
+	m_tickedAgents.clear();
+	m_lastDeferredCount = count;
 }
 
 void AIManager::RegisterAIComponent(GameObject* gameObject, IAIComponent* aiComponent)
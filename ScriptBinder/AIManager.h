@@ -29,7 +29,16 @@ public:
 
 	void UnRegisterAIComponent(GameObject* gameObject, IAIComponent* aiComponent);
 
+	// Ÿ/߿䵵 ֱ ƽ AI  ,   ȿ  AI ->  AI  ƽѴ.
+	//  Ѱ и AI   ӿ  ٸ   ƽѴ.
 	void InternalAIUpdate(float deltaSeconds);
+	//  ƽ AI  ̷  ⸦ Ѵ. AI ۾ շ   忡 ȣѴ
+	void FlushDeferredWrites();
+
+	void SetTickBudget(float milliseconds) { m_tickBudgetMs = milliseconds; }
+	float GetTickBudget() const { return m_tickBudgetMs; }
+	uint32 GetLastTickedCount() const { return m_lastTickedCount; }
+	uint32 GetLastDeferredCount() const { return m_lastDeferredCount; }
 
 	BT::BTNode::NodePtr CreateNode(std::string_view nodeName);
 
@@ -95,6 +104,24 @@ public:
 private:
 	friend class HotLoadSystem;
 
+	static constexpr float NearTickDistance = 20.f;	//  
+	static constexpr float MidTickDistance = 50.f;	// 4 Ӹ
+	static constexpr uint32 MaxTickInterval = 16;	//  
+	static constexpr float MaxPendingDelta = 0.5f;	// ġ    ѱ ð 
+
+	uint32 GetTickInterval(const IAIComponent* comp, float distanceSq) const;
+	void TickAgent(IAIComponent* comp);
+
+	uint64 m_frameIndex{};
+	float m_tickBudgetMs{ 2.f };
+	float m_avgTickCostMs{ 0.05f };	// AI ϳ ƽ  ̵ ,  ƽ    
+	uint32 m_lastTickedCount{};
+	uint32 m_lastDeferredCount{};
+	std::vector<IAIComponent*> m_dueAgents;
+	std::vector<IAIComponent*> m_parallelAgents;
+	std::vector<IAIComponent*> m_serialAgents;
+	std::vector<IAIComponent*> m_tickedAgents;
+
 	std::vector<std::string> m_btActionNodeNames{};
 	std::vector<std::string> m_btConditionNodeNames{};
 	std::vector<std::string> m_btConditionDecoratorNodeNames{};
@@ -28,6 +28,7 @@ InputAction* ActionMap::AddAction()
 	newAction->key.clear();
 	newAction->key.resize(4);
 	m_actions.push_back(newAction);
+	MarkDirty();
 	return newAction;
 }
 
@@ -60,6 +61,7 @@ void ActionMap::AddButtonAction(std::string name, size_t _playerindex, InputType
 	inputAction->buttonAction = _action;
 	if(isNew)
 	m_actions.push_back(inputAction);
+	MarkDirty();
 }
 
 void ActionMap::AddButtonAction(std::string name, size_t _playerindex, InputType _inputType, size_t _key, KeyState _state, void(*_action)())
@@ -109,6 +111,7 @@ void ActionMap::AddValueAction(std::string name, size_t _playerindex, InputValue
 
 	if(isNew)
 		m_actions.push_back(inputAction);
+	MarkDirty();
 }
 
 void ActionMap::AddValueAction(std::string name, size_t _playerindex, InputValueType _inputValueType, InputType _inputType, std::vector<size_t> _keys, std::function<void(float)> _action)
@@ -153,6 +156,7 @@ void ActionMap::AddValueAction(std::string name, size_t _playerindex, InputValue
 		};
 	if(isNew)
 		m_actions.push_back(inputAction);
+	MarkDirty();
 }
 void ActionMap::CheckAction()
 {
@@ -244,94 +248,6 @@ void ActionMap::CheckAction()
 
 }
 
-void ActionMap::CheckAction(int playerIndex,void* instance, const Meta::Type* type)
-{
-	for (auto& action : m_actions)
-	{
-		if (type->name != action->m_scriptName) return;
-		if (action->actionType == ActionType::Button)
-		{
-			if (action->key.size() == 0) continue;
-			switch (action->inputType)
-			{
-			case InputType::KeyBoard:
-				switch (action->keystate)
-				{
-				case KeyState::Down:
-					if (InputManagement->IsKeyDown(action->key[0]))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				case KeyState::Pressed:
-					if (InputManagement->IsKeyPressed(action->key[0]))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				case KeyState::Released:
-					if (InputManagement->IsKeyReleased(action->key[0]))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				}
-				break;
-			case InputType::GamePad:
-				switch (action->keystate)
-				{
-				case KeyState::Down:
-					if (InputManagement->IsControllerButtonDown(playerIndex, static_cast<ControllerButton>(action->key[0])))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				case KeyState::Pressed:
-					if (InputManagement->IsControllerButtonPressed(playerIndex, static_cast<ControllerButton>(action->key[0])))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				case KeyState::Released:
-					if (InputManagement->IsControllerButtonReleased(playerIndex, static_cast<ControllerButton>(action->key[0])))
-						InvokeAction(instance, type, action->funName, {});
-					break;
-				}
-				break;
-
-			}
-		}
-		else if (action->actionType == ActionType::Value)
-		{
-			if (action->valueType == InputValueType::Float)
-			{
-
-			}
-			else if (action->valueType == InputValueType::Vector2)
-			{
-
-				switch (action->inputType)
-				{
-				case InputType::KeyBoard:
-					if (InputManagement->IsKeyPressed(action->key[0])) action->value.v2Value.x = -1.0f;
-					else if (InputManagement->IsKeyPressed(action->key[1])) action->value.v2Value.x = 1.0f;
-					else action->value.v2Value.x = 0.0f;
-					if (InputManagement->IsKeyPressed(action->key[2])) action->value.v2Value.y = -1.0f;
-					else if (InputManagement->IsKeyPressed(action->key[3])) action->value.v2Value.y = 1.0f;
-					else action->value.v2Value.y = 0.0f;
-
-					InvokeAction(instance, type, action->funName, { action->value.v2Value });
-					//action->valueAction(action->value.v2Value);
-					break;
-				case InputType::GamePad:
-					if (action->key[0] == static_cast<size_t>(ControllerButton::LEFT_THUMB))
-						action->value.v2Value = InputManagement->GetControllerThumbL(playerIndex);
-					else if (action->key[0] == static_cast<size_t>(ControllerButton::RIGHT_THUMB))
-						action->value.v2Value = InputManagement->GetControllerThumbR(playerIndex);
-
-
-					InvokeAction(instance, type, action->funName,{ action->value.v2Value });
-					//action->valueAction(action->value.v2Value);
-					break; //&&&&& Ʈѷ vector2 ¿ ƽ
-				}
-
-			}
-
-		}
-	}
-
-}
-
 void ActionMap::InvokeAction(void* instance, const Meta::Type* type, const std::string& methodName, const std::vector<std::any>& args)
 {
 	Meta::InvokeMethodByMetaName(instance, *type, methodName, args);
@@ -347,6 +263,7 @@ void ActionMap::DeleteAction(const std::string& name)
 		{
 			delete* it;
 			m_actions.erase(it);
+			MarkDirty();
 		}
 	}
 
@@ -18,7 +18,9 @@ public:
 	void AddValueAction(std::string name, size_t _playerindex, InputValueType _inputValueType, InputType _inputType, std::vector<size_t> _keys, std::function<void(float)> _action);
 	void CheckAction();
 
-	void CheckAction(int playerIndex,void* instance, const Meta::Type* type);
+	// bumped whenever the action list changes so compiled bindings can rebuild
+	void MarkDirty() { ++m_revision; }
+	uint32 GetRevision() const { return m_revision; }
 
 	void InvokeAction(void* instance, const Meta::Type* type, const std::string& methodName, const std::vector<std::any>& args);
 	void DeleteAction(const std::string& name);
@@ -30,7 +32,7 @@ public:
 
 
 private:
-	
+	uint32 m_revision{};
 };
 
 
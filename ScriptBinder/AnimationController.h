@@ -5,6 +5,7 @@
 #include "AnimationState.h"
 #include "AnimationController.generated.h"
 #include "AvatarMask.h"
+#include "BakedAnimation.h"
 #include "imgui-node-editor/imgui_node_editor.h"
 #include "IRegistableEvent.h"
 #include <nlohmann/json.hpp>
@@ -39,6 +40,9 @@ public:
 
 	float m_timeElapsed;
 	float m_nextTimeElapsed;
+	// AnimationJob ø Ű ġ ĳ (/ ִϸ̼)
+	AnimationKeyCursor m_keyCursor;
+	AnimationKeyCursor m_nextKeyCursor;
 	[[Property]]
 	AvatarMask* m_avatarMask{};
 	float curAnimationProgress = 0.f;
@@ -5,6 +5,7 @@
 #include "NodeEditor.h"
 #include "SceneManager.h"
 #include "Socket.h"
+#include "Core.PakFileSystem.h"
 #include <nlohmann/json.hpp>
 void Animator::Awake()
 {
@@ -352,7 +353,7 @@ void Animator::DeserializeControllers(std::string _filename)
 
 		}
 	}*/
-	std::ifstream file(_filename);
+	AssetStream file(_filename);
 	if (!file.is_open())
 	{
 		std::cerr << "Failed to open: " << _filename << std::endl;
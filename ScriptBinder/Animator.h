@@ -85,6 +85,9 @@ public:
     int m_AnimIndex{};
     int nextAnimIndex = -1;
     float m_nextTimeElapsed{};
+    // Ʈѷ     Ű ġ ĳ (/ ִϸ̼)
+    AnimationKeyCursor m_keyCursor;
+    AnimationKeyCursor m_nextKeyCursor;
     [[Property]]
     FileGuid m_Motion{};
     XMMATRIX blendtransform;
@@ -0,0 +1,100 @@
+#include "AudioBackend.h"
+#include <cmath>
+
+AudioChannelId NullAudioBackend::Start(const AudioStartParams& params)
+{
+	Channel channel{};
+	channel.params = params;
+	channel.positionMs = static_cast<float>(params.startMs);
+	channel.volume = params.volume;
+	channel.isPlaying = true;
+
+	m_channels.push_back(channel);
+	++m_startCount;
+	++m_playingCount;
+	return static_cast<AudioChannelId>(m_channels.size());
+}
+
+void NullAudioBackend::Stop(AudioChannelId channel)
+{
+	if (Channel* found = FindMutable(channel))
+	{
+		if (found->isPlaying) ++m_stopCount;
+		End(*found);
+	}
+}
+
+bool NullAudioBackend::IsPlaying(AudioChannelId channel) const
+{
+	const Channel* found = Find(channel);
+	return found && found->isPlaying;
+}
+
+void NullAudioBackend::SetVolume(AudioChannelId channel, float volume)
+{
+	if (Channel* found = FindMutable(channel)) found->volume = volume;
+}
+
+void NullAudioBackend::SetPaused(AudioChannelId channel, bool paused)
+{
+	if (Channel* found = FindMutable(channel)) found->isPaused = paused;
+}
+
+void NullAudioBackend::Set3DAttributes(AudioChannelId channel, const AudioVector& position, const AudioVector& velocity)
+{
+	if (Channel* found = FindMutable(channel))
+	{
+		found->params.position = position;
+		found->params.velocity = velocity;
+	}
+}
+
+uint32_t NullAudioBackend::GetClipLengthMs(AudioClipId clip) const
+{
+	return clip < m_clipLengthMs.size() ? m_clipLengthMs[clip] : 0;
+}
+
+void NullAudioBackend::SetClipLengthMs(AudioClipId clip, uint32_t lengthMs)
+{
+	if (clip >= m_clipLengthMs.size()) m_clipLengthMs.resize(clip + 1, 0);
+	m_clipLengthMs[clip] = lengthMs;
+}
+
+void NullAudioBackend::Advance(float deltaMs)
+{
+	for (Channel& channel : m_channels)
+	{
+		if (!channel.isPlaying || channel.isPaused) continue;
+
+		channel.positionMs += deltaMs * channel.params.pitch;
+		const uint32_t lengthMs = GetClipLengthMs(channel.params.clip);
+		if (0 == lengthMs || channel.positionMs < static_cast<float>(lengthMs)) continue;
+
+		if (channel.params.loop)
+		{
+			channel.positionMs = std::fmod(channel.positionMs, static_cast<float>(lengthMs));
+		}
+		else
+		{
+			End(channel);
+		}
+	}
+}
+
+const NullAudioBackend::Channel* NullAudioBackend::Find(AudioChannelId channel) const
+{
+	if (0 == channel || channel > m_channels.size()) return nullptr;
+	return &m_channels[channel - 1];
+}
+
+NullAudioBackend::Channel* NullAudioBackend::FindMutable(AudioChannelId channel)
+{
+	return const_cast<Channel*>(Find(channel));
+}
+
+void NullAudioBackend::End(Channel& channel)
+{
+	if (!channel.isPlaying) return;
+	channel.isPlaying = false;
+	--m_playingCount;
+}
@@ -0,0 +1,89 @@
+#pragma once
+// 가상 보이스 계층과 실제 출력 장치 사이의 경계. FMOD 없이도 빌드/검증할 수 있게 표준 헤더만 쓴다.
+#include <cstdint>
+#include <vector>
+
+struct AudioVector
+{
+	float x{};
+	float y{};
+	float z{};
+};
+
+using AudioClipId		= uint32_t;	// SoundManager 클립 테이블 인덱스 (이름은 한 번만 풀어 둔다)
+using AudioChannelId	= uint64_t;	// 백엔드가 발급한 실제 채널, 0 이면 없음
+
+constexpr AudioClipId InvalidAudioClip = UINT32_MAX;
+
+struct AudioStartParams
+{
+	AudioClipId	clip{ InvalidAudioClip };
+	uint32_t	bus{};
+	float		volume{ 1.f };
+	float		pitch{ 1.f };
+	int			priority{ 128 };
+	bool		loop{ false };
+	bool		is3D{ false };
+	AudioVector	position{};
+	AudioVector	velocity{};
+	float		minDistance{ 1.f };
+	float		maxDistance{ 50.f };
+	uint32_t	startMs{};		// 가상 상태였던 동안 흐른 재생 위치
+	void*		userData{};
+};
+
+class IAudioBackend
+{
+public:
+	virtual ~IAudioBackend() = default;
+
+	virtual AudioChannelId Start(const AudioStartParams& params) = 0;
+	virtual void Stop(AudioChannelId channel) = 0;
+	virtual bool IsPlaying(AudioChannelId channel) const = 0;
+	virtual void SetVolume(AudioChannelId channel, float volume) = 0;
+	virtual void SetPaused(AudioChannelId channel, bool paused) = 0;
+	virtual void Set3DAttributes(AudioChannelId channel, const AudioVector& position, const AudioVector& velocity) = 0;
+	// 0 이면 길이를 모른다 (실제 채널이 끝났는지로만 판단)
+	virtual uint32_t GetClipLengthMs(AudioClipId clip) const = 0;
+};
+
+// 소리를 내지 않고 채널 시작/정지만 기록하는 백엔드 (헤드리스 검증, 벤치마크용)
+// 시간은 Advance 로 직접 흘려야 루프가 아닌 채널이 끝난다.
+class NullAudioBackend final : public IAudioBackend
+{
+public:
+	struct Channel
+	{
+		AudioStartParams	params{};
+		float				positionMs{};
+		float				volume{};
+		bool				isPlaying{ false };
+		bool				isPaused{ false };
+	};
+
+	AudioChannelId Start(const AudioStartParams& params) override;
+	void Stop(AudioChannelId channel) override;
+	bool IsPlaying(AudioChannelId channel) const override;
+	void SetVolume(AudioChannelId channel, float volume) override;
+	void SetPaused(AudioChannelId channel, bool paused) override;
+	void Set3DAttributes(AudioChannelId channel, const AudioVector& position, const AudioVector& velocity) override;
+	uint32_t GetClipLengthMs(AudioClipId clip) const override;
+
+	void SetClipLengthMs(AudioClipId clip, uint32_t lengthMs);
+	void Advance(float deltaMs);
+
+	uint32_t GetStartCount() const { return m_startCount; }
+	uint32_t GetStopCount() const { return m_stopCount; }
+	uint32_t GetPlayingCount() const { return m_playingCount; }
+	const Channel* Find(AudioChannelId channel) const;
+
+private:
+	Channel* FindMutable(AudioChannelId channel);
+	void End(Channel& channel);
+
+	std::vector<Channel>	m_channels;		// 채널 id = 인덱스 + 1 (재사용하지 않는다)
+	std::vector<uint32_t>	m_clipLengthMs;
+	uint32_t				m_startCount{};
+	uint32_t				m_stopCount{};
+	uint32_t				m_playingCount{};
+};
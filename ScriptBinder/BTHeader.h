@@ -3,6 +3,7 @@
 #include "BTBuildGraph.h"
 #include "BlackBoard.h"
 #include "ManagedHeapObject.h"
+#include "IAIComponent.h"
 #include <memory>
 #include <random>
 
@@ -23,12 +24,29 @@ namespace BT
 
 		virtual bool IsOutpinConnected() const { return false; }
 
+		// Ʈ     ȣȴ. 尡  BlackBoardKey  ⼭ Resolve  д
+		virtual void ResolveKeys(const BlackBoard& blackBoard) {}
+
 		virtual BehaviorNodeType GetNodeType() const = 0;
 		void SetOwner(GameObject* owner) { m_owner = owner; }
 		GameObject* GetOwner() const { return m_owner; }
+		void SetAgent(IAIComponent* agent) { m_agent = agent; }
+
+		// ڱ Ʈ   (Ʈ ̵, ִϸ, ٸ ũƮ ȣ) ٲٴ ۾.
+		// Ʈ  ƽ̸ ƽ   AIManager   ϰ, ƴϸ ٷ Ѵ
+		void DeferWrite(std::function<void()> write)
+		{
+			if (m_agent && m_agent->IsParallelTick())
+			{
+				m_agent->DeferWrite(std::move(write));
+				return;
+			}
+			write();
+		}
 	protected:
 		std::string m_name;
 		GameObject* m_owner{ nullptr }; // Node Ҽӵ GameObject
+		IAIComponent* m_agent{ nullptr }; // Node ƽϴ AI Ʈ
 		bool m_isOutpinConnected{ false };
 	};
 
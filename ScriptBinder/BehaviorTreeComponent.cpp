@@ -1,9 +1,12 @@
 #include "BehaviorTreeComponent.h"
 #include "SceneManager.h"
 #include "NodeFactory.h"
+#include "Core.PakFileSystem.h"
 
 void BehaviorTreeComponent::Initialize()
 {
+	SetTickImportance(tickImportance);
+	SetParallelTick(parallelTick);
 	AIManagers->RegisterAIComponent(GetOwner(), this);
 	if (m_BlackBoardGuid != nullFileGuid)
 	{
@@ -11,7 +14,7 @@ void BehaviorTreeComponent::Initialize()
 		m_pBlackboard = new BlackBoard();
 
 		file::path blackBoardPath = DataSystems->GetFilePath(m_BlackBoardGuid);
-		if (!file::exists(blackBoardPath))
+		if (!PakFileSystems->Exists(blackBoardPath))
 		{
 			Debug->LogError("Blackboard File not Exists");
 		}
@@ -44,6 +47,10 @@ void BehaviorTreeComponent::Awake()
 
 void BehaviorTreeComponent::InternalAIUpdate(float deltaSecond)
 {
+	// νͿ ٲ   ٺ ݿȴ
+	SetTickImportance(tickImportance);
+	SetParallelTick(parallelTick);
+
 	if (GetOwner()->m_isEnabled == false) return;
 
 	if (m_root && m_pBlackboard && SceneManagers->m_isGameStart)
@@ -102,6 +109,11 @@ BTNode::NodePtr BehaviorTreeComponent::BuildTreeRecursively(const HashedGuid& no
 	m_built[nodeId] = node;
 
 	node->SetOwner(GetOwner());
+	node->SetAgent(this);
+	if (m_pBlackboard)
+	{
+		node->ResolveKeys(*m_pBlackboard);
+	}
 
 	for (size_t i = 0; i < buildNode->Children.size(); ++i)
 	{
@@ -163,10 +175,11 @@ void BehaviorTreeComponent::GraphToBuild()
 	else
 	{
 		file::path BTpath = DataSystems->GetFilePath(m_BehaviorTreeGuid);
-		if (!BTpath.empty() && file::exists(BTpath))
+		if (!BTpath.empty() && PakFileSystems->Exists(BTpath))
 		{
 			std::shared_ptr<BTBuildGraph> graph = std::make_shared<BTBuildGraph>();
-			auto node = MetaYml::LoadFile(BTpath.string());
+			AssetStream btFile(BTpath);
+			auto node = MetaYml::Load(btFile);
 			const MetaYml::Node& nodeList = node["NodeList"];
 			if (nodeList && nodeList.IsSequence())
 			{
@@ -7,6 +7,8 @@ ReflectionFieldInheritance(BehaviorTreeComponent, Component) \
 	({ \
 		meta_property(name) \
 		meta_property(blackBoardName) \
+		meta_property(tickImportance) \
+		meta_property(parallelTick) \
 		meta_property(m_BehaviorTreeGuid) \
 		meta_property(m_BlackBoardGuid) \
 	}); \
@@ -21,6 +21,11 @@ public:
 	std::string name; // BT  ̸
 	[[Property]]
 	std::string blackBoardName;
+	// AIManager ƽ   ( ƽ  IAIComponent  ű)
+	[[Property]]
+	AITickImportance tickImportance{ AITickImportance::Normal };
+	[[Property]]
+	bool parallelTick{ false };	// true  ٸ AI  ķ ƽѴ. ׼   BTNode::DeferWrite  ѱ
 
 	// IAIComponent ̽ 
 	void Initialize() override;
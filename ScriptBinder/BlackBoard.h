@@ -5,6 +5,31 @@
 class GameObject;
 class Transform;
 class MenuBarWindow;
+class BlackBoard;
+
+//  ȣ ĳ δ  Ű
+// Ʈ   Resolve  θ  ȸ  迭 ε   .
+// Ű ߰//̸ /ε  ġ ٲ    ̸ ٽ ã´.
+// ĳô  ̾ƿ ID θ ǴѴ. ID   ʾ  ּҿ  尡 ܵ (ABA)    ʴ´.
+class BlackBoardKey
+{
+public:
+	static constexpr uint32_t InvalidSlot = 0xFFFFFFFF;
+
+	BlackBoardKey() = default;
+	explicit BlackBoardKey(std::string name) : m_name(std::move(name)) {}
+
+	const std::string& GetName() const { return m_name; }
+	void Resolve(const BlackBoard& blackBoard) const;
+
+private:
+	friend class BlackBoard;
+
+	std::string					m_name;
+	mutable uint64_t			m_layoutId{};	// 0  Resolve 
+	mutable uint32_t			m_slot{ InvalidSlot };
+};
+
 class BlackBoard
 {
 public:
@@ -30,6 +55,28 @@ public:
 	GameObject* GetValueAsGameObject(const std::string& key) const;
 	const Transform& GetValueAsTransform(const std::string& key) const;
 
+	// Slot key (BT   )
+	void SetValueAsBool(const BlackBoardKey& key, bool value);
+	void SetValueAsInt(const BlackBoardKey& key, int value);
+	void SetValueAsFloat(const BlackBoardKey& key, float value);
+	void SetValueAsString(const BlackBoardKey& key, const std::string& value);
+	void SetValueAsVector2(const BlackBoardKey& key, const Mathf::Vector2& value);
+	void SetValueAsVector3(const BlackBoardKey& key, const Mathf::Vector3& value);
+	void SetValueAsVector4(const BlackBoardKey& key, const Mathf::Vector4& value);
+	void SetValueAsGameObject(const BlackBoardKey& key, const std::string& objectName);
+
+	bool GetValueAsBool(const BlackBoardKey& key) const;
+	int GetValueAsInt(const BlackBoardKey& key) const;
+	float GetValueAsFloat(const BlackBoardKey& key) const;
+	const std::string& GetValueAsString(const BlackBoardKey& key) const;
+	const Mathf::Vector2& GetValueAsVector2(const BlackBoardKey& key) const;
+	const Mathf::Vector3& GetValueAsVector3(const BlackBoardKey& key) const;
+	const Mathf::Vector4& GetValueAsVector4(const BlackBoardKey& key) const;
+	GameObject* GetValueAsGameObject(const BlackBoardKey& key) const;
+	const Transform& GetValueAsTransform(const BlackBoardKey& key) const;
+
+	bool HasKey(const BlackBoardKey& key) const { return BlackBoardKey::InvalidSlot != ResolveSlot(key); }
+
 	// Management
 	void AddKey(const std::string& key, const BlackBoardType& type);
 	bool HasKey(const std::string& key) const;
@@ -44,13 +91,37 @@ public:
 
 private:
 	friend class MenuBarWindow; // Allow MenuBarWindow to access private members
+	friend class BlackBoardKey;
 
 	std::string m_name; // Name of the blackboard
-	std::unordered_map<std::string, BlackBoardValue> m_values;
+	std::vector<BlackBoardValue>				m_slots;		//   迭  д
+	std::vector<std::string>					m_slotNames;	//  ȣ -> Ű ̸
+	std::unordered_map<std::string, uint32_t>	m_slotIndex;	// Ű ̸ ->  ȣ (ڿ API, Ű Resolve )
+	uint64_t									m_layoutId{ NextLayoutId() };	//  ġ ٲ   ޴´ ( )
 	//Core::Delegate<void, const std::string&> m_valueChangedDelegate; //  濡  Ʈ
 
+	static uint64_t NextLayoutId();
+	uint32_t FindSlot(const std::string& key) const;
+	uint32_t ResolveSlot(const BlackBoardKey& key) const
+	{
+		if (key.m_layoutId != m_layoutId)
+		{
+			key.m_slot = FindSlot(key.m_name);
+			key.m_layoutId = m_layoutId;
+		}
+		return key.m_slot;
+	}
+
 	BlackBoardValue& GetOrCreate(const std::string& key);
+	BlackBoardValue& GetOrCreate(const BlackBoardKey& key);
 	const BlackBoardValue& GetChecked(const std::string& key, BlackBoardType expected) const;
+	const BlackBoardValue& GetChecked(const BlackBoardKey& key, BlackBoardType expected) const;
+	const BlackBoardValue& CheckType(const std::string& key, const BlackBoardValue& value, BlackBoardType expected) const;
 };
 
+inline void BlackBoardKey::Resolve(const BlackBoard& blackBoard) const
+{
+	blackBoard.ResolveSlot(*this);
+}
+
 using ConditionFunc = std::function<bool(const BlackBoard&)>;
\ No newline at end of file
@@ -2,34 +2,89 @@
 #include "GameObject.h"
 #include "Transform.h"
 #include "SceneManager.h"
+#include "Core.PakFileSystem.h"
+
+uint64_t BlackBoard::NextLayoutId()
+{
+	//  ũƮ DLL   ī͸ Ƿ ⸶ ī ּҷ ۰  д
+	static std::atomic<uint64_t> nextId{ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&nextId)) << 16) | 1 };
+	return nextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t BlackBoard::FindSlot(const std::string& key) const
+{
+	auto it = m_slotIndex.find(key);
+	return it != m_slotIndex.end() ? it->second : BlackBoardKey::InvalidSlot;
+}
 
 BlackBoardValue& BlackBoard::GetOrCreate(const std::string& key)
 {
-	return m_values[key]; // default 
+	auto [it, isInserted] = m_slotIndex.try_emplace(key, static_cast<uint32_t>(m_slots.size()));
+	if (isInserted)
+	{
+		m_slots.emplace_back(); // default 
+		m_slotNames.push_back(key);
+		m_layoutId = NextLayoutId(); //  Ű Resolve  ڵ ٽ ã
+	}
+	return m_slots[it->second];
 }
 
-const BlackBoardValue& BlackBoard::GetChecked(const std::string& key, BlackBoardType expected) const
+BlackBoardValue& BlackBoard::GetOrCreate(const BlackBoardKey& key)
 {
-	auto it = m_values.find(key);
-	if (it == m_values.end())
+	uint32_t slot = ResolveSlot(key);
+	if (BlackBoardKey::InvalidSlot == slot)
 	{
-		// If the key does not exist, throw an error
-		Debug->LogError("BlackBoard key not found: " + key);
-		throw std::runtime_error("BlackBoard key not found: " + key);
+		GetOrCreate(key.m_name);
+		slot = ResolveSlot(key);
 	}
+	return m_slots[slot];
+}
 
-	if (it->second.Type != expected)
+const BlackBoardValue& BlackBoard::CheckType(const std::string& key, const BlackBoardValue& value, BlackBoardType expected) const
+{
+	if (value.Type != expected)
 	{
 		Debug->LogError("BlackBoard type mismatch for key: " + key +
 			". Expected: " + BlackBoardTypeToString(expected) +
-			", Actual: " + BlackBoardTypeToString(it->second.Type));
+			", Actual: " + BlackBoardTypeToString(value.Type));
 
 		throw std::runtime_error("BlackBoard type mismatch for key: " + key + 
 			". Expected: " + BlackBoardTypeToString(expected) + 
-			", Actual: " + BlackBoardTypeToString(it->second.Type));
+			", Actual: " + BlackBoardTypeToString(value.Type));
 	}
 
-	return it->second;
+	return value;
+}
+
+const BlackBoardValue& BlackBoard::GetChecked(const std::string& key, BlackBoardType expected) const
+{
+	const uint32_t slot = FindSlot(key);
+	if (BlackBoardKey::InvalidSlot == slot)
+	{
+		// If the key does not exist, throw an error
+		Debug->LogError("BlackBoard key not found: " + key);
+		throw std::runtime_error("BlackBoard key not found: " + key);
+	}
+
+	return CheckType(key, m_slots[slot], expected);
+}
+
+const BlackBoardValue& BlackBoard::GetChecked(const BlackBoardKey& key, BlackBoardType expected) const
+{
+	const uint32_t slot = ResolveSlot(key);
+	if (BlackBoardKey::InvalidSlot == slot)
+	{
+		Debug->LogError("BlackBoard key not found: " + key.m_name);
+		throw std::runtime_error("BlackBoard key not found: " + key.m_name);
+	}
+
+	const BlackBoardValue& value = m_slots[slot];
+	if (value.Type == expected)
+	{
+		return value;
+	}
+
+	return CheckType(key.m_name, value, expected);
 }
 
 // Setters
@@ -169,41 +224,177 @@ const Transform& BlackBoard::GetValueAsTransform(const std::string& key) const
 	return gameObject->m_transform;
 }
 
+// Slot key
+void BlackBoard::SetValueAsBool(const BlackBoardKey& key, bool value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Bool;
+	entry.BoolValue = value;
+}
+
+void BlackBoard::SetValueAsInt(const BlackBoardKey& key, int value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Int;
+	entry.IntValue = value;
+}
+
+void BlackBoard::SetValueAsFloat(const BlackBoardKey& key, float value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Float;
+	entry.FloatValue = value;
+}
+
+void BlackBoard::SetValueAsString(const BlackBoardKey& key, const std::string& value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::String;
+	entry.StringValue = value;
+}
+
+void BlackBoard::SetValueAsVector2(const BlackBoardKey& key, const Mathf::Vector2& value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Vector2;
+	entry.Vec2Value = value;
+}
+
+void BlackBoard::SetValueAsVector3(const BlackBoardKey& key, const Mathf::Vector3& value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Vector3;
+	entry.Vec3Value = value;
+}
+
+void BlackBoard::SetValueAsVector4(const BlackBoardKey& key, const Mathf::Vector4& value)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::Vector4;
+	entry.Vec4Value = value;
+}
+
+void BlackBoard::SetValueAsGameObject(const BlackBoardKey& key, const std::string& objectName)
+{
+	auto& entry = GetOrCreate(key);
+	entry.Type = BlackBoardType::GameObject;
+	entry.StringValue = objectName;
+}
+
+bool BlackBoard::GetValueAsBool(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Bool).BoolValue;
+}
+
+int BlackBoard::GetValueAsInt(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Int).IntValue;
+}
+
+float BlackBoard::GetValueAsFloat(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Float).FloatValue;
+}
+
+const std::string& BlackBoard::GetValueAsString(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::String).StringValue;
+}
+
+const Mathf::Vector2& BlackBoard::GetValueAsVector2(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Vector2).Vec2Value;
+}
+
+const Mathf::Vector3& BlackBoard::GetValueAsVector3(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Vector3).Vec3Value;
+}
+
+const Mathf::Vector4& BlackBoard::GetValueAsVector4(const BlackBoardKey& key) const
+{
+	return GetChecked(key, BlackBoardType::Vector4).Vec4Value;
+}
+
+GameObject* BlackBoard::GetValueAsGameObject(const BlackBoardKey& key) const
+{
+	auto& entry = GetChecked(key, BlackBoardType::GameObject);
+	auto gameObject = GameObject::Find(entry.StringValue);
+	if (!gameObject)
+	{
+		Debug->LogError("GameObject not found: " + entry.StringValue);
+
+		throw std::runtime_error("GameObject not found: " + entry.StringValue);
+	}
+
+	return gameObject;
+}
+
+const Transform& BlackBoard::GetValueAsTransform(const BlackBoardKey& key) const
+{
+	auto& entry = GetChecked(key, BlackBoardType::Transform);
+	auto gameObject = GameObject::Find(entry.StringValue);
+	if (!gameObject)
+	{
+		Debug->LogError("GameObject not found: " + entry.StringValue);
+
+		throw std::runtime_error("GameObject not found: " + entry.StringValue);
+	}
+
+	return gameObject->m_transform;
+}
+
 void BlackBoard::AddKey(const std::string& key, const BlackBoardType& type)
 {
 	if (HasKey(key)) return;
 
-	m_values[key].Type = type;
+	GetOrCreate(key).Type = type;
 }
 
 // Other
 bool BlackBoard::HasKey(const std::string& key) const
 {
-	return m_values.find(key) != m_values.end();
+	return m_slotIndex.find(key) != m_slotIndex.end();
 }
 
 BlackBoardType BlackBoard::GetType(const std::string& key) const
 {
-	auto it = m_values.find(key);
-	if (it != m_values.end())
-		return it->second.Type;
+	const uint32_t slot = FindSlot(key);
+	if (BlackBoardKey::InvalidSlot != slot)
+		return m_slots[slot].Type;
 	return BlackBoardType::None;
 }
 
 void BlackBoard::RemoveKey(const std::string& key)
 {
-	m_values.erase(key);
+	auto it = m_slotIndex.find(key);
+	if (it == m_slotIndex.end()) return;
+
+	//   ڸ Ű 迭  Ѵ
+	const uint32_t slot = it->second;
+	const uint32_t last = static_cast<uint32_t>(m_slots.size()) - 1;
+	m_slotIndex.erase(it);
+	if (slot != last)
+	{
+		m_slots[slot] = std::move(m_slots[last]);
+		m_slotNames[slot] = std::move(m_slotNames[last]);
+		m_slotIndex[m_slotNames[slot]] = slot;
+	}
+	m_slots.pop_back();
+	m_slotNames.pop_back();
+	m_layoutId = NextLayoutId();
 }
 
 void BlackBoard::RenameKey(const std::string& curKey, const std::string& newKey)
 {
-	BlackBoardValue curValue;
-	if(m_values.find(curKey) != m_values.end())
-	{
-		curValue = m_values[curKey];
-		m_values.erase(curKey);
-		m_values[newKey] = curValue;
-	}
+	auto it = m_slotIndex.find(curKey);
+	if (it == m_slotIndex.end() || HasKey(newKey)) return;
+
+	const uint32_t slot = it->second;
+	m_slotIndex.erase(it);
+	m_slotIndex[newKey] = slot;
+	m_slotNames[slot] = newKey;
+	m_layoutId = NextLayoutId();
 }
 
 void BlackBoard::Serialize(std::string_view name)
@@ -228,11 +419,11 @@ void BlackBoard::Serialize(std::string_view name)
 	}
 
 	MetaYml::Node node;
-	for(auto& [key, value] : m_values)
+	for (uint32_t slot = 0; slot < m_slots.size(); ++slot)
 	{
 		MetaYml::Node entryNode;
-		entryNode["key"] = key;
-		entryNode["value"] = Meta::Serialize(&value);
+		entryNode["key"] = m_slotNames[slot];
+		entryNode["value"] = Meta::Serialize(&m_slots[slot]);
 		node[m_name].push_back(entryNode);
 	}
 
@@ -249,21 +440,22 @@ void BlackBoard::Deserialize(std::string_view name)
 	}
 
 	file::path filePath = PathFinder::Relative("BehaviorTree\\" + std::string(name) + ".blackboard");
-	if (!file::exists(filePath))
+	if (!PakFileSystems->Exists(filePath))
 	{
 		Debug->LogError("Blackboard file not found: " + filePath.string());
 
 		throw std::runtime_error("Blackboard file not found: " + filePath.string());
 	}
 
-	MetaYml::Node node = MetaYml::LoadFile(filePath.string());
+	AssetStream blackboardFile(filePath);
+	MetaYml::Node node = MetaYml::Load(blackboardFile);
 	for (const auto& entry : node[m_name])
 	{
 		std::string key = entry["key"].as<std::string>();
-		if (key.empty() || m_values.find(key) != m_values.end())
+		if (key.empty() || HasKey(key))
 			continue; // Skip empty keys
 
-		BlackBoardValue& bbValue = m_values[key]; // Get or create the entry
+		BlackBoardValue& bbValue = GetOrCreate(key); //    Ѵ
 		Meta::Deserialize(&bbValue, entry["value"]);
 	}
 }
@@ -271,5 +463,8 @@ void BlackBoard::Deserialize(std::string_view name)
 void BlackBoard::Clear()
 {
 	m_name.clear();
-	m_values.clear();
+	m_slots.clear();
+	m_slotNames.clear();
+	m_slotIndex.clear();
+	m_layoutId = NextLayoutId();
 }
\ No newline at end of file
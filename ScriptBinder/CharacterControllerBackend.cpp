@@ -0,0 +1,70 @@
+#include "CharacterControllerBackend.h"
+#include "../Physics/CharacterMovement.h"
+
+void NullCharacterControllerBackend::Submit(const ControllerUploadBatch& batch)
+{
+	++m_submitCount;
+
+	for (size_t i = 0; i < batch.Size(); ++i)
+	{
+		auto [it, inserted] = m_slotById.try_emplace(batch.ids[i], static_cast<uint32_t>(m_ids.size()));
+		if (inserted)
+		{
+			m_ids.push_back(batch.ids[i]);
+			m_positions.emplace_back();
+			m_velocities.emplace_back();
+		}
+
+		const uint32_t slot = it->second;
+
+		// PhysicX::ApplyControllerBatch 처럼 배치의 이동 상태를 CharacterMovement 에 싣고 한 스텝 계산한다.
+		// 배치에 없는 마찰/점프/중력 값은 CharacterMovement 기본값(0) 을 쓴다
+		CharacterMovement movement;
+		movement.SetIsFall(0 != batch.isFall[i]);
+		movement.SetVelocity(batch.velocities[i]);
+		movement.SetMaxSpeed(batch.maxSpeeds[i]);
+		movement.SetAcceleration(batch.accelerations[i]);
+		movement.Update(batch.deltaTime, batch.inputs[i], 0 != batch.isDynamic[i]);
+
+		DirectX::SimpleMath::Vector3 velocity = movement.GetOutVector();
+
+		const uint8_t restrictMask = batch.restricts[i];
+		auto isRestricted = [restrictMask](ERestrictDirection direction)
+		{
+			return 0 != (restrictMask & (1u << static_cast<int>(direction)));
+		};
+		if ((velocity.x < 0.f && isRestricted(ERestrictDirection::MINUS_X)) ||
+			(velocity.x > 0.f && isRestricted(ERestrictDirection::PlUS_X)))
+		{
+			velocity.x = 0.f;
+		}
+		if ((velocity.z < 0.f && isRestricted(ERestrictDirection::MINUS_Z)) ||
+			(velocity.z > 0.f && isRestricted(ERestrictDirection::PLUS_Z)))
+		{
+			velocity.z = 0.f;
+		}
+
+		// CharacterController::ApplyMove 와 같이 제한을 건 출력 벡터를 이번 스텝 변위로 쓰고,
+		// PhysicX::ReadControllers 와 같이 속도는 제한 전 출력 벡터를 돌려준다
+		m_positions[slot] = batch.positions[i] + velocity;
+		m_velocities[slot] = movement.GetOutVector();
+	}
+}
+
+void NullCharacterControllerBackend::Read(ControllerReadbackBatch& outBatch)
+{
+	outBatch.Clear();
+	outBatch.ids = m_ids;
+	outBatch.positions = m_positions;
+	outBatch.velocities = m_velocities;
+	outBatch.isFall.assign(m_ids.size(), 0);
+}
+
+void NullCharacterControllerBackend::Clear()
+{
+	m_slotById.clear();
+	m_ids.clear();
+	m_positions.clear();
+	m_velocities.clear();
+	m_submitCount = 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+// PhysicsManager 의 CCT 일괄 제출/읽기 단계와 실제 CCT 물리 사이의 경계.
+// PxScene 없이도 수집 -> 제출 -> 읽기 단계를 돌려 볼 수 있게 PhysX 헤더를 쓰지 않는다.
+#include "../Physics/PhysicsSyncBuffer.h"
+#include <unordered_map>
+
+class ICharacterControllerBackend
+{
+public:
+	virtual ~ICharacterControllerBackend() = default;
+
+	// 고정 스텝마다 한 번, 모든 CCT 의 입력/이동 상태를 넘긴다 (이동은 다음 시뮬레이션에서 일어난다)
+	virtual void Submit(const ControllerUploadBatch& batch) = 0;
+	// 시뮬레이션이 끝난 뒤 CCT 결과를 한 번에 읽는다
+	virtual void Read(ControllerReadbackBatch& outBatch) = 0;
+};
+
+// 충돌 없이 CharacterMovement 로 위치만 적분하는 백엔드 (헤드리스 검증, 벤치마크용)
+// Submit 한 번이 batch.deltaTime 길이의 시뮬레이션 한 스텝이고, 이동 제한은 PhysicX 와 같은 규칙으로 적용한다.
+// 바닥은 항상 있다고 보므로 스텝이 끝나면 떨어지는 중이 아니다.
+class NullCharacterControllerBackend final : public ICharacterControllerBackend
+{
+public:
+	void Submit(const ControllerUploadBatch& batch) override;
+	void Read(ControllerReadbackBatch& outBatch) override;
+
+	void Clear();
+
+	uint32_t GetSubmitCount() const { return m_submitCount; }
+	size_t GetControllerCount() const { return m_ids.size(); }
+
+private:
+	std::unordered_map<unsigned int, uint32_t>		m_slotById;
+	std::vector<unsigned int>					m_ids;
+	std::vector<DirectX::SimpleMath::Vector3>		m_positions;
+	std::vector<DirectX::SimpleMath::Vector3>		m_velocities;
+	uint32_t									m_submitCount{};
+};
@@ -34,17 +34,8 @@ void CharacterControllerComponent::OnFixedUpdate(float fixedDeltaTime)
 
 	input.Normalize();
 
-	CharactorControllerInputInfo inputInfo;
-	inputInfo.id = m_controllerInfo.id;
-	inputInfo.input = input;
-	auto component = GetOwner()->GetComponent<RigidBodyComponent>();
-	if (!component) return;
-
-	inputInfo.isDynamic = component->GetBodyType() == EBodyType::DYNAMIC;
-	Physics->AddInputMove(inputInfo);
-
-
-	Physics->SetCharacterMovementMaxSpeed(inputInfo, m_movementInfo.maxSpeed);
+	// PhysicsManager::SetPhysicData   CCT Է    ѱ
+	m_moveDirection = input;
 
 	if (m_useAutomaticRotation)
 	{
@@ -84,6 +75,13 @@ void CharacterControllerComponent::OnLateUpdate(float fixedDeltaTime)
 }
 
 
+DirectX::SimpleMath::Vector3 CharacterControllerComponent::ConsumeMoveDirection()
+{
+	DirectX::SimpleMath::Vector3 direction = m_moveDirection;
+	m_moveDirection = DirectX::SimpleMath::Vector3::Zero;
+	return direction;
+}
+
 void CharacterControllerComponent::ForcedSetPosition(const DirectX::SimpleMath::Vector3& pos)
 {
 	PhysicsManagers->SetControllerPosition(m_controllerInfo.id, pos);
@@ -177,6 +177,9 @@ public:
 		return m_collsionCount;
 	}
 
+	//̹   ȭ ̵ Է  (PhysicsManager ϰ ,  )
+	DirectX::SimpleMath::Vector3 ConsumeMoveDirection();
+
 	//̵ ش  ġ ̵
 	void ForcedSetPosition(const DirectX::SimpleMath::Vector3& pos);
 	// CCT ڵ ȸ  Ѱų ϴ.
@@ -220,6 +223,7 @@ private:
 	bool m_useAutomaticRotation{ true }; // ڵ ȸ   
 
 	DirectX::SimpleMath::Vector3 m_lookDirection;
+	DirectX::SimpleMath::Vector3 m_moveDirection{}; //OnFixedUpdate  ȭ ̵ Է
 	bool m_hasCustomLookDirection = false;
 
 	Transform* m_transform;
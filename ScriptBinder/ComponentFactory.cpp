@@ -458,6 +458,10 @@ void ComponentFactory::LoadComponent(GameObject* obj, const MetaYml::detail::ite
 			}
 
 			foliage->m_foliageAssetGuid = FoliageGuid.as<std::string>();
+			if (itNode["m_cullDistance"])
+			{
+				foliage->m_cullDistance = itNode["m_cullDistance"].as<float>();
+			}
 
 			foliage->LoadFoliageAsset(foliage->m_foliageAssetGuid);
 
@@ -490,24 +494,8 @@ void ComponentFactory::LoadComponent(GameObject* obj, const MetaYml::detail::ite
 				}
 			}
 
-			MetaYml::Node foliageInstanceNode = itNode["m_foliageInstances"];
-
-			for(auto& instance : foliage->GetFoliageInstances())
-			{
-				Mathf::Matrix modelMatrix = Mathf::xMatrixIdentity;
-				Mathf::Vector3 position = instance.m_position;
-				Mathf::Vector3 rotation = instance.m_rotation;
-				Mathf::Vector3 scale = instance.m_scale;
-
-				modelMatrix = Mathf::Matrix::CreateScale(scale) *
-					Mathf::Matrix::CreateRotationX(Mathf::ToRadians(rotation.x)) *
-					Mathf::Matrix::CreateRotationY(Mathf::ToRadians(rotation.y)) *
-					Mathf::Matrix::CreateRotationZ(Mathf::ToRadians(rotation.z)) *
-					Mathf::Matrix::CreateTranslation(position);
-
-				const_cast<Mathf::xMatrix&>(instance.m_worldMatrix) = modelMatrix;
-			}
-
+			// mesh bounds are known now, so rebuild the cached matrices and clusters
+			foliage->RebuildClusters();
 
 			foliage->SetOwner(obj);
 			foliage->SetEnabled(true);
@@ -711,14 +699,56 @@ void ComponentFactory::LoadComponent(GameObject* obj, const MetaYml::detail::ite
 			component->SetOwner(obj);
 		}
 
-		if (isEditorToGame)
-		{
-			component->MakeInstanceID();
-		}
-		// Initialize if the component is initializable
-		if (auto initializable = dynamic_cast<System::IInitializable*>(component))
-		{
-			initializable->Initialize();
-		}
+		FinishLoad(component, isEditorToGame);
     }
 }
+
+void ComponentFactory::LoadComponent(GameObject* obj, const Meta::Type& componentType, const std::function<void(void*)>& deserialize, bool isEditorToGame)
+{
+	auto component = obj->AddComponent(componentType).get();
+	if (!component)
+	{
+		return;
+	}
+
+	deserialize(reinterpret_cast<void*>(component));
+	component->SetOwner(obj);
+	FinishLoad(component, isEditorToGame);
+}
+
+bool ComponentFactory::HasCustomLoader(HashedGuid typeID) const
+{
+	using namespace TypeTrait;
+	static const HashedGuid customTypes[] =
+	{
+		type_guid(MeshRenderer),
+		type_guid(Animator),
+		type_guid(LightComponent),
+		type_guid(CameraComponent),
+		type_guid(SpriteRenderer),
+		type_guid(FoliageComponent),
+		type_guid(TerrainComponent),
+		type_guid(BehaviorTreeComponent),
+		type_guid(PlayerInputComponent),
+		type_guid(Canvas),
+		type_guid(ImageComponent),
+		type_guid(TextComponent),
+		type_guid(SpriteSheetComponent),
+		type_guid(SoundComponent),
+	};
+
+	return std::find(std::begin(customTypes), std::end(customTypes), typeID) != std::end(customTypes);
+}
+
+void ComponentFactory::FinishLoad(Component* component, bool isEditorToGame)
+{
+	if (isEditorToGame)
+	{
+		component->MakeInstanceID();
+	}
+	// Initialize if the component is initializable
+	if (auto initializable = dynamic_cast<System::IInitializable*>(component))
+	{
+		initializable->Initialize();
+	}
+}
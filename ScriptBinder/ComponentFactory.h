@@ -4,6 +4,7 @@
 #include "ReflectionYml.h"
 
 class GameObject;
+class Component;
 class ComponentFactory : public DLLCore::Singleton<ComponentFactory>
 {
 private:
@@ -14,6 +15,15 @@ private:
 public:
 	void Initialize();
 	void LoadComponent(GameObject* obj, const MetaYml::detail::iterator_value& itNode, bool isEditorToGame = false);
+	// Cooked scene path: the caller writes the properties (no YAML), only for types without a custom loader
+	void LoadComponent(GameObject* obj, const Meta::Type& componentType, const std::function<void(void*)>& deserialize, bool isEditorToGame = false);
+	// True when LoadComponent(itNode) does more than Deserialize + SetOwner for this type
+	bool HasCustomLoader(HashedGuid typeID) const;
+
+private:
+	void FinishLoad(Component* component, bool isEditorToGame);
+
+public:
 
 	std::map<std::string, const Meta::Type*> m_componentTypes{};
 };
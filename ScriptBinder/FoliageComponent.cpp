@@ -4,7 +4,8 @@
 #include "Terrain.h"
 #include "Scene.h"
 #include "Camera.h"
-#include "SceneManager.h"
+#include "Core.JobSystem.h"
+#include "Core.PakFileSystem.h"
 #include <random>
 
 void FoliageComponent::Awake()
@@ -49,32 +50,57 @@ void FoliageComponent::OnDestroy()
     }
 }
 
+namespace
+{
+    constexpr uint32 FoliageAssetMagic = 0x314C4F46; // "FOL1"
+    constexpr uint32 FoliageAssetVersion = 1;
+
+    // .foliage  ״  νϽ ڵ
+    struct FoliageInstanceRecord
+    {
+        Mathf::Vector3 position;
+        Mathf::Vector3 rotation;
+        Mathf::Vector3 scale;
+        uint32 foliageTypeID;
+    };
+    static_assert(sizeof(FoliageInstanceRecord) == 40);
+}
+
 void FoliageComponent::SaveFoliageAsset(const file::path& savePath)
 {
 	file::path path = savePath.string() + ".foliage";
-	std::ofstream outFile(path);
+	std::ofstream outFile(path, std::ios::binary);
     if (!outFile.is_open())
     {
         std::cerr << "Failed to open file for saving foliage asset: " << path << std::endl;
         return;
 	}
 
-	MetaYml::Node assetNode;
-    for (auto& type : m_foliageTypes)
-    {
-        MetaYml::Node typeNode = Meta::Serialize(&type);
-        assetNode["FoliageAsset"]["Types"].push_back(typeNode);
-	}
+    //  + Ÿ + νϽ 迭 (YAML  °   ִ ̳ʸ)
+    uint32 typeCount = static_cast<uint32>(m_foliageTypes.size());
+    uint32 instanceCount = static_cast<uint32>(m_foliageInstances.size());
+    outFile.write(reinterpret_cast<const char*>(&FoliageAssetMagic), sizeof(FoliageAssetMagic));
+    outFile.write(reinterpret_cast<const char*>(&FoliageAssetVersion), sizeof(FoliageAssetVersion));
+    outFile.write(reinterpret_cast<char*>(&typeCount), sizeof(typeCount));
+    outFile.write(reinterpret_cast<char*>(&instanceCount), sizeof(instanceCount));
 
-    for (auto& instance : m_foliageInstances)
+    for (const auto& type : m_foliageTypes)
     {
-        MetaYml::Node instanceNode = Meta::Serialize(&instance);
-        assetNode["FoliageAsset"]["Instances"].push_back(instanceNode);
-	}
+        uint32 nameSize = static_cast<uint32>(type.m_modelName.size());
+        outFile.write(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
+        outFile.write(type.m_modelName.data(), nameSize);
+        outFile.write(reinterpret_cast<const char*>(&type.m_castShadow), sizeof(type.m_castShadow));
+        outFile.write(reinterpret_cast<const char*>(&type.m_isShadowRecive), sizeof(type.m_isShadowRecive));
+    }
 
-    outFile << assetNode;
+    std::vector<FoliageInstanceRecord> records;
+    records.reserve(m_foliageInstances.size());
+    for (const auto& instance : m_foliageInstances)
+    {
+        records.push_back({ instance.m_position, instance.m_rotation, instance.m_scale, instance.m_foliageTypeID });
+    }
+    outFile.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(FoliageInstanceRecord));
     outFile.close();
-    outFile.flush();
 	DataSystems->ForceCreateYamlMetaFile(path);
 
 	std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Ensure file is written before next operation
@@ -82,7 +108,6 @@ void FoliageComponent::SaveFoliageAsset(const file::path& savePath)
     if (metaGuid != nullFileGuid)
     {
         m_foliageAssetGuid = metaGuid;
-        assetNode["FoliageAsset"]["Guid"] = m_foliageAssetGuid.ToString();
     }
     else
     {
@@ -102,27 +127,86 @@ void FoliageComponent::LoadFoliageAsset(FileGuid assetGuid)
         return;
     }
 
-    MetaYml::Node assetNode = MetaYml::LoadFile(assetPath.string());
-    if (assetNode.IsNull() || !assetNode["FoliageAsset"])
+    AssetStream file(assetPath, std::ios::binary);
+    if (!file)
     {
         std::cerr << "Invalid foliage asset file: " << assetPath << std::endl;
         return;
     }
 
+    uint32 magic{};
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+
     m_foliageTypes.clear();
     m_foliageInstances.clear();
-    for (const auto& typeNode : assetNode["FoliageAsset"]["Types"])
+    MarkClustersDirty();
+
+    if (FoliageAssetMagic != magic)
+    {
+        //  YAML  (ٽ ϸ ̳ʸ ȴ)
+        file.clear();
+        file.seekg(0);
+        MetaYml::Node assetNode = MetaYml::Load(file);
+        if (assetNode.IsNull() || !assetNode["FoliageAsset"])
+        {
+            std::cerr << "Invalid foliage asset file: " << assetPath << std::endl;
+            return;
+        }
+
+        for (const auto& typeNode : assetNode["FoliageAsset"]["Types"])
+        {
+            FoliageType type;
+            Meta::Deserialize(&type, typeNode);
+            m_foliageTypes.push_back(type);
+        }
+
+        for (const auto& instanceNode : assetNode["FoliageAsset"]["Instances"])
+        {
+            FoliageInstance instance;
+            Meta::Deserialize(&instance, instanceNode);
+            m_foliageInstances.push_back(instance);
+        }
+
+        std::cout << "Foliage asset loaded successfully: " << assetPath << std::endl;
+        return;
+    }
+
+    uint32 version{};
+    uint32 typeCount{};
+    uint32 instanceCount{};
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&typeCount), sizeof(typeCount));
+    file.read(reinterpret_cast<char*>(&instanceCount), sizeof(instanceCount));
+
+    m_foliageTypes.reserve(typeCount);
+    for (uint32 i = 0; i < typeCount && file; ++i)
     {
         FoliageType type;
-        Meta::Deserialize(&type, typeNode);
-        AddFoliageType(type);
+        uint32 nameSize{};
+        file.read(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
+        type.m_modelName.resize(nameSize);
+        file.read(type.m_modelName.data(), nameSize);
+        file.read(reinterpret_cast<char*>(&type.m_castShadow), sizeof(type.m_castShadow));
+        file.read(reinterpret_cast<char*>(&type.m_isShadowRecive), sizeof(type.m_isShadowRecive));
+        m_foliageTypes.push_back(type);
+    }
+
+    std::vector<FoliageInstanceRecord> records(instanceCount);
+    file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(FoliageInstanceRecord));
+    if (!file)
+    {
+        m_foliageTypes.clear();
+        std::cerr << "Broken foliage asset file: " << assetPath << std::endl;
+        return;
     }
 
-    for (const auto& instanceNode : assetNode["FoliageAsset"]["Instances"])
+    m_foliageInstances.resize(instanceCount);
+    for (uint32 i = 0; i < instanceCount; ++i)
     {
-        FoliageInstance instance;
-        Meta::Deserialize(&instance, instanceNode);
-        AddFoliageInstance(instance);
+        m_foliageInstances[i].m_position = records[i].position;
+        m_foliageInstances[i].m_rotation = records[i].rotation;
+        m_foliageInstances[i].m_scale = records[i].scale;
+        m_foliageInstances[i].m_foliageTypeID = records[i].foliageTypeID;
     }
 	std::cout << "Foliage asset loaded successfully: " << assetPath << std::endl;
 }
@@ -130,12 +214,16 @@ void FoliageComponent::LoadFoliageAsset(FileGuid assetGuid)
 void FoliageComponent::AddFoliageType(const FoliageType& type)
 {
     m_foliageTypes.push_back(type);
+    MarkClustersDirty();
 }
 
 void FoliageComponent::RemoveFoliageType(uint32 typeID)
 {
     if (typeID < m_foliageTypes.size())
+    {
         m_foliageTypes.erase(m_foliageTypes.begin() + typeID);
+        MarkClustersDirty();
+    }
 }
 
 void FoliageComponent::AddFoliageInstance(const FoliageInstance& instance)
@@ -149,13 +237,17 @@ void FoliageComponent::AddFoliageInstance(const FoliageInstance& instance)
     if (found == m_foliageInstances.end())
     {
         m_foliageInstances.push_back(instance);
+        MarkClustersDirty();
     }
 }
 
 void FoliageComponent::RemoveFoliageInstance(size_t index)
 {
     if(index < m_foliageInstances.size())
+    {
         m_foliageInstances.erase(m_foliageInstances.begin()+index);
+        MarkClustersDirty();
+    }
 }
 
 void FoliageComponent::AddInstanceFromTerrain(TerrainComponent* terrain, const FoliageInstance& instance)
@@ -211,33 +303,118 @@ void FoliageComponent::RemoveInstancesInBrush(TerrainComponent* terrain, const T
             float dz = inst.m_position.z - brush.m_center.y;
             return dx * dx + dz * dz <= brush.m_radius * brush.m_radius;
         }), m_foliageInstances.end());
+    MarkClustersDirty();
 }
-//helper
-std::vector<std::pair<size_t, size_t>> DivideRangeAuto(size_t count)
+void FoliageComponent::RebuildClusters()
 {
-    std::vector<std::pair<size_t, size_t>> ranges;
-    if (count == 0)
-        return ranges;
+    m_isClusterDirty = false;
 
-    unsigned int hwThreads = std::thread::hardware_concurrency();
-    if (hwThreads == 0) hwThreads = 4; //  ⺻ (̰ )
+    //    νϽ پ ֵ   Ѵ ( ȿ   )
+    auto cellOf = [](const FoliageInstance& instance)
+    {
+        const int32 x = static_cast<int32>(std::floor(instance.m_position.x / ClusterCellSize));
+        const int32 z = static_cast<int32>(std::floor(instance.m_position.z / ClusterCellSize));
+        return (static_cast<int64>(z) << 32) | static_cast<uint32>(x);
+    };
+    std::ranges::stable_sort(m_foliageInstances, {}, cellOf);
 
-    const size_t numSplits = hwThreads * 2 + 1;
-    ranges.reserve(numSplits);
+    const size_t count = m_foliageInstances.size();
+    const size_t paddedCount = (count + 3) & ~size_t(3);
+    auto matrices = std::make_shared<std::vector<Mathf::xMatrix>>(count);
+
+    // е ĭ ˻縸 ϰ  
+    BoundsSoA& bounds = m_instanceBounds;
+    bounds.centerX.assign(paddedCount, 0.f);
+    bounds.centerY.assign(paddedCount, 0.f);
+    bounds.centerZ.assign(paddedCount, 0.f);
+    bounds.extentX.assign(paddedCount, 0.f);
+    bounds.extentY.assign(paddedCount, 0.f);
+    bounds.extentZ.assign(paddedCount, 0.f);
+
+    m_clusters.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const FoliageInstance& instance = m_foliageInstances[i];
+        const Mathf::xMatrix world =
+            Mathf::Matrix::CreateScale(instance.m_scale) *
+            Mathf::Matrix::CreateRotationX(Mathf::ToRadians(instance.m_rotation.x)) *
+            Mathf::Matrix::CreateRotationY(Mathf::ToRadians(instance.m_rotation.y)) *
+            Mathf::Matrix::CreateRotationZ(Mathf::ToRadians(instance.m_rotation.z)) *
+            Mathf::Matrix::CreateTranslation(instance.m_position);
+        (*matrices)[i] = world;
+
+        DirectX::BoundingBox localBox{};
+        if (instance.m_foliageTypeID < m_foliageTypes.size() && m_foliageTypes[instance.m_foliageTypeID].m_mesh)
+        {
+            localBox = m_foliageTypes[instance.m_foliageTypeID].m_mesh->GetBoundingBox();
+        }
 
-    const size_t chunk = (count + numSplits - 1) / numSplits; // ceil(count / numSplits)
-    size_t begin = 0;
+        DirectX::BoundingBox worldBox{};
+        localBox.Transform(worldBox, world);
+        bounds.centerX[i] = worldBox.Center.x;
+        bounds.centerY[i] = worldBox.Center.y;
+        bounds.centerZ[i] = worldBox.Center.z;
+        bounds.extentX[i] = worldBox.Extents.x;
+        bounds.extentY[i] = worldBox.Extents.y;
+        bounds.extentZ[i] = worldBox.Extents.z;
 
-    for (size_t i = 0; i < numSplits; ++i)
-    {
-        size_t end = std::min(begin + chunk, count);
-        if (begin >= end)
-            break;
-        ranges.emplace_back(begin, end);
-        begin = end;
+        if (0 == i || cellOf(m_foliageInstances[i - 1]) != cellOf(instance))
+        {
+            m_clusters.push_back({ worldBox, static_cast<uint32>(i), 0 });
+        }
+        else
+        {
+            DirectX::BoundingBox::CreateMerged(m_clusters.back().bounds, m_clusters.back().bounds, worldBox);
+        }
+        ++m_clusters.back().instanceCount;
     }
 
-    return ranges;
+    //  尡  ִ   ״ ΰ    ٲ۴
+    m_instanceMatrices = std::move(matrices);
+    m_clusterVisible.resize(m_clusters.size());
+}
+
+void FoliageComponent::CullCluster(const Cluster& cluster, const Mathf::xVector planes[6], std::vector<uint32>& outVisible) const
+{
+    const BoundsSoA& bounds = m_instanceBounds;
+    const uint32 begin = cluster.firstInstance & ~3u;
+    const uint32 end = cluster.firstInstance + cluster.instanceCount;
+
+    // 4 AABB- ˻: ߽ Ÿ >  ݰ̸  
+    for (uint32 base = begin; base < end; base += 4)
+    {
+        const XMVECTOR cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.centerX[base]));
+        const XMVECTOR cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.centerY[base]));
+        const XMVECTOR cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.centerZ[base]));
+        const XMVECTOR ex = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extentX[base]));
+        const XMVECTOR ey = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extentY[base]));
+        const XMVECTOR ez = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&bounds.extentZ[base]));
+
+        XMVECTOR outside = XMVectorFalseInt();
+        for (int p = 0; p < 6; ++p)
+        {
+            const XMVECTOR a = XMVectorSplatX(planes[p]);
+            const XMVECTOR b = XMVectorSplatY(planes[p]);
+            const XMVECTOR c = XMVectorSplatZ(planes[p]);
+            const XMVECTOR d = XMVectorSplatW(planes[p]);
+
+            const XMVECTOR distance = XMVectorMultiplyAdd(a, cx, XMVectorMultiplyAdd(b, cy, XMVectorMultiplyAdd(c, cz, d)));
+            const XMVECTOR radius = XMVectorMultiplyAdd(XMVectorAbs(a), ex, XMVectorMultiplyAdd(XMVectorAbs(b), ey, XMVectorMultiply(XMVectorAbs(c), ez)));
+            outside = XMVectorOrInt(outside, XMVectorGreater(distance, radius));
+        }
+
+        XMUINT4 mask;
+        XMStoreUInt4(&mask, outside);
+        const uint32 lanes[4]{ mask.x, mask.y, mask.z, mask.w };
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            const uint32 index = base + lane;
+            if (0 == lanes[lane] && cluster.firstInstance <= index && index < end)
+            {
+                outVisible.push_back(index);
+            }
+        }
+    }
 }
 
 void FoliageComponent::UpdateFoliageCullingData(Camera* camera)
@@ -245,71 +422,95 @@ void FoliageComponent::UpdateFoliageCullingData(Camera* camera)
     if (!camera) return;
     if (m_foliageTypes.empty()) return;
 
+    if (m_isClusterDirty)
+    {
+        RebuildClusters();
+    }
+
+    m_visibleInstances.resize(m_foliageTypes.size());
+    for (auto& visible : m_visibleInstances)
+    {
+        visible.clear();
+    }
+
     const size_t count = m_foliageInstances.size();
     if (count == 0) return;
 
-    //   ĸó( )
-    const auto frustum = camera->GetFrustum();
-
-    auto process_range = [&](size_t begin, size_t end)
+    // Ϳ ø ʴ´
+    if (!SceneManagers->IsGameStart())
     {
-        for (size_t i = begin; i < end; ++i)
+        for (uint32 i = 0; i < count; ++i)
         {
-            if (i >= m_foliageInstances.size()) return;
-
-            auto& foliage = m_foliageInstances[i];
+            const uint32 typeID = m_foliageInstances[i].m_foliageTypeID;
+            if (typeID < m_visibleInstances.size())
+            {
+                m_visibleInstances[typeID].push_back(i);
+            }
+        }
+        return;
+    }
 
-            //  üũ : >=
-            if (static_cast<size_t>(foliage.m_foliageTypeID) >= m_foliageTypes.size())
-                continue;
+    // νϽ ٿ Ʈ  ̹Ƿ Ұ ī޶ ġ ÷ ű
+    const Mathf::xMatrix ownerWorld = GetOwner()->m_transform.GetWorldMatrix();
+    const Mathf::xMatrix toLocal = XMMatrixInverse(nullptr, ownerWorld);
+    DirectX::BoundingFrustum frustum;
+    camera->GetFrustum().Transform(frustum, toLocal);
+    const XMVECTOR eye = XMVector3TransformCoord(camera->m_eyePosition, toLocal);
 
-            const Mathf::Vector3 position = foliage.m_position;
-            const Mathf::Vector3 rotation = foliage.m_rotation;
-            const Mathf::Vector3 scale = foliage.m_scale;
+    Mathf::xVector planes[6];
+    frustum.GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
 
-            foliage.m_worldMatrix =
-                Mathf::Matrix::CreateScale(scale) *
-                Mathf::Matrix::CreateRotationX(Mathf::ToRadians(rotation.x)) *
-                Mathf::Matrix::CreateRotationY(Mathf::ToRadians(rotation.y)) *
-                Mathf::Matrix::CreateRotationZ(Mathf::ToRadians(rotation.z)) *
-                Mathf::Matrix::CreateTranslation(position);
+    const float cullDistanceSq = m_cullDistance * m_cullDistance;
+    JobHandle cullGroup = JobSystems->ParallelFor(static_cast<uint32>(m_clusters.size()), 0, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 c = begin; c < end; ++c)
+        {
+            const Cluster& cluster = m_clusters[c];
+            std::vector<uint32>& visible = m_clusterVisible[c];
+            visible.clear();
 
-            const FoliageType& foliageType = m_foliageTypes[foliage.m_foliageTypeID];
-            Mesh* mesh = foliageType.m_mesh;
-            if (!mesh)
+            if (0.f < m_cullDistance)
             {
-                foliage.m_isCulled = true; //  ⺻
-                continue;
+                //  AABB  ִ Ÿ
+                const XMVECTOR center = XMLoadFloat3(&cluster.bounds.Center);
+                const XMVECTOR extents = XMLoadFloat3(&cluster.bounds.Extents);
+                const XMVECTOR delta = XMVectorMax(XMVectorSubtract(XMVectorAbs(XMVectorSubtract(eye, center)), extents), XMVectorZero());
+                if (cullDistanceSq < XMVectorGetX(XMVector3LengthSq(delta)))
+                {
+                    continue;
+                }
             }
 
-            if(SceneManagers->IsGameStart())
+            const DirectX::ContainmentType containment = frustum.Contains(cluster.bounds);
+            if (DirectX::DISJOINT == containment)
             {
-                DirectX::BoundingBox box = mesh->GetBoundingBox();
-                DirectX::BoundingBox tbox;
-                box.Transform(tbox, foliage.m_worldMatrix);
-
-                foliage.m_isCulled = !frustum.Intersects(tbox);
+                continue;
             }
-            else
+
+            if (DirectX::CONTAINS == containment)
             {
-				foliage.m_isCulled = false;
+                for (uint32 i = 0; i < cluster.instanceCount; ++i)
+                {
+                    visible.push_back(cluster.firstInstance + i);
+                }
+                continue;
             }
-        }
-    };
-
-    auto ranges = DivideRangeAuto(m_foliageInstances.size());
 
-    std::vector<std::future<void>> tasks;
-    tasks.reserve(ranges.size());
-
-    for (auto& [begin, end] : ranges)
-    {
-        tasks.emplace_back(std::async(std::launch::async, process_range, begin, end));
-    }
+            CullCluster(cluster, planes, visible);
+        }
+    });
+    JobSystems->Wait(cullGroup);
 
-    // Ϸ 
-    for (auto& f : tasks)
+    // Ŭͺ  ŸԺ  
+    for (const auto& visible : m_clusterVisible)
     {
-        if (f.valid()) f.get();
+        for (uint32 index : visible)
+        {
+            const uint32 typeID = m_foliageInstances[index].m_foliageTypeID;
+            if (typeID < m_visibleInstances.size())
+            {
+                m_visibleInstances[typeID].push_back(index);
+            }
+        }
     }
 }
@@ -6,6 +6,7 @@ ReflectionFieldInheritance(FoliageComponent, Component) \
 	PropertyField \
 	({ \
 		meta_property(m_foliageAssetGuid) \
+		meta_property(m_cullDistance) \
 	}); \
 	FieldEnd(FoliageComponent, PropertyOnlyInheritance) \
 };
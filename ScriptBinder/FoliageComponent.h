@@ -33,13 +33,49 @@ public:
     void RemoveInstancesInBrush(TerrainComponent* terrain, const TerrainBrush& brush);
 
 	void UpdateFoliageCullingData(Camera* camera);
+    // rebuilds cached matrices, world bounds and clusters (called lazily after any edit)
+    void RebuildClusters();
+    void MarkClustersDirty() { m_isClusterDirty = true; }
 
     const std::vector<FoliageType>& GetFoliageTypes() const { return m_foliageTypes; }
     const std::vector<FoliageInstance>& GetFoliageInstances() const { return m_foliageInstances; }
+    // world matrices in instance order, shared with the render proxy until the next rebuild
+    std::shared_ptr<const std::vector<Mathf::xMatrix>> GetInstanceMatrices() const { return m_instanceMatrices; }
+    // visible instance indices per foliage type from the last culling
+    const std::vector<std::vector<uint32>>& GetVisibleInstances() const { return m_visibleInstances; }
 
     [[Property]]
     FileGuid m_foliageAssetGuid{};
+    [[Property]]
+    float m_cullDistance{ 0.f }; // 0 = no distance culling
+
+    static constexpr float ClusterCellSize = 32.f; // in heightmap units, so cells line up with the terrain grid
+
 private:
+    // instances of one grid cell, contiguous in m_foliageInstances
+    struct Cluster
+    {
+        DirectX::BoundingBox bounds{};
+        uint32 firstInstance{};
+        uint32 instanceCount{};
+    };
+
+    // world AABBs as structure of arrays, padded to a multiple of 4 for the SIMD test
+    struct BoundsSoA
+    {
+        std::vector<float> centerX, centerY, centerZ;
+        std::vector<float> extentX, extentY, extentZ;
+    };
+
+    void CullCluster(const Cluster& cluster, const Mathf::xVector planes[6], std::vector<uint32>& outVisible) const;
+
     std::vector<FoliageType> m_foliageTypes{};
     std::vector<FoliageInstance> m_foliageInstances{};
+
+    std::shared_ptr<const std::vector<Mathf::xMatrix>> m_instanceMatrices{ std::make_shared<std::vector<Mathf::xMatrix>>() };
+    BoundsSoA m_instanceBounds{};
+    std::vector<Cluster> m_clusters{};
+    std::vector<std::vector<uint32>> m_clusterVisible{};
+    std::vector<std::vector<uint32>> m_visibleInstances{};
+    bool m_isClusterDirty{ true };
 };
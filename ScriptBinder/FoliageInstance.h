@@ -12,8 +12,6 @@ struct FoliageInstance
     Mathf::Vector3 m_scale{ 1.f,1.f,1.f };
     [[Property]]
     uint32 m_foliageTypeID{ 0 }; // index of FoliageType
-    bool m_isCulled{ false }; // whether this instance is culled or not
-	Mathf::xMatrix m_worldMatrix{ Mathf::Matrix::Identity };
 
    ReflectFoliageInstance
     [[Serializable]]
@@ -244,6 +244,7 @@ void GameObject::AddChild(GameObject* _objcet)
 	_objcet->m_parentIndex = m_index;
 	m_childrenIndices.push_back(_objcet->m_index);
 	_objcet->m_transform.SetParentID(m_index);
+	scene->MarkHierarchyDirty();
 }
 
 void GameObject::RemoveComponentIndex(uint32 id)
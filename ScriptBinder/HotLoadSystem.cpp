@@ -471,6 +471,7 @@ void HotLoadSystem::BindScriptEvents(ModuleBehavior* script, std::string_view na
 {
 	auto owner = script->GetOwner();
 	auto activeScene = owner->GetScene();
+	if (activeScene) activeScene->MarkScriptEventsChanged();
 	auto sharedThis = std::static_pointer_cast<ModuleBehavior>(script->shared_from_this());
 	//결국 이렇게되면 .meta파일을 클라이언트가 가지고 있어야 됨...
 	std::string scriptMetaFile = "Assets\\Script\\" + std::string(name) + ".cpp" + ".meta";
@@ -586,6 +587,7 @@ void HotLoadSystem::UnbindScriptEvents(ModuleBehavior* script, std::string_view
 {
 	auto owner = script->GetOwner();
 	auto activeScene = owner->GetScene();
+	if (activeScene) activeScene->MarkScriptEventsChanged();
 
 	if (script->m_awakeEventHandle.IsValid())
 	{
@@ -1,5 +1,8 @@
 #pragma once
+#include "Core.Minimal.h"
 #include "Delegate.h"
+#include <functional>
+#include <vector>
 
 enum class AIType
 {
@@ -7,6 +10,16 @@ enum class AIType
 	FSM,
 };
 
+// 틱 주기 결정에 쓰는 중요도. Critical 은 거리와 예산에 상관없이 매 프레임 틱한다.
+enum class AITickImportance
+{
+	Low,
+	Normal,
+	High,
+	Critical,
+};
+AUTO_REGISTER_ENUM(AITickImportance)
+
 class IAIComponent
 {
 public:
@@ -17,8 +30,27 @@ public:
 	virtual AIType GetAIType() const { return m_aiType; }
 	virtual void InternalAIUpdate(float deltaSecond) {};
 
+	AITickImportance GetTickImportance() const { return m_tickImportance; }
+	void SetTickImportance(AITickImportance importance) { m_tickImportance = importance; }
+
+	// true 면 다른 AI 와 병렬로 틱한다. 자기 오브젝트 밖의 씬 상태를 바꾸는 작업은 DeferWrite 로 넘겨야 한다.
+	bool IsParallelTick() const { return m_isParallelTick; }
+	void SetParallelTick(bool isParallel) { m_isParallelTick = isParallel; }
+
+	// 틱이 끝난 뒤 AIManager 가 AI 순서대로 하나씩 실행한다
+	void DeferWrite(std::function<void()> write) { m_deferredWrites.push_back(std::move(write)); }
+
 	Core::DelegateHandle m_handle{};
 
 protected:
 	AIType m_aiType{ AIType::BT }; // Default to Behavior Tree
-};
\ No newline at end of file
+	AITickImportance m_tickImportance{ AITickImportance::Normal };
+	bool m_isParallelTick{ false };
+
+private:
+	friend class AIManager;
+
+	std::vector<std::function<void()>> m_deferredWrites;
+	float m_pendingDeltaSecond{};	// 건너뛴 프레임의 시간 누적
+	uint64_t m_lastTickFrame{};
+};
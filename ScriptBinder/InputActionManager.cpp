@@ -1,6 +1,7 @@
 #include "InputActionManager.h"
 #include "SceneManager.h"
 #include "PathFinder.h"
+#include "Core.PakFileSystem.h"
 InputActionManager* InputActionManagers = nullptr;
 void InputActionManager::Update(float tick)
 {
@@ -96,20 +97,19 @@ void InputActionManager::LoadManager()
 	ClearActionMaps();
 	namespace fs = std::filesystem;
 	fs::path dirPath = PathFinder::InputMapPath();
-	if (!fs::exists(dirPath) || !fs::is_directory(dirPath))
+	if (!PakFileSystems->IsMounted() && (!fs::exists(dirPath) || !fs::is_directory(dirPath)))
 	{
 		std::cerr << "Directory does not exist: " << dirPath << std::endl;
 		return;
 	}
 
-	for (const auto& entry : fs::directory_iterator(dirPath))
+	PakFileSystems->ForEachFile(dirPath, false, [&](const fs::path& filePath)
 	{
-		if (entry.is_regular_file() && entry.path().extension() == ".json")
+		if (filePath.extension() == ".json")
 		{
-			std::string filePath = entry.path().string();
-			m_actionMaps.push_back(DeSerializeMap(filePath));
+			m_actionMaps.push_back(DeSerializeMap(filePath.string()));
 		}
-	}
+	});
 }
 
 nlohmann::json InputActionManager::SerializeMap(ActionMap* _actionMap)
@@ -156,7 +156,7 @@ nlohmann::json InputActionManager::SerializeMap(ActionMap* _actionMap)
 
 ActionMap* InputActionManager::DeSerializeMap(std::string _filepath)
 {
-	std::ifstream file(_filepath);
+	AssetStream file(_filepath);
 	if (!file.is_open())
 	{
 		std::cerr << "Failed to open: " << _filepath << std::endl;
@@ -0,0 +1,246 @@
+#include "InputBindingTable.h"
+#include "ActionMap.h"
+#include "InputAction.h"
+#include "InputManager.h"
+#include "ModuleBehavior.h"
+
+namespace
+{
+	const Meta::Method* FindMethod(const Meta::Type& type, const std::string& methodName)
+	{
+		for (const auto& method : type.methods)
+		{
+			if (method.name == methodName)
+			{
+				return &method;
+			}
+		}
+		return nullptr;
+	}
+}
+
+void InputBindingTable::Build(const ActionMap& actionMap, const std::vector<ModuleBehavior*>& scripts)
+{
+	Clear();
+
+	for (ModuleBehavior* script : scripts)
+	{
+		const Meta::Type* type = Meta::Find(script->GetHashedName().ToString());
+		if (nullptr == type) continue;
+
+		for (const InputAction* action : actionMap.m_actions)
+		{
+			if (nullptr == action || action->m_scriptName != type->name) continue;
+
+			Binding binding{};
+			binding.instance = static_cast<void*>(script);
+			binding.method = FindMethod(*type, action->funName);
+			if (nullptr == binding.method)
+			{
+				Debug->LogWarning("Input action '" + action->actionName + "' : " + type->name + "::" + action->funName + " not found");
+				continue;
+			}
+
+			size_t paramCount = 0;
+			if (ActionType::Button == action->actionType)
+			{
+				if (action->key.empty()) continue;
+
+				binding.source = Source::Button;
+				binding.keystate = action->keystate;
+				binding.slots[0] = FindOrAddSlot(action->inputType, action->key[0]);
+				if (InvalidSlot == binding.slots[0]) continue;
+			}
+			else if (InputValueType::Vector2 == action->valueType)
+			{
+				paramCount = 1;
+				if (InputType::KeyBoard == action->inputType)
+				{
+					if (action->key.size() < 4) continue;
+
+					binding.source = Source::KeyAxis;
+					for (int axis = 0; axis < 4; ++axis)
+					{
+						binding.slots[axis] = FindOrAddSlot(InputType::KeyBoard, action->key[axis]);
+					}
+				}
+				else if (InputType::GamePad == action->inputType && !action->key.empty())
+				{
+					if (action->key[0] == static_cast<size_t>(ControllerButton::LEFT_THUMB))
+					{
+						binding.source = Source::ThumbL;
+						m_usesThumbL = true;
+					}
+					else if (action->key[0] == static_cast<size_t>(ControllerButton::RIGHT_THUMB))
+					{
+						binding.source = Source::ThumbR;
+						m_usesThumbR = true;
+					}
+					else continue;
+				}
+				else continue;
+			}
+			else continue; // Float 값 액션은 아직 입력 소스가 없다
+
+			// 인자 수가 다르면 호출할 때마다 예외가 나므로 묶지 않는다
+			if (binding.method->parameters.size() != paramCount)
+			{
+				Debug->LogWarning("Input action '" + action->actionName + "' : " + type->name + "::" + action->funName + " parameter count mismatch");
+				continue;
+			}
+
+			m_bindings.push_back(binding);
+		}
+	}
+}
+
+void InputBindingTable::Clear()
+{
+	m_slots.clear();
+	m_bindings.clear();
+	m_events.clear();
+	m_prevButtons = 0;
+	m_usesThumbL = false;
+	m_usesThumbR = false;
+}
+
+InputFrame InputBindingTable::Sample(int playerIndex) const
+{
+	InputFrame frame{};
+	if (playerIndex < 0 || playerIndex >= static_cast<int>(MAX_CONTROLLER)) return frame;
+
+	const DWORD padIndex = static_cast<DWORD>(playerIndex);
+	for (size_t slot = 0; slot < m_slots.size(); ++slot)
+	{
+		const KeySlot& keySlot = m_slots[slot];
+		bool isDown = false;
+		if (InputType::KeyBoard == keySlot.inputType)
+		{
+			isDown = InputManagement->IsKeyDown(keySlot.code) || InputManagement->IsKeyPressed(keySlot.code);
+		}
+		else
+		{
+			const ControllerButton button = static_cast<ControllerButton>(keySlot.code);
+			isDown = InputManagement->IsControllerButtonDown(padIndex, button) || InputManagement->IsControllerButtonPressed(padIndex, button);
+		}
+
+		if (isDown)
+		{
+			frame.buttons |= 1ull << slot;
+		}
+	}
+
+	if (m_usesThumbL) frame.thumbL = InputManagement->GetControllerThumbL(padIndex);
+	if (m_usesThumbR) frame.thumbR = InputManagement->GetControllerThumbR(padIndex);
+
+	return frame;
+}
+
+void InputBindingTable::Diff(const InputFrame& frame)
+{
+	const uint64 current = frame.buttons;
+	const uint64 down = current & ~m_prevButtons;
+	const uint64 held = current & m_prevButtons;
+	const uint64 released = m_prevButtons & ~current;
+
+	for (uint32 index = 0; index < static_cast<uint32>(m_bindings.size()); ++index)
+	{
+		Binding& binding = m_bindings[index];
+
+		Mathf::Vector2 value{};
+		switch (binding.source)
+		{
+		case Source::Button:
+		{
+			uint64 fired = 0;
+			switch (binding.keystate)
+			{
+			case KeyState::Down:		fired = down;		break;
+			case KeyState::Pressed:		fired = held;		break;
+			case KeyState::Released:	fired = released;	break;
+			default:										break;
+			}
+
+			if (IsSlotDown(fired, binding.slots[0]))
+			{
+				m_events.push_back({ index, {} });
+			}
+			continue;
+		}
+		case Source::KeyAxis:
+			// 기존 동작과 같이 음수 키가 양수 키보다 우선한다
+			if (IsSlotDown(current, binding.slots[0]))		value.x = -1.0f;
+			else if (IsSlotDown(current, binding.slots[1]))	value.x = 1.0f;
+			if (IsSlotDown(current, binding.slots[2]))		value.y = -1.0f;
+			else if (IsSlotDown(current, binding.slots[3]))	value.y = 1.0f;
+			break;
+		case Source::ThumbL:
+			value = frame.thumbL;
+			break;
+		case Source::ThumbR:
+			value = frame.thumbR;
+			break;
+		}
+
+		if (value != binding.lastValue || value != Mathf::Vector2::Zero)
+		{
+			m_events.push_back({ index, value });
+		}
+		binding.lastValue = value;
+	}
+
+	m_prevButtons = current;
+}
+
+void InputBindingTable::Dispatch()
+{
+	for (const InputEvent& event : m_events)
+	{
+		const Binding& binding = m_bindings[event.binding];
+		m_args.clear();
+		if (Source::Button != binding.source)
+		{
+			m_args.emplace_back(event.value);
+		}
+		binding.method->invoker(binding.instance, m_args);
+	}
+	m_events.clear();
+}
+
+uint8 InputBindingTable::FindOrAddSlot(InputType inputType, size_t code)
+{
+	if (InputType::KeyBoard == inputType)
+	{
+		if (code >= KEYBOARD_COUNT) return InvalidSlot;
+	}
+	else if (InputType::GamePad == inputType)
+	{
+		if (code >= GAMEPAD_KEY_COUNT) return InvalidSlot;
+	}
+	else
+	{
+		return InvalidSlot; // 마우스 버튼 액션은 기존 CheckAction 에서도 처리하지 않았다
+	}
+
+	for (size_t slot = 0; slot < m_slots.size(); ++slot)
+	{
+		if (m_slots[slot].inputType == inputType && m_slots[slot].code == code)
+		{
+			return static_cast<uint8>(slot);
+		}
+	}
+
+	if (m_slots.size() >= MaxKeySlots)
+	{
+		Debug->LogWarning("Input binding table is full, key " + std::to_string(code) + " ignored");
+		return InvalidSlot;
+	}
+
+	m_slots.push_back({ inputType, static_cast<uint32>(code) });
+	return static_cast<uint8>(m_slots.size() - 1);
+}
+
+bool InputBindingTable::IsSlotDown(uint64 buttons, uint8 slot)
+{
+	return InvalidSlot != slot && 0 != (buttons & (1ull << slot));
+}
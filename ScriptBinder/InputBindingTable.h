@@ -0,0 +1,81 @@
+#pragma once
+#include "Core.Minimal.h"
+#include "KeyState.h"
+
+class ActionMap;
+class ModuleBehavior;
+
+// 한 프레임 입력 스냅샷. 버튼은 바인딩 테이블이 정한 슬롯 순서의 눌림 비트다.
+// (InputManager 없이 직접 채워서 Diff 에 넣으면 헤드리스로 바인딩을 돌려볼 수 있다)
+struct InputFrame
+{
+	uint64			buttons{};
+	Mathf::Vector2	thumbL{};
+	Mathf::Vector2	thumbR{};
+};
+
+struct InputEvent
+{
+	uint32			binding{};	// InputBindingTable 의 바인딩 인덱스
+	Mathf::Vector2	value{};	// 값 액션만 사용
+};
+
+// 액션맵 + 스크립트 목록을 평평한 바인딩 테이블로 컴파일해 두고 프레임마다 상태가 바뀐 것만 호출한다
+// - 스크립트 이름 비교와 메서드 이름 검색은 Build 에서 한 번만 한다
+// - 키/버튼은 슬롯 비트마스크로 샘플링하고 이전 프레임 마스크와 비교한다
+//   Down = 이번에 눌림, Pressed = 이전부터 눌려 있음, Released = 이번에 뗌
+// - Vector2 값 액션은 값이 바뀌었거나 0 이 아닐 때만 호출한다 (입력이 없으면 호출하지 않는다)
+class InputBindingTable
+{
+public:
+	static constexpr uint32 MaxKeySlots = 64;
+
+	void Build(const ActionMap& actionMap, const std::vector<ModuleBehavior*>& scripts);
+	void Clear();
+	bool IsEmpty() const { return m_bindings.empty(); }
+
+	InputFrame Sample(int playerIndex) const;
+	// 이전 프레임과 비교해 호출할 이벤트를 큐에 쌓는다
+	void Diff(const InputFrame& frame);
+	void Dispatch();
+
+	const std::vector<InputEvent>& GetPendingEvents() const { return m_events; }
+
+private:
+	static constexpr uint8 InvalidSlot = 0xFF;
+
+	enum class Source : uint8
+	{
+		Button,
+		KeyAxis,	// 키보드 4키 -> Vector2
+		ThumbL,
+		ThumbR,
+	};
+
+	struct KeySlot
+	{
+		InputType	inputType{ InputType::KeyBoard };
+		uint32		code{};
+	};
+
+	struct Binding
+	{
+		void*				instance{};
+		const Meta::Method*	method{};
+		Source				source{ Source::Button };
+		KeyState			keystate{ KeyState::Idle };
+		uint8				slots[4]{ InvalidSlot, InvalidSlot, InvalidSlot, InvalidSlot };	// Button 은 [0] 만, KeyAxis 는 -x, +x, -y, +y
+		Mathf::Vector2		lastValue{};
+	};
+
+	uint8 FindOrAddSlot(InputType inputType, size_t code);
+	static bool IsSlotDown(uint64 buttons, uint8 slot);
+
+	std::vector<KeySlot>	m_slots;
+	std::vector<Binding>	m_bindings;
+	std::vector<InputEvent>	m_events;
+	std::vector<std::any>	m_args;
+	uint64					m_prevButtons{};
+	bool					m_usesThumbL{ false };
+	bool					m_usesThumbR{ false };
+};
@@ -27,12 +27,8 @@ void MeshRenderer::Awake()
         renderScene->RegisterCommand(this);
     }
 
-    if(!m_isSkinnedMesh)
-    {
-        CullingManagers->Insert(this);
-
-		m_isNeedUpdateCulling = true;
-    }
+    CullingManagers->Insert(this);
+    SetNeedUpdateCulling(true);
 }
 
 void MeshRenderer::OnDestroy()
@@ -62,15 +58,13 @@ BoundingBox MeshRenderer::GetBoundingBox() const
     return BoundingBox();
 }
 
-void MeshRenderer::CullGroupInsert(OctreeNode* node)
+void MeshRenderer::SetNeedUpdateCulling(bool able)
 {
-	if (node)
-	{
-		m_OctreeNodes.insert(node);
-	}
-}
+    if (able && !m_isNeedUpdateCulling)
+    {
+        m_isNeedUpdateCulling = CullingManagers->MarkDirty(this);
+        return;
+    }
 
-void MeshRenderer::CullGroupClear()
-{
-	m_OctreeNodes.clear();
+    m_isNeedUpdateCulling = able;
 }
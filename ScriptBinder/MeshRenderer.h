@@ -10,7 +10,6 @@ class Mesh;
 class Material;
 class Animator;
 class Camera;
-class OctreeNode;
 class MeshRenderer : public Component, public RegistableEvent<MeshRenderer>
 {
 public:
@@ -20,7 +19,7 @@ public:
    virtual ~MeshRenderer() override;
 
    bool IsNeedUpdateCulling() const { return m_isNeedUpdateCulling; }
-   void SetNeedUpdateCulling(bool able) { m_isNeedUpdateCulling = able; }
+   void SetNeedUpdateCulling(bool able);
 
    virtual void Awake() override;
    virtual void OnDestroy() override;
@@ -30,9 +29,8 @@ public:
 
     BoundingBox GetBoundingBox() const;
 
-	void CullGroupInsert(OctreeNode* node);
-    void CullGroupClear();
-	std::unordered_set<OctreeNode*>& GetCullGroup() { return m_OctreeNodes; }
+    int32_t GetCullingProxyID() const { return m_cullingProxyID; }
+    void SetCullingProxyID(int32_t proxyID) { m_cullingProxyID = proxyID; }
 
 public:
     [[Property]]
@@ -45,7 +43,7 @@ public:
     uint32 m_bitflag{ 0 };
 
 private:
-	std::unordered_set<OctreeNode*> m_OctreeNodes;
+	int32_t m_cullingProxyID{ -1 };
 	bool m_isNeedUpdateCulling{ false };
 
 public: 
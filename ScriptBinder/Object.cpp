@@ -81,6 +81,8 @@ void Object::SetDontDestroyOnLoad(Object* objPtr)
     go->m_parentIndex   = GameObject::INVALID_INDEX;
     go->m_rootIndex     = GameObject::INVALID_INDEX;
     go->m_transform.SetParentID(-1);
+    if (originScene)
+        originScene->MarkHierarchyDirty();
 
     // Register to global DDOL bucket
     for (auto& o : collected)
@@ -149,6 +151,8 @@ Object* Object::Instantiate(const Object* original, std::string_view newName)
                     cloneGameObject->m_childrenIndices.push_back(childCloneGameObject->m_index);
 				}
             }
+            if (scene)
+                scene->MarkHierarchyDirty();
         }
 
         if (originalNode["m_components"])
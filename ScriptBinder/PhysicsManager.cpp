@@ -4,6 +4,7 @@
 #include "GameObject.h"
 #include "Transform.h"
 #include "Component.h"
+#include "Core.PakFileSystem.h"
 #include "RigidBodyComponent.h"
 #include "BoxColliderComponent.h"
 #include "SphereColliderComponent.h"
@@ -15,11 +16,38 @@
 #include "TerrainCollider.h"
 #include "CharacterControllerComponent.h"
 
+// PhysicX  ѱ ⺻ CCT 鿣
+class PhysXCharacterControllerBackend final : public ICharacterControllerBackend
+{
+public:
+	void Submit(const ControllerUploadBatch& batch) override
+	{
+		Physics->ApplyControllerBatch(batch);
+	}
+
+	void Read(ControllerReadbackBatch& outBatch) override
+	{
+		Physics->ReadControllers(outBatch);
+	}
+};
+
+// PhysicX  ѱ ⺻   鿣
+class PhysXSceneQueryBackend final : public ISceneQueryBackend
+{
+public:
+	void Execute(SceneQueryBatch& batch) override
+	{
+		Physics->ExecuteSceneQueries(batch);
+	}
+};
+
 class Scene;
 void PhysicsManager::Initialize()
 {
 	// PhysicsManager ʱȭ
 	m_bIsInitialized = Physics->Initialize();
+	m_controllerBackend = std::make_unique<PhysXCharacterControllerBackend>();
+	m_queryBackend = std::make_unique<PhysXSceneQueryBackend>();
 	
 	//  ε, ε,  ̺Ʈ ڵ鷯 
 	m_OnSceneLoadHandle		= sceneLoadedEvent.AddRaw(this, &PhysicsManager::OnLoadScene);
@@ -30,6 +58,7 @@ void PhysicsManager::Initialize()
 	Physics->SetCallBackCollisionFunction([this](const CollisionData& data, ECollisionEventType type) {
 		this->CallbackEvent(data, type);
 	});
+	Physics->SetContactEventBuffer(&m_contactEvents);
 	
 	//⺻ ü 浹 Ʈ 
 	std::vector<std::vector<uint8_t>> collisionGrid;
@@ -44,13 +73,20 @@ void PhysicsManager::Initialize()
 void PhysicsManager::Update(float fixedDeltaTime)
 {
 	if (!m_bIsInitialized) return;
+	FetchSimulation();
 	
 	// ݹ ̺Ʈ ʱȭ
-	m_callbacks.clear();
-	SetPhysicData();
+	m_contactEvents.Clear();
+	SetPhysicData(fixedDeltaTime);
 	//     
 	//Benchmark bm;
 	ApplyPendingChanges();
+	if (m_isAsyncSimulation)
+	{
+		//       FetchSimulation  ݿѴ
+		m_isSimulating = Physics->Simulate(fixedDeltaTime);
+		return;
+	}
 	//   Ʈ
 	Physics->Update(fixedDeltaTime);
 	//std::cout << " Physics->Update" << bm.GetElapsedTime() << std::endl;
@@ -72,13 +108,87 @@ void PhysicsManager::Update(float fixedDeltaTime)
 	//   Ͽ   غŵϴ.
 	ApplyPendingControllerPositionChanges();
 }
+void PhysicsManager::FetchSimulation()
+{
+	if (!m_isSimulating) return;
+
+	m_isSimulating = false;
+	Physics->FetchResults();
+	GetPhysicData();
+	ProcessCallback();
+	ApplyPendingControllerPositionChanges();
+}
+
+void PhysicsManager::DiscardSimulation()
+{
+	if (!m_isSimulating) return;
+
+	//  ϱ    ùķ̼   
+	m_isSimulating = false;
+	Physics->FetchResults();
+	m_contactEvents.Clear();
+}
+
+void PhysicsManager::InterpolatePoses(float alpha)
+{
+	m_renderPoses.clear();
+	if (!m_bIsInitialized || !m_isInterpolation) return;
+
+	ValidateBodySyncTable(SceneManagers->GetActiveScene());
+
+	auto& table = m_bodySync;
+	const uint32_t bodyCount = static_cast<uint32_t>(table.Size());
+	for (uint32_t slot = 0; slot < bodyCount; ++slot)
+	{
+		// ֱ ܿ  ٵ Ѵ ( ٵ ֱ  ״)
+		if (table.poseSteps[slot] != m_poseStep || table.infos[slot]->bIsDestroyed)
+		{
+			continue;
+		}
+
+		// Transform   ʰ  θ ѱ
+		TransformHierarchy::RenderPose pose;
+		pose.index = table.infos[slot]->gameObject->m_index;
+		pose.simulatedPosition = table.currPositions[slot];
+		pose.position = Mathf::Vector3::Lerp(table.prevPositions[slot], table.currPositions[slot], alpha);
+		pose.rotation = Mathf::Quaternion::Slerp(table.prevRotations[slot], table.currRotations[slot], alpha);
+		pose.scale = table.poseScales[slot];
+		// CCT ȸ ũƮ ϹǷ ġ ٷ
+		pose.positionOnly = nullptr != table.controllers[slot];
+		m_renderPoses.push_back(pose);
+	}
+}
+
+void PhysicsManager::RecordSimulatedPose(uint32_t slot, const Mathf::Vector3& position, const Mathf::Quaternion& rotation, const Mathf::Vector3& scale)
+{
+	auto& table = m_bodySync;
+	if (table.poseSteps[slot] + 1 == m_poseStep)
+	{
+		table.prevPositions[slot] = table.currPositions[slot];
+		table.prevRotations[slot] = table.currRotations[slot];
+	}
+	else
+	{
+		//      ʴ´
+		table.prevPositions[slot] = position;
+		table.prevRotations[slot] = rotation;
+	}
+
+	table.currPositions[slot] = position;
+	table.currRotations[slot] = rotation;
+	table.poseScales[slot] = scale;
+	table.poseSteps[slot] = m_poseStep;
+}
+
 void PhysicsManager::Shutdown()
 {
+	DiscardSimulation();
 	//    
 	Physics->ChangeScene();
 	//̳ 
 	auto& Container = SceneManagers->GetActiveScene()->m_colliderContainer;
 	Container.clear();
+	m_bodySync.Clear();
 	//   
 	Physics->UnInitialize();
 
@@ -87,7 +197,12 @@ void PhysicsManager::Shutdown()
 }
 void PhysicsManager::ChangeScene()
 {
+	DiscardSimulation();
 	Physics->ChangeScene();
+	m_bodySync.Clear();
+	m_renderPoses.clear();
+	m_collisionHandlers.clear();
+	m_collisionHandlerScene = nullptr;
 	/*Physics->Initialize();
 	Physics->SetCallBackCollisionFunction([this](CollisionData data, ECollisionEventType type) {
 		this->CallbackEvent(data, type);
@@ -108,62 +223,119 @@ void PhysicsManager::OnUnloadScene()
 	Physics->ChangeScene();
 	Physics->Update(1.0f);
 	Physics->FinalUpdate();
-	m_callbacks.clear();
+	m_contactEvents.Clear();
+	m_bodySync.Clear();
+	m_collisionHandlers.clear();
+	m_collisionHandlerScene = nullptr;
 }
 
 void PhysicsManager::ProcessCallback()
 {
-	auto& Container = SceneManagers->GetActiveScene()->m_colliderContainer;
-	//std::cout << " ProcessCallback size :" << m_callbacks.size() << std::endl;
+	Scene* scene = SceneManagers->GetActiveScene();
+	auto& Container = scene->m_colliderContainer;
+	//std::cout << " ProcessCallback size :" << m_contactEvents.Size() << std::endl;
 	//std::cout << " ColliderContainer size :" << Container.size() << std::endl;
-	for (auto& [data, type] : m_callbacks) {
 
-	
+	// ũƮ ε ٲų  ٲ ڵ ĳø 
+	if (m_collisionHandlerScene != scene || m_collisionHandlerVersion != scene->m_scriptEventVersion)
+	{
+		m_collisionHandlers.clear();
+		m_collisionHandlerScene = scene;
+		m_collisionHandlerVersion = scene->m_scriptEventVersion;
+	}
+
+	++m_callbackStep;
+	CoalesceStayEvents();
+
+	// ݹ ȿ ̺Ʈ  ׿ ̹ ܿ  ͸ óѴ
+	const uint32_t eventCount = static_cast<uint32_t>(m_contactEvents.Size());
+	for (uint32_t i = 0; i < eventCount; ++i)
+	{
+		if (m_skipEvent[i]) continue;
+
+		const unsigned int thisId = m_contactEvents.thisIds[i];
+		const unsigned int otherId = m_contactEvents.otherIds[i];
+		const ECollisionEventType type = m_contactEvents.types[i];
+
+		// Stay  ָ  ܿ  (   )
+		const bool isStay = ECollisionEventType::ON_OVERLAP == type || ECollisionEventType::ON_COLLISION == type;
+		if (isStay && m_stayEventInterval > 1 && 0 != (m_callbackStep + thisId + otherId) % m_stayEventInterval)
+		{
+			continue;
+		}
 
-		auto lhs = Container.find(data.thisId);
-		auto rhs = Container.find(data.otherId);
-		bool isSameID = data.thisId == data.otherId;
+		auto lhs = Container.find(thisId);
+		auto rhs = Container.find(otherId);
+		bool isSameID = thisId == otherId;
 		auto iterEnd = Container.end();
 
 		if (isSameID || lhs == iterEnd || rhs == iterEnd)
 		{
 			//ڽ ݶ̴ 浹 ̰ų 浹ü    -> error
-			Debug->LogError("Collision Callback Error lfs :" + std::to_string(data.thisId) + " ,rhs : " + std::to_string(data.otherId));
+			Debug->LogError("Collision Callback Error lfs :" + std::to_string(thisId) + " ,rhs : " + std::to_string(otherId));
 			continue;
 		}
 
 		auto lhsObj = lhs->second.gameObject;
 		auto rhsObj = rhs->second.gameObject;
 
-		Collision collision{ lhsObj,rhsObj,data.contactPoints };
-		
+		//   ̺Ʈ ޴ ũƮ  Collision   ʴ´
+		auto& handlers = GetCollisionHandlers(scene, lhsObj)[static_cast<uint32_t>(type)];
+		if (handlers.empty()) continue;
+
+		const uint32_t pointOffset = m_contactEvents.pointOffsets[i];
+		const uint32_t pointCount = m_contactEvents.pointCounts[i];
+		m_contactPointScratch.assign(m_contactEvents.points.begin() + pointOffset, m_contactEvents.points.begin() + pointOffset + pointCount);
+
+		Collision collision{ lhsObj,rhsObj,m_contactPointScratch,m_contactEvents.normals[i],m_contactEvents.impulses[i] };
+
 		//std::cout << " ProcessCallback thisId :" << lhsObj->GetHashedName().ToString() << " , otherId : " << rhsObj->GetHashedName().ToString() << " , type : " << static_cast<int>(type) << std::endl;
 
-		switch (type)
+		scene->InvokeCollisionHandlers(type, handlers, collision);
+	}
+}
+
+void PhysicsManager::CoalesceStayEvents()
+{
+	//  ܿ    Stay     ( , CCT Ʈ Ʈ + PhysX persist) ϳ ģ
+	const uint32_t eventCount = static_cast<uint32_t>(m_contactEvents.Size());
+	m_skipEvent.assign(eventCount, 0);
+	for (auto& index : m_stayEventIndex)
+	{
+		index.clear();
+	}
+
+	for (uint32_t i = 0; i < eventCount; ++i)
+	{
+		const ECollisionEventType type = m_contactEvents.types[i];
+		if (ECollisionEventType::ON_OVERLAP != type && ECollisionEventType::ON_COLLISION != type) continue;
+
+		auto& index = m_stayEventIndex[ECollisionEventType::ON_OVERLAP == type ? 0 : 1];
+		const uint64_t key = (static_cast<uint64_t>(m_contactEvents.thisIds[i]) << 32) | m_contactEvents.otherIds[i];
+		auto [iter, inserted] = index.try_emplace(key, i);
+		if (inserted) continue;
+
+		// ݷ ϰ,    ʿ   ´
+		const uint32_t first = iter->second;
+		m_contactEvents.impulses[first] += m_contactEvents.impulses[i];
+		if (0 == m_contactEvents.pointCounts[first] && 0 != m_contactEvents.pointCounts[i])
 		{
-		case ECollisionEventType::ENTER_OVERLAP:
-			SceneManagers->GetActiveScene()->OnTriggerEnter(collision);
-			break;
-		case ECollisionEventType::ON_OVERLAP:
-			SceneManagers->GetActiveScene()->OnTriggerStay(collision);
-			break;
-		case ECollisionEventType::END_OVERLAP:
-			SceneManagers->GetActiveScene()->OnTriggerExit(collision);
-			break;
-		case ECollisionEventType::ENTER_COLLISION:
-			SceneManagers->GetActiveScene()->OnCollisionEnter(collision);
-			break;
-		case ECollisionEventType::ON_COLLISION:
-			SceneManagers->GetActiveScene()->OnCollisionStay(collision);
-			break;
-		case ECollisionEventType::END_COLLISION:
-			SceneManagers->GetActiveScene()->OnCollisionExit(collision);
-			break;
-		default:
-			break;
+			m_contactEvents.pointOffsets[first] = m_contactEvents.pointOffsets[i];
+			m_contactEvents.pointCounts[first] = m_contactEvents.pointCounts[i];
+			m_contactEvents.normals[first] = m_contactEvents.normals[i];
 		}
+		m_skipEvent[i] = 1;
+	}
+}
 
+CollisionHandlerList& PhysicsManager::GetCollisionHandlers(Scene* scene, GameObject* object)
+{
+	auto [iter, inserted] = m_collisionHandlers.try_emplace(object);
+	if (inserted)
+	{
+		scene->CollectCollisionHandlers(object, iter->second);
 	}
+	return iter->second;
 }
 
 void PhysicsManager::RayCast(RayEvent& rayEvent)
@@ -269,6 +441,43 @@ int PhysicsManager::Raycast(RayEvent& rayEvent, std::vector<RaycastHit>& hits)
 	return result.hitSize;
 }
 
+void PhysicsManager::ExecuteQueries(SceneQueryBatch& batch)
+{
+	if (batch.Empty())
+	{
+		return;
+	}
+	m_queryBackend->Execute(batch);
+}
+
+int PhysicsManager::AppendQueryHits(const SceneQueryBatch& batch, uint32_t query, std::vector<HitResult>& out_hits)
+{
+	const uint32_t hitCount = batch.GetHitCount(query);
+	if (0 == hitCount)
+	{
+		return 0;
+	}
+
+	auto& Container = SceneManagers->GetActiveScene()->m_colliderContainer;
+	const SceneQueryHit* hits = batch.GetHits(query);
+	int appended = 0;
+	for (uint32_t i = 0; i < hitCount; ++i)
+	{
+		auto it = Container.find(hits[i].id);
+		if (it == Container.end()) continue;
+
+		HitResult finalHit;
+		finalHit.gameObject = it->second.gameObject;
+		finalHit.layer = hits[i].layer;
+		finalHit.point = hits[i].point;
+		finalHit.normal = hits[i].normal;
+		finalHit.distance = hits[i].distance;
+		out_hits.push_back(finalHit);
+		++appended;
+	}
+	return appended;
+}
+
 int PhysicsManager::BoxSweep(const SweepInput& in, const DirectX::SimpleMath::Vector3& boxExtent, std::vector<HitResult>& out_hits) {
 	SweepOutput pxOut;
 	
@@ -587,9 +796,6 @@ void PhysicsManager::AddCollider(MeshColliderComponent* mesh)
 		convexMeshInfo.colliderInfo.collsionTransform.worldMatrix._42 = convexMeshInfo.colliderInfo.collsionTransform.worldPosition.y;
 		convexMeshInfo.colliderInfo.collsionTransform.worldMatrix._43 = convexMeshInfo.colliderInfo.collsionTransform.worldPosition.z;
 	}
-	auto model = obj->GetComponent<MeshRenderer>();
-	auto modelVertices = model->m_Mesh->GetVertices();
-
 	mesh->SetMeshInfoMation(convexMeshInfo);
 }
 
@@ -717,101 +923,282 @@ void PhysicsManager::RemoveCollider(TerrainColliderComponent* terrain)
 void PhysicsManager::CallbackEvent(CollisionData data, ECollisionEventType type)
 {
 	//std::cout << "PhysicsManager::CallbackEvent - ThisID: " << data.thisId << ", OtherID: " << data.otherId << ", EventType: " << static_cast<int>(type) << std::endl;
-	m_callbacks.push_back({ data,type });
+	//CCT Ʈ Ʈ  : ùķ̼ ̺Ʈ  ۿ ״´
+	const uint32_t pointCount = static_cast<uint32_t>(data.contactPoints.size());
+	const uint32_t pointOffset = m_contactEvents.AppendPoints(data.contactPoints.data(), pointCount);
+	m_contactEvents.Push(data.thisId, data.otherId, data.thisLayerNumber, data.otherLayerNumber, type, pointOffset, pointCount);
 }
 
-void PhysicsManager::SetPhysicData()
+namespace
 {
-	
-	auto& Container = SceneManagers->GetActiveScene()->m_colliderContainer;
-	//std::cout << "Container size" << Container.size()<<std::endl;
-	for (auto& [id, colliderInfo] : Container) 
+	uint8_t PackRigidBodyStateFlags(const RigidBodyComponent* rigidbody)
 	{
-		if (colliderInfo.bIsDestroyed)
+		return static_cast<uint8_t>(
+			(rigidbody->IsKinematic()		? 1u << 0 : 0u) |
+			(rigidbody->IsTrigger()			? 1u << 1 : 0u) |
+			(rigidbody->IsColliderEnabled()	? 1u << 2 : 0u) |
+			(rigidbody->IsUsingGravity()	? 1u << 3 : 0u));
+	}
+
+	// Transform + ݶ̴  ->  ü  Pose
+	void ComputeBodyPose(const Transform& transform, ICollider* collider, Mathf::Vector3& outPosition, Mathf::Quaternion& outRotation)
+	{
+		Mathf::Matrix worldMatrix_NoScale = transform.GetWorldMatrix_NoScale();
+		Mathf::Quaternion pureWorldRot;
+		Mathf::Vector3 pureWorldPos;
+		Mathf::Vector3 scale;
+		worldMatrix_NoScale.Decompose(scale, pureWorldRot, pureWorldPos);
+
+		auto offset = collider->GetPositionOffset();
+		auto rotOffset = collider->GetRotationOffset();
+
+		outRotation = Mathf::Quaternion::Concatenate(rotOffset, pureWorldRot);
+		outPosition = pureWorldPos + DirectX::SimpleMath::Vector3::Transform(offset, pureWorldRot);
+	}
+}
+
+void PhysicsManager::BodySyncTable::Clear()
+{
+	ids.clear();
+	infos.clear();
+	registeredVersions.clear();
+	rigidbodies.clear();
+	controllers.clear();
+	syncedVersions.clear();
+	layers.clear();
+	stateFlags.clear();
+	enabled.clear();
+	dirty.clear();
+	prevPositions.clear();
+	currPositions.clear();
+	prevRotations.clear();
+	currRotations.clear();
+	poseScales.clear();
+	poseSteps.clear();
+	slotById.clear();
+	scene = nullptr;
+	containerVersion = 0;
+}
+
+void PhysicsManager::ValidateBodySyncTable(Scene* scene)
+{
+	if (m_bodySync.scene != scene || m_bodySync.containerVersion != scene->m_colliderContainerVersion)
+	{
+		RebuildBodySyncTable(scene);
+	}
+}
+
+void PhysicsManager::RebuildBodySyncTable(Scene* scene)
+{
+	//  ٵ(id +  ) ȭ ¸ ̾ް,   ٵ ü ȭѴ
+	BodySyncTable prev = std::move(m_bodySync);
+	m_bodySync.Clear();
+
+	auto& table = m_bodySync;
+	auto& Container = scene->m_colliderContainer;
+	const size_t reserveCount = Container.size();
+	table.ids.reserve(reserveCount);
+	table.infos.reserve(reserveCount);
+	table.registeredVersions.reserve(reserveCount);
+	table.rigidbodies.reserve(reserveCount);
+	table.controllers.reserve(reserveCount);
+	table.syncedVersions.reserve(reserveCount);
+	table.layers.reserve(reserveCount);
+	table.stateFlags.reserve(reserveCount);
+	table.enabled.reserve(reserveCount);
+	table.dirty.reserve(reserveCount);
+	table.slotById.reserve(reserveCount);
+
+	for (auto& [id, colliderInfo] : Container)
+	{
+		if (colliderInfo.bIsDestroyed || nullptr == colliderInfo.gameObject || nullptr == colliderInfo.collider)
 		{
 			continue;
 		}
 
-		auto& transform = colliderInfo.gameObject->m_transform;
-		//colliderInfo.collider.
 		auto rigidbody = colliderInfo.gameObject->GetComponent<RigidBodyComponent>();
-		auto offset = colliderInfo.collider->GetPositionOffset();
-		bool _isColliderEnabled = rigidbody->IsColliderEnabled();
-		//todo : CCT,Controller,ragdoll,capsule,?중??deformeSuface
-		//sleeping
-		bool enable = colliderInfo.gameObject->IsEnabled();
-
-		if (!enable) {
-			Physics->PutToSleep(id);
+		if (nullptr == rigidbody)
+		{
 			continue;
 		}
-		else {
-			Physics->WakeUp(id);
-		}
 
+		CharacterControllerComponent* controller = nullptr;
 		if (colliderInfo.id == m_controllerTypeId)
 		{
-			//Benchmark bm;
-			
-			auto controller = colliderInfo.gameObject->GetComponent<CharacterControllerComponent>();
-			CharacterControllerGetSetData data;
-			DirectX::SimpleMath::Vector3 position = transform.GetWorldPosition();
-			data.position = position+controller->GetPositionOffset();
-			data.rotation = transform.GetWorldQuaternion();
-			data.Scale = transform.GetWorldScale();
+			controller = colliderInfo.gameObject->GetComponent<CharacterControllerComponent>();
+		}
+
+		const uint32_t slot = static_cast<uint32_t>(table.ids.size());
+		table.ids.push_back(id);
+		table.infos.push_back(&colliderInfo);
+		table.registeredVersions.push_back(colliderInfo.registeredVersion);
+		table.rigidbodies.push_back(rigidbody);
+		table.controllers.push_back(controller);
+		table.slotById[id] = slot;
+
+		auto prevIt = prev.slotById.find(id);
+		if (prev.scene == scene && prevIt != prev.slotById.end() &&
+			prev.registeredVersions[prevIt->second] == colliderInfo.registeredVersion)
+		{
+			const uint32_t prevSlot = prevIt->second;
+			table.syncedVersions.push_back(prev.syncedVersions[prevSlot]);
+			table.layers.push_back(prev.layers[prevSlot]);
+			table.stateFlags.push_back(prev.stateFlags[prevSlot]);
+			table.enabled.push_back(prev.enabled[prevSlot]);
+			table.dirty.push_back(prev.dirty[prevSlot]);
+		}
+		else
+		{
+			//  PxActor   ִ · ȴ
+			table.syncedVersions.push_back(0);
+			table.layers.push_back(0);
+			table.stateFlags.push_back(0);
+			table.enabled.push_back(1);
+			table.dirty.push_back(BodySync_All);
+		}
+
+		//    ܺ ٽ ״´
+		table.prevPositions.emplace_back();
+		table.currPositions.emplace_back();
+		table.prevRotations.emplace_back();
+		table.currRotations.emplace_back();
+		table.poseScales.emplace_back(1.f, 1.f, 1.f);
+		table.poseSteps.push_back(0);
+	}
+
+	table.scene = scene;
+	table.containerVersion = scene->m_colliderContainerVersion;
+}
+
+void PhysicsManager::SetPhysicData(float fixedDeltaTime)
+{
+	auto scene = SceneManagers->GetActiveScene();
+	ValidateBodySyncTable(scene);
+
+	auto& table = m_bodySync;
+	auto& batch = m_uploadBatch;
+	batch.Clear();
+	auto& controllers = m_controllerBatch;
+	controllers.Clear();
+	controllers.deltaTime = fixedDeltaTime;
+
+	const uint32_t bodyCount = static_cast<uint32_t>(table.Size());
+	for (uint32_t slot = 0; slot < bodyCount; ++slot)
+	{
+		auto& colliderInfo = *table.infos[slot];
+		if (colliderInfo.bIsDestroyed)
+		{
+			continue;
+		}
+
+		const ColliderID id = table.ids[slot];
+		auto rigidbody = table.rigidbodies[slot];
+		auto& transform = colliderInfo.gameObject->m_transform;
+
+		//sleeping : Ȱ ٵ  , Ȱȭ ٲ  
+		// ٵ   Ƿ(PutToSleep/WakeUp  ƹ͵  ʴ´) / Ͽ  ʴ´
+		const bool isStatic = rigidbody->GetBodyType() == EBodyType::STATIC;
+		const uint8_t enable = colliderInfo.gameObject->IsEnabled() ? 1 : 0;
+		if (!enable)
+		{
+			if (auto controller = table.controllers[slot])
+			{
+				controller->ConsumeMoveDirection();
+			}
+			table.enabled[slot] = 0;
+			if (!isStatic)
+			{
+				batch.sleepIds.push_back(id);
+			}
+			continue;
+		}
+		if (!table.enabled[slot])
+		{
+			table.enabled[slot] = 1;
+			table.dirty[slot] |= BodySync_All;
+			if (!isStatic)
+			{
+				batch.wakeIds.push_back(id);
+			}
+		}
 
+		// CCT : Է° ̵ ¸ SoA        ѱ
+		if (auto controller = table.controllers[slot])
+		{
 			auto controllerInfo = controller->GetControllerInfo();
 			auto prevlayer = controllerInfo.layerNumber;
 			auto currentLayer = static_cast<unsigned int>(colliderInfo.gameObject->GetCollisionType());
-			
-			if (prevlayer != currentLayer) 
+
+			unsigned int layer = UINT_MAX;
+			if (prevlayer != currentLayer)
 			{
-				data.LayerNumber = currentLayer;
+				layer = currentLayer;
 				controllerInfo.layerNumber = currentLayer;
 				controller->SetControllerInfo(controllerInfo);
 			}
 
-			Physics->SetCCTData(id, data);
-
-			CharacterMovementGetSetData movementData;
+			uint8_t restrictMask = 0;
+			const auto restrictDirection = controller->GetMoveRestrict();
+			for (size_t i = 0; i < restrictDirection.size(); ++i)
+			{
+				if (restrictDirection[i])
+				{
+					restrictMask |= static_cast<uint8_t>(1u << i);
+				}
+			}
 
-			auto movementInfo = controller->GetMovementInfo();
-			movementData.acceleration = movementInfo.acceleration;
-			movementData.maxSpeed = movementInfo.maxSpeed;
-			movementData.velocity = rigidbody->GetLinearVelocity();
-			movementData.isFall = controller->IsFalling();
-			movementData.restrictDirection = controller->GetMoveRestrict();
+			const auto movementInfo = controller->GetMovementInfo();
+			controllers.ids.push_back(id);
+			controllers.positions.push_back(transform.GetWorldPosition() + controller->GetPositionOffset());
+			controllers.layers.push_back(layer);
+			controllers.inputs.push_back(controller->ConsumeMoveDirection());
+			controllers.isDynamic.push_back(rigidbody->GetBodyType() == EBodyType::DYNAMIC ? 1 : 0);
+			controllers.velocities.push_back(rigidbody->GetLinearVelocity());
+			controllers.maxSpeeds.push_back(movementInfo.maxSpeed);
+			controllers.accelerations.push_back(movementInfo.acceleration);
+			controllers.isFall.push_back(controller->IsFalling() ? 1 : 0);
+			controllers.restricts.push_back(restrictMask);
+			continue;
+		}
 
-			Physics->SetMovementData(id, movementData);
+		//   : Transform  , Ʈ ÷, ̾
+		uint8_t dirty = table.dirty[slot];
+		const uint32_t worldVersion = transform.GetWorldVersion();
+		const uint32_t layer = static_cast<uint32_t>(colliderInfo.gameObject->GetCollisionType());
+		const uint8_t stateFlags = PackRigidBodyStateFlags(rigidbody);
 
-			//std::cout << " PhysicsManager::SetPhysicData CCT : " << bm.GetElapsedTime() << std::endl;
+		if (worldVersion != table.syncedVersions[slot])
+		{
+			dirty |= BodySync_Pose;
 		}
-		else
+		if (rigidbody->IsVelocityDirty())
+		{
+			dirty |= BodySync_Velocity;
+		}
+		if (rigidbody->IsRigidbodyDirty() || layer != table.layers[slot] || stateFlags != table.stateFlags[slot])
 		{
+			dirty |= BodySync_State;
+		}
+		const bool hasForce = rigidbody->GetForceMode() != EForceMode::NONE;
+
+		table.dirty[slot] = 0;
+		if (!dirty && !hasForce)
+		{
+			continue;
+		}
+
+		table.syncedVersions[slot] = worldVersion;
+		table.layers[slot] = layer;
+		table.stateFlags[slot] = stateFlags;
+		rigidbody->ClearVelocityDirty();
 
-			//Benchmark bm1;
+		if (dirty & BodySync_State)
+		{
+			// Ӽ/÷  幰    ü ͸ Ѵ
 			RigidBodyGetSetData data;
-			if (colliderInfo.gameObject->m_tag == "Asis") {
-				int a = 0;
-			}
-			Mathf::Matrix worldMatrix_NoScale = transform.GetWorldMatrix_NoScale();
-			Mathf::Quaternion pureWorldRot;
-			Mathf::Vector3 pureWorldPos;
-			Mathf::Vector3 scale;
-			worldMatrix_NoScale.Decompose(scale, pureWorldRot, pureWorldPos);
-
-			// 2. ݶ̴   ɴϴ.  
-			auto offset = colliderInfo.collider->GetPositionOffset();
-			auto rotOffset = colliderInfo.collider->GetRotationOffset();
-
-			auto type = colliderInfo.collider->GetColliderType();
-
-			// 3.  Ͽ  ü '  Pose' մϴ
-			data.rotation = Mathf::Quaternion::Concatenate(rotOffset, pureWorldRot);
-			data.position = pureWorldPos + DirectX::SimpleMath::Vector3::Transform(offset, pureWorldRot);
-			// 4.     ɴϴ.  
+			ComputeBodyPose(transform, colliderInfo.collider, data.position, data.rotation);
 			data.scale = transform.GetWorldScale();
-			if(data.scale != rigidbody->GetScale())
+			if (data.scale != rigidbody->GetScale())
 			{
 				data.isGeometryDirty = true;
 			}
@@ -831,118 +1218,168 @@ void PhysicsManager::SetPhysicData()
 			data.maxDepenetrationVelocity = rigidbody->GetMaxDepenetrationVelocity();
 
 			data.forceMode = static_cast<int>(rigidbody->GetForceMode());
-			rigidbody->SetForceMode(EForceMode::NONE); 
+			rigidbody->SetForceMode(EForceMode::NONE);
 			data.velocity = rigidbody->GetLinearVelocity();
 			data.AngularDamping = rigidbody->GetAngularDamping();
 			data.LinearDamping = rigidbody->GetLinearDamping();
 			data.mass = rigidbody->GetMass();
 
-			
 			data.m_EColliderType = rigidbody->IsTrigger() ? EColliderType::TRIGGER : EColliderType::COLLISION;
 			data.isColliderEnabled = rigidbody->IsColliderEnabled();
 			data.useGravity = rigidbody->IsUsingGravity();
 			data.isKinematic = rigidbody->IsKinematic();
 			data.isDisabled = !rigidbody->IsColliderEnabled();
 
-			data.LayerNumber = static_cast<unsigned int>(colliderInfo.gameObject->GetCollisionType());
+			data.LayerNumber = layer;
 
 			data.isDirty = rigidbody->IsRigidbodyDirty();
 			rigidbody->DevelopOnlyDirtySet(false);
-			
 
-			//std::cout << " PhysicsManager::SetPhysicData CCT elses RigidBodyGetSetData Set  : " << bm1.GetElapsedTime() << std::endl;
+			batch.stateIds.push_back(id);
+			batch.states.push_back(data);
+			continue;
+		}
+
+		if (dirty & BodySync_Pose)
+		{
+			Mathf::Vector3 position;
+			Mathf::Quaternion rotation;
+			ComputeBodyPose(transform, colliderInfo.collider, position, rotation);
+
+			batch.poseIds.push_back(id);
+			batch.posePositions.push_back(position);
+			batch.poseRotations.push_back(rotation);
+			batch.poseScales.push_back(transform.GetWorldScale());
+		}
 
-			//Benchmark bm2;
-			Physics->SetRigidBodyData(id, data);
-			//std::cout << " PhysicsManager::SetPhysicData CCT elses SetRigidBodyData : " << bm2.GetElapsedTime() << std::endl;
+		if (dirty & BodySync_Velocity)
+		{
+			batch.velocityIds.push_back(id);
+			batch.linearVelocities.push_back(rigidbody->GetLinearVelocity());
+			batch.angularVelocities.push_back(rigidbody->GetAngularVelocity());
+		}
+
+		if (hasForce)
+		{
+			batch.forceIds.push_back(id);
+			batch.forces.push_back(rigidbody->GetLinearVelocity());
+			batch.forceModes.push_back(static_cast<int>(rigidbody->GetForceMode()));
+			rigidbody->SetForceMode(EForceMode::NONE);
 		}
 	}
-	
+
+	if (!batch.Empty())
+	{
+		Physics->ApplyRigidBodyBatch(batch);
+	}
+	if (!controllers.Empty())
+	{
+		m_controllerBackend->Submit(controllers);
+	}
 }
 
 //PxScene --> GameScene
 void PhysicsManager::GetPhysicData()
 {
-	//Benchmark bm;
-	auto& Container = SceneManagers->GetActiveScene()->m_colliderContainer;
-	for (auto& [id, ColliderInfo] : Container) {
+	auto scene = SceneManagers->GetActiveScene();
+	ValidateBodySyncTable(scene);
+	++m_poseStep;
 
-		if (nullptr == ColliderInfo.gameObject)
+	auto& table = m_bodySync;
+	const uint32_t bodyCount = static_cast<uint32_t>(table.Size());
+
+	// ı  Ʈ ǥ
+	for (uint32_t slot = 0; slot < bodyCount; ++slot)
+	{
+		auto& ColliderInfo = *table.infos[slot];
+		if (ColliderInfo.bIsDestroyed)
+		{
 			continue;
+		}
 
 		if (ColliderInfo.gameObject->IsDestroyMark())
 		{
 			ColliderInfo.bIsDestroyed = true;
+		}
+	}
+
+	// CCT :   Ʈѷ    д´
+	auto& controllers = m_controllerReadback;
+	m_controllerBackend->Read(controllers);
+	for (size_t i = 0; i < controllers.Size(); ++i)
+	{
+		auto slotIt = table.slotById.find(controllers.ids[i]);
+		if (slotIt == table.slotById.end())
+		{
 			continue;
 		}
 
-		
-		if (ColliderInfo.bIsDestroyed)
+		const uint32_t slot = slotIt->second;
+		auto& ColliderInfo = *table.infos[slot];
+		auto controller = table.controllers[slot];
+		auto rigidbody = table.rigidbodies[slot];
+		if (ColliderInfo.bIsDestroyed || nullptr == controller || rigidbody->GetBodyType() != EBodyType::DYNAMIC)
 		{
 			continue;
 		}
 
-		auto rigidbody = ColliderInfo.gameObject->GetComponent<RigidBodyComponent>();
 		auto& transform = ColliderInfo.gameObject->m_transform;
-		auto offset = ColliderInfo.collider->GetPositionOffset();
+		auto position = controllers.positions[i] - controller->GetPositionOffset();
 
+		controller->SetFalling(0 != controllers.isFall[i]);
+		rigidbody->SyncVelocityFromPhysics(controllers.velocities[i], rigidbody->GetAngularVelocity());
+		transform.SetPosition(position);
+		RecordSimulatedPose(slot, position, transform.GetWorldQuaternion(), transform.GetWorldScale());
+	}
 
-		if (rigidbody->GetBodyType() != EBodyType::DYNAMIC)
+	// ̳ ٵ : ̹ ܿ ùķ̼ǵ ͸ д´ ( ٵ ȭ )
+	auto& readback = m_readbackBatch;
+	Physics->ReadActiveRigidBodies(readback);
+	for (size_t i = 0; i < readback.Size(); ++i)
+	{
+		auto slotIt = table.slotById.find(readback.ids[i]);
+		if (slotIt == table.slotById.end())
 		{
-			
 			continue;
 		}
 
-		
-		if (ColliderInfo.id == m_controllerTypeId) {
-			
-			auto controller = ColliderInfo.gameObject->GetComponent<CharacterControllerComponent>();
-			auto controll = Physics->GetCCTData(id);
-			auto movement = Physics->GetMovementData(id);
-			auto position = controll.position - controller->GetPositionOffset();
-
-			controller->SetFalling(movement.isFall);
-			rigidbody->SetLinearVelocity(movement.velocity);
-			transform.SetPosition(position);
+		const uint32_t slot = slotIt->second;
+		auto& ColliderInfo = *table.infos[slot];
+		auto rigidbody = table.rigidbodies[slot];
+		if (ColliderInfo.bIsDestroyed || table.controllers[slot] || rigidbody->GetBodyType() != EBodyType::DYNAMIC)
+		{
+			continue;
 		}
-		else
+
+		auto& transform = ColliderInfo.gameObject->m_transform;
+		rigidbody->SyncVelocityFromPhysics(readback.linearVelocities[i], readback.angularVelocities[i]);
+		if (readback.velocityClamped[i])
 		{
-			
-			auto data = Physics->GetRigidBodyData(id);
-			rigidbody->SetLinearVelocity(data.linearVelocity);
-			rigidbody->SetAngularVelocity(data.angularVelocity);
-
-			rigidbody->SetLockLinearX(data.isLockLinearX);
-			rigidbody->SetLockLinearY(data.isLockLinearY);
-			rigidbody->SetLockLinearZ(data.isLockLinearZ);
-			rigidbody->SetLockAngularX(data.isLockAngularX);
-			rigidbody->SetLockAngularY(data.isLockAngularY);
-			rigidbody->SetLockAngularZ(data.isLockAngularZ);
-
-			DirectX::SimpleMath::Vector3 pos = data.position;
-			DirectX::SimpleMath::Quaternion rotation = data.rotation;
-			DirectX::SimpleMath::Vector3 scale = data.scale;
-
-			auto posOffset = ColliderInfo.collider->GetPositionOffset();
-			auto rotOffset = ColliderInfo.collider->GetRotationOffset();
-
-			// 2. ȸ :  忡  ȸ(data.rotation) ݶ̴ ȸ  մϴ.
-			Mathf::Quaternion pureWorldRot;
-			rotOffset.Inverse(pureWorldRot);
-			pureWorldRot = Mathf::Quaternion::Concatenate(pureWorldRot, data.rotation);
-
-			// 3. ġ :   '  ȸ' Ͽ ġ   մϴ.
-			Mathf::Vector3 pureWorldPos = data.position - DirectX::SimpleMath::Vector3::Transform(posOffset,
-				pureWorldRot);
-
-			DirectX::SimpleMath::Matrix matrix = DirectX::SimpleMath::Matrix::CreateScale(scale)
-				* DirectX::SimpleMath::Matrix::CreateFromQuaternion(pureWorldRot)
-				* DirectX::SimpleMath::Matrix::CreateTranslation(pureWorldPos);
-
-			transform.SetAndDecomposeMatrix(matrix, true);
+			// ߶ ӵ  ܿ PxScene  ǵ ش
+			table.dirty[slot] |= BodySync_Velocity;
 		}
+
+		auto posOffset = ColliderInfo.collider->GetPositionOffset();
+		auto rotOffset = ColliderInfo.collider->GetRotationOffset();
+
+		// ȸ :  忡  ȸ ݶ̴ ȸ  մϴ.
+		Mathf::Quaternion pureWorldRot;
+		rotOffset.Inverse(pureWorldRot);
+		pureWorldRot = Mathf::Quaternion::Concatenate(pureWorldRot, readback.rotations[i]);
+
+		// ġ : '  ȸ' Ͽ ġ   մϴ.
+		Mathf::Vector3 pureWorldPos = readback.positions[i] - DirectX::SimpleMath::Vector3::Transform(posOffset,
+			pureWorldRot);
+
+		DirectX::SimpleMath::Matrix matrix = DirectX::SimpleMath::Matrix::CreateScale(readback.scales[i])
+			* DirectX::SimpleMath::Matrix::CreateFromQuaternion(pureWorldRot)
+			* DirectX::SimpleMath::Matrix::CreateTranslation(pureWorldPos);
+
+		transform.SetAndDecomposeMatrix(matrix, true);
+		//   ٲ  ٽ ε ʴ´
+		table.syncedVersions[slot] = transform.GetWorldVersion();
+		RecordSimulatedPose(slot, pureWorldPos, pureWorldRot, readback.scales[i]);
 	}
-	//std::cout <<" PhysicsManager::GetPhysicData" << bm.GetElapsedTime() << std::endl;
 }
 
 //  CCT ġ  û ϰ óϴ Լ
@@ -1003,13 +1440,13 @@ void PhysicsManager::SaveCollisionMatrix()
 void PhysicsManager::LoadCollisionMatrix()
 {
 	file::path matrixSettingsPath = PathFinder::ProjectSettingPath("CollisionMatrix.asset");
-	std::ifstream settingsFile(matrixSettingsPath);
+	AssetStream settingsFile(matrixSettingsPath);
 	if (!settingsFile.is_open())
 	{
 		Debug->LogWarning("No CollisionMatrix.asset file found. Using default collision matrix.");
 		return;
 	}
-	MetaYml::Node matrixNode = MetaYml::LoadFile(matrixSettingsPath.string());
+	MetaYml::Node matrixNode = MetaYml::Load(settingsFile);
 	constexpr int MAX_LAYER_SIZE = 32;
 	for (int i = 0; i < MAX_LAYER_SIZE; ++i)
 	{
@@ -1026,7 +1463,6 @@ void PhysicsManager::LoadCollisionMatrix()
 		}
 	}
 	SetCollisionMatrix(m_collisionMatrix);
-	settingsFile.close();
 }
 
 void PhysicsManager::SetRigidBodyState(const RigidBodyState& state)
@@ -1059,6 +1495,18 @@ void PhysicsManager::SetControllerPosition(UINT id, const DirectX::SimpleMath::V
 	m_pendingControllerPositions.push_back({ id, pos });
 }
 
+void PhysicsManager::SetCharacterControllerBackend(std::unique_ptr<ICharacterControllerBackend> backend)
+{
+	// nullptr ̸ ⺻ PhysicX 鿣 ǵ
+	m_controllerBackend = backend ? std::move(backend) : std::make_unique<PhysXCharacterControllerBackend>();
+}
+
+void PhysicsManager::SetSceneQueryBackend(std::unique_ptr<ISceneQueryBackend> backend)
+{
+	// nullptr ̸ ⺻ PhysicX 鿣 ǵ
+	m_queryBackend = backend ? std::move(backend) : std::make_unique<PhysXSceneQueryBackend>();
+}
+
 void PhysicsManager::ApplyPendingChanges()
 {
 	for (const auto& change : m_pendingChanges)
@@ -2,6 +2,11 @@
 #include "Core.Minimal.h"
 #include "../Physics/Physx.h"
 #include "../Physics/ICollider.h"
+#include "CharacterControllerBackend.h"
+#include "TransformHierarchy.h"
+#include <memory>
+#include <array>
+#include <unordered_map>
 
 class Component;
 class GameObject;
@@ -11,8 +16,13 @@ struct Collision
 	GameObject* otherObj;
 
 	const std::vector<Mathf::Vector3>& contactPoints;
+	Mathf::Vector3 normal{};	// this ʿ     (ƮŴ 0)
+	float impulse{};			//  ݷ ũ  (ƮŴ 0)
 };
 
+// Ʈ ũƮ  浹 ̺Ʈ (ECollisionEventType) ε ڵ 
+using CollisionHandlerList = std::array<std::vector<Core::DelegateHandle>, CollisionEventTypeCount>;
+
 //raycast event  Լ  κο  Ұ
 struct RayEvent {
 	struct ResultData {
@@ -63,6 +73,7 @@ class CapsuleColliderComponent;
 class MeshColliderComponent;
 class CharacterControllerComponent;
 class TerrainColliderComponent;
+class RigidBodyComponent;
 class Scene;
 class PhysicsManager : public DLLCore::Singleton<PhysicsManager>
 {
@@ -89,12 +100,9 @@ public:
 		ICollider* collider;
 		bool bIsDestroyed = false;
 		bool bIsRemoveBody = false;
+		uint32_t registeredVersion = 0; //   Scene::m_colliderContainerVersion (ٵ  )
 	};
 
-	struct CollisionCallbackInfo {
-		CollisionData data;
-		ECollisionEventType Type;
-	};
 	// RigidBodyComponent PhysicsManager   û  ϴ ü
 	struct RigidBodyState
 	{
@@ -111,6 +119,21 @@ public:
 	void Initialize();
 	void Update(float fixedDeltaTime);
 
+	// true  Update  simulate  ϰ,       FetchSimulation  ´.
+	//  (Update/LateUpdate) ٵ ġ/ӵ ٲٴ  API  ȣϸ  ȴ.
+	void SetAsyncSimulation(bool isAsync) { m_isAsyncSimulation = isAsync; }
+	bool IsAsyncSimulation() const { return m_isAsyncSimulation; }
+	void FetchSimulation();
+	void DiscardSimulation();
+
+	//    ӿ ̳ ٵ CCT      ̷  ׸
+	//    ̴. Transform  CCT ġ ׻  ùķ̼  ´
+	void SetInterpolation(bool isInterpolation) { m_isInterpolation = isInterpolation; }
+	bool IsInterpolation() const { return m_isInterpolation; }
+	void InterpolatePoses(float alpha);
+	// ̹    (TransformHierarchy::ApplyRenderPoses Է)
+	const std::vector<TransformHierarchy::RenderPose>& GetRenderPoses() const { return m_renderPoses; }
+
 	//  
 	void Shutdown();
 
@@ -142,6 +165,18 @@ public:
 	int SphereOverlap(const OverlapInput& in, float radius, std::vector<HitResult>& out_hits);
 	int CapsuleOverlap(const OverlapInput& in, float radius, float halfHeight, std::vector<HitResult>& out_hits);
 	//============================
+	//  ġ :       Ѵ
+	void ExecuteQueries(SceneQueryBatch& batch);
+	//query °   out_hits ڿ δ ( ʴ´),   ȯ
+	int AppendQueryHits(const SceneQueryBatch& batch, uint32_t query, std::vector<HitResult>& out_hits);
+	//     (⺻ PhysicX, 帮  ReferenceSceneQueryBackend)
+	void SetSceneQueryBackend(std::unique_ptr<ISceneQueryBackend> backend);
+	//============================
+	//Stay ̺Ʈ(OnTriggerStay, OnCollisionStay)  ܸ  (⺻ 1 =  )
+	//ָ     ܿ  ʰ Ѵ
+	void SetStayEventInterval(uint32_t steps) { m_stayEventInterval = steps > 0 ? steps : 1; }
+	uint32_t GetStayEventInterval() const { return m_stayEventInterval; }
+	//============================
 	
 	//浹 Ʈ 
 	void SetCollisionMatrix(std::vector<std::vector<uint8_t>> collisionGrid) {
@@ -183,6 +218,9 @@ public:
 	// CharacterController ġ  ϴ ̽ ( ť ۾ ߰մϴ)
 	void SetControllerPosition(UINT id, const DirectX::SimpleMath::Vector3& pos);
 
+	// CCT Է ϰ / б  (⺻ PhysicX, 帮  NullCharacterControllerBackend)
+	void SetCharacterControllerBackend(std::unique_ptr<ICharacterControllerBackend> backend);
+
 	//geometry ˻
 	//bool IsPenetrating();
 
@@ -199,6 +237,11 @@ private:
 	//  ùķƮ 
 	bool m_bPlay{ false };
 
+	bool m_isAsyncSimulation{ false };
+	bool m_isSimulating{ false };	// simulate      
+	bool m_isInterpolation{ true };
+	uint32_t m_poseStep{ 1 };		// GetPhysicData ȣ Ƚ (  ȿ Ȯο, 0   )
+
 	// ο 
 	bool m_bDebugDraw{ false };
 
@@ -237,11 +280,60 @@ private:
 	Core::DelegateHandle m_OnChangeSceneHandle;
 
 	//pre update  GameObject data -> pxScene data
-	void SetPhysicData();
+	void SetPhysicData(float fixedDeltaTime);
 
 	//post update pxScene data -> GameObject data
 	void GetPhysicData();
 
+	// ٵ ȭ ̺ (slot  SoA, ݶ̴ ̳  ٲ  籸)
+	enum BodySyncBits : uint8_t
+	{
+		BodySync_Pose		= 1u << 0,
+		BodySync_Velocity	= 1u << 1,
+		BodySync_State		= 1u << 2,
+		BodySync_All		= BodySync_Pose | BodySync_Velocity | BodySync_State,
+	};
+
+	struct BodySyncTable
+	{
+		std::vector<ColliderID>						ids;
+		std::vector<ColliderInfo*>					infos;
+		std::vector<uint32_t>						registeredVersions;
+		std::vector<RigidBodyComponent*>			rigidbodies;
+		std::vector<CharacterControllerComponent*>	controllers;	// CCT  ƴϸ nullptr
+		std::vector<uint32_t>						syncedVersions;	//  PxScene   Transform  
+		std::vector<uint32_t>						layers;
+		std::vector<uint8_t>						stateFlags;		// kinematic/trigger/collider/gravity
+		std::vector<uint8_t>						enabled;
+		std::vector<uint8_t>						dirty;			// BodySyncBits
+		//    (/ֱ   )
+		std::vector<Mathf::Vector3>					prevPositions;
+		std::vector<Mathf::Vector3>					currPositions;
+		std::vector<Mathf::Quaternion>				prevRotations;
+		std::vector<Mathf::Quaternion>				currRotations;
+		std::vector<Mathf::Vector3>					poseScales;
+		std::vector<uint32_t>						poseSteps;		// ֱ   m_poseStep
+		std::unordered_map<ColliderID, uint32_t>	slotById;
+		Scene*										scene{ nullptr };
+		uint32_t									containerVersion{ 0 };
+
+		size_t Size() const { return ids.size(); }
+		void Clear();
+	};
+
+	void RebuildBodySyncTable(Scene* scene);
+	void ValidateBodySyncTable(Scene* scene);
+	void RecordSimulatedPose(uint32_t slot, const Mathf::Vector3& position, const Mathf::Quaternion& rotation, const Mathf::Vector3& scale);
+
+	BodySyncTable			m_bodySync;
+	RigidBodyUploadBatch	m_uploadBatch;
+	RigidBodyReadbackBatch	m_readbackBatch;
+	ControllerUploadBatch	m_controllerBatch;
+	ControllerReadbackBatch	m_controllerReadback;
+	std::unique_ptr<ICharacterControllerBackend> m_controllerBackend;
+	std::unique_ptr<ISceneQueryBackend> m_queryBackend;
+	std::vector<TransformHierarchy::RenderPose> m_renderPoses;
+
 	unsigned int m_lastColliderID{ 0 };
 
 
@@ -261,7 +353,20 @@ private:
 	//std::unordered_map<ColliderID, ColliderInfo> m_colliderContainer;
 
 	//ݸ ݹ 
-	std::vector<CollisionCallbackInfo> m_callbacks;
+	ContactEventBuffer m_contactEvents;
+	//  ߺ Stay ̺Ʈ տ (key = thisId << 32 | otherId)
+	std::array<std::unordered_map<uint64_t, uint32_t>, 2> m_stayEventIndex;
+	std::vector<uint8_t> m_skipEvent;
+	std::vector<Mathf::Vector3> m_contactPointScratch;
+	uint32_t m_stayEventInterval{ 1 };
+	uint32_t m_callbackStep{ 0 };
+
+	//Ʈ 浹 ̺Ʈ ڵ ĳ (Scene::m_scriptEventVersion  ٲ ٽ )
+	CollisionHandlerList& GetCollisionHandlers(Scene* scene, GameObject* object);
+	void CoalesceStayEvents();
+	std::unordered_map<GameObject*, CollisionHandlerList> m_collisionHandlers;
+	Scene* m_collisionHandlerScene{ nullptr };
+	uint32_t m_collisionHandlerVersion{ 0 };
 };
 
 static auto PhysicsManagers = PhysicsManager::GetInstance();
@@ -6,7 +6,12 @@
 #include "InputManager.h"
 void PlayerInputComponent::Update(float tick)
 {
-	if (SceneManagers->m_isGameStart == false) return;
+	if (SceneManagers->m_isGameStart == false)
+	{
+		// edits made while stopped are picked up on the next play
+		m_boundActionMap = nullptr;
+		return;
+	}
 	if (m_actionMap == nullptr)
 	{
 		SetActionMap(m_actionMapName);
@@ -15,27 +20,53 @@ void PlayerInputComponent::Update(float tick)
 	if (m_actionMap == nullptr) return;
 	GameObject* owner = GetOwner();
 
+	if (IsBindingStale(owner))
+	{
+		RebuildBindings(owner);
+	}
+
+	if (m_bindings.IsEmpty()) return;
+
+	m_bindings.Diff(m_bindings.Sample(controllerIndex));
+	m_bindings.Dispatch();
+}
+
+bool PlayerInputComponent::IsBindingStale(GameObject* owner) const
+{
+	if (m_boundActionMap != m_actionMap || m_boundRevision != m_actionMap->GetRevision())
+		return true;
+
+	// scripts are swapped on hot reload, so comparing pointers is enough
+	if (m_boundComponents.size() != owner->m_components.size())
+		return true;
+
+	for (size_t i = 0; i < m_boundComponents.size(); ++i)
+	{
+		if (m_boundComponents[i] != owner->m_components[i].get())
+			return true;
+	}
+	return false;
+}
+
+void PlayerInputComponent::RebuildBindings(GameObject* owner)
+{
 	std::vector<ModuleBehavior*> scripts{};
-	ModuleBehavior* script = nullptr;
+	m_boundComponents.clear();
 	for (auto& component : owner->m_components)
 	{
+		m_boundComponents.push_back(component.get());
 		if (nullptr == component)
 			continue;
-		script = dynamic_cast<ModuleBehavior*>(component.get());
+		ModuleBehavior* script = dynamic_cast<ModuleBehavior*>(component.get());
 		if (script != nullptr)
 		{
 			scripts.push_back(script);
-		};
+		}
 	}
 
-	if (scripts.size() == 0) return;
-
-	for (auto& _script : scripts)
-	{
-		auto typeName = Meta::Find(_script->GetHashedName().ToString());
-		void* voidPtr = static_cast<void*>(_script);
-		m_actionMap->CheckAction(controllerIndex, voidPtr, typeName);
-	}
+	m_bindings.Build(*m_actionMap, scripts);
+	m_boundActionMap = m_actionMap;
+	m_boundRevision = m_actionMap->GetRevision();
 }
 
 void PlayerInputComponent::SetActionMap(std::string mapName)
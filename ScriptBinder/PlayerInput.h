@@ -3,6 +3,7 @@
 #include "Component.h"
 #include "IRegistableEvent.h"
 #include "KeyState.h"
+#include "InputBindingTable.h"
 #include "PlayerInputComponent.generated.h"
 class ActionMap;
 class PlayerInputComponent : public Component, public RegistableEvent<PlayerInputComponent>
@@ -31,5 +32,15 @@ public:
 	int controllerIndex = 0;
 	//Ʈ  ڵ ǲ׼ǸŴ  ->  Ʈ ȸϸ鼭 ϵȸ Űε Ű üũɽ 
 	//Ʈ  ũƮ ȸϸ鼭 ִ Լ 
+
+private:
+	// ׼Ǹ/ũƮ  ٲ  ε ٽ Ѵ
+	bool IsBindingStale(GameObject* owner) const;
+	void RebuildBindings(GameObject* owner);
+
+	InputBindingTable		m_bindings;
+	std::vector<Component*>	m_boundComponents;
+	ActionMap*				m_boundActionMap{ nullptr };
+	uint32					m_boundRevision{};
 };
 
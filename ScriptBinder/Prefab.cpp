@@ -25,69 +25,77 @@ Prefab* Prefab::CreateFromGameObject(const GameObject* source, std::string_view
 
 GameObject* Prefab::Instantiate(std::string_view newName) const
 {
-    if (!m_prefabData)
-        return nullptr;
-
-    Scene* scene = SceneManagers->GetActiveScene();
-    if (!scene)
-        return nullptr;
-
-    if (!m_prefabData || !m_prefabData.IsSequence() || m_prefabData.size() == 0)
-        return nullptr;
-	Benchmark bm;
-    auto gameObjNode = m_prefabData["GameObject"];
+    return InstantiateTemplate(SceneManagers->GetActiveScene(), newName);
+}
 
-    GameObject* rootObject = nullptr;
+GameObject* Prefab::Instantiate(Scene* targetScene, std::string_view newName) const
+{
+    return InstantiateTemplate(targetScene, newName);
+}
 
-    for (std::size_t i = 0; i < m_prefabData.size(); ++i)
+const PrefabTemplate& Prefab::GetTemplate() const
+{
+    if (!m_template)
     {
-        const MetaYml::Node& gameObjNode = m_prefabData[i];
-
-        // ù ° GameObject overrideName 
-        std::string_view nameOverride = (i == 0) ? newName : "";
-
-        GameObject* instantiated = InstantiateRecursive(gameObjNode, scene, 0, nameOverride);
-
-        if (i == 0)
-            rootObject = instantiated;
+        m_template = std::make_shared<PrefabTemplate>();
+        try
+        {
+            m_template->Compile(m_prefabData);
+        }
+        catch (const std::exception& e)
+        {
+            Debug->LogError("Prefab compile failed: " + std::string(e.what()));
+            m_template->Clear();
+        }
     }
-
-	std::cout << "Prefab instantiated in " << bm.GetElapsedTime() << " ms\n";
-
-    return rootObject;
+    return *m_template;
 }
 
-GameObject* Prefab::Instantiate(Scene* targetScene, std::string_view newName) const
+GameObject* Prefab::InstantiateTemplate(Scene* scene, std::string_view newName) const
 {
-    if (!m_prefabData)
-        return nullptr;
-
-    Scene* scene = targetScene;
     if (!scene)
         return nullptr;
 
     if (!m_prefabData || !m_prefabData.IsSequence() || m_prefabData.size() == 0)
         return nullptr;
-    Benchmark bm;
-    auto gameObjNode = m_prefabData["GameObject"];
 
-    GameObject* rootObject = nullptr;
+    // ø  д (νϽȭ   ŵǾ ϵ)
+    GetTemplate();
+    std::shared_ptr<PrefabTemplate> prefabTemplate = m_template;
+    const auto& objects = prefabTemplate->GetObjects();
+    if (objects.empty())
+        return nullptr;
+
+    // slot ->  Ʈ ε (θ   slot   Ʈ ǳʶڴ)
+    // Ʈ ε  ٸ    Ƿ  ۸ 
+    std::vector<GameObject::Index> createdIndices(objects.size(), GameObject::INVALID_INDEX);
 
-    for (std::size_t i = 0; i < m_prefabData.size(); ++i)
+    GameObject* rootObject = nullptr;
+    for (std::size_t slot = 0; slot < objects.size(); ++slot)
     {
-        const MetaYml::Node& gameObjNode = m_prefabData[i];
+        const auto& entry = objects[slot];
+
+        GameObject::Index parent = 0;
+        if (entry.parentSlot != PrefabTemplate::NullSlot)
+        {
+            parent = createdIndices[entry.parentSlot];
+            if (GameObject::IsInvalidIndex(parent))
+                continue;
+        }
 
         // ù ° GameObject overrideName 
-        std::string_view nameOverride = (i == 0) ? newName : "";
+        std::string_view nameOverride = (slot == 0) ? newName : "";
 
-        GameObject* instantiated = InstantiateRecursive(gameObjNode, scene, 0, nameOverride);
+        GameObject* instantiated = InstantiateEntry(*prefabTemplate, entry, scene, parent, nameOverride);
+        if (instantiated)
+        {
+            createdIndices[slot] = instantiated->m_index;
+        }
 
-        if (i == 0)
+        if (slot == 0)
             rootObject = instantiated;
     }
 
-    std::cout << "Prefab instantiated in " << bm.GetElapsedTime() << " ms\n";
-
     return rootObject;
 }
 
@@ -124,42 +132,36 @@ MetaYml::Node Prefab::SerializeRecursive(const GameObject* obj)
     return node;
 }
 
-GameObject* Prefab::InstantiateRecursive(const MetaYml::Node& node,
+GameObject* Prefab::InstantiateEntry(const PrefabTemplate& prefabTemplate,
+    const PrefabTemplate::ObjectEntry& entry,
     Scene* scene,
     GameObject::Index parent,
     std::string_view overrideName) const
 {
-    if (!scene || !node)
-        return nullptr;
-
-    GameObjectType type = static_cast<GameObjectType>(node["m_gameObjectType"].as<int>());
-    std::string objName = overrideName.empty() ? node["m_name"].as<std::string>() : std::string(overrideName);
-    Benchmark bm;
+    GameObjectType type = entry.type;
+    std::string_view objName = overrideName.empty() ? std::string_view(entry.name) : overrideName;
     auto objPtr = scene->LoadGameObject(make_guid(), objName, type, parent);
     GameObject* obj = objPtr.get();
     if (!obj)
         return nullptr;
 
-	std::cout << "GameObject Create Time: " << bm.GetElapsedTime() << " ms\n";
-
-    Benchmark bm3;
-    const Meta::Type* meta = Meta::MetaDataRegistry->Find(TypeTrait::GUIDCreator::GetTypeID<GameObject>());
     HashedGuid newInstanceID = obj->GetInstanceID();
 	HashingString newHashedName = obj->GetHashedName();
     GameObject::Index newIndex = obj->m_index;
-    if (meta)
+    try
     {
-        try
+        // ̸ ȯ   Ƽ ä, ġ    ͸  η ȭ
+        prefabTemplate.ApplyPatches(entry, obj);
+        if (entry.residual)
         {
-            Meta::Deserialize(obj, node);
+            Meta::Deserialize(obj, entry.residual);
         }
-        catch (const std::exception& e)
-        {
-            Debug->LogError("Prefab instantiation failed: " + std::string(e.what()));
-            return nullptr;
-		}
     }
-    std::cout << "Deserialize Time: " << bm3.GetElapsedTime() << " ms\n";
+    catch (const std::exception& e)
+    {
+        Debug->LogError("Prefab instantiation failed: " + std::string(e.what()));
+        return nullptr;
+    }
 
     if (type != GameObjectType::UI)
     {
@@ -195,53 +197,26 @@ GameObject* Prefab::InstantiateRecursive(const MetaYml::Node& node,
 		}
 
     }
+    scene->MarkHierarchyDirty();
 
-    Benchmark bm2;
-    if (node["m_components"])
+    for (uint32 i = 0; i < entry.componentCount; ++i)
     {
-        for (const auto& componentNode : node["m_components"])
+        try
         {
-            try
-            {
-                ComponentFactorys->LoadComponent(obj, componentNode ,true);
-            }
-            catch (const std::exception& e)
-            {
-                Debug->LogError(e.what());
-                continue;
-            }
+            ComponentFactorys->LoadComponent(obj, prefabTemplate.GetComponentNode(entry.componentOffset + i), true);
         }
-    }
-	std::cout << "Component Load Time: " << bm2.GetElapsedTime() << " ms\n";
-
-    //if(SceneManagers->m_isGameStart)
-    //{
-    //    for (auto& comp : obj->m_components)
-    //    {
-    //        if (!comp) continue;
-
-    //        auto script = std::dynamic_pointer_cast<ModuleBehavior>(comp);
-    //        if (script)
-    //        {
-    //            ScriptManager->BindScriptEvents(script.get(), script->m_name.ToString());
-    //        }
-    //    }
-    //}
-
-    if (node["children"])
-    {
-        for (const auto& childNode : node["children"])
+        catch (const std::exception& e)
         {
-            auto childObj = InstantiateRecursive(childNode, scene, obj->m_index);
+            Debug->LogError(e.what());
+            continue;
         }
     }
 
-    obj->m_prefabFileGuid = m_fileGuid;
     obj->m_prefab = const_cast<Prefab*>(this);
     obj->m_prefabFileGuid = GetFileGuid();
-    obj->m_prefabOriginal = node;
+    obj->m_prefabOriginal = entry.source;
     if (parent == 0)
         PrefabUtilitys->RegisterInstance(obj, this);
 
     return obj;
-}
\ No newline at end of file
+}
@@ -4,6 +4,7 @@
 #include "ReflectionYml.h"
 #include "SceneManager.h"
 #include "ComponentFactory.h"
+#include "PrefabTemplate.h"
 #include "Prefab.generated.h"
 
 class Prefab : public Object
@@ -21,18 +22,23 @@ public:
     GameObject* Instantiate(Scene* targetScene, std::string_view newName = "") const;
 
     const MetaYml::Node& GetPrefabData() const { return m_prefabData; }
-    void SetPrefabData(const MetaYml::Node& node) { m_prefabData = node; }
+    void SetPrefabData(const MetaYml::Node& node) { m_prefabData = node; m_template.reset(); }
+    // 처음 호출될 때 m_prefabData 를 컴파일해 캐시한다
+    const PrefabTemplate& GetTemplate() const;
     FileGuid GetFileGuid() const { return m_fileGuid; }
     void SetFileGuid(const FileGuid& guid) { m_fileGuid = guid; }
 
 private:
     static MetaYml::Node SerializeRecursive(const GameObject* obj);
-    GameObject* InstantiateRecursive(const MetaYml::Node& node,
-                                     Scene* scene,
-                                     GameObject::Index parent,
-                                     std::string_view overrideName = "") const;
+    GameObject* InstantiateTemplate(Scene* scene, std::string_view overrideName) const;
+    GameObject* InstantiateEntry(const PrefabTemplate& prefabTemplate,
+                                 const PrefabTemplate::ObjectEntry& entry,
+                                 Scene* scene,
+                                 GameObject::Index parent,
+                                 std::string_view overrideName) const;
 
     MetaYml::Node m_prefabData{};
+    mutable std::shared_ptr<PrefabTemplate> m_template{};
 
     [[Property]]
 	FileGuid m_fileGuid{};
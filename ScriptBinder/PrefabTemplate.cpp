@@ -0,0 +1,153 @@
+#include "PrefabTemplate.h"
+#include "GameObject.h"
+
+namespace
+{
+    // 인스턴스화 과정에서 따로 채워지는 프로퍼티 (컴포넌트는 ComponentFactory, 자식 목록은 계층 구성 시)
+    bool IsRebuiltOnInstantiate(std::string_view name)
+    {
+        return name == "m_components" || name == "m_childrenIndices";
+    }
+}
+
+void PrefabTemplate::Compile(const MetaYml::Node& prefabData)
+{
+    Clear();
+
+    if (!prefabData || !prefabData.IsSequence())
+        return;
+
+    for (std::size_t i = 0; i < prefabData.size(); ++i)
+    {
+        CompileObject(prefabData[i], NullSlot);
+    }
+
+    m_compiled = true;
+}
+
+void PrefabTemplate::Clear()
+{
+    m_objects.clear();
+    m_patches.clear();
+    m_components.clear();
+    m_compiled = false;
+}
+
+void PrefabTemplate::ApplyPatches(const ObjectEntry& entry, void* instance) const
+{
+    char* base = reinterpret_cast<char*>(instance);
+    for (uint32 i = entry.patchOffset; i < entry.patchOffset + entry.patchCount; ++i)
+    {
+        const PropertyPatch& patch = m_patches[i];
+        patch.property->setter(base + patch.offset, patch.value);
+    }
+}
+
+void PrefabTemplate::CompileObject(const MetaYml::Node& node, int32 parentSlot)
+{
+    if (!node)
+        return;
+
+    const int32 slot = static_cast<int32>(m_objects.size());
+    {
+        ObjectEntry entry{};
+        entry.parentSlot = parentSlot;
+        entry.type = static_cast<GameObjectType>(node["m_gameObjectType"].as<int>());
+        entry.name = node["m_name"].as<std::string>();
+        entry.source = node;
+
+        entry.patchOffset = static_cast<uint32>(m_patches.size());
+        CompileProperties(GameObject::Reflect(), node, 0, m_patches, &entry.residual);
+        entry.patchCount = static_cast<uint32>(m_patches.size()) - entry.patchOffset;
+
+        entry.componentOffset = static_cast<uint32>(m_components.size());
+        if (node["m_components"])
+        {
+            for (const auto& componentNode : node["m_components"])
+            {
+                m_components.push_back(componentNode);
+            }
+        }
+        entry.componentCount = static_cast<uint32>(m_components.size()) - entry.componentOffset;
+
+        m_objects.push_back(std::move(entry));
+    }
+
+    // 깊이 우선 순서 : 부모 slot 은 항상 자식보다 앞에 온다
+    if (node["children"])
+    {
+        for (const auto& childNode : node["children"])
+        {
+            CompileObject(childNode, slot);
+        }
+    }
+}
+
+bool PrefabTemplate::CompileProperties(const Meta::Type& type, const MetaYml::Node& node, Meta::OffsetType baseOffset,
+                                       std::vector<PropertyPatch>& outPatches, MetaYml::Node* residual)
+{
+    // Meta::Deserialize 와 같은 순서 (부모 타입 먼저)
+    bool patchable = true;
+    if (type.parent)
+    {
+        patchable &= CompileProperties(*type.parent, node, baseOffset, outPatches, residual);
+    }
+
+    for (const auto& prop : type.properties)
+    {
+        if (!node[prop.name])
+            continue;
+
+        // 최상위에서만 남은 프로퍼티를 residual 노드로 넘길 수 있다
+        auto deferToResidual = [&]()
+        {
+            if (residual)
+            {
+                (*residual)[prop.name] = node[prop.name];
+                return;
+            }
+            patchable = false;
+        };
+
+        if (residual && IsRebuiltOnInstantiate(prop.name))
+            continue;
+
+        if (prop.isPointer || prop.isVector)
+        {
+            deferToResidual();
+            continue;
+        }
+
+        if (const Meta::Type* subType = Meta::MetaDataRegistry->Find(prop.typeName))
+        {
+            std::vector<PropertyPatch> subPatches;
+            if (CompileProperties(*subType, node[prop.name], baseOffset + prop.offset, subPatches, nullptr))
+            {
+                outPatches.insert(outPatches.end(),
+                    std::make_move_iterator(subPatches.begin()), std::make_move_iterator(subPatches.end()));
+            }
+            else
+            {
+                deferToResidual();
+            }
+        }
+        else if (Meta::MetaEnumRegistry->Find(prop.typeName))
+        {
+            outPatches.push_back({ baseOffset, &prop, std::any(node[prop.name].as<int>()) });
+        }
+        else
+        {
+            // YAML -> 값 변환은 기존 경로를 그대로 쓰고, setter 대신 값을 받아 둔다
+            std::any value;
+            Meta::Property capture = prop;
+            capture.setter = [&value](void*, std::any v) { value = std::move(v); };
+            Meta::YamlNodeToProperty(capture, nullptr, node);
+            if (value.has_value())
+            {
+                outPatches.push_back({ baseOffset, &prop, std::move(value) });
+            }
+        }
+    }
+
+    return patchable;
+}
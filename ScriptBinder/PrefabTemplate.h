@@ -0,0 +1,54 @@
+#pragma once
+#include "Core.Minimal.h"
+#include "ReflectionYml.h"
+#include "GameObjectType.h"
+
+// 프리팹 YAML 을 한 번만 해석해 만든 인스턴스화용 템플릿.
+// 오브젝트 테이블(깊이 우선 순서), 컴포넌트 노드 테이블, 미리 변환된 프로퍼티 패치 목록으로 구성된다.
+class PrefabTemplate
+{
+public:
+    static constexpr int32 NullSlot = -1;
+
+    struct PropertyPatch
+    {
+        Meta::OffsetType        offset{};   // 인스턴스 시작 주소 기준 (중첩 타입 포함)
+        const Meta::Property*   property{ nullptr };
+        std::any                value{};
+    };
+
+    struct ObjectEntry
+    {
+        int32           parentSlot{ NullSlot };
+        GameObjectType  type{ GameObjectType::Empty };
+        std::string     name{};
+        uint32          patchOffset{};
+        uint32          patchCount{};
+        uint32          componentOffset{};
+        uint32          componentCount{};
+        MetaYml::Node   residual{};     // 패치로 만들 수 없는 프로퍼티 (포인터, 객체 벡터 등)
+        MetaYml::Node   source{};       // GameObject::m_prefabOriginal 용 원본 노드
+    };
+
+    void Compile(const MetaYml::Node& prefabData);
+    void Clear();
+
+    bool IsCompiled() const { return m_compiled; }
+    const std::vector<ObjectEntry>& GetObjects() const { return m_objects; }
+    const MetaYml::detail::iterator_value& GetComponentNode(uint32 index) const { return m_components[index]; }
+
+    // 패치 목록을 인스턴스에 적용한다 (Meta::Deserialize 와 같은 순서)
+    void ApplyPatches(const ObjectEntry& entry, void* instance) const;
+
+private:
+    void CompileObject(const MetaYml::Node& node, int32 parentSlot);
+    // false 면 패치로 표현할 수 없는 프로퍼티가 포함되어 있음
+    bool CompileProperties(const Meta::Type& type, const MetaYml::Node& node, Meta::OffsetType baseOffset,
+                           std::vector<PropertyPatch>& outPatches, MetaYml::Node* residual);
+
+private:
+    std::vector<ObjectEntry>                        m_objects;
+    std::vector<PropertyPatch>                      m_patches;
+    std::vector<MetaYml::detail::iterator_value>    m_components;
+    bool                                            m_compiled{ false };
+};
@@ -2,6 +2,8 @@
 #include "GameObject.h"
 #include "Object.h"
 #include "ReflectionYml.h"
+#include "Core.PakFileSystem.h"
+#include "Scene.h"
 
 Prefab* PrefabUtility::CreatePrefab(const GameObject* source, std::string_view name)
 {
@@ -120,14 +122,25 @@ bool PrefabUtility::SavePrefab(const Prefab* prefab, const std::string& path)
     out << node;
     out.close();
 
+    // ĳõ    ͷ Ѵ (ø  νϽȭ  ٽ )
+    auto cacheIt = m_prefabCache.find(prefab->GetFileGuid());
+    if (cacheIt != m_prefabCache.end() && cacheIt->second != prefab)
+    {
+        cacheIt->second->SetPrefabData(prefab->GetPrefabData());
+    }
+
     return true;
 }
 
 Prefab* PrefabUtility::LoadPrefabFullPath(const std::string& path)
 {
-    if (path.empty() || !file::exists(path))
+    if (path.empty())
+        return nullptr;
+
+    AssetStream prefabFile(path);
+    if (!prefabFile.is_open())
         return nullptr;
-    auto node = MetaYml::LoadFile(path);
+    auto node = MetaYml::Load(prefabFile);
     auto prefab = new Prefab();
     Meta::Deserialize(prefab, node);
 	prefab->SetPrefabData(node["PrefabNode"]);
@@ -137,14 +150,41 @@ Prefab* PrefabUtility::LoadPrefabFullPath(const std::string& path)
 
 Prefab* PrefabUtility::LoadPrefab(const std::string& path)
 {
+    //      ٽ аų Ľ ʴ´
+    auto nameIt = m_prefabNameCache.find(path);
+    if (nameIt != m_prefabNameCache.end())
+    {
+        auto cacheIt = m_prefabCache.find(nameIt->second);
+        if (cacheIt != m_prefabCache.end())
+            return cacheIt->second;
+    }
+
     file::path filepath = PathFinder::Relative("Prefabs\\") / (path + ".prefab");
-    if (!file::exists(filepath))
+    if (!PakFileSystems->Exists(filepath))
 		return nullptr;
 
+    FileGuid guid = DataSystems->GetFileGuid(filepath.string());
+    if (guid != nullFileGuid)
+    {
+        auto cacheIt = m_prefabCache.find(guid);
+        if (cacheIt != m_prefabCache.end())
+        {
+            m_prefabNameCache[path] = guid;
+            return cacheIt->second;
+        }
+    }
+
     auto prefab = LoadPrefabFullPath(filepath.string());
     if (prefab)
     {
-        prefab->SetFileGuid(DataSystems->GetFileGuid(filepath.string()));
+        prefab->SetFileGuid(guid);
+        if (guid != nullFileGuid)
+        {
+            // ù     ʵ ε  ø 
+            prefab->GetTemplate();
+            m_prefabCache[guid] = prefab;
+            m_prefabNameCache[path] = guid;
+        }
         return prefab;
     }
 
@@ -158,3 +198,134 @@ Prefab* PrefabUtility::LoadPrefabGuid(const FileGuid& guid)
         return nullptr;
 	return LoadPrefabFullPath(path.string());
 }
+
+void PrefabUtility::EnableInstancePool(const Prefab* prefab, size_t capacity, size_t prewarmCount)
+{
+    if (!prefab)
+        return;
+
+    auto& pool = m_instancePools[prefab->GetFileGuid()];
+    pool.capacity = capacity;
+    pool.freeList.reserve(capacity);
+
+    Scene* scene = SceneManagers->GetActiveScene();
+    if (pool.scene != scene)
+    {
+        pool.freeList.clear();
+        pool.scene = scene;
+    }
+
+    const size_t count = std::min(prewarmCount, capacity);
+    while (pool.freeList.size() < count)
+    {
+        GameObject* obj = InstantiatePrefab(prefab);
+        if (!obj)
+            break;
+
+        obj->SetEnabled(false);
+        pool.freeList.push_back({ obj->m_index, obj->GetInstanceID() });
+    }
+}
+
+void PrefabUtility::DisableInstancePool(const Prefab* prefab)
+{
+    if (!prefab)
+        return;
+
+    auto it = m_instancePools.find(prefab->GetFileGuid());
+    if (it == m_instancePools.end())
+        return;
+
+    //  ̴ νϽ ıѴ
+    InstancePool& pool = it->second;
+    while (GameObject* obj = PopPooledInstance(pool))
+    {
+        obj->Destroy();
+    }
+    m_instancePools.erase(it);
+}
+
+GameObject* PrefabUtility::AcquireInstance(const Prefab* prefab, std::string_view name)
+{
+    if (!prefab)
+        return nullptr;
+
+    InstancePool* pool = FindInstancePool(prefab->GetFileGuid());
+    if (pool)
+    {
+        if (GameObject* obj = PopPooledInstance(*pool))
+        {
+            if (!name.empty())
+                obj->SetName(name);
+            obj->SetEnabled(true);
+            return obj;
+        }
+    }
+
+    return InstantiatePrefab(prefab, name);
+}
+
+bool PrefabUtility::ReleaseInstance(GameObject* instance)
+{
+    if (!instance)
+        return false;
+
+    InstancePool* pool = FindInstancePool(instance->m_prefabFileGuid);
+    if (!pool || instance->IsDestroyMark() || instance->m_ownerScene != pool->scene ||
+        pool->freeList.size() >= pool->capacity)
+    {
+        instance->Destroy();
+        return false;
+    }
+
+    const HashedGuid instanceID = instance->GetInstanceID();
+    auto it = std::find_if(pool->freeList.begin(), pool->freeList.end(),
+        [&](const InstancePool::Entry& entry) { return entry.index == instance->m_index && entry.instanceID == instanceID; });
+    if (it != pool->freeList.end())
+    {
+        return true; // ̹ Ǯ ִ νϽ
+    }
+
+    instance->SetEnabled(false);
+    pool->freeList.push_back({ instance->m_index, instanceID });
+    return true;
+}
+
+void PrefabUtility::ClearInstancePools()
+{
+    m_instancePools.clear();
+}
+
+PrefabUtility::InstancePool* PrefabUtility::FindInstancePool(const FileGuid& guid)
+{
+    auto it = m_instancePools.find(guid);
+    if (it == m_instancePools.end())
+        return nullptr;
+
+    //  ٲ   νϽ ̹ 
+    InstancePool& pool = it->second;
+    Scene* scene = SceneManagers->GetActiveScene();
+    if (pool.scene != scene)
+    {
+        pool.freeList.clear();
+        pool.scene = scene;
+    }
+    return &pool;
+}
+
+GameObject* PrefabUtility::PopPooledInstance(InstancePool& pool)
+{
+    // Ǯ ִ  ıǾų ε  ׸ 
+    while (!pool.freeList.empty() && pool.scene)
+    {
+        const InstancePool::Entry entry = pool.freeList.back();
+        pool.freeList.pop_back();
+
+        auto obj = pool.scene->TryGetGameObject(entry.index);
+        if (obj && !obj->IsDestroyMark() && obj->GetInstanceID() == entry.instanceID)
+        {
+            return obj.get();
+        }
+    }
+    return nullptr;
+}
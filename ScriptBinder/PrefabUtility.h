@@ -26,8 +26,37 @@ public:
     Prefab* LoadPrefab(const std::string& path);
 	Prefab* LoadPrefabGuid(const FileGuid& guid);
 
+    // 인스턴스 풀 (프리팹별 opt-in)
+    // 풀을 켠 프리팹은 ReleaseInstance 로 반환된 계층을 비활성화해 보관했다가 AcquireInstance 에서 재사용한다
+    void EnableInstancePool(const Prefab* prefab, size_t capacity, size_t prewarmCount = 0);
+    void DisableInstancePool(const Prefab* prefab);
+    GameObject* AcquireInstance(const Prefab* prefab, std::string_view name = "");
+    // 풀에 들어가면 true, 풀이 없거나 가득 차 파괴되면 false
+    bool ReleaseInstance(GameObject* instance);
+    void ClearInstancePools();
+
 private:
+    struct InstancePool
+    {
+        struct Entry
+        {
+            GameObject::Index index{ GameObject::INVALID_INDEX };
+            HashedGuid instanceID{};
+        };
+
+        size_t capacity{};
+        Scene* scene{ nullptr };
+        std::vector<Entry> freeList;
+    };
+
+    InstancePool* FindInstancePool(const FileGuid& guid);
+    GameObject* PopPooledInstance(InstancePool& pool);
+
     std::unordered_map<FileGuid, std::vector<GameObject*>> m_instanceMap{};
+    // LoadPrefab 캐시 : 파일 GUID 당 하나의 Prefab (템플릿도 함께 유지된다)
+    std::unordered_map<FileGuid, Prefab*> m_prefabCache{};
+    std::unordered_map<std::string, FileGuid> m_prefabNameCache{};
+    std::unordered_map<FileGuid, InstancePool> m_instancePools{};
 };
 
 static auto PrefabUtilitys = PrefabUtility::GetInstance();
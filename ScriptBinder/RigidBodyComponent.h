@@ -21,11 +21,20 @@ public:
 	void SetBodyType(const EBodyType& bodyType);
 	
 	Mathf::Vector3 GetLinearVelocity() const { return m_linearVelocity; }
-	void SetLinearVelocity(const Mathf::Vector3& linearVelocity) { m_linearVelocity = linearVelocity; }
-	void AddLinearVelocity(const Mathf::Vector3& linearVelocity) { m_linearVelocity += linearVelocity; }
+	void SetLinearVelocity(const Mathf::Vector3& linearVelocity) { m_linearVelocity = linearVelocity; SetFlag(RB_VELOCITY_DIRTY, true); }
+	void AddLinearVelocity(const Mathf::Vector3& linearVelocity) { m_linearVelocity += linearVelocity; SetFlag(RB_VELOCITY_DIRTY, true); }
 
 	Mathf::Vector3 GetAngularVelocity() const { return m_angularVelocity; }
-	void SetAngularVelocity(const Mathf::Vector3& angularVelocity) { m_angularVelocity = angularVelocity; }
+	void SetAngularVelocity(const Mathf::Vector3& angularVelocity) { m_angularVelocity = angularVelocity; SetFlag(RB_VELOCITY_DIRTY, true); }
+
+	// PhysicsManager  ùķ̼  ǵ    ( ÷׸  ʴ´)
+	void SyncVelocityFromPhysics(const Mathf::Vector3& linearVelocity, const Mathf::Vector3& angularVelocity)
+	{
+		m_linearVelocity = linearVelocity;
+		m_angularVelocity = angularVelocity;
+	}
+	bool IsVelocityDirty() const { return TestFlag(RB_VELOCITY_DIRTY); }
+	void ClearVelocityDirty() { SetFlag(RB_VELOCITY_DIRTY, false); }
 
 	void SetLockLinearX(bool isLock) { SetFlag(RB_LOCK_LIN_X, isLock); SetDirty(true); }
 	void SetLockLinearY(bool isLock) { SetFlag(RB_LOCK_LIN_Y, isLock); SetDirty(true); }
@@ -129,6 +138,7 @@ private:
 		RB_LOCK_ANG_Y = 1u << 4,
 		RB_LOCK_ANG_Z = 1u << 5,
 		RB_DIRTY = 1u << 6, // isRigidbodyDirty
+		RB_VELOCITY_DIRTY = 1u << 7, // ũƮ ӵ ٲ ( ܿ ε)
 	};
 
 	//  Ʈ   (ʱⰪ: dirty=false,  lock=false)
@@ -24,7 +24,8 @@
 #include "RectTransformComponent.h"
 #include "SpriteSheetComponent.h"
 #include "AIManager.h"
-#include <execution>
+#include "CullingManager.h"
+#include "Core.JobSystem.h"
 #include <queue>
 #include <algorithm>
 
@@ -39,6 +40,8 @@ Scene::Scene()
 
 Scene::~Scene()
 {
+	// std::future 소멸 때처럼 진행 중인 AI 업데이트가 끝난 뒤 정리한다
+	JobSystems->Wait(m_AIJob);
     SceneManagers->resetSelectedObjectEvent -= resetObjHandle;
 	AwakeEvent.Clear();
 	OnEnableEvent.Clear();
@@ -83,6 +86,7 @@ std::shared_ptr<GameObject> Scene::AddGameObject(const std::shared_ptr<GameObjec
 	const_cast<GameObject::Index&>(sceneObject->m_index) = m_SceneObjects.size() - 1;
 
 	m_SceneObjects[0]->m_childrenIndices.push_back(sceneObject->m_index);
+	MarkHierarchyDirty();
 
 	if (!sceneObject->m_tag.ToString().empty())
 	{
@@ -118,6 +122,7 @@ void Scene::AddRootGameObject(std::string_view name)
 	}
 
 	m_SceneObjects.push_back(ptr);
+	MarkHierarchyDirty();
 }
 
 std::shared_ptr<GameObject> Scene::CreateGameObject(std::string_view name, GameObjectType type, GameObject::Index parentIndex)
@@ -151,6 +156,7 @@ std::shared_ptr<GameObject> Scene::CreateGameObject(std::string_view name, GameO
 	{
 		parentObj->m_childrenIndices.push_back(index);
 	}
+	MarkHierarchyDirty();
 
 	if (!ptr->m_tag.ToString().empty())
 	{
@@ -191,6 +197,7 @@ std::shared_ptr<GameObject> Scene::LoadGameObject(size_t instanceID, std::string
 	ptr->m_removedSuffixNumberTag = name.data();
 
     m_SceneObjects.push_back(ptr);
+    MarkHierarchyDirty();
 
     return m_SceneObjects[index];
 }
@@ -251,6 +258,7 @@ void Scene::DetachGameObjectHierarchy(GameObject* root)
         }
     };
     detachFromParent(root);
+    MarkHierarchyDirty();
 
     for (size_t qi = 0; qi < queue.size(); ++qi)
     {
@@ -317,6 +325,7 @@ GameObject::Index Scene::AttachExistingGameObject(std::shared_ptr<GameObject> go
     GameObject::Index newIndex = static_cast<GameObject::Index>(m_SceneObjects.size());
     go->m_index = newIndex;
     m_SceneObjects.push_back(go);
+    MarkHierarchyDirty();
 
     // Tag/Layer 재등록
     if (!go->m_tag.ToString().empty())
@@ -436,161 +445,123 @@ void Scene::CullMeshData()
 {
 	InternalPauseUpdateForUI();
 
-	std::vector<MeshRenderer*> allMeshes = m_allMeshRenderers;
-	std::vector<MeshRenderer*> staticMeshes = m_staticMeshRenderers;
-	std::vector<MeshRenderer*> skinnedMeshes = m_skinnedMeshRenderers;
-	std::vector<TerrainComponent*> terrainComponents = m_terrainComponents;
-	std::vector<FoliageComponent*> foliageComponents = m_foliageComponents;
-	std::vector<ImageComponent*> imageComponents = UIManagers->Images;
-	std::vector<TextComponent*> textComponents = UIManagers->Texts;
-	std::vector<SpriteRenderer*> spriteRenderers = m_spriteRenderers;
-	std::vector<SpriteSheetComponent*> spriteSheetComponents = UIManagers->SpriteSheets;
-	std::vector<DecalComponent*> decalComponents = m_decalComponents;
+	auto& cameras = CameraManagement->GetCameras();
 
-	for (auto camera : CameraManagement->GetCameras())
+	std::vector<Camera*> validCameras;
+	std::vector<RenderPassData*> passDatas;
+	std::vector<DirectX::BoundingFrustum> frustums;
+	validCameras.reserve(cameras.size());
+	passDatas.reserve(cameras.size());
+	frustums.reserve(cameras.size());
+
+	for (auto& camera : cameras)
 	{
-		if (!RenderPassData::VaildCheck(camera.get())) return;
-		auto data = RenderPassData::GetData(camera.get());
+		if (!RenderPassData::VaildCheck(camera.get())) break;
+		validCameras.push_back(camera.get());
+		passDatas.push_back(RenderPassData::GetData(camera.get()));
+		frustums.push_back(camera->GetFrustum());
+	}
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& mesh : allMeshes)
-			{
-				if (mesh->IsDestroyMark()					|| 
-					false == mesh->IsEnabled()				|| 
-					false == mesh->GetOwner()->IsEnabled()
-				) continue;
-				data->PushShadowRenderData(mesh->GetInstanceID());
-			}
-		});
+	if (validCameras.empty()) return;
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& culledMesh : staticMeshes)
-			{
-				if (false == culledMesh->IsEnabled() || false == culledMesh->GetOwner()->IsEnabled()) continue;
+	auto isVisible = [](const auto* component)
+	{
+		return component->IsEnabled() && component->GetOwner()->IsEnabled();
+	};
 
-				auto frustum = camera->GetFrustum();
-				if (frustum.Intersects(culledMesh->GetBoundingBox()))
-				{
-					data->PushCullData(culledMesh->GetInstanceID());
-				}
-			}
-		});
+	auto isUIVisibleInScene = [this](GameObject* owner)
+	{
+		if (nullptr == owner) return false;
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& skinnedMesh : skinnedMeshes)
-			{
-				if (false == skinnedMesh->IsEnabled() || false == skinnedMesh->GetOwner()->IsEnabled()) continue;
+		auto scene = owner->GetScene();
 
-				auto frustum = camera->GetFrustum();
-				if (frustum.Intersects(skinnedMesh->GetBoundingBox()))
-				{
-					data->PushCullData(skinnedMesh->GetInstanceID());
-				}
-			}
-		});
+		// (G) UI 중복 렌더 가드:
+		//  - 같은 씬이면 렌더
+		//  - DDOL이면 "활성 씬 소속"인 경우에만 렌더
+		return scene && (scene == this ||
+			(owner->IsDontDestroyOnLoad() && scene == SceneManagers->GetActiveScene()));
+	};
 
-		SceneManagers->m_threadPool->Enqueue([=]
+	// 컬링이 필요 없는 컴포넌트는 카메라당 하나의 작업으로 처리하고,
+	// 그 동안 게임 스레드에서 BVH 한 번 순회로 모든 카메라의 메쉬 컬링을 수행한다.
+	JobHandle cullGroup = JobSystems->CreateGroup();
+	for (RenderPassData* data : passDatas)
+	{
+		JobSystems->Schedule(cullGroup, [=, this]
 		{
-			for (auto& terrainComponent : terrainComponents)
+			for (auto& mesh : m_allMeshRenderers)
 			{
-				if (false == terrainComponent->IsEnabled() || false == terrainComponent->GetOwner()->IsEnabled()) continue;
+				if (mesh->IsDestroyMark() || false == isVisible(mesh)) continue;
+				data->PushShadowRenderData(mesh->GetInstanceID());
+			}
 
+			for (auto& terrainComponent : m_terrainComponents)
+			{
+				if (false == isVisible(terrainComponent)) continue;
 				data->PushCullData(terrainComponent->GetInstanceID());
 			}
-		});
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& foliageComponent : foliageComponents)
+			for (auto& foliageComponent : m_foliageComponents)
 			{
-				if (false == foliageComponent->IsEnabled() || false == foliageComponent->GetOwner()->IsEnabled()) continue;
-
+				if (false == isVisible(foliageComponent)) continue;
 				data->PushCullData(foliageComponent->GetInstanceID());
 			}
-		});
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& decalComponent : decalComponents)
+			for (auto& decalComponent : m_decalComponents)
 			{
-				if (false == decalComponent->IsEnabled() || false == decalComponent->GetOwner()->IsEnabled()) continue;
-
+				if (false == isVisible(decalComponent)) continue;
 				data->PushCullData(decalComponent->GetInstanceID());
 			}
-		});
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& sprite : spriteRenderers)
+			for (auto& sprite : m_spriteRenderers)
 			{
-				if (false == sprite->IsEnabled() || false == sprite->GetOwner()->IsEnabled()) continue;
-
+				if (false == isVisible(sprite)) continue;
 				data->PushCullData(sprite->GetInstanceID());
 			}
-		});
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& image : imageComponents)
+			for (auto& image : UIManagers->Images)
 			{
-				if (false == image->IsEnabled() || false == image->GetOwner()->IsEnabled()) continue;
-
-				auto owner = image->GetOwner();
-				if (nullptr == owner) continue;
-
-				auto scene = owner->GetScene();
-
-				// (G) UI 중복 렌더 가드:
-				//  - 같은 씬이면 렌더
-				//  - DDOL이면 "활성 씬 소속"인 경우에만 렌더
-				if (scene && (scene == this ||
-					(owner->IsDontDestroyOnLoad() && scene == SceneManagers->GetActiveScene())))
-				{
-					data->PushUIRenderData(image->GetInstanceID());
-				}
+				if (false == isVisible(image) || false == isUIVisibleInScene(image->GetOwner())) continue;
+				data->PushUIRenderData(image->GetInstanceID());
 			}
-		});
 
-		SceneManagers->m_threadPool->Enqueue([=]
-		{
-			for (auto& text : textComponents)
+			for (auto& text : UIManagers->Texts)
 			{
-				if (false == text->IsEnabled() || false == text->GetOwner()->IsEnabled()) continue;
-
-				auto owner = text->GetOwner();
-				if (nullptr == owner) continue;
-
-				auto scene = owner->GetScene();
+				if (false == isVisible(text) || false == isUIVisibleInScene(text->GetOwner())) continue;
+				data->PushUIRenderData(text->GetInstanceID());
+			}
 
-				if (scene && (scene == this ||
-					(owner->IsDontDestroyOnLoad() && scene == SceneManagers->GetActiveScene())))
-				{
-					data->PushUIRenderData(text->GetInstanceID());
-				}
+			for (auto& spriteSheet : UIManagers->SpriteSheets)
+			{
+				if (false == isVisible(spriteSheet) || false == isUIVisibleInScene(spriteSheet->GetOwner())) continue;
+				data->PushUIRenderData(spriteSheet->GetInstanceID());
 			}
 		});
+	}
 
-		SceneManagers->m_threadPool->Enqueue([=]
+	PROFILE_CPU_BEGIN("CullMeshes");
+	CullingManagers->CullMeshes(frustums, m_visibleMeshesPerCamera);
+	PROFILE_CPU_END();
+
+	for (size_t i = 0; i < passDatas.size(); ++i)
+	{
+		RenderPassData* data = passDatas[i];
+		const auto& visibleMeshes = m_visibleMeshesPerCamera[i];
+
+		JobSystems->Schedule(cullGroup, [this, data, &visibleMeshes]
 		{
-			for (auto& spriteSheet : spriteSheetComponents)
+			for (MeshRenderer* mesh : visibleMeshes)
 			{
-				if (false == spriteSheet->IsEnabled() || false == spriteSheet->GetOwner()->IsEnabled()) continue;
-				auto owner = spriteSheet->GetOwner();
-				if (nullptr == owner) continue;
-				auto scene = owner->GetScene();
-				if (scene && (scene == this ||
-					(owner->IsDontDestroyOnLoad() && scene == SceneManagers->GetActiveScene())))
-				{
-					data->PushUIRenderData(spriteSheet->GetInstanceID());
-				}
+				auto owner = mesh->GetOwner();
+				// BVH 는 모든 씬의 메쉬를 가지고 있으므로 이 씬 소속만 통과시킨다
+				if (owner->m_ownerScene != this || false == mesh->IsEnabled() || false == owner->IsEnabled()) continue;
+
+				data->PushCullData(mesh->GetInstanceID());
 			}
 		});
-
-		SceneManagers->m_threadPool->NotifyAllAndWait();
 	}
+
+	JobSystems->Wait(cullGroup);
 }
 
 void Scene::InternalPauseUpdateForUI()
@@ -700,13 +671,32 @@ void Scene::Start()
     StartEvent.Broadcast();
 }
 
+void Scene::WaitAIUpdate()
+{
+	if (!m_AIJob)
+		return;
+
+	JobSystems->Wait(m_AIJob);
+	m_AIJob.reset();
+	// 작업 안에서 쓰지 않고 합류한 뒤 게임 스레드에서 적용한다
+	AIManagers->FlushDeferredWrites();
+}
+
+void Scene::ScheduleAIUpdate()
+{
+	// JobHandle 은 대입으로 합류하지 않으므로 (std::future 와 다르다) 남은 작업이 있으면 먼저 합류한다
+	WaitAIUpdate();
+	float deltaSecond = Time->GetElapsedSeconds();
+	m_AIJob = JobSystems->Schedule([deltaSecond]
+		{
+			AIManagers->InternalAIUpdate(deltaSecond);
+		});
+}
+
 void Scene::FixedUpdate(float deltaSecond)
 {
-	//여기서 반드시 블로킹해서 BT 업데이트를 마친다.
-	if (m_AIFuture.valid())
-	{
-		m_AIFuture.get();
-	}
+	// 비동기로 돌린 이전 스텝 결과를 받는다
+	PhysicsManagers->FetchSimulation();
 #ifndef BUILD_FLAG
 	PROFILE_CPU_BEGIN("AllUpdateWorldMatrix");
 	AllUpdateWorldMatrix();	// render 단계에서 imgui를 통해 transform의 변경이 있으므로 디버그모드에서만 사용.
@@ -786,6 +776,48 @@ void Scene::OnCollisionExit(const Collision& collider)
     }
 }
 
+void Scene::CollectCollisionHandlers(GameObject* object, CollisionHandlerList& outHandlers)
+{
+	for (auto& handlers : outHandlers)
+	{
+		handlers.clear();
+	}
+
+	auto target = object->GetComponents<ModuleBehavior>();
+	for (auto& t : target) {
+		const Core::DelegateHandle handles[CollisionEventTypeCount] = {
+			t->m_onTriggerEnterEventHandle,		// ENTER_OVERLAP
+			t->m_onTriggerStayEventHandle,		// ON_OVERLAP
+			t->m_onTriggerExitEventHandle,		// END_OVERLAP
+			t->m_onCollisionEnterEventHandle,	// ENTER_COLLISION
+			t->m_onCollisionStayEventHandle,	// ON_COLLISION
+			t->m_onCollisionExitEventHandle,	// END_COLLISION
+		};
+		for (uint32_t i = 0; i < CollisionEventTypeCount; ++i) {
+			if (handles[i].IsValid()) {
+				outHandlers[i].push_back(handles[i]);
+			}
+		}
+	}
+}
+
+void Scene::InvokeCollisionHandlers(ECollisionEventType type, std::vector<Core::DelegateHandle>& handlers, const Collision& collider)
+{
+	Core::Delegate<void, const Collision&>* events[CollisionEventTypeCount] = {
+		&OnTriggerEnterEvent,
+		&OnTriggerStayEvent,
+		&OnTriggerExitEvent,
+		&OnCollisionEnterEvent,
+		&OnCollisionStayEvent,
+		&OnCollisionExitEvent,
+	};
+
+	auto& event = *events[static_cast<uint32_t>(type)];
+	for (auto& handle : handlers) {
+		event.TargetInvoke(handle, collider);
+	}
+}
+
 void Scene::Update(float deltaSecond)
 {
 	PROFILE_CPU_BEGIN("PreAllUpdateWorldMatrix");
@@ -799,6 +831,11 @@ void Scene::Update(float deltaSecond)
 	PROFILE_CPU_BEGIN("LateAllUpdateWorldMatrix");
 	AllUpdateWorldMatrix();
 	PROFILE_CPU_END();
+
+	// 물리 보간은 Update 가 옮긴 결과 위에 렌더 행렬로만 얹는다
+	PROFILE_CPU_BEGIN("ApplyRenderPoses");
+	m_transformHierarchy.ApplyRenderPoses(PhysicsManagers->GetRenderPoses());
+	PROFILE_CPU_END();
 }
 
 void Scene::YieldNull()
@@ -837,16 +874,12 @@ void Scene::OnDestroy()
 	PROFILE_CPU_BEGIN("DestroyGameObjects");
     DestroyGameObjects();
 	PROFILE_CPU_END();
-	//여기서 병렬처리
-	float deltaSecond = Time->GetElapsedSeconds();
-	m_AIFuture = std::async(std::launch::async, [deltaSecond]
-		{
-			AIManagers->InternalAIUpdate(deltaSecond);
-		});
 }
 
 void Scene::AllDestroyMark()
 {
+	// 씬을 내리기 전에 떠 있는 AI 업데이트와 합류한다 (에디터 UI 처럼 프레임 중간에 내릴 수 있다)
+	WaitAIUpdate();
     for (const auto& obj : m_SceneObjects)
     {
         if (obj && !obj->IsDestroyMark() && !obj->IsDontDestroyOnLoad())
@@ -1016,6 +1049,7 @@ void Scene::CollectMeshRenderer(MeshRenderer* ptr)
 		{
 			m_staticMeshRenderers.push_back(ptr);
 		}
+		MarkHierarchyDirty();
 	}
 }
 
@@ -1032,6 +1066,7 @@ void Scene::UnCollectMeshRenderer(MeshRenderer* ptr)
 			std::erase_if(m_staticMeshRenderers, [ptr](const auto& mesh) { return mesh == ptr; });
         }
 		std::erase_if(m_allMeshRenderers, [ptr](const auto& mesh) { return mesh == ptr; });
+		MarkHierarchyDirty();
 	}
 }
 
@@ -1156,6 +1191,7 @@ void Scene::CollectColliderComponent(BoxColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 			else
 			{
@@ -1170,6 +1206,7 @@ void Scene::CollectColliderComponent(BoxColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 		};
 
@@ -1221,6 +1258,7 @@ void Scene::CollectColliderComponent(SphereColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 			else
 			{
@@ -1235,6 +1273,7 @@ void Scene::CollectColliderComponent(SphereColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 		};
 
@@ -1286,6 +1325,7 @@ void Scene::CollectColliderComponent(CapsuleColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 			else
 			{
@@ -1300,6 +1340,7 @@ void Scene::CollectColliderComponent(CapsuleColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 		};
 
@@ -1351,6 +1392,7 @@ void Scene::CollectColliderComponent(MeshColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 			else
 			{
@@ -1365,6 +1407,7 @@ void Scene::CollectColliderComponent(MeshColliderComponent* ptr)
 						ptr,
 						false
 				};
+				m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 			}
 		};
 
@@ -1407,6 +1450,7 @@ void Scene::CollectColliderComponent(CharacterControllerComponent* ptr)
 				ptr,
 				false
 		};
+		m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 	}
 }
 
@@ -1436,6 +1480,7 @@ void Scene::CollectColliderComponent(TerrainColliderComponent* ptr)
 			ptr,
 			false
 		} });
+		m_colliderContainer[colliderID].registeredVersion = ++m_colliderContainerVersion;
 	}
 }
 
@@ -1471,6 +1516,8 @@ void Scene::DestroyGameObjects()
 	if (deletedIndices.empty())
 		return;
 
+	MarkHierarchyDirty();
+
 	for (auto& obj : m_SceneObjects)
 	{
 		if (obj && deletedIndices.contains(obj->m_index))
@@ -1598,90 +1645,6 @@ void Scene::RemoveGameObjectName(const std::string_view& name)
 	m_gameObjectNameSet.erase(name.data());
 }
 
-void Scene::UpdateModelRecursive(GameObject::Index objIndex, Mathf::xMatrix model, bool recursive)
-{
-	if (objIndex == GameObject::INVALID_INDEX || objIndex < 0 ||
-		static_cast<size_t>(objIndex) >= m_SceneObjects.size())
-	{
-		return;
-	}
-
-	const auto& obj = m_SceneObjects[objIndex];
-
-	if (!obj || obj->IsDestroyMark())
-	{
-		return;
-	}
-
-	switch (obj->GetType())
-	{
-	case GameObjectType::UI:
-	{
-		const auto& RectTransform = obj->GetComponent<RectTransformComponent>();
-		const auto& objParent = m_SceneObjects[obj->m_parentIndex];
-		if (!RectTransform || !RectTransform->IsEnabled() || !objParent)
-		{
-			return;
-		}
-		const auto& ParentRectTransform = objParent->GetComponent<RectTransformComponent>();
-		if (!ParentRectTransform || !ParentRectTransform->IsEnabled())
-		{
-			return;
-		}
-		RectTransform->UpdateLayout(ParentRectTransform->GetWorldRect());
-		break;
-	}
-	case GameObjectType::Bone:
-	{
-		//const auto& animator = GetGameObject(obj->m_rootIndex)->GetComponent<Animator>();
-		//if (!animator || !animator->m_Skeleton || !animator->IsEnabled())
-		//{
-		//	return;
-		//}
-		//const auto bone = animator->m_Skeleton->FindBone(obj->RemoveSuffixNumberTag());
-		//obj->m_transform.SetAndDecomposeMatrix(XMMatrixMultiply(bone ?
-		//	animator->m_localTransforms[bone->m_index] : obj->m_transform.GetLocalMatrix(), model));
-		//break;
-
-		const auto& rootObj = TryGetGameObject(obj->m_rootIndex);
-		if (!rootObj)
-		{
-			return;
-		}
-		const auto& animator = rootObj->GetComponent<Animator>();
-		if (!animator || !animator->m_Skeleton || !animator->IsEnabled())
-		{
-			return;
-		}
-		const auto bone = animator->m_Skeleton->FindBone(obj->RemoveSuffixNumberTag());
-		obj->m_transform.SetAndDecomposeMatrix(XMMatrixMultiply(bone ?
-			animator->m_localTransforms[bone->m_index] : obj->m_transform.GetLocalMatrix(), model));
-		break;
-	}
-	default:
-	{
-		if (obj->m_transform.IsDirty())
-		{
-			auto renderer = obj->GetComponent<MeshRenderer>();
-			if (renderer)
-			{
-				renderer->SetNeedUpdateCulling(true);
-			}
-		}
-		model = XMMatrixMultiply(obj->m_transform.GetLocalMatrix(), model);
-		obj->m_transform.SetAndDecomposeMatrix(model);
-		break;
-	}
-	}
-
-
-	for (auto& childIndex : obj->m_childrenIndices)
-	{
-		if (childIndex == obj->m_index) continue;
-		UpdateModelRecursive(childIndex, model, recursive);
-	}
-}
-
 void Scene::UpdateUIRecursive(GameObject::Index objIndex, bool recursive)
 {
 	if (objIndex == GameObject::INVALID_INDEX || objIndex < 0 ||
@@ -1723,11 +1686,15 @@ void Scene::SetInternalPhysicData()
 {
 	if(!m_colliderContainer.empty())
 	{
-		std::erase_if(m_colliderContainer,
+		const auto erased = std::erase_if(m_colliderContainer,
 			[&](const auto& pair)
 			{
 				return pair.second.bIsDestroyed == true;
 			});
+		if (erased > 0)
+		{
+			++m_colliderContainerVersion;
+		}
 	}
 
 	std::unordered_map<GameObject*, EBodyType> m_bodyType;
@@ -1810,17 +1777,7 @@ void Scene::AllUpdateWorldMatrix()
 {
 	if (m_SceneObjects.empty()) return;
 
-	auto& rootObjects = m_SceneObjects[0]->m_childrenIndices;
-
-	auto updateFunc = [this](GameObject::Index index)
-	{
-		UpdateModelRecursive(index, XMMatrixIdentity());
-	};
-
-	if (!rootObjects.empty())
-	{
-		std::for_each(std::execution::par, rootObjects.begin(), rootObjects.end(), updateFunc);
-	}
+	m_transformHierarchy.Update(*this);
 }
 
 void Scene::AllUIUpdateWorldMatrix()
@@ -1828,15 +1785,14 @@ void Scene::AllUIUpdateWorldMatrix()
 	if (m_SceneObjects.empty()) return;
 
 	auto& rootObjects = m_SceneObjects[0]->m_childrenIndices;
-	auto updateFunc = [this](GameObject::Index index)
-	{
-		UpdateUIRecursive(index);
-	};
-
-	if (!rootObjects.empty())
+	JobHandle updateGroup = JobSystems->ParallelFor(static_cast<uint32>(rootObjects.size()), 1, [this, &rootObjects](uint32 begin, uint32 end)
 	{
-		std::for_each(std::execution::par, rootObjects.begin(), rootObjects.end(), updateFunc);
-	}
+		for (uint32 i = begin; i < end; ++i)
+		{
+			UpdateUIRecursive(rootObjects[i]);
+		}
+	});
+	JobSystems->Wait(updateGroup);
 }
 
 void Scene::AddCanvas(const std::shared_ptr<GameObject>& canvas)
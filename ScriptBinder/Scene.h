@@ -4,6 +4,7 @@
 #include "AssetBundle.h"
 #include "Scene.generated.h"
 #include "EBodyType.h"
+#include "TransformHierarchy.h"
 #include <unordered_map>
 
 #pragma region forward_decl
@@ -30,6 +31,7 @@ class TerrainColliderComponent;
 class Transform;
 class Animator;
 class SpriteRenderer;
+class JobCounter;
 #pragma endregion forward_decl
 class Scene
 {
@@ -41,7 +43,6 @@ public:
 
     [[Property]]
 	std::vector<std::shared_ptr<GameObject>> m_SceneObjects;
-	std::future<void> m_AIFuture;
 
 	std::shared_ptr<GameObject> AddGameObject(const std::shared_ptr<GameObject>& sceneObject);
 	std::shared_ptr<GameObject> CreateGameObject(std::string_view name, GameObjectType type = GameObjectType::Empty, GameObject::Index parentIndex = -1);
@@ -73,8 +74,12 @@ public:
 	inline void InsertGameObjects(std::vector<std::shared_ptr<GameObject>>& gameObjects)
 	{
 		m_SceneObjects.insert(m_SceneObjects.end(), gameObjects.begin(), gameObjects.end());
+		MarkHierarchyDirty();
 	}
 
+	// 부모/자식 관계나 MeshRenderer 등록이 바뀌면 호출 (다음 AllUpdateWorldMatrix 에서 계층 재구성)
+	inline void MarkHierarchyDirty() { m_transformHierarchy.MarkStructureDirty(); }
+
 private:
     friend class SceneManager;
     //for Editor
@@ -123,8 +128,17 @@ public:
     void OnCollisionEnter(const Collision& collider);
     void OnCollisionStay(const Collision& collider);
     void OnCollisionExit(const Collision& collider);
+    // 오브젝트 스크립트의 충돌 이벤트 핸들을 종류별로 모은다 (PhysicsManager 가 캐시)
+    void CollectCollisionHandlers(GameObject* object, CollisionHandlerList& outHandlers);
+    void InvokeCollisionHandlers(ECollisionEventType type, std::vector<Core::DelegateHandle>& handlers, const Collision& collider);
+    // 스크립트 이벤트 바인딩이 바뀌었음을 알린다 (충돌 핸들 캐시 무효화)
+    void MarkScriptEventsChanged() { ++m_scriptEventVersion; }
 
     //Game logic
+    // 이전 프레임 끝에 띄운 AI 업데이트와 합류하고, AI 가 미뤄 둔 쓰기를 적용한다 (띄운 작업이 없으면 바로 반환)
+    void WaitAIUpdate();
+    // 프레임 끝(SceneManager::DisableOrEnable)에서 AI 업데이트를 띄운다
+    void ScheduleAIUpdate();
     void Update(float deltaSecond);
     void YieldNull();
     void LateUpdate(float deltaSecond);
@@ -235,7 +249,6 @@ private:
 	void DestroyComponents();
     std::string GenerateUniqueGameObjectName(const std::string_view& name);
 	void RemoveGameObjectName(const std::string_view& name);
-    void UpdateModelRecursive(GameObject::Index objIndex, Mathf::xMatrix model, bool recursive = false);
 	void UpdateUIRecursive(GameObject::Index objIndex, bool recursive = false);
 
 private:
@@ -257,6 +270,9 @@ private:
     std::vector<FoliageComponent*>  m_foliageComponents;
 	std::vector<DecalComponent*>	m_decalComponents;
 	std::vector<SpriteRenderer*>	m_spriteRenderers;
+	std::vector<std::vector<MeshRenderer*>> m_visibleMeshesPerCamera;
+	// 깊이 순 SoA 트랜스폼 계층 (AllUpdateWorldMatrix 에서 사용)
+	TransformHierarchy m_transformHierarchy;
 	std::mutex sceneMutex{};
 
 private:
@@ -274,6 +290,9 @@ private:
 	std::vector<std::shared_ptr<Animator*>>     m_animators;
     RigidBodyTypeLinkCallback					m_ColliderTypeLinkCallback;
 	ColliderContainerType						m_colliderContainer;
+	uint32										m_colliderContainerVersion{ 0 }; // 컨테이너 구성이 바뀔 때마다 증가 (PhysicsManager 동기화 테이블 재구성용)
+	uint32										m_scriptEventVersion{ 0 };		// 스크립트 이벤트 바인딩이 바뀔 때마다 증가 (PhysicsManager 충돌 핸들 캐시용)
+	std::shared_ptr<JobCounter>					m_AIJob;	// ScheduleAIUpdate 에서 띄운 AI 업데이트 (WaitAIUpdate 로만 합류)
 
 private:
 	std::vector<std::weak_ptr<GameObject>>	Canvases;
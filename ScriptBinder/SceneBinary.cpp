@@ -0,0 +1,923 @@
+#include "SceneBinary.h"
+#include "GameObject.h"
+#include "ComponentFactory.h"
+#include "Core.PakFileSystem.h"
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    constexpr uint32 DecodeChunkSize = 64;
+
+    constexpr size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    enum class FieldKind : uint8
+    {
+        Raw,        // 오프셋에 바로 memcpy
+        Enum,       // int 로 setter 호출
+        String,     // 문자열 테이블 인덱스로 setter 호출
+        Residual,   // YAML 로 남겨 Meta::Deserialize
+    };
+
+    struct RawType
+    {
+        HashedGuid  typeID{};
+        uint32      size{};
+        void        (*store)(const std::any& value, std::byte* out){ nullptr };
+    };
+
+    template<typename T>
+    RawType MakeRawType()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return { type_guid(T), sizeof(T), [](const std::any& value, std::byte* out)
+        {
+            const T typed = std::any_cast<T>(value);
+            std::memcpy(out, &typed, sizeof(T));
+        } };
+    }
+
+    // YamlNodeToProperty 가 지원하는 타입 중 오프셋 기록이 가능한 타입
+    const RawType* FindRawType(HashedGuid typeID)
+    {
+        static const RawType rawTypes[] =
+        {
+            MakeRawType<int>(),
+            MakeRawType<float>(),
+            MakeRawType<bool>(),
+            MakeRawType<int8_t>(),
+            MakeRawType<uint8_t>(),
+            MakeRawType<int16_t>(),
+            MakeRawType<uint16_t>(),
+            MakeRawType<uint32_t>(),
+            MakeRawType<int64_t>(),
+            MakeRawType<uint64_t>(),
+            MakeRawType<HashedGuid>(),
+            MakeRawType<Mathf::Vector2>(),
+            MakeRawType<Mathf::Vector3>(),
+            MakeRawType<Mathf::Vector4>(),
+            MakeRawType<Mathf::Color4>(),
+            MakeRawType<Mathf::Quaternion>(),
+            MakeRawType<Mathf::Rect>(),
+        };
+
+        for (const RawType& raw : rawTypes)
+        {
+            if (raw.typeID == typeID)
+                return &raw;
+        }
+        return nullptr;
+    }
+
+    bool IsStringType(HashedGuid typeID)
+    {
+        return typeID == type_guid(std::string) || typeID == type_guid(file::path) ||
+            typeID == type_guid(HashingString) || typeID == type_guid(FileGuid);
+    }
+
+    void SetStringProperty(const Meta::Property& prop, void* owner, std::string_view value)
+    {
+        if (prop.typeID == type_guid(HashingString))
+        {
+            prop.setter(owner, HashingString(std::string(value)));
+        }
+        else if (prop.typeID == type_guid(FileGuid))
+        {
+            prop.setter(owner, FileGuid(std::string(value)));
+        }
+        else if (prop.typeID == type_guid(file::path))
+        {
+            prop.setter(owner, file::path(value));
+        }
+        else
+        {
+            prop.setter(owner, std::string(value));
+        }
+    }
+
+    struct FieldLayout
+    {
+        std::vector<const char*>    path;                   // YAML 노드 경로 (중첩 타입 포함)
+        const Meta::Property*       property{ nullptr };
+        const RawType*              raw{ nullptr };
+        Meta::OffsetType            ownerOffset{};          // setter 에 넘길 소유 객체 오프셋
+        uint32                      size{};
+        FieldKind                   kind{ FieldKind::Residual };
+    };
+
+    // Meta::Deserialize 와 같은 순서로 프로퍼티를 펼친다 (부모 타입 먼저)
+    bool FlattenProperties(const Meta::Type& type, Meta::OffsetType ownerOffset,
+                           const std::vector<const char*>& prefix, std::vector<FieldLayout>& out)
+    {
+        bool patchable = true;
+        if (type.parent)
+        {
+            patchable &= FlattenProperties(*type.parent, ownerOffset, prefix, out);
+        }
+
+        const bool topLevel = prefix.empty();
+        for (const auto& prop : type.properties)
+        {
+            // 컴포넌트는 타입별 블록으로 따로 쿠킹한다
+            if (topLevel && std::string_view(prop.name) == "m_components")
+                continue;
+
+            std::vector<const char*> path = prefix;
+            path.push_back(prop.name);
+
+            // 최상위에서만 residual 로 넘길 수 있다
+            auto deferToResidual = [&]()
+            {
+                if (topLevel)
+                {
+                    out.push_back({ path, &prop, nullptr, ownerOffset, 0, FieldKind::Residual });
+                    return;
+                }
+                patchable = false;
+            };
+
+            if (prop.isPointer || prop.isVector)
+            {
+                deferToResidual();
+                continue;
+            }
+
+            if (const Meta::Type* subType = Meta::MetaDataRegistry->Find(prop.typeName))
+            {
+                std::vector<FieldLayout> subFields;
+                if (FlattenProperties(*subType, ownerOffset + prop.offset, path, subFields))
+                {
+                    out.insert(out.end(),
+                        std::make_move_iterator(subFields.begin()), std::make_move_iterator(subFields.end()));
+                }
+                else
+                {
+                    deferToResidual();
+                }
+            }
+            else if (Meta::MetaEnumRegistry->Find(prop.typeName))
+            {
+                out.push_back({ path, &prop, nullptr, ownerOffset, static_cast<uint32>(sizeof(int)), FieldKind::Enum });
+            }
+            else if (const RawType* raw = FindRawType(prop.typeID))
+            {
+                out.push_back({ path, &prop, raw, ownerOffset, raw->size, FieldKind::Raw });
+            }
+            else if (IsStringType(prop.typeID))
+            {
+                out.push_back({ path, &prop, nullptr, ownerOffset, 0, FieldKind::String });
+            }
+            else
+            {
+                deferToResidual();
+            }
+        }
+
+        return patchable;
+    }
+}
+
+struct SceneBinary::TypeLayout
+{
+    const Meta::Type*           type{ nullptr };
+    std::vector<FieldLayout>    fields;
+    uint64                      hash{};
+};
+
+namespace
+{
+    using TypeLayout = SceneBinary::TypeLayout;
+
+    TypeLayout BuildTypeLayout(const Meta::Type& type)
+    {
+        TypeLayout result;
+        result.type = &type;
+        FlattenProperties(type, 0, {}, result.fields);
+
+        // 레이아웃이 바뀌면 (멤버 추가/이동) 기존 쿠킹 파일은 무효
+        uint64 hash = 14695981039346656037ull;
+        auto mix = [&hash](const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+
+        for (const FieldLayout& field : result.fields)
+        {
+            for (const char* name : field.path)
+            {
+                mix(name, std::strlen(name));
+            }
+            const uint64 offsets[] = { static_cast<uint64>(field.ownerOffset), static_cast<uint64>(field.property->offset) };
+            mix(offsets, sizeof(offsets));
+            mix(&field.size, sizeof(field.size));
+            mix(&field.kind, sizeof(field.kind));
+        }
+        result.hash = hash;
+        return result;
+    }
+
+    // 타입별 레이아웃은 처음 쓸 때 만들고 유지한다 (비동기 로드에서도 불릴 수 있다)
+    const TypeLayout& GetTypeLayout(const Meta::Type& type)
+    {
+        static std::mutex mutex;
+        static std::unordered_map<const Meta::Type*, std::unique_ptr<TypeLayout>> layouts;
+
+        std::scoped_lock lock(mutex);
+        auto& layout = layouts[&type];
+        if (!layout)
+        {
+            layout = std::make_unique<TypeLayout>(BuildTypeLayout(type));
+        }
+        return *layout;
+    }
+
+    const TypeLayout& GetObjectLayout()
+    {
+        static const TypeLayout& layout = GetTypeLayout(GameObject::Reflect());
+        return layout;
+    }
+
+    // 전용 로더가 없는 엔진 컴포넌트만 필드 레코드로 쿠킹한다
+    const Meta::Type* FindCookableComponentType(const MetaYml::Node& componentNode)
+    {
+        if (componentNode["ModuleBehavior"])
+            return nullptr;
+
+        const Meta::Type* type = Meta::ExtractTypeFromYAML(componentNode);
+        if (!type || ComponentFactorys->HasCustomLoader(type->typeID))
+            return nullptr;
+        return type;
+    }
+
+    // path 의 마지막 프로퍼티를 담고 있는 노드를 찾는다
+    bool FindOwnerNode(const MetaYml::Node& root, const std::vector<const char*>& path, MetaYml::Node& owner)
+    {
+        owner.reset(root);
+        for (size_t i = 0; i + 1 < path.size(); ++i)
+        {
+            const MetaYml::Node& current = owner;
+            MetaYml::Node next = current[path[i]];
+            if (!next)
+                return false;
+            owner.reset(next);
+        }
+
+        const MetaYml::Node& current = owner;
+        return static_cast<bool>(current[path.back()]);
+    }
+}
+
+file::path SceneBinary::GetCookedPath(const file::path& scenePath)
+{
+    file::path cookedPath = scenePath;
+    cookedPath.replace_extension(".scenebin");
+    return cookedPath;
+}
+
+bool SceneBinary::Cook(const MetaYml::Node& sceneNode, const file::path& scenePath)
+{
+    if (!sceneNode || !sceneNode.IsMap())
+        return false;
+
+    const TypeLayout& layout = GetObjectLayout();
+
+    std::vector<std::string>                    strings;
+    std::unordered_map<std::string, uint32>     stringLookup;
+    auto addString = [&](std::string value) -> uint32
+    {
+        auto [it, inserted] = stringLookup.try_emplace(value, static_cast<uint32>(strings.size()));
+        if (inserted)
+        {
+            strings.push_back(std::move(value));
+        }
+        return it->second;
+    };
+
+    struct PendingComponent
+    {
+        std::string typeName;
+        uint64      layoutHash{};
+        bool        cooked{};
+        uint32      object{};
+        uint32      fieldOffset{};
+        uint32      fieldCount{};
+        uint32      text{ NullString };
+    };
+
+    Header                          header{};
+    std::vector<ObjectRecord>       objects;
+    std::vector<FieldRecord>        fields;
+    std::vector<std::byte>          fieldData;
+    std::vector<PendingComponent>   pendingComponents;
+
+    // 레이아웃 기준으로 노드를 필드 레코드로 옮기고, 남은 프로퍼티는 residual 문자열 인덱스로 돌려준다
+    auto cookFields = [&](const TypeLayout& typeLayout, const MetaYml::Node& node, uint32& fieldOffset, uint32& fieldCount) -> uint32
+    {
+        fieldOffset = static_cast<uint32>(fields.size());
+        MetaYml::Node residual;
+        bool hasResidual = false;
+        for (uint32 i = 0; i < static_cast<uint32>(typeLayout.fields.size()); ++i)
+        {
+            const FieldLayout& field = typeLayout.fields[i];
+            MetaYml::Node owner;
+            if (!FindOwnerNode(node, field.path, owner))
+                continue;
+
+            const MetaYml::Node& constOwner = owner;
+            FieldRecord fieldRecord{ i, 0 };
+            switch (field.kind)
+            {
+            case FieldKind::Raw:
+            {
+                // YAML -> 값 변환은 기존 경로를 그대로 쓰고, setter 대신 값을 받아 둔다
+                std::any value;
+                Meta::Property capture = *field.property;
+                capture.setter = [&value](void*, std::any v) { value = std::move(v); };
+                Meta::YamlNodeToProperty(capture, nullptr, constOwner);
+                if (!value.has_value())
+                    continue;
+
+                const size_t dataOffset = AlignUp(fieldData.size(), alignof(std::max_align_t));
+                fieldData.resize(dataOffset + field.size);
+                field.raw->store(value, fieldData.data() + dataOffset);
+                fieldRecord.value = static_cast<uint32>(dataOffset);
+                break;
+            }
+            case FieldKind::Enum:
+                fieldRecord.value = static_cast<uint32>(constOwner[field.path.back()].as<int>());
+                break;
+            case FieldKind::String:
+                fieldRecord.value = addString(constOwner[field.path.back()].as<std::string>());
+                break;
+            case FieldKind::Residual:
+                residual[field.path.front()] = constOwner[field.path.back()];
+                hasResidual = true;
+                continue;
+            }
+            fields.push_back(fieldRecord);
+        }
+        fieldCount = static_cast<uint32>(fields.size()) - fieldOffset;
+        return hasResidual ? addString(MetaYml::Dump(residual)) : NullString;
+    };
+
+    try
+    {
+        // 오브젝트 목록을 뺀 나머지는 YAML 그대로 (에셋 번들, DontDestroyOnLoadObjects)
+        MetaYml::Node restNode;
+        for (const auto& kv : sceneNode)
+        {
+            const std::string key = kv.first.as<std::string>();
+            if (key == "m_SceneObjects")
+                continue;
+            restNode[key] = kv.second;
+        }
+        header.sceneNode = addString(MetaYml::Dump(restNode));
+
+        const MetaYml::Node objectsNode = sceneNode["m_SceneObjects"];
+        if (objectsNode)
+        {
+            for (const auto& objNode : objectsNode)
+            {
+                // YAML 경로와 같이 GameObject 만 로드한다
+                const Meta::Type* type = Meta::ExtractTypeFromYAML(objNode);
+                if (!type || type->typeID != type_guid(GameObject))
+                    continue;
+
+                const uint32 objectIndex = static_cast<uint32>(objects.size());
+                ObjectRecord record{};
+                record.instanceID = objNode["m_instanceID"].as<size_t>();
+                record.name = addString(objNode["m_name"].as<std::string>());
+                record.parentIndex = objNode["m_parentIndex"].as<GameObject::Index>();
+
+                record.residual = cookFields(layout, objNode, record.fieldOffset, record.fieldCount);
+
+                record.componentOffset = static_cast<uint32>(pendingComponents.size());
+                const MetaYml::Node componentsNode = objNode["m_components"];
+                if (componentsNode)
+                {
+                    for (const auto& componentNode : componentsNode)
+                    {
+                        PendingComponent pending{};
+                        pending.object = objectIndex;
+                        if (const Meta::Type* cookable = FindCookableComponentType(componentNode))
+                        {
+                            const TypeLayout& componentLayout = GetTypeLayout(*cookable);
+                            pending.typeName = cookable->name;
+                            pending.layoutHash = componentLayout.hash;
+                            pending.cooked = true;
+                            pending.text = cookFields(componentLayout, componentNode, pending.fieldOffset, pending.fieldCount);
+                        }
+                        else
+                        {
+                            const Meta::Type* componentType = Meta::ExtractTypeFromYAML(componentNode);
+                            pending.typeName = componentType ? componentType->name : std::string{};
+                            pending.text = addString(MetaYml::Dump(componentNode));
+                        }
+                        pendingComponents.push_back(std::move(pending));
+                    }
+                }
+                record.componentCount = static_cast<uint32>(pendingComponents.size()) - record.componentOffset;
+
+                objects.push_back(record);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Debug->LogError(std::string("SceneBinary::Cook failed: ") + e.what());
+        return false;
+    }
+
+    // 컴포넌트를 타입별 블록으로 재배치하고, 원래 순서 -> 테이블 인덱스 매핑을 남긴다
+    std::vector<uint32> sorted(pendingComponents.size());
+    std::iota(sorted.begin(), sorted.end(), 0u);
+    auto blockKey = [&pendingComponents](uint32 index)
+    {
+        return std::tie(pendingComponents[index].cooked, pendingComponents[index].typeName);
+    };
+    std::stable_sort(sorted.begin(), sorted.end(), [&](uint32 lhs, uint32 rhs)
+    {
+        return blockKey(lhs) < blockKey(rhs);
+    });
+
+    std::vector<BlockRecord>        blocks;
+    std::vector<ComponentRecord>    components(sorted.size());
+    std::vector<uint32>             componentOrder(sorted.size());
+    for (uint32 slot = 0; slot < static_cast<uint32>(sorted.size()); ++slot)
+    {
+        const PendingComponent& pending = pendingComponents[sorted[slot]];
+        if (blocks.empty() || blockKey(sorted[blocks.back().first]) != blockKey(sorted[slot]))
+        {
+            blocks.push_back({ addString(pending.typeName), slot, 0, pending.cooked ? 1u : 0u, pending.layoutHash });
+        }
+        ++blocks.back().count;
+
+        components[slot] = { pending.object, pending.fieldOffset, pending.fieldCount, pending.text };
+        componentOrder[sorted[slot]] = slot;
+    }
+
+    std::vector<StringRecord>   stringRecords;
+    std::vector<char>           chars;
+    stringRecords.reserve(strings.size());
+    for (const std::string& value : strings)
+    {
+        stringRecords.push_back({ static_cast<uint32>(chars.size()), static_cast<uint32>(value.size()) });
+        chars.insert(chars.end(), value.begin(), value.end());
+    }
+
+    std::vector<std::byte> buffer(sizeof(Header));
+    auto appendSection = [&buffer](const void* data, size_t elementSize, size_t count) -> Section
+    {
+        buffer.resize(AlignUp(buffer.size(), 8));
+        Section section{ static_cast<uint32>(buffer.size()), static_cast<uint32>(count) };
+        const auto* bytes = static_cast<const std::byte*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + elementSize * count);
+        return section;
+    };
+
+    header.magic = Magic;
+    header.version = Version;
+    header.layoutHash = layout.hash;
+    header.strings = appendSection(stringRecords.data(), sizeof(StringRecord), stringRecords.size());
+    header.chars = appendSection(chars.data(), sizeof(char), chars.size());
+    header.objects = appendSection(objects.data(), sizeof(ObjectRecord), objects.size());
+    header.fields = appendSection(fields.data(), sizeof(FieldRecord), fields.size());
+    header.fieldData = appendSection(fieldData.data(), sizeof(std::byte), fieldData.size());
+    header.blocks = appendSection(blocks.data(), sizeof(BlockRecord), blocks.size());
+    header.components = appendSection(components.data(), sizeof(ComponentRecord), components.size());
+    header.componentOrder = appendSection(componentOrder.data(), sizeof(uint32), componentOrder.size());
+
+    std::error_code ec;
+    if (file::exists(scenePath, ec))
+    {
+        header.sourceWriteTime = static_cast<int64>(file::last_write_time(scenePath, ec).time_since_epoch().count());
+        header.sourceSize = static_cast<uint64>(file::file_size(scenePath, ec));
+    }
+    std::memcpy(buffer.data(), &header, sizeof(Header));
+
+    std::ofstream out(GetCookedPath(scenePath), std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        Debug->LogError("SceneBinary::Cook: failed to open " + GetCookedPath(scenePath).string());
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(out);
+}
+
+uint32 SceneBinary::CookAll(const file::path& directory)
+{
+    uint32 cookedCount = 0;
+    std::error_code ec;
+    for (file::recursive_directory_iterator it{ directory, file::directory_options::skip_permission_denied, ec }, end; !ec && it != end; it.increment(ec))
+    {
+        if (!it->is_regular_file(ec) || it->path().extension() != ".creator")
+            continue;
+
+        try
+        {
+            std::ifstream sceneFile(it->path());
+            if (sceneFile && Cook(MetaYml::Load(sceneFile), it->path()))
+            {
+                ++cookedCount;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Debug->LogError("SceneBinary::CookAll: " + it->path().string() + ": " + e.what());
+        }
+    }
+    return cookedCount;
+}
+
+bool SceneBinary::Open(const file::path& scenePath)
+{
+    Close();
+
+    const file::path cookedPath = GetCookedPath(scenePath);
+    std::error_code ec;
+    if (PakFileSystems->Contains(cookedPath))
+    {
+        // 섹션을 바로 캐스팅해 읽으므로 8 바이트 정렬이 안 맞으면 복사해 둔다
+        m_data = PakFileSystems->View(cookedPath);
+        if (m_data.empty() || 0 != reinterpret_cast<uintptr_t>(m_data.data()) % 8)
+        {
+            if (!PakFileSystems->Read(cookedPath, m_pakData))
+                return false;
+            m_data = m_pakData;
+        }
+    }
+    else
+    {
+        if (!file::exists(cookedPath, ec) || !m_file.Open(cookedPath))
+            return false;
+        m_data = { m_file.Data(), m_file.Size() };
+    }
+
+    if (m_data.size() < sizeof(Header))
+    {
+        Close();
+        return false;
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(m_data.data());
+    if (header->magic != Magic || header->version != Version || header->layoutHash != GetObjectLayout().hash)
+    {
+        Close();
+        return false;
+    }
+
+    // 원본 YAML 이 함께 있으면 쿠킹 시점의 원본과 같은지 확인한다 (빌드에는 쿠킹 파일만 있을 수 있음)
+    if (file::exists(scenePath, ec))
+    {
+        const int64 writeTime = static_cast<int64>(file::last_write_time(scenePath, ec).time_since_epoch().count());
+        const uint64 size = static_cast<uint64>(file::file_size(scenePath, ec));
+        if (ec || writeTime != header->sourceWriteTime || size != header->sourceSize)
+        {
+            Close();
+            return false;
+        }
+    }
+
+    m_header = header;
+    if (!ValidateSections() || !ResolveComponentLayouts())
+    {
+        Debug->LogError("SceneBinary: corrupted cooked scene " + cookedPath.string());
+        Close();
+        return false;
+    }
+
+    DecodeNodes();
+    if (!m_sceneNode.IsMap())
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void SceneBinary::Close()
+{
+    m_header = nullptr;
+    m_sceneNode.reset();
+    m_componentNodes.clear();
+    m_componentLayouts.clear();
+    m_residualNodes.clear();
+    m_data = {};
+    m_pakData.clear();
+    m_file.Close();
+}
+
+uint32 SceneBinary::GetObjectCount() const
+{
+    return m_header ? m_header->objects.count : 0;
+}
+
+SceneBinary::ObjectDesc SceneBinary::GetObjectDesc(uint32 objectIndex) const
+{
+    const ObjectRecord& record = GetSection<ObjectRecord>(m_header->objects)[objectIndex];
+    return { static_cast<size_t>(record.instanceID), GetString(record.name), record.parentIndex };
+}
+
+void SceneBinary::ApplyObjectFields(uint32 objectIndex, GameObject* object) const
+{
+    const ObjectRecord& record = GetSection<ObjectRecord>(m_header->objects)[objectIndex];
+    ApplyFields(GetObjectLayout(), record.fieldOffset, record.fieldCount, object);
+
+    const MetaYml::Node& residual = m_residualNodes[objectIndex];
+    if (residual.IsMap())
+    {
+        Meta::Deserialize(object, residual);
+    }
+
+    // Transform 멤버는 setter 없이 기록되므로 월드 행렬을 다시 계산하게 한다
+    object->m_transform.SetDirty();
+}
+
+void SceneBinary::ApplyFields(const TypeLayout& layout, uint32 fieldOffset, uint32 fieldCount, void* instance) const
+{
+    const FieldRecord* fields = GetSection<FieldRecord>(m_header->fields) + fieldOffset;
+    const std::byte* fieldData = GetSection<std::byte>(m_header->fieldData);
+    std::byte* base = static_cast<std::byte*>(instance);
+
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        const FieldRecord& fieldRecord = fields[i];
+        const FieldLayout& field = layout.fields[fieldRecord.layoutIndex];
+        std::byte* owner = base + field.ownerOffset;
+        switch (field.kind)
+        {
+        case FieldKind::Raw:
+            std::memcpy(owner + field.property->offset, fieldData + fieldRecord.value, field.size);
+            break;
+        case FieldKind::Enum:
+            field.property->setter(owner, static_cast<int>(fieldRecord.value));
+            break;
+        case FieldKind::String:
+            SetStringProperty(*field.property, owner, GetString(fieldRecord.value));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+uint32 SceneBinary::GetComponentCount(uint32 objectIndex) const
+{
+    return GetSection<ObjectRecord>(m_header->objects)[objectIndex].componentCount;
+}
+
+uint32 SceneBinary::GetComponentSlot(uint32 objectIndex, uint32 order) const
+{
+    const ObjectRecord& record = GetSection<ObjectRecord>(m_header->objects)[objectIndex];
+    return GetSection<uint32>(m_header->componentOrder)[record.componentOffset + order];
+}
+
+const Meta::Type* SceneBinary::GetComponentType(uint32 objectIndex, uint32 order) const
+{
+    const TypeLayout* layout = m_componentLayouts[GetComponentSlot(objectIndex, order)];
+    return layout ? layout->type : nullptr;
+}
+
+void SceneBinary::ApplyComponentFields(uint32 objectIndex, uint32 order, void* component) const
+{
+    const uint32 slot = GetComponentSlot(objectIndex, order);
+    const TypeLayout* layout = m_componentLayouts[slot];
+    if (!layout)
+        return;
+
+    const ComponentRecord& record = GetSection<ComponentRecord>(m_header->components)[slot];
+    ApplyFields(*layout, record.fieldOffset, record.fieldCount, component);
+
+    const MetaYml::Node& residual = m_componentNodes[slot];
+    if (residual.IsMap())
+    {
+        Meta::Deserialize(component, *layout->type, residual);
+    }
+}
+
+const MetaYml::Node& SceneBinary::GetComponentNode(uint32 objectIndex, uint32 order) const
+{
+    return m_componentNodes[GetComponentSlot(objectIndex, order)];
+}
+
+std::string_view SceneBinary::GetString(uint32 index) const
+{
+    if (index == NullString)
+        return {};
+
+    const StringRecord& record = GetSection<StringRecord>(m_header->strings)[index];
+    return { GetSection<char>(m_header->chars) + record.offset, record.size };
+}
+
+bool SceneBinary::ValidateSections() const
+{
+    const size_t fileSize = m_data.size();
+    auto inRange = [fileSize](const Section& section, size_t elementSize)
+    {
+        return section.offset % 8 == 0 &&
+            static_cast<size_t>(section.offset) + static_cast<size_t>(section.count) * elementSize <= fileSize;
+    };
+
+    if (!inRange(m_header->strings, sizeof(StringRecord)) ||
+        !inRange(m_header->chars, sizeof(char)) ||
+        !inRange(m_header->objects, sizeof(ObjectRecord)) ||
+        !inRange(m_header->fields, sizeof(FieldRecord)) ||
+        !inRange(m_header->fieldData, sizeof(std::byte)) ||
+        !inRange(m_header->blocks, sizeof(BlockRecord)) ||
+        !inRange(m_header->components, sizeof(ComponentRecord)) ||
+        !inRange(m_header->componentOrder, sizeof(uint32)))
+    {
+        return false;
+    }
+
+    const uint32 stringCount = m_header->strings.count;
+    auto validString = [stringCount](uint32 index)
+    {
+        return index == NullString || index < stringCount;
+    };
+
+    const StringRecord* strings = GetSection<StringRecord>(m_header->strings);
+    for (uint32 i = 0; i < stringCount; ++i)
+    {
+        if (static_cast<size_t>(strings[i].offset) + strings[i].size > m_header->chars.count)
+            return false;
+    }
+
+    if (!validString(m_header->sceneNode) || m_header->components.count != m_header->componentOrder.count)
+        return false;
+
+    const uint32 componentCount = m_header->components.count;
+    const ObjectRecord* objects = GetSection<ObjectRecord>(m_header->objects);
+    for (uint32 i = 0; i < m_header->objects.count; ++i)
+    {
+        if (!validString(objects[i].name) || !validString(objects[i].residual) ||
+            static_cast<size_t>(objects[i].componentOffset) + objects[i].componentCount > componentCount ||
+            !ValidateFields(GetObjectLayout(), objects[i].fieldOffset, objects[i].fieldCount))
+        {
+            return false;
+        }
+    }
+
+    const ComponentRecord* components = GetSection<ComponentRecord>(m_header->components);
+    const uint32* componentOrder = GetSection<uint32>(m_header->componentOrder);
+    for (uint32 i = 0; i < componentCount; ++i)
+    {
+        if (components[i].object >= m_header->objects.count || !validString(components[i].text) ||
+            componentOrder[i] >= componentCount)
+        {
+            return false;
+        }
+    }
+
+    const BlockRecord* blocks = GetSection<BlockRecord>(m_header->blocks);
+    for (uint32 b = 0; b < m_header->blocks.count; ++b)
+    {
+        if (!validString(blocks[b].typeName) || static_cast<size_t>(blocks[b].first) + blocks[b].count > componentCount)
+            return false;
+    }
+    return true;
+}
+
+bool SceneBinary::ValidateFields(const TypeLayout& layout, uint32 fieldOffset, uint32 fieldCount) const
+{
+    if (static_cast<size_t>(fieldOffset) + fieldCount > m_header->fields.count)
+        return false;
+
+    const FieldRecord* fields = GetSection<FieldRecord>(m_header->fields) + fieldOffset;
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        if (fields[i].layoutIndex >= layout.fields.size())
+            return false;
+
+        const FieldLayout& field = layout.fields[fields[i].layoutIndex];
+        switch (field.kind)
+        {
+        case FieldKind::Raw:
+            if (static_cast<size_t>(fields[i].value) + field.size > m_header->fieldData.count)
+                return false;
+            break;
+        case FieldKind::String:
+            if (fields[i].value >= m_header->strings.count)
+                return false;
+            break;
+        case FieldKind::Enum:
+            break;
+        default:
+            // residual 필드는 레코드로 기록되지 않는다
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SceneBinary::ResolveComponentLayouts()
+{
+    m_componentLayouts.assign(m_header->components.count, nullptr);
+
+    const BlockRecord* blocks = GetSection<BlockRecord>(m_header->blocks);
+    const ComponentRecord* components = GetSection<ComponentRecord>(m_header->components);
+    for (uint32 b = 0; b < m_header->blocks.count; ++b)
+    {
+        if (!blocks[b].cooked)
+            continue;
+
+        // 쿠킹 이후 타입이 사라졌거나 멤버가 바뀌었으면 쿠킹 파일을 쓰지 않는다
+        const Meta::Type* type = Meta::MetaDataRegistry->Find(std::string(GetString(blocks[b].typeName)));
+        if (!type)
+            return false;
+
+        const TypeLayout& layout = GetTypeLayout(*type);
+        if (layout.hash != blocks[b].layoutHash)
+            return false;
+
+        for (uint32 i = blocks[b].first; i < blocks[b].first + blocks[b].count; ++i)
+        {
+            if (!ValidateFields(layout, components[i].fieldOffset, components[i].fieldCount))
+                return false;
+            m_componentLayouts[i] = &layout;
+        }
+    }
+    return true;
+}
+
+void SceneBinary::ParseNode(uint32 text, MetaYml::Node& out) const
+{
+    if (text == NullString)
+        return;
+
+    try
+    {
+        out.reset(MetaYml::Load(std::string(GetString(text))));
+    }
+    catch (const std::exception& e)
+    {
+        Debug->LogError(std::string("SceneBinary: failed to parse node: ") + e.what());
+    }
+}
+
+void SceneBinary::DecodeNodes()
+{
+    const BlockRecord* blocks = GetSection<BlockRecord>(m_header->blocks);
+    const ComponentRecord* components = GetSection<ComponentRecord>(m_header->components);
+    const ObjectRecord* objects = GetSection<ObjectRecord>(m_header->objects);
+    const uint32 objectCount = m_header->objects.count;
+
+    m_componentNodes.assign(m_header->components.count, MetaYml::Node{});
+    m_residualNodes.assign(objectCount, MetaYml::Node{});
+
+    // 각 작업은 서로 다른 노드 슬롯만 채운다
+    std::vector<std::function<void()>> jobs;
+    jobs.emplace_back([this]() { ParseNode(m_header->sceneNode, m_sceneNode); });
+
+    for (uint32 b = 0; b < m_header->blocks.count; ++b)
+    {
+        const uint32 blockEnd = blocks[b].first + blocks[b].count;
+        for (uint32 first = blocks[b].first; first < blockEnd; first += DecodeChunkSize)
+        {
+            const uint32 last = (std::min)(first + DecodeChunkSize, blockEnd);
+            jobs.emplace_back([this, components, first, last]()
+            {
+                for (uint32 i = first; i < last; ++i)
+                {
+                    ParseNode(components[i].text, m_componentNodes[i]);
+                }
+            });
+        }
+    }
+
+    for (uint32 first = 0; first < objectCount; first += DecodeChunkSize)
+    {
+        const uint32 last = (std::min)(first + DecodeChunkSize, objectCount);
+        jobs.emplace_back([this, objects, first, last]()
+        {
+            for (uint32 i = first; i < last; ++i)
+            {
+                ParseNode(objects[i].residual, m_residualNodes[i]);
+            }
+        });
+    }
+
+    if (jobs.size() == 1)
+    {
+        jobs.front()();
+        return;
+    }
+
+    JobHandle decodeGroup = JobSystems->CreateGroup();
+    for (auto& job : jobs)
+    {
+        JobSystems->Schedule(decodeGroup, std::move(job));
+    }
+    JobSystems->Wait(decodeGroup);
+}
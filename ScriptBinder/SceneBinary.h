@@ -0,0 +1,161 @@
+#pragma once
+#include "Core.Minimal.h"
+#include "Core.MappedFile.h"
+#include "Core.JobSystem.h"
+#include "ReflectionYml.h"
+
+class GameObject;
+
+// 씬 YAML 을 리플렉션 메타데이터 기준으로 쿠킹한 바이너리 씬 (.scenebin).
+// YAML 은 에디터/원본 포맷으로 유지하고, 로드 시 원본보다 최신인 쿠킹 파일이 있으면 이쪽을 사용한다.
+//
+// [Header][StringRecord...][chars][ObjectRecord...][FieldRecord...][field data][BlockRecord...][ComponentRecord...][component order]
+//  - GameObject 의 POD 프로퍼티는 오프셋 기준으로 인스턴스에 바로 기록한다
+//  - 문자열/enum 은 문자열 테이블 인덱스, 정수값으로 보관하고 setter 로 적용한다
+//  - 포인터, 객체 벡터 등은 오브젝트별 residual YAML 로 남긴다
+//  - 컴포넌트는 타입별 블록으로 묶는다. 전용 로더가 없는 타입은 GameObject 와 같은 필드 레코드로,
+//    전용 로더가 있는 타입과 스크립트는 YAML 로 남겨 ComponentFactory 경로를 그대로 탄다
+//
+// 쿠킹은 씬 저장(SaveScene)과 빌드 단계(CookAll)에서만 한다. 로드 경로는 쿠킹 파일을 쓰지 않는다.
+class SceneBinary
+{
+public:
+    static constexpr uint32 Magic = 0x424E4353; // "SCNB"
+    static constexpr uint32 Version = 2;
+    static constexpr uint32 NullString = 0xFFFFFFFF;
+
+    struct ObjectDesc
+    {
+        size_t              instanceID{};
+        std::string_view    name{};
+        int32               parentIndex{ -1 };
+    };
+
+    SceneBinary() = default;
+    ~SceneBinary() = default;
+    SceneBinary(const SceneBinary&) = delete;
+    SceneBinary& operator=(const SceneBinary&) = delete;
+
+    static file::path GetCookedPath(const file::path& scenePath);
+    // 씬 YAML 노드를 쿠킹해 원본 옆에 저장한다
+    static bool Cook(const MetaYml::Node& sceneNode, const file::path& scenePath);
+    // 디렉터리 아래 씬(.creator)을 모두 다시 쿠킹한다 (pak 패키징 전 빌드 단계)
+    static uint32 CookAll(const file::path& directory);
+
+    // 원본보다 최신이고 리플렉션 레이아웃이 같은 쿠킹 파일이 있을 때만 연다.
+    // 컴포넌트 블록/residual 노드는 잡 시스템에서 병렬로 해석한다.
+    bool Open(const file::path& scenePath);
+    void Close();
+    bool IsOpen() const { return m_header != nullptr; }
+
+    // m_SceneObjects 를 제외한 씬 노드 (에셋 번들, DontDestroyOnLoadObjects 등)
+    const MetaYml::Node& GetSceneNode() const { return m_sceneNode; }
+
+    uint32 GetObjectCount() const;
+    ObjectDesc GetObjectDesc(uint32 objectIndex) const;
+    // 필드 레코드와 residual 노드를 GameObject 에 적용한다 (Meta::Deserialize 대체)
+    void ApplyObjectFields(uint32 objectIndex, GameObject* object) const;
+
+    uint32 GetComponentCount(uint32 objectIndex) const;
+    // 필드 레코드로 쿠킹된 컴포넌트면 타입을, YAML 로 남은 컴포넌트면 nullptr 를 돌려준다
+    const Meta::Type* GetComponentType(uint32 objectIndex, uint32 order) const;
+    // 필드 레코드와 residual 노드를 컴포넌트에 적용한다 (GetComponentType 이 nullptr 가 아닐 때)
+    void ApplyComponentFields(uint32 objectIndex, uint32 order, void* component) const;
+    // 원본 YAML 의 컴포넌트 순서대로 해석된 노드를 돌려준다 (YAML 로 남은 컴포넌트)
+    const MetaYml::Node& GetComponentNode(uint32 objectIndex, uint32 order) const;
+
+    struct TypeLayout;
+
+private:
+    struct Section
+    {
+        uint32 offset{};
+        uint32 count{};
+    };
+
+    struct Header
+    {
+        uint32  magic{};
+        uint32  version{};
+        uint64  layoutHash{};
+        int64   sourceWriteTime{};
+        uint64  sourceSize{};
+        Section strings{};
+        Section chars{};
+        Section objects{};
+        Section fields{};
+        Section fieldData{};
+        Section blocks{};
+        Section components{};
+        Section componentOrder{};
+        uint32  sceneNode{ NullString };
+        uint32  reserved{};
+    };
+
+    struct StringRecord
+    {
+        uint32 offset{};
+        uint32 size{};
+    };
+
+    struct ObjectRecord
+    {
+        uint64  instanceID{};
+        uint32  name{ NullString };
+        int32   parentIndex{ -1 };
+        uint32  fieldOffset{};
+        uint32  fieldCount{};
+        uint32  componentOffset{};    // componentOrder 섹션 기준
+        uint32  componentCount{};
+        uint32  residual{ NullString };
+        uint32  reserved{};
+    };
+
+    struct FieldRecord
+    {
+        uint32 layoutIndex{};
+        uint32 value{};     // Raw: field data 오프셋, Enum: 값, String: 문자열 인덱스
+    };
+
+    struct BlockRecord
+    {
+        uint32 typeName{ NullString };
+        uint32 first{};
+        uint32 count{};
+        uint32 cooked{};        // 1 이면 필드 레코드 블록
+        uint64 layoutHash{};    // 필드 레코드 블록의 타입 레이아웃
+    };
+
+    struct ComponentRecord
+    {
+        uint32 object{};
+        uint32 fieldOffset{};
+        uint32 fieldCount{};
+        uint32 text{ NullString };    // 필드 레코드 블록: residual, YAML 블록: 컴포넌트 전체
+    };
+
+    template<typename T>
+    const T* GetSection(const Section& section) const
+    {
+        return reinterpret_cast<const T*>(m_data.data() + section.offset);
+    }
+
+    uint32 GetComponentSlot(uint32 objectIndex, uint32 order) const;
+    std::string_view GetString(uint32 index) const;
+    bool ValidateSections() const;
+    bool ValidateFields(const TypeLayout& layout, uint32 fieldOffset, uint32 fieldCount) const;
+    bool ResolveComponentLayouts();
+    void ApplyFields(const TypeLayout& layout, uint32 fieldOffset, uint32 fieldCount, void* instance) const;
+    void ParseNode(uint32 text, MetaYml::Node& out) const;
+    void DecodeNodes();
+
+private:
+    MappedFile                  m_file;
+    std::vector<std::byte>      m_pakData;          // pak 에서 풀었거나 정렬이 안 맞아 복사한 경우
+    std::span<const std::byte>  m_data;
+    const Header*               m_header{ nullptr };
+    MetaYml::Node               m_sceneNode{};
+    std::vector<MetaYml::Node>  m_componentNodes;   // ComponentRecord 인덱스 기준
+    std::vector<const TypeLayout*> m_componentLayouts; // ComponentRecord 인덱스 기준, YAML 컴포넌트는 nullptr
+    std::vector<MetaYml::Node>  m_residualNodes;    // 오브젝트 인덱스 기준
+};
@@ -9,12 +9,15 @@
 #include "Profiler.h"
 #include "InputActionManager.h"
 #include "NodeFactory.h"
+#include "AIManager.h"
 #include "TagManager.h"
 #include "ReflectionRegister.h"
 #include <algorithm>
 #include "IRegistableEvent.h"
 #include "TimeSystem.h"
 #include "PrefabEditor.h"
+#include "SceneBinary.h"
+#include "Core.PakFileSystem.h"
 
 void SceneManager::SetGameStart(bool isStart)
 {
@@ -51,10 +54,10 @@ void SceneManager::ManagerInitialize()
 {
     REFLECTION_REGISTER_EXECUTE();
         ComponentFactorys->Initialize();
-	m_threadPool = new ThreadPool;
     m_inputActionManager = new InputActionManager();
     InputActionManagers = m_inputActionManager;
     InputActionManagers->LoadManager();
+    AIManagers->SetTickBudget(EngineSettingInstance->GetAITickBudget());
 }
 
 void SceneManager::Editor()
@@ -133,7 +136,19 @@ void SceneManager::Initialization()
 void SceneManager::Physics(float deltaSecond)
 {
     PROFILE_CPU_BEGIN("FixedUpdate");
-    m_activeScene.load()->FixedUpdate(deltaSecond);
+    // 프레임이 튀어도 스텝 크기는 그대로 두고, 따라잡지 못한 시간은 버린다
+    m_fixedAccumulator = (std::min)(m_fixedAccumulator + deltaSecond, m_fixedTimeStep * m_maxSubSteps);
+
+    Scene* scene = m_activeScene.load();
+    while (m_fixedAccumulator >= m_fixedTimeStep)
+    {
+        scene->FixedUpdate(m_fixedTimeStep);
+        m_fixedAccumulator -= m_fixedTimeStep;
+    }
+
+    const float alpha = m_fixedAccumulator / m_fixedTimeStep;
+    Time->SetFixedInterpolatedSeconds(alpha);
+    PhysicsManagers->InterpolatePoses(alpha);
     PROFILE_CPU_END();
 }
 
@@ -144,6 +159,16 @@ void SceneManager::InputEvents(float deltaSecond)
     PROFILE_CPU_END();
 }
 
+void SceneManager::WaitAIUpdate()
+{
+    PROFILE_CPU_BEGIN("WaitAIUpdate");
+    if (Scene* scene = m_activeScene.load())
+    {
+        scene->WaitAIUpdate();
+    }
+    PROFILE_CPU_END();
+}
+
 void SceneManager::GameLogic(float deltaSecond)
 {
     PROFILE_CPU_BEGIN("Update");
@@ -198,6 +223,8 @@ void SceneManager::DisableOrEnable()
 {
     m_activeScene.load()->OnDisable();
     m_activeScene.load()->OnDestroy();
+    // 다음 프레임 시작의 WaitAIUpdate 가 유일한 합류 지점이다
+    m_activeScene.load()->ScheduleAIUpdate();
 }
 
 void SceneManager::Decommissioning()
@@ -218,7 +245,6 @@ void SceneManager::Decommissioning()
     m_dontDestroyOnLoadObjects.clear();
 
     Memory::SafeDelete(m_inputActionManager);
-    Memory::SafeDelete(m_threadPool);
 
 	PlayModeEvent.Clear();
 	InputEvent.Clear();
@@ -327,6 +353,7 @@ Scene* SceneManager::SaveScene(std::string_view name)
 	sceneFileOut << sceneNode;
 
     sceneFileOut.close();
+    SceneBinary::Cook(sceneNode, saveSceneFileName);
 }
 
 Scene* SceneManager::LoadSceneImmediate(std::string_view name)
@@ -335,7 +362,8 @@ Scene* SceneManager::LoadSceneImmediate(std::string_view name)
 
 	try
 	{
-        MetaYml::Node sceneNode = MetaYml::LoadFile(loadSceneName);
+        SceneBinary cooked;
+        MetaYml::Node sceneNode = LoadSceneSource(loadSceneName, cooked);
         Scene* swapScene{};
         if (m_activeScene)
         {
@@ -406,6 +434,12 @@ Scene* SceneManager::LoadSceneImmediate(std::string_view name)
         DataSystems->RetainAssets(m_dontDestroyOnLoadAssetsBundle);
         DataSystems->RetainAssets(m_activeScene.load()->m_requiredLoadAssetsBundle);
 
+        // 쿠킹된 씬은 오브젝트를 바이너리에서 만들고, 씬 노드에는 m_SceneObjects 가 없다
+        if (cooked.IsOpen())
+        {
+            DesirealizeCookedScene(m_activeScene.load(), cooked, false);
+        }
+
         for (const auto& objNode : sceneNode["m_SceneObjects"])
         {
             try
@@ -473,7 +507,8 @@ Scene* SceneManager::LoadScene(std::string_view name)
 
     try
     {
-        MetaYml::Node sceneNode = MetaYml::LoadFile(loadSceneName);
+        SceneBinary cooked;
+        MetaYml::Node sceneNode = LoadSceneSource(loadSceneName, cooked);
         file::path sceneName = name.data();
         scene = Scene::LoadScene(sceneName.stem().string());
 
@@ -490,6 +525,11 @@ Scene* SceneManager::LoadScene(std::string_view name)
             }
         }
 
+        if (cooked.IsOpen())
+        {
+            DesirealizeCookedScene(scene, cooked, true);
+        }
+
         for (const auto& objNode : sceneNode["m_SceneObjects"])
         {
             const Meta::Type* type = Meta::ExtractTypeFromYAML(objNode);
@@ -537,7 +577,8 @@ std::future<Scene*> SceneManager::LoadSceneAsync(std::string_view name)
         try
         {
             // This code runs in a background thread.
-            MetaYml::Node sceneNode = MetaYml::LoadFile(scenePath);
+            SceneBinary cooked;
+            MetaYml::Node sceneNode = LoadSceneSource(scenePath, cooked);
             Scene* newScene = Scene::LoadScene(std::filesystem::path(scenePath).stem().string());
 
             if (auto assetsBundleNode = sceneNode["m_requiredLoadAssetsBundle"])
@@ -571,6 +612,11 @@ std::future<Scene*> SceneManager::LoadSceneAsync(std::string_view name)
                 }
             }
 
+            if (cooked.IsOpen())
+            {
+                DesirealizeCookedScene(newScene, cooked, true);
+            }
+
             for (const auto& objNode : sceneNode["m_SceneObjects"])
             {
                 try
@@ -630,7 +676,8 @@ void SceneManager::LoadSceneAsyncAndWaitCallback(std::string_view name)
         try
         {
             // This code runs in a background thread.
-            MetaYml::Node sceneNode = MetaYml::LoadFile(scenePath);
+            SceneBinary cooked;
+            MetaYml::Node sceneNode = LoadSceneSource(scenePath, cooked);
             Scene* newScene = Scene::LoadScene(std::filesystem::path(scenePath).stem().string());
 
             if (auto assetsBundleNode = sceneNode["m_requiredLoadAssetsBundle"])
@@ -658,6 +705,11 @@ void SceneManager::LoadSceneAsyncAndWaitCallback(std::string_view name)
                 }
             }
 
+            if (cooked.IsOpen())
+            {
+                DesirealizeCookedScene(newScene, cooked, true);
+            }
+
             for (const auto& objNode : sceneNode["m_SceneObjects"])
             {
                 const Meta::Type* type = Meta::ExtractTypeFromYAML(objNode);
@@ -739,6 +791,7 @@ void SceneManager::BeforeAwakeSceneLoad()
         resourceTrimEvent.Broadcast();
         m_activeScene = m_sceneToActivate.load();
         m_scenes.push_back(m_sceneToActivate);
+        m_fixedAccumulator = 0.f;
         m_activeSceneIndex = m_scenes.size() - 1;
         // Debug log the time taken to activate the scene
         Debug->Log(std::string("Scene activation took ") + std::to_string(debugTimer.GetElapsedTime()) + " ms.");
@@ -1094,3 +1147,86 @@ void SceneManager::DesirealizeDontDestroyOnLoadObjects(Scene* targetScene, const
         Object::SetDontDestroyOnLoad(obj);
 	}
 }
+
+MetaYml::Node SceneManager::LoadSceneSource(const std::string& scenePath, SceneBinary& cooked)
+{
+    if (cooked.Open(scenePath))
+    {
+        return cooked.GetSceneNode();
+    }
+
+    AssetStream sceneFile(scenePath);
+    if (!sceneFile.is_open())
+    {
+        throw std::runtime_error("Failed to open scene: " + scenePath);
+    }
+
+    return MetaYml::Load(sceneFile);
+}
+
+void SceneManager::DesirealizeCookedScene(Scene* targetScene, const SceneBinary& cooked, bool isLoadSceneReturn)
+{
+    for (uint32 i = 0; i < cooked.GetObjectCount(); ++i)
+    {
+        try
+        {
+            const SceneBinary::ObjectDesc desc = cooked.GetObjectDesc(i);
+            auto obj = targetScene->LoadGameObject(
+                desc.instanceID,
+                desc.name,
+                GameObjectType::Empty,
+                desc.parentIndex
+            ).get();
+
+            if (!obj)
+                continue;
+
+            cooked.ApplyObjectFields(i, obj);
+            if (!obj->m_tag.ToString().empty())
+            {
+                TagManager::GetInstance()->AddTagToObject(obj->m_tag.ToString(), obj);
+            }
+
+            if (!obj->m_layer.ToString().empty())
+            {
+                TagManager::GetInstance()->AddObjectToLayer(obj->m_layer.ToString(), obj);
+            }
+
+            for (uint32 order = 0; order < cooked.GetComponentCount(i); ++order)
+            {
+                const Meta::Type* componentType = cooked.GetComponentType(i, order);
+                const MetaYml::Node& componentNode = cooked.GetComponentNode(i, order);
+                if (!componentType && !componentNode.IsMap())
+                    continue;
+
+                try
+                {
+                    m_loadSceneReturn = isLoadSceneReturn;
+                    if (componentType)
+                    {
+                        ComponentFactorys->LoadComponent(obj, *componentType, [&](void* component)
+                        {
+                            cooked.ApplyComponentFields(i, order, component);
+                        }, m_isGameStart);
+                    }
+                    else
+                    {
+                        ComponentFactorys->LoadComponent(obj, MetaYml::detail::iterator_value(componentNode), m_isGameStart);
+                    }
+                    m_loadSceneReturn = false;
+                }
+                catch (const std::exception& e)
+                {
+                    m_loadSceneReturn = false;
+                    Debug->LogError(e.what());
+                    continue;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Debug->LogError(std::string("Failed to deserialize GameObject: ") + e.what());
+            continue;
+        }
+    }
+}
@@ -3,9 +3,9 @@
 #include "AssetBundle.h"
 #include "ReflectionYml.h"
 #include "DLLAcrossSingleton.h"
-#include "Core.ThreadPool.h"
 
 class Scene;
+class SceneBinary;
 class MeshRenderer;
 class RenderScene;
 class InputActionManager;
@@ -20,8 +20,15 @@ public:
 	void ManagerInitialize();
     void Editor();
     void Initialization();
+    // 프레임 시간을 누적해 고정 스텝마다 FixedUpdate 를 돌린다 (한 프레임 최대 maxSubSteps 번, 넘치는 시간은 버림)
     void Physics(float deltaSecond);
+    void SetFixedTimeStep(float fixedTimeStep) { m_fixedTimeStep = fixedTimeStep; }
+    float GetFixedTimeStep() const { return m_fixedTimeStep; }
+    void SetMaxSubSteps(uint32 maxSubSteps) { m_maxSubSteps = maxSubSteps; }
+    uint32 GetMaxSubSteps() const { return m_maxSubSteps; }
     void InputEvents(float deltaSecond);
+    // 지난 프레임 끝에 띄운 AI 업데이트를 기다린다. 게임 루프가 프레임 시작(Initialization 전)에 부른다
+    void WaitAIUpdate();
     void GameLogic(float deltaSecond = 0);
     void SceneRendering(float deltaSecond);
 	void OnDrawGizmos();
@@ -104,7 +111,6 @@ public:
 	std::atomic_bool                    m_isInitialized{ false };
 	size_t 					            m_EditorSceneIndex{ 0 };
     std::atomic_bool                    m_loadSceneReturn{ false };
-    ThreadPool<std::function<void()>>*  m_threadPool{ nullptr };
 
     std::future<Scene*>                 m_loadingSceneFuture;
     InputActionManager*                 m_inputActionManager{ nullptr };  //TODO: 삭제처리 없음 필요시 추가해야함 //sehwan&&&&&
@@ -114,6 +120,9 @@ private:
     void DesirealizeGameObject(const Meta::Type* type, const MetaYml::detail::iterator_value& itNode);
     void DesirealizeGameObject(Scene* targetScene, const Meta::Type* type, const MetaYml::detail::iterator_value& itNode);
 	void DesirealizeDontDestroyOnLoadObjects(Scene* targetScene, const Meta::Type* type, const MetaYml::detail::iterator_value& itNode);
+    // 쿠킹된 씬(.scenebin)이 최신이면 매핑해서 쓰고, 아니면 YAML 을 읽는다 (쿠킹은 SaveScene / 빌드 단계에서만)
+    MetaYml::Node LoadSceneSource(const std::string& scenePath, SceneBinary& cooked);
+    void DesirealizeCookedScene(Scene* targetScene, const SceneBinary& cooked, bool isLoadSceneReturn);
 private:
     std::atomic<Scene*>                 m_sceneToActivate{};
     std::vector<Scene*>                 m_scenes{};
@@ -126,6 +135,9 @@ private:
 	std::atomic_bool                    m_volumeProfileApply{ false };
     std::atomic_bool                    m_exitCommand{ false };
     std::atomic_bool                    m_isOldSceneDelete = true;
+    float                               m_fixedTimeStep{ 1.f / 60.f };
+    uint32                              m_maxSubSteps{ 4 };
+    float                               m_fixedAccumulator{};
 };
 
 static auto SceneManagers = SceneManager::GetInstance();
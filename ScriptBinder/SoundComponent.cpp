@@ -38,10 +38,10 @@ void SoundComponent::Update(float tick)
 
         position = transform->GetWorldPosition();
 
-        if (channel3D) {
+        if (spatial && m_voice.IsValid()) {
             _pos = ToFVec(position);
             _velocity = ToFVec(velocity);
-            channel3D->set3DAttributes(&_pos, &_velocity);
+            Sound->setVoice3DAttributes(m_voice, _pos, _velocity);
         }
     }
 }
@@ -67,8 +67,7 @@ void SoundComponent::LateUpdate(float tick)
             w3D = sinf(spatialBlend * (3.14159265f * 0.5f));
 
             float att = SampleLocalRolloff(d);
-            if (channel2D) channel2D->setVolume(volume * w2D);
-            if (channel3D) channel3D->setVolume(volume * w3D * att);
+            Sound->setVoiceGains(m_voice, volume * w2D, volume * w3D * att);
         }
     }
 }
@@ -85,60 +84,59 @@ void SoundComponent::Play()
     //    / ä ( )
     Sound->stopByOwnerTag(this, bus);
 
-    // SpatialBlend(0~1)  2D/3D ä , ownerTag=this
-    auto pair = Sound->playFromSourceBlended(*this, this);
-    channel2D = pair.ch2D;
-    channel3D = pair.ch3D;
-
-    // /ġ/켱 (̹ ο  )
-    if (channel2D) { channel2D->setVolume(volume); channel2D->setPitch(pitch); channel2D->setPriority(priority); }
-    if (channel3D) { channel3D->setVolume(volume); channel3D->setPitch(pitch); channel3D->setPriority(priority); }
-
-    //  ̵ : FMOD ⺻ 踦 ȭ(ǻ źȭ)
-    if (rolloff == Rolloff::Custom && channel3D) {
-        channel3D->set3DMinMaxDistance(0.01f, 1e6f); // ſ ū max ⺻ 踦  1
-    }
+    // SpatialBlend(0~1)  2D/3D ä ̽ , ownerTag=this
+    // (Custom rolloff   źȭ SoundManager  ̽ ִ´)
+    m_voice = Sound->playFromSourceBlended(*this, this);
 }
 
 void SoundComponent::Stop()
 {
     //    ä( ҹ) 
     Sound->stopByOwnerTag(this);
-    channel2D = nullptr;
-    channel3D = nullptr;
+    m_voice = {};
 }
 
 void SoundComponent::Pause(bool pause)
 {
-    if (channel2D) channel2D->setPaused(pause);
-    if (channel3D) channel3D->setPaused(pause);
+    Sound->setVoicePaused(m_voice, pause);
 }
 
 bool SoundComponent::IsPlaying()
 {
-    bool playing = false;
-    if (channel2D) { if (channel2D->isPlaying(&playing) == FMOD_OK && playing) return true; }
-    if (channel3D) { if (channel3D->isPlaying(&playing) == FMOD_OK && playing) return true; }
-    return false;
+    //  ̽   
+    return Sound->isVoicePlaying(m_voice);
 }
 
 void SoundComponent::PlayOneShot()
 {
     if (clipKey.empty()) return;
+    if (m_clipId == InvalidAudioClip || m_resolvedClipKey != clipKey) {
+        m_clipId = Sound->resolveClip(clipKey);
+        m_resolvedClipKey = clipKey;
+    }
+    if (m_clipId == InvalidAudioClip) { Debug->LogError("Sound not found: " + clipKey); return; }
+
     auto pos = ToFVec(position);
     auto vel = ToFVec(velocity);
 
-    // Ǯ  ٷ  (ʿ SoundManager::playOneShotPooled )
-    auto pair = Sound->playOneShotPooled(
-        clipKey, bus, volume, pitch, priority,
+    // (Ŭ, ) κ Ǯ 
+    m_voice = Sound->playOneShotPooled(
+        m_clipId, bus, volume, pitch, priority,
         spatial ? spatialBlend : 0.0f,
         spatial ? &pos : nullptr,
         spatial ? &vel : nullptr,
         this
     );
-    //  ä   ص , ʿϸ  :
-    channel2D = pair.ch2D;
-    channel3D = pair.ch3D;
+}
+
+FMOD::Channel* SoundComponent::Get2DChannel() const
+{
+    return Sound->getVoiceChannel(m_voice, false);
+}
+
+FMOD::Channel* SoundComponent::Get3DChannel() const
+{
+    return Sound->getVoiceChannel(m_voice, true);
 }
 
 void SoundComponent::EditorSet()
@@ -150,10 +148,10 @@ void SoundComponent::EditorSet()
 
         position = transform->GetWorldPosition();
 
-        if (channel3D) {
+        if (spatial && m_voice.IsValid()) {
             _pos = ToFVec(position);
             _velocity = ToFVec(velocity);
-            channel3D->set3DAttributes(&_pos, &_velocity);
+            Sound->setVoice3DAttributes(m_voice, _pos, _velocity);
         }
     }
 }
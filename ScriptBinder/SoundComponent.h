@@ -2,6 +2,7 @@
 #include "Core.Minimal.h"
 #include "Component.h"
 #include "SoundDefinition.h"
+#include "VirtualVoiceSystem.h"
 #include "IRegistableEvent.h"
 #include "SoundComponent.generated.h"
 
@@ -35,8 +36,9 @@ public:
 
 	void EditorSet();
 
-	FMOD::Channel* Get2DChannel() const { return channel2D; }
-	FMOD::Channel* Get3DChannel() const { return channel3D; }
+	//  ̽ nullptr
+	FMOD::Channel* Get2DChannel() const;
+	FMOD::Channel* Get3DChannel() const;
 
 public:
 	[[Property]]
@@ -80,8 +82,10 @@ private:
 	FMOD_VECTOR _pos{};
 	FMOD_VECTOR _velocity{};
 
-	FMOD::Channel* channel2D = nullptr;
-	FMOD::Channel* channel3D = nullptr;
+	VoiceHandle m_voice{};
+	// clipKey  ٲ  ٽ Ǭ
+	std::string m_resolvedClipKey;
+	AudioClipId m_clipId = InvalidAudioClip;
 
 public:
 	[[Property]]
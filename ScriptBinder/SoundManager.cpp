@@ -2,11 +2,94 @@
 #include "PathFinder.h"
 #include "SoundComponent.h"
 #include "Core.Minimal.h"
+#include "Core.PakFileSystem.h"
 
 namespace fs = std::filesystem;
 
+namespace
+{
+    FMOD_VECTOR ToFmod(const AudioVector& v) { return { v.x, v.y, v.z }; }
+    AudioVector ToAudio(const FMOD_VECTOR& v) { return { v.x, v.y, v.z }; }
+    FMOD::Channel* ToChannel(AudioChannelId id) { return reinterpret_cast<FMOD::Channel*>(id); }
+
+    VoiceRank ToVoiceRank(StealPolicy policy)
+    {
+        switch (policy) {
+        case StealPolicy::Oldest:         return VoiceRank::Age;
+        case StealPolicy::LowestPriority: return VoiceRank::Priority;
+        case StealPolicy::Quietest:
+        default:                          return VoiceRank::Audibility;
+        }
+    }
+}
+
+// ===== FMOD 鿣 =====
+// ä id  FMOD::Channel  ״ (FMOD ä ڵ   ȣص ϴ)
+class FmodAudioBackend final : public IAudioBackend
+{
+public:
+    explicit FmodAudioBackend(SoundManager& owner) : m_owner(owner) {}
+
+    AudioChannelId Start(const AudioStartParams& params) override
+    {
+        FMOD::Sound* sound = m_owner.getClipSound(params.clip);
+        if (!sound || !m_owner.system || params.bus >= m_owner.groups.size()) return 0;
+        FMOD::ChannelGroup* group = m_owner.groups[params.bus];
+        if (!group) return 0;
+
+        FMOD::Channel* c = nullptr;
+        if (m_owner.system->playSound(sound, group, true, &c) != FMOD_OK || !c) return 0;
+
+        c->setMode(FMOD_DEFAULT | (params.is3D ? FMOD_3D : FMOD_2D) | (params.loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
+        if (params.is3D) {
+            FMOD_VECTOR pos = ToFmod(params.position);
+            FMOD_VECTOR vel = ToFmod(params.velocity);
+            c->set3DAttributes(&pos, &vel);
+            c->set3DMinMaxDistance(params.minDistance, params.maxDistance);
+        }
+        c->setPriority(params.priority);
+        c->setPitch(params.pitch);
+        c->setVolume(params.volume);
+        if (params.userData) c->setUserData(params.userData);
+        //  ¿  帥 ŭ ǳʶڴ
+        if (params.startMs > 0) c->setPosition(params.startMs, FMOD_TIMEUNIT_MS);
+        c->setPaused(false);
+        return reinterpret_cast<AudioChannelId>(c);
+    }
+
+    void Stop(AudioChannelId channel) override { ToChannel(channel)->stop(); }
+
+    bool IsPlaying(AudioChannelId channel) const override
+    {
+        bool playing = false;
+        return ToChannel(channel)->isPlaying(&playing) == FMOD_OK && playing;
+    }
+
+    void SetVolume(AudioChannelId channel, float volume) override { ToChannel(channel)->setVolume(volume); }
+    void SetPaused(AudioChannelId channel, bool paused) override { ToChannel(channel)->setPaused(paused); }
+
+    void Set3DAttributes(AudioChannelId channel, const AudioVector& position, const AudioVector& velocity) override
+    {
+        FMOD_VECTOR pos = ToFmod(position);
+        FMOD_VECTOR vel = ToFmod(velocity);
+        ToChannel(channel)->set3DAttributes(&pos, &vel);
+    }
+
+    uint32_t GetClipLengthMs(AudioClipId clip) const override
+    {
+        return clip < SoundManager::MaxClips ? m_owner.clipLengthMs[clip].load(std::memory_order_acquire) : 0;
+    }
+
+private:
+    SoundManager& m_owner;
+};
+
 // ===== ctor/dtor =====
-SoundManager::SoundManager() {}
+SoundManager::SoundManager()
+    : clipSounds(std::make_unique<std::atomic<FMOD::Sound*>[]>(MaxClips))
+    , clipLengthMs(std::make_unique<std::atomic<uint32_t>[]>(MaxClips))
+{
+}
 SoundManager::~SoundManager() {
     while (_isSoundLoaderThreadRunning) std::this_thread::sleep_for(std::chrono::milliseconds(10));
     shutdown();
@@ -24,15 +107,29 @@ bool SoundManager::initialize(int maxChannels)
 
 void SoundManager::update()
 {
+    const auto now = std::chrono::steady_clock::now();
+    const float deltaSeconds = _lastUpdateTime.time_since_epoch().count() == 0
+        ? 0.0f : std::chrono::duration<float>(now - _lastUpdateTime).count();
+    _lastUpdateTime = now;
+
+    if (voices) voices->Update(deltaSeconds);
     if (system) system->update();
 }
 
 void SoundManager::shutdown()
 {
+    // ̽ ä  ؾ FMOD    ִ
+    voices.reset();
+    backend.reset();
+
     {
         std::unique_lock wlock(_soundsMutex);
-        for (auto& [k, s] : sounds) if (s) s->release();
-        sounds.clear();
+        for (size_t i = 0; i < clipNames.size(); ++i) {
+            if (FMOD::Sound* s = clipSounds[i].exchange(nullptr)) s->release();
+            clipLengthMs[i].store(0);
+        }
+        clipIds.clear();
+        clipNames.clear();
     }
 
     for (auto* g : groups) if (g) g->release();
@@ -82,6 +179,9 @@ void SoundManager::Initialize()
         }
     }
 
+    backend = std::make_unique<FmodAudioBackend>(*this);
+    voices = std::make_unique<VirtualVoiceSystem>(*backend);
+
     // ⺻ 
     setMasterVolume(1.0f);
     setBusVolumeDb(ChannelType::BGM, -5.0f);
@@ -92,6 +192,7 @@ void SoundManager::Initialize()
 
     // ⺻ å
     groupCfg[(int)ChannelType::SFX] = { 12, StealPolicy::Quietest, true };
+    for (int b = 0; b < (int)ChannelType::MaxChannel; ++b) applyGroupConfig((ChannelType)b);
 
     _isInitialized = true;
 }
@@ -102,13 +203,11 @@ void SoundManager::SoundLoaderThread()
         uint32_t cnt = 0;
         try {
             fs::path root = PathFinder::Relative("Sounds\\");
-            for (auto& e : fs::recursive_directory_iterator(root)) {
-                if (!e.is_directory()) {
-                    auto ext = e.path().extension().string();
-                    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-                    if (ext == ".mp3" || ext == ".wav" || ext == ".ogg") cnt++;
-                }
-            }
+            PakFileSystems->ForEachFile(root, true, [&](const fs::path& path) {
+                auto ext = path.extension().string();
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+                if (ext == ".mp3" || ext == ".wav" || ext == ".ogg") cnt++;
+            });
         }
         catch (...) {}
 
@@ -125,17 +224,16 @@ void SoundManager::LoadSounds()
     _isSoundLoaderThreadRunning = true;
     try {
         fs::path root = PathFinder::Relative("Sounds\\");
-        for (auto& e : fs::recursive_directory_iterator(root)) {
-            if (e.is_directory()) continue;
-            auto ext = e.path().extension().string();
+        PakFileSystems->ForEachFile(root, true, [&](const fs::path& path) {
+            auto ext = path.extension().string();
             std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
             if (ext == ".mp3" || ext == ".wav" || ext == ".ogg") {
-                std::string key = e.path().filename().string();
+                std::string key = path.filename().string();
                 key = key.substr(0, key.find_last_of('.'));
-                bool loop = (e.path().parent_path() == PathFinder::Relative("Sounds\\BGM"));
-                loadSound(key, e.path().string(), /*is3D=*/false, loop);
+                bool loop = (path.parent_path() == PathFinder::Relative("Sounds\\BGM"));
+                loadSound(key, path.string(), /*is3D=*/false, loop);
             }
-        }
+        });
     }
     catch (...) {}
     _isSoundLoaderThreadRunning = false;
@@ -148,9 +246,14 @@ void SoundManager::setListenerAttributes(const FMOD_VECTOR& pos,
     const FMOD_VECTOR& up)
 {
     if (system) system->set3DListenerAttributes(0, &pos, &vel, &forward, &up);
+    if (voices) voices->SetListener(ToAudio(pos));
 }
 void SoundManager::setMasterVolume(float v) { if (master) master->setVolume(v); }
-void SoundManager::setBusVolume(ChannelType bus, float lin) { if (groups[(int)bus]) groups[(int)bus]->setVolume(lin); }
+void SoundManager::setBusVolume(ChannelType bus, float lin)
+{
+    if (groups[(int)bus]) groups[(int)bus]->setVolume(lin);
+    if (voices) voices->SetBusGain((uint32_t)bus, lin);
+}
 void SoundManager::setBusVolumeDb(ChannelType bus, float db) { setBusVolume(bus, dbToLinear(db)); }
 void SoundManager::setBusVolumePercent(ChannelType bus, int percent) { setBusVolumeDb(bus, sliderToDb(percent)); }
 
@@ -159,7 +262,8 @@ bool SoundManager::loadSound(const std::string& name, const std::string& filePat
 {
     {
         std::shared_lock rlock(_soundsMutex);
-        if (sounds.count(name)) return true;
+        auto it = clipIds.find(name);
+        if (it != clipIds.end() && clipSounds[it->second].load(std::memory_order_acquire)) return true;
     }
 
     FMOD_MODE mode = FMOD_DEFAULT | (is3D ? FMOD_3D : FMOD_2D);
@@ -169,7 +273,28 @@ bool SoundManager::loadSound(const std::string& name, const std::string& filePat
     if (loop)  mode |= FMOD_LOOP_NORMAL;
 
     FMOD::Sound* s = nullptr;
-    FMOD_RESULT r = system->createSound(filePath.c_str(), mode, nullptr, &s);
+    FMOD_RESULT r = FMOD_OK;
+    if (PakFileSystems->Contains(filePath)) {
+        // pak ׸ ״ ѱ. ε ޸𸮸      Ű, ƴϸ Ǯ FMOD  ϰ Ѵ
+        std::vector<std::byte> bytes;
+        std::span<const std::byte> data = PakFileSystems->View(filePath);
+        if (data.empty()) {
+            PakFileSystems->Read(filePath, bytes);
+            data = bytes;
+            mode |= FMOD_OPENMEMORY;
+        }
+        else {
+            mode |= FMOD_OPENMEMORY_POINT;
+        }
+
+        FMOD_CREATESOUNDEXINFO exinfo{};
+        exinfo.cbsize = sizeof(exinfo);
+        exinfo.length = static_cast<unsigned int>(data.size());
+        r = system->createSound(reinterpret_cast<const char*>(data.data()), mode, &exinfo, &s);
+    }
+    else {
+        r = system->createSound(filePath.c_str(), mode, nullptr, &s);
+    }
     if (r != FMOD_OK) {
         Debug->LogError("Failed to load sound: " + filePath + " - " + std::string(FMOD_ErrorString(r)));
         return false;
@@ -179,9 +304,28 @@ bool SoundManager::loadSound(const std::string& name, const std::string& filePat
         if (s->getDefaults(&freq, &pr) == FMOD_OK) s->setDefaults(freq, 0);
     }
 
+    unsigned int lengthMs = 0;
+    s->getLength(&lengthMs, FMOD_TIMEUNIT_MS);
+
     {
         std::unique_lock wlock(_soundsMutex);
-        sounds[name] = s;
+        AudioClipId id = InvalidAudioClip;
+        if (auto it = clipIds.find(name); it != clipIds.end()) {
+            id = it->second;
+        }
+        else if (clipNames.size() < MaxClips) {
+            id = (AudioClipId)clipNames.size();
+            clipNames.push_back(name);
+            clipIds.emplace(name, id);
+        }
+        else {
+            Debug->LogError("Sound clip table is full: " + name);
+            s->release();
+            return false;
+        }
+
+        clipLengthMs[id].store(lengthMs, std::memory_order_relaxed);
+        if (FMOD::Sound* prev = clipSounds[id].exchange(s, std::memory_order_acq_rel)) prev->release();
     }
     return true;
 }
@@ -189,328 +333,165 @@ bool SoundManager::loadSound(const std::string& name, const std::string& filePat
 void SoundManager::unloadSound(const std::string& name)
 {
     std::unique_lock wlock(_soundsMutex);
-    auto it = sounds.find(name);
-    if (it != sounds.end()) { if (it->second) it->second->release(); sounds.erase(it); }
+    auto it = clipIds.find(name);
+    if (it == clipIds.end()) return;
+    // id   ΰ 常  ( ̸ ٽ εǸ  id)
+    if (FMOD::Sound* s = clipSounds[it->second].exchange(nullptr, std::memory_order_acq_rel)) s->release();
+}
+
+AudioClipId SoundManager::resolveClip(const std::string& name) const
+{
+    std::shared_lock rlock(_soundsMutex);
+    auto it = clipIds.find(name);
+    if (it == clipIds.end() || !clipSounds[it->second].load(std::memory_order_acquire)) return InvalidAudioClip;
+    return it->second;
+}
+
+FMOD::Sound* SoundManager::getClipSound(AudioClipId clip) const
+{
+    return clip < MaxClips ? clipSounds[clip].load(std::memory_order_acquire) : nullptr;
 }
 
 std::vector<std::string> SoundManager::getAllClipKeys() const
 {
     std::shared_lock rlock(_soundsMutex);
-    std::vector<std::string> out; out.reserve(sounds.size());
-    for (auto& kv : sounds) out.push_back(kv.first);
+    std::vector<std::string> out; out.reserve(clipNames.size());
+    for (size_t i = 0; i < clipNames.size(); ++i)
+        if (clipSounds[i].load(std::memory_order_acquire)) out.push_back(clipNames[i]);
     std::sort(out.begin(), out.end());
     return out;
 }
 
 // ===== å =====
-void SoundManager::setGroupMaxVoices(ChannelType bus, int maxVoices) { groupCfg[(int)bus].maxVoices = std::max(0, maxVoices); }
-void SoundManager::setGroupStealPolicy(ChannelType bus, StealPolicy p) { groupCfg[(int)bus].policy = p; }
-void SoundManager::setGroupPreemptSameClip(ChannelType bus, bool on) { groupCfg[(int)bus].preemptSameClip = on; }
+void SoundManager::setGroupMaxVoices(ChannelType bus, int maxVoices) { groupCfg[(int)bus].maxVoices = std::max(0, maxVoices); applyGroupConfig(bus); }
+void SoundManager::setGroupStealPolicy(ChannelType bus, StealPolicy p) { groupCfg[(int)bus].policy = p; applyGroupConfig(bus); }
+void SoundManager::setGroupPreemptSameClip(ChannelType bus, bool on) { groupCfg[(int)bus].preemptSameClip = on; applyGroupConfig(bus); }
 
-// ===== SpatialBlend =====
-void SoundManager::computeEqualPowerGains(float t, float& w2D, float& w3D)
+// maxVoices   ä  ƴ϶   ä  ̽  (2D+3D  ̽ 1)
+void SoundManager::applyGroupConfig(ChannelType bus)
 {
-    t = std::clamp(t, 0.0f, 1.0f);
-    w2D = cosf(t * (3.14159265f * 0.5f));
-    w3D = sinf(t * (3.14159265f * 0.5f));
+    if (!voices) return;
+    const auto& cfg = groupCfg[(int)bus];
+    voices->SetBusLimit((uint32_t)bus, (uint32_t)cfg.maxVoices);
+    voices->SetBusRank((uint32_t)bus, ToVoiceRank(cfg.policy));
+    voices->SetBusPreemptSameClip((uint32_t)bus, cfg.preemptSameClip);
 }
 
-ChannelPair
-SoundManager::playBlendedInternal(FMOD::Sound* sound, ChannelType bus,
-    float volume, float pitch, int priority,
-    float blend01, bool loop,
-    const FMOD_VECTOR* pos, const FMOD_VECTOR* vel,
-    void* ownerTag)
+// ===== SpatialBlend =====
+VoiceHandle SoundManager::playFromSourceBlended(const SoundComponent& src, void* ownerTag)
 {
-    ChannelPair out{};
-    if (!sound) return out;
-    auto* group = groups[(int)bus];
-    if (!group) return out;
-
-    pruneStopped(bus);
-    const auto& cfg = groupCfg[(int)bus];
-    int playing = countPlaying(bus);
-    const int limit = cfg.maxVoices;
-
-    float w2D = 1.f, w3D = 0.f;
-    computeEqualPowerGains(blend01, w2D, w3D);
-    const bool want2D = (w2D > 1e-3f);
-    const bool want3D = (w3D > 1e-3f);
-    int need = (int)want2D + (int)want3D;
-
-    // ϸ ƿ  ׷ ϸ 1äη degrade (3D 켱)
-    if (limit > 0 && playing + need > limit) {
-        int deficit = (playing + need) - limit;
-        while (deficit-- > 0) {
-            if (FMOD::Channel* v = findStealCandidate(bus, sound)) v->stop();
-            else break;
-        }
-        playing = countPlaying(bus);
-        if (limit > 0 && playing + need > limit) {
-            if (want3D) {
-                FMOD::Channel* c = nullptr;
-                if (system->playSound(sound, group, true, &c) == FMOD_OK && c) {
-                    c->setMode(FMOD_DEFAULT | FMOD_3D | (loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
-                    if (pos) c->set3DAttributes(pos, vel);
-                    c->set3DMinMaxDistance(1.f, 50.f);
-                    c->setPriority(priority);
-                    c->setPitch(pitch);
-                    c->setVolume(volume * w3D);
-                    if (ownerTag) c->setUserData(ownerTag);
-                    c->setPaused(false);
-                    out.ch3D = c;
-                }
-                return out;
-            }
-            else {
-                FMOD::Channel* c = nullptr;
-                if (system->playSound(sound, group, true, &c) == FMOD_OK && c) {
-                    c->setMode(FMOD_DEFAULT | FMOD_2D | (loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
-                    c->setPriority(priority);
-                    c->setPitch(pitch);
-                    c->setVolume(volume * w2D);
-                    if (ownerTag) c->setUserData(ownerTag);
-                    c->setPaused(false);
-                    out.ch2D = c;
-                }
-                return out;
-            }
-        }
-    }
-
-    auto create2D = [&](FMOD::Channel** ch) {
-        FMOD::Channel* c = nullptr;
-        if (system->playSound(sound, group, true, &c) == FMOD_OK && c) {
-            c->setMode(FMOD_DEFAULT | FMOD_2D | (loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
-            c->setPriority(priority);
-            c->setPitch(pitch);
-            c->setVolume(volume * w2D);
-            if (ownerTag) c->setUserData(ownerTag);
-            c->setPaused(false);
-            *ch = c;
-        }
-        };
-    auto create3D = [&](FMOD::Channel** ch) {
-        FMOD::Channel* c = nullptr;
-        if (system->playSound(sound, group, true, &c) == FMOD_OK && c) {
-            c->setMode(FMOD_DEFAULT | FMOD_3D | (loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF));
-            if (pos) c->set3DAttributes(pos, vel);
-            c->set3DMinMaxDistance(1.f, 50.f);
-            c->setPriority(priority);
-            c->setPitch(pitch);
-            c->setVolume(volume * w3D);
-            if (ownerTag) c->setUserData(ownerTag);
-            c->setPaused(false);
-            *ch = c;
-        }
-        };
-
-    if (want2D) create2D(&out.ch2D);
-    if (want3D) create3D(&out.ch3D);
-    return out;
+    const AudioClipId clip = resolveClip(src.clipKey);
+    if (clip == InvalidAudioClip) { Debug->LogError("Sound not found: " + src.clipKey); return {}; }
+
+    VoiceDesc desc{};
+    desc.clip = clip;
+    desc.bus = (uint32_t)src.bus;
+    desc.volume = src.volume;
+    desc.pitch = src.pitch;
+    desc.priority = src.priority;
+    desc.loop = src.loop;
+    desc.is3D = src.spatial;
+    desc.spatialBlend = src.spatial ? std::clamp(src.spatialBlend, 0.f, 1.f) : 0.f;
+    desc.position = { src.position.x, src.position.y, src.position.z };
+    desc.velocity = { src.velocity.x, src.velocity.y, src.velocity.z };
+    desc.ownerTag = ownerTag;
+    //  Rolloff ̵ : FMOD ⺻ 踦 ȭ(ǻ źȭ)
+    if (src.rolloff == Rolloff::Custom) { desc.minDistance = 0.01f; desc.maxDistance = 1e6f; }
+
+    return playVoice(desc);
 }
 
-ChannelPair
-SoundManager::playFromSourceBlended(const SoundComponent& src, void* ownerTag)
+VoiceHandle SoundManager::playVoice(const VoiceDesc& desc)
 {
-    FMOD::Sound* snd = nullptr;
-    {
-        std::shared_lock rlock(_soundsMutex);
-        auto it = sounds.find(src.clipKey);
-        if (it == sounds.end()) { Debug->LogError("Sound not found: " + src.clipKey); return {}; }
-        snd = it->second;
-    }
-
-    FMOD_VECTOR p{ src.position.x, src.position.y, src.position.z };
-    FMOD_VECTOR v{ src.velocity.x, src.velocity.y, src.velocity.z };
-    float blend = src.spatial ? std::clamp(src.spatialBlend, 0.f, 1.f) : 0.f;
-
-    return playBlendedInternal(snd, src.bus,
-        src.volume, src.pitch, src.priority,
-        blend, src.loop,
-        src.spatial ? &p : nullptr,
-        src.spatial ? &v : nullptr,
-        ownerTag);
+    return voices ? voices->Play(desc) : VoiceHandle{};
 }
 
 // ===== Ǯ =====
-std::string SoundManager::poolKey(const std::string& clipKey, ChannelType bus) {
-    return clipKey + "#" + std::to_string((int)bus);
-}
-
 void SoundManager::configureVoicePool(const std::string& clipKey, ChannelType bus, int capacity)
 {
-    auto& pool = voicePools[poolKey(clipKey, bus)];
-    pool.bus = bus;
-    pool.capacity = std::max(1, capacity);
-    pool.cursor = 0;
-    pool.slots.clear();
-    pool.slots.resize(pool.capacity);
+    const AudioClipId clip = resolveClip(clipKey);
+    if (clip == InvalidAudioClip || !voices) return;
+    voices->ConfigurePool(clip, (uint32_t)bus, (uint32_t)std::max(1, capacity));
 }
 
-ChannelPair
+VoiceHandle
 SoundManager::playOneShotPooled(const std::string& clipKey, ChannelType bus,
     float volume, float pitch, int priority,
     float spatialBlend,
     const FMOD_VECTOR* pos, const FMOD_VECTOR* vel,
     void* ownerTag)
 {
-    FMOD::Sound* snd = nullptr;
-    {
-        std::shared_lock rlock(_soundsMutex);
-        auto it = sounds.find(clipKey);
-        if (it == sounds.end()) { Debug->LogError("Sound not found: " + clipKey); return {}; }
-        snd = it->second;
-    }
-
-    auto& pool = voicePools[poolKey(clipKey, bus)];
-    if (pool.slots.empty()) { pool.bus = bus; pool.capacity = 8; pool.cursor = 0; pool.slots.resize(pool.capacity); }
-
-    const int idx = pool.cursor++ % pool.capacity;
-    auto& slot = pool.slots[idx];
-
-    if (slot.ch2D) { bool p = false; if (slot.ch2D->isPlaying(&p) == FMOD_OK && p) slot.ch2D->stop(); slot.ch2D = nullptr; }
-    if (slot.ch3D) { bool p = false; if (slot.ch3D->isPlaying(&p) == FMOD_OK && p) slot.ch3D->stop(); slot.ch3D = nullptr; }
+    const AudioClipId clip = resolveClip(clipKey);
+    if (clip == InvalidAudioClip) { Debug->LogError("Sound not found: " + clipKey); return {}; }
+    return playOneShotPooled(clip, bus, volume, pitch, priority, spatialBlend, pos, vel, ownerTag);
+}
 
-    auto made = playBlendedInternal(snd, bus, volume, pitch, priority,
-        std::clamp(spatialBlend, 0.f, 1.f),
-        /*loop=*/false, pos, vel, ownerTag);
-    slot.ch2D = made.ch2D;
-    slot.ch3D = made.ch3D;
-    return made;
+VoiceHandle
+SoundManager::playOneShotPooled(AudioClipId clip, ChannelType bus,
+    float volume, float pitch, int priority,
+    float spatialBlend,
+    const FMOD_VECTOR* pos, const FMOD_VECTOR* vel,
+    void* ownerTag)
+{
+    if (!voices) return {};
+
+    VoiceDesc desc{};
+    desc.clip = clip;
+    desc.bus = (uint32_t)bus;
+    desc.volume = volume;
+    desc.pitch = pitch;
+    desc.priority = priority;
+    desc.is3D = (pos != nullptr);
+    desc.spatialBlend = std::clamp(spatialBlend, 0.f, 1.f);
+    if (pos) desc.position = ToAudio(*pos);
+    if (vel) desc.velocity = ToAudio(*vel);
+    desc.ownerTag = ownerTag;
+    return voices->PlayPooled(desc);
 }
 
 void SoundManager::clearVoicePool(const std::string& clipKey, ChannelType bus)
 {
-    auto it = voicePools.find(poolKey(clipKey, bus));
-    if (it == voicePools.end()) return;
-    for (auto& s : it->second.slots) {
-        if (s.ch2D) { s.ch2D->stop(); s.ch2D = nullptr; }
-        if (s.ch3D) { s.ch3D->stop(); s.ch3D = nullptr; }
-    }
-    voicePools.erase(it);
+    const AudioClipId clip = resolveClip(clipKey);
+    if (clip == InvalidAudioClip || !voices) return;
+    voices->ClearPool(clip, (uint32_t)bus);
 }
 
-void SoundManager::stopByOwnerTag(void* ownerTag)
-{
-    if (!ownerTag) return;
-    for (int b = 0; b < (int)ChannelType::MaxChannel; ++b)
-        stopByOwnerTag(ownerTag, (ChannelType)b);
+// ===== ̽  =====
+void SoundManager::stopVoice(VoiceHandle voice) { if (voices) voices->Stop(voice); }
+void SoundManager::setVoicePaused(VoiceHandle voice, bool paused) { if (voices) voices->SetPaused(voice, paused); }
+bool SoundManager::isVoicePlaying(VoiceHandle voice) const { return voices && voices->IsPlaying(voice); }
 
+void SoundManager::setVoice3DAttributes(VoiceHandle voice, const FMOD_VECTOR& pos, const FMOD_VECTOR& vel)
+{
+    if (voices) voices->Set3DAttributes(voice, ToAudio(pos), ToAudio(vel));
 }
 
-void SoundManager::stopByOwnerTag(void* ownerTag, ChannelType bus)
+void SoundManager::setVoiceGains(VoiceHandle voice, float gain2D, float gain3D)
 {
-    if (!ownerTag) return;
-    FMOD::ChannelGroup* g = groups[(int)bus];
-    if (!g) return;
-
-    int n = 0; g->getNumChannels(&n);
-    for (int i = 0; i < n; ++i) {
-        FMOD::Channel* ch = nullptr;
-        if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-            void* tag = nullptr;
-            ch->getUserData(&tag);
-            if (tag == ownerTag) ch->stop();
-        }
-    }
+    if (voices) voices->SetGains(voice, gain2D, gain3D);
 }
 
-bool SoundManager::getListenerPosition(FMOD_VECTOR& out) const
+FMOD::Channel* SoundManager::getVoiceChannel(VoiceHandle voice, bool is3D) const
 {
-    if (!system) return false;
-    FMOD_VECTOR vel{}, fwd{}, up{};
-    auto r = system->get3DListenerAttributes(0, &out, &vel, &fwd, &up);
-    return r == FMOD_OK;
+    return voices ? ToChannel(voices->GetChannel(voice, is3D)) : nullptr;
 }
 
-// =====  ƿ =====
-int SoundManager::countPlaying(ChannelType bus) const
+void SoundManager::stopByOwnerTag(void* ownerTag)
 {
-    int n = 0;
-    if (auto* g = groups[(int)bus]) g->getNumChannels(&n);
-    return n;
+    if (!ownerTag || !voices) return;
+    voices->StopByOwner(ownerTag);
 }
 
-void SoundManager::pruneStopped(ChannelType bus)
+void SoundManager::stopByOwnerTag(void* ownerTag, ChannelType bus)
 {
-    if (auto* g = groups[(int)bus]) {
-        int n = 0; g->getNumChannels(&n);
-        for (int i = 0; i < n; ++i) {
-            FMOD::Channel* ch = nullptr;
-            if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-                bool playing = false; ch->isPlaying(&playing);
-                (void)playing; // ʿ  stop()   
-            }
-        }
-    }
+    if (!ownerTag || !voices) return;
+    voices->StopByOwner(ownerTag, (uint32_t)bus);
 }
 
-FMOD::Channel* SoundManager::findStealCandidate(ChannelType bus, FMOD::Sound* newSound)
+bool SoundManager::getListenerPosition(FMOD_VECTOR& out) const
 {
-    auto& cfg = groupCfg[(int)bus];
-    FMOD::Channel* cand = nullptr;
-
-    if (auto* g = groups[(int)bus]) {
-        int n = 0; g->getNumChannels(&n);
-
-        if (cfg.preemptSameClip && newSound) {
-            for (int i = 0; i < n; ++i) {
-                FMOD::Channel* ch = nullptr;
-                if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-                    FMOD::Sound* cur = nullptr;
-                    if (ch->getCurrentSound(&cur) == FMOD_OK && cur == newSound) return ch;
-                }
-            }
-        }
-
-        switch (cfg.policy) {
-        case StealPolicy::Oldest: {
-            unsigned int maxPos = 0;
-            for (int i = 0; i < n; ++i) {
-                FMOD::Channel* ch = nullptr;
-                if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-                    bool playing = false; ch->isPlaying(&playing);
-                    if (!playing) return ch;
-                    unsigned int pos = 0;
-                    if (ch->getPosition(&pos, FMOD_TIMEUNIT_MS) == FMOD_OK) {
-                        if (pos >= maxPos) { maxPos = pos; cand = ch; }
-                    }
-                }
-            }
-            break;
-        }
-        case StealPolicy::Quietest: {
-            float minAud = FLT_MAX;
-            for (int i = 0; i < n; ++i) {
-                FMOD::Channel* ch = nullptr;
-                if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-                    bool playing = false; ch->isPlaying(&playing);
-                    if (!playing) return ch;
-                    float aud = 0.f;
-                    if (ch->getAudibility(&aud) == FMOD_OK) {
-                        if (aud <= minAud) { minAud = aud; cand = ch; }
-                    }
-                }
-            }
-            break;
-        }
-        case StealPolicy::LowestPriority: {
-            int worst = -1;
-            for (int i = 0; i < n; ++i) {
-                FMOD::Channel* ch = nullptr;
-                if (g->getChannel(i, &ch) == FMOD_OK && ch) {
-                    bool playing = false; ch->isPlaying(&playing);
-                    if (!playing) return ch;
-                    int p = 0;
-                    if (ch->getPriority(&p) == FMOD_OK) {
-                        if (p > worst) { worst = p; cand = ch; }
-                    }
-                }
-            }
-            break;
-        }
-        }
-    }
-    return cand;
+    if (!system) return false;
+    FMOD_VECTOR vel{}, fwd{}, up{};
+    auto r = system->get3DListenerAttributes(0, &out, &vel, &fwd, &up);
+    return r == FMOD_OK;
 }
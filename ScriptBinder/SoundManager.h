@@ -2,19 +2,16 @@
 #pragma once
 #include "Core.Minimal.h"
 #include "SoundDefinition.h"
+#include "VirtualVoiceSystem.h"
 #include <shared_mutex>
 
-struct ChannelPair
-{
-    FMOD::Channel* ch2D{ nullptr };
-    FMOD::Channel* ch3D{ nullptr };
-};
-
 class SoundComponent;
+class FmodAudioBackend;
 class SoundManager : public DLLCore::Singleton<SoundManager>
 {
 private:
     friend class DLLCore::Singleton<SoundManager>;
+    friend class FmodAudioBackend;
     SoundManager();
     ~SoundManager();
 
@@ -41,6 +38,9 @@ public:
         bool is3D = false, bool loop = false);
     void unloadSound(const std::string& name);
 
+    // Ŭ ̸ -> ڵ.  δ ڵ鸸 Ƿ ȣϴ ʿ   Ǯ θ ȴ ( InvalidAudioClip)
+    AudioClipId resolveClip(const std::string& name) const;
+
     // ϵ Ŭ Ű (˻)
     std::vector<std::string> getAllClipKeys() const;
 
@@ -49,13 +49,20 @@ public:
     void setGroupStealPolicy(ChannelType bus, StealPolicy p);
     void setGroupPreemptSameClip(ChannelType bus, bool on);
 
-    // ===== SpatialBlend ä  =====
-    ChannelPair playFromSourceBlended(const SoundComponent& src,
+    // ===== SpatialBlend ä  (   ̽ ޴´) =====
+    VoiceHandle playFromSourceBlended(const SoundComponent& src,
         void* ownerTag = nullptr);
+    VoiceHandle playVoice(const VoiceDesc& desc);
 
     // =====  Ǯ(per-clip κ) =====
     void configureVoicePool(const std::string& clipKey, ChannelType bus, int capacity);
-    ChannelPair playOneShotPooled(const std::string& clipKey, ChannelType bus,
+    VoiceHandle playOneShotPooled(const std::string& clipKey, ChannelType bus,
+        float volume, float pitch, int priority,
+        float spatialBlend,
+        const FMOD_VECTOR* pos = nullptr,
+        const FMOD_VECTOR* vel = nullptr,
+        void* ownerTag = nullptr);
+    VoiceHandle playOneShotPooled(AudioClipId clip, ChannelType bus,
         float volume, float pitch, int priority,
         float spatialBlend,
         const FMOD_VECTOR* pos = nullptr,
@@ -63,32 +70,27 @@ public:
         void* ownerTag = nullptr);
     void clearVoicePool(const std::string& clipKey, ChannelType bus);
 
+    // ===== ̽  (ų  ڵ õȴ) =====
+    void stopVoice(VoiceHandle voice);
+    void setVoicePaused(VoiceHandle voice, bool paused);
+    bool isVoicePlaying(VoiceHandle voice) const;
+    void setVoice3DAttributes(VoiceHandle voice, const FMOD_VECTOR& pos, const FMOD_VECTOR& vel);
+    void setVoiceGains(VoiceHandle voice, float gain2D, float gain3D);
+    //  ¸ nullptr ( ä Update  ٲ      )
+    FMOD::Channel* getVoiceChannel(VoiceHandle voice, bool is3D) const;
+
     // =====  ±׷ (/ ä Ȯ ) =====
     void stopByOwnerTag(void* ownerTag);                  //  
     void stopByOwnerTag(void* ownerTag, ChannelType bus); // Ư 
 
     bool getListenerPosition(FMOD_VECTOR& out) const;
 
+    static constexpr uint32_t MaxClips = 4096;
+
 private:
     //  
-    static void computeEqualPowerGains(float blend01, float& w2D, float& w3D);
-    ChannelPair playBlendedInternal(FMOD::Sound* sound, ChannelType bus,
-        float volume, float pitch, int priority,
-        float blend01, bool loop,
-        const FMOD_VECTOR* pos, const FMOD_VECTOR* vel,
-        void* ownerTag);
-    FMOD::Channel* findStealCandidate(ChannelType bus, FMOD::Sound* newSound);
-    int            countPlaying(ChannelType bus) const;
-    void           pruneStopped(ChannelType bus);
-
-    struct PooledVoice { FMOD::Channel* ch2D{ nullptr }; FMOD::Channel* ch3D{ nullptr }; };
-    struct VoicePool {
-        ChannelType bus{};
-        int capacity{ 8 };
-        int cursor{ 0 };
-        std::vector<PooledVoice> slots;
-    };
-    static std::string poolKey(const std::string& clipKey, ChannelType bus);
+    FMOD::Sound* getClipSound(AudioClipId clip) const;
+    void         applyGroupConfig(ChannelType bus);
 
 private:
     // FMOD Core
@@ -103,9 +105,19 @@ private:
     uint32_t _currSoundCount{ 0 };
 
     std::array<GroupConfig, (int)ChannelType::MaxChannel> groupCfg{};
+
+    // Ŭ ̺: ̸ -> id   Ʒ, id ->  δ 尡 ä     д´
+    // (    ű ʴ´. εϸ  ΰ  ̸ ٽ  )
     mutable std::shared_mutex _soundsMutex;
-    std::unordered_map<std::string, FMOD::Sound*> sounds;
-    std::unordered_map<std::string, VoicePool>    voicePools;
+    std::unordered_map<std::string, AudioClipId> clipIds;
+    std::vector<std::string>                     clipNames;
+    std::unique_ptr<std::atomic<FMOD::Sound*>[]> clipSounds;
+    std::unique_ptr<std::atomic<uint32_t>[]>     clipLengthMs;
+
+    //  ̽ (  )
+    std::unique_ptr<IAudioBackend>      backend;
+    std::unique_ptr<VirtualVoiceSystem> voices;
+    std::chrono::steady_clock::time_point _lastUpdateTime{};
 
     // δ 
     std::thread      _soundLoaderThread;
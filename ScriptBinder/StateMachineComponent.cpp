@@ -5,6 +5,8 @@
 void StateMachineComponent::Initialize()
 {
 	m_aiType = AIType::FSM;
+	SetTickImportance(tickImportance);
+	SetParallelTick(parallelTick);
 	if (m_currentState)
 	{
 		m_currentState->Enter(m_localBB);
@@ -6,6 +6,8 @@ ReflectionFieldInheritance(StateMachineComponent, Component) \
 	PropertyField \
 	({ \
 		meta_property(name) \
+		meta_property(tickImportance) \
+		meta_property(parallelTick) \
 	}); \
 	FieldEnd(StateMachineComponent, PropertyOnlyInheritance) \
 };
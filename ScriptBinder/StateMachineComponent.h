@@ -28,6 +28,11 @@ public:
 
 	[[Property]]
 	std::string name;
+	// AIManager tick scheduling, copied into IAIComponent on Initialize
+	[[Property]]
+	AITickImportance tickImportance{ AITickImportance::Normal };
+	[[Property]]
+	bool parallelTick{ false };
 
 	void Initialize() override;
 	//void Tick(float deltaTime) override;
@@ -1,6 +1,7 @@
 #include "TagManager.h"
 #include "Core.Minimal.h"
 #include "ReflectionYml.h"
+#include "Core.PakFileSystem.h"
 
 void TagManager::Initialize()
 {
@@ -63,7 +64,8 @@ void TagManager::Load()
     }
 #endif // !BUILD_FLAG
 
-    YAML::Node root = YAML::LoadFile(path.string());
+    AssetStream tagFile(path);
+    YAML::Node root = YAML::Load(tagFile);
 
     if (root["tags"])
     {
@@ -1,6 +1,7 @@
 ﻿#include "Transform.h"
 #include "Terrain.h"
 #include "SceneManager.h"
+#include "Core.JobSystem.h"
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb_image.h"
@@ -423,7 +424,8 @@ void TerrainComponent::Save(const std::wstring& assetRoot, const std::wstring& n
 
 	//height map
 	std::wstring heightMapPath = (terrainPath / (name + L"_HeightMap.png")).wstring();
-	SceneManagers->m_threadPool->Enqueue(
+	JobHandle saveGroup = JobSystems->CreateGroup();
+	JobSystems->Schedule(saveGroup,
 		[this, heightMapPath]()
 		{
 			SaveEditorHeightMap(heightMapPath, m_minHeight, m_maxHeight);
@@ -436,7 +438,7 @@ void TerrainComponent::Save(const std::wstring& assetRoot, const std::wstring& n
 	for (size_t i = 0; i < m_layers.size(); ++i)
 	{
 		splatMapFiles[i] = name + L"_Splat_" + std::to_wstring(i) + L".png";
-		SceneManagers->m_threadPool->Enqueue([this, i, path = (terrainPath / splatMapFiles[i]).wstring()]() {
+		JobSystems->Schedule(saveGroup, [this, i, path = (terrainPath / splatMapFiles[i]).wstring()]() {
 			SaveEditorSplatMap(path, i);
 			});
 	}
@@ -459,7 +461,7 @@ void TerrainComponent::Save(const std::wstring& assetRoot, const std::wstring& n
 			fs::path destPath = difusePath / fs::path(layer.diffuseTexturePath).filename();
 			//이미 존제하면 복	사하지 않음
 			if (!fs::exists(destPath)) {
-				SceneManagers->m_threadPool->Enqueue(
+				JobSystems->Schedule(saveGroup,
 					[src = layer.diffuseTexturePath, dst = destPath.wstring()]()
 					{
 						std::error_code ec;
@@ -476,7 +478,7 @@ void TerrainComponent::Save(const std::wstring& assetRoot, const std::wstring& n
 	}
 
 	//스레드 대기
-	SceneManagers->m_threadPool->NotifyAllAndWait();
+	JobSystems->Wait(saveGroup);
 
 	//풀페스 저장 하면 다른 사람이 쓰김 힘듬 상대경로 쓸레
 	fs::path relheightMap = fs::relative(heightMapPath, terrainDir);
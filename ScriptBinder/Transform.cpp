@@ -41,6 +41,7 @@ Transform& Transform::operator=(const Transform& rhs)
 	m_worldScale = rhs.m_worldScale;
 	m_worldQuaternion = rhs.m_worldQuaternion;
 	m_worldPosition = rhs.m_worldPosition;
+	++m_worldVersion;
 
 	return *this;
 }
@@ -57,6 +58,7 @@ Transform& Transform::operator=(Transform&& rhs) noexcept
 	m_worldScale		= std::exchange(rhs.m_worldScale, {});
 	m_worldQuaternion	= std::exchange(rhs.m_worldQuaternion, {});
 	m_worldPosition		= std::exchange(rhs.m_worldPosition, {});
+	++m_worldVersion;
 
 	return *this;
 }
@@ -207,7 +209,13 @@ Mathf::xMatrix Transform::UpdateWorldMatrix()
 	else 
 	{
 		UpdateLocalMatrix();
-		m_worldMatrix = m_localMatrix;
+		// SetAndDecomposeMatrix     ٲ 쿡  ø
+		Mathf::Matrix compareMat = m_localMatrix;
+		if (compareMat != m_worldMatrix)
+		{
+			m_worldMatrix = m_localMatrix;
+			++m_worldVersion;
+		}
 		return m_worldMatrix;
 	}
 }
@@ -244,6 +252,7 @@ void Transform::SetLocalMatrix(const Mathf::xMatrix& matrix)
 	XMStoreFloat4(&rotation, DirectX::XMVector4Normalize(_rotation));
 
 	m_dirty = false;
+	m_worldDirty = true;
 }
 
 void Transform::SetAndDecomposeMatrix(const Mathf::xMatrix& matrix, bool setLocal)
@@ -252,6 +261,7 @@ void Transform::SetAndDecomposeMatrix(const Mathf::xMatrix& matrix, bool setLoca
 	if (compareMat == m_worldMatrix) return;
 
 	m_worldMatrix = matrix;
+	++m_worldVersion;
 	XMMatrixDecompose(&m_worldScale, &m_worldQuaternion, &m_worldPosition, m_worldMatrix);
 	m_worldQuaternion = DirectX::XMVector4Normalize(m_worldQuaternion);
 
@@ -313,6 +323,7 @@ void Transform::SetDirty()
 	{
 		m_dirty = true;
 	}
+	m_worldDirty = true;
 	//	if (m_owner && m_owner->GetScene())
 	//	{
 	//		m_owner->GetScene()->RegisterDirtyTransform(this);
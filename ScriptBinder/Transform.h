@@ -58,6 +58,20 @@ public:
 	Mathf::Vector3 GetUp();
 	void SetDirty();
 	bool IsDirty() const;
+	// TransformHierarchy 가 월드 행렬을 다시 계산해야 하는지 여부
+	bool IsWorldDirty() const { return m_worldDirty; }
+	void ClearWorldDirty() { m_worldDirty = false; }
+	// 월드 행렬이 실제로 바뀔 때마다 증가 (PhysicsManager 변경 감지용)
+	uint32 GetWorldVersion() const { return m_worldVersion; }
+
+	// 렌더에만 쓰는 월드 행렬 (물리 보간). 없으면 월드 행렬과 같다. 게임 코드는 GetWorldMatrix 를 쓴다
+	Mathf::xMatrix GetRenderWorldMatrix() const { return m_hasRenderMatrix ? m_renderMatrix : m_worldMatrix; }
+	Mathf::xVector GetRenderWorldPosition() const { return m_hasRenderMatrix ? m_renderMatrix.r[3] : m_worldPosition; }
+	// 월드 행렬이나 렌더 행렬이 바뀌면 달라진다 (프록시 변경 감지용)
+	uint32 GetRenderVersion() const { return m_worldVersion + m_renderVersion; }
+	bool HasRenderMatrix() const { return m_hasRenderMatrix; }
+	void SetRenderMatrix(const Mathf::xMatrix& matrix) { m_renderMatrix = matrix; m_hasRenderMatrix = true; ++m_renderVersion; }
+	void ClearRenderMatrix() { if (m_hasRenderMatrix) { m_hasRenderMatrix = false; ++m_renderVersion; } }
 
 	void SetParentID(uint32 id);
 
@@ -73,6 +87,11 @@ private:
 	[[Property]]
 	uint32 m_parentID{ 0 };
 	bool32 m_dirty{ false };
+	bool32 m_worldDirty{ true };
+	uint32 m_worldVersion{ 0 };
+	bool32 m_hasRenderMatrix{ false };
+	uint32 m_renderVersion{ 0 };
+	Mathf::xMatrix m_renderMatrix{ XMMatrixIdentity() };
 	Mathf::xMatrix m_worldMatrix{ XMMatrixIdentity() };
 	Mathf::xMatrix m_localMatrix{ XMMatrixIdentity() };
 	Mathf::xMatrix m_inverseMatrix{ XMMatrixIdentity() };
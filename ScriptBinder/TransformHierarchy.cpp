@@ -0,0 +1,380 @@
+#include "TransformHierarchy.h"
+#include "Scene.h"
+#include "MeshRenderer.h"
+#include "Animator.h"
+#include "Skeleton.h"
+#include "RectTransformComponent.h"
+#include "Core.JobSystem.h"
+
+void TransformHierarchy::Update(Scene& scene)
+{
+	auto& objects = scene.m_SceneObjects;
+	if (objects.empty() || !objects[0])
+	{
+		Clear();
+		return;
+	}
+
+	// 구조 변경은 Scene 의 훅이 알린다. 오브젝트 수 비교는 훅을 거치지 않은 추가/삭제에 대한 안전망이다
+	bool forceFull = false;
+	if (m_structureDirty.exchange(false, std::memory_order_acq_rel) || objects.size() != m_slotByIndex.size())
+	{
+		Rebuild(scene);
+		forceFull = true;
+	}
+
+	// 재구성 직후에는 모든 노드를 변경된 것으로 보고 한 번 전체 전파한다
+	m_forceFull = forceFull;
+	m_updatedCount.store(0, std::memory_order_relaxed);
+
+	const size_t levelCount = GetLevelCount();
+	for (size_t level = 0; level < levelCount; ++level)
+	{
+		const uint32 begin = m_levelOffsets[level];
+		const uint32 end = m_levelOffsets[level + 1];
+		const uint32 count = end - begin;
+
+		if (count <= ParallelGrainSize)
+		{
+			PropagateLevel(scene, begin, end);
+			continue;
+		}
+
+		JobHandle levelGroup = JobSystems->ParallelFor(count, ParallelGrainSize, [this, &scene, begin](uint32 chunkBegin, uint32 chunkEnd)
+		{
+			PropagateLevel(scene, begin + chunkBegin, begin + chunkEnd);
+		});
+		JobSystems->Wait(levelGroup);
+	}
+
+	m_forceFull = false;
+	m_lastUpdatedCount = m_updatedCount.load(std::memory_order_relaxed);
+}
+
+void TransformHierarchy::Clear()
+{
+	m_objects.clear();
+	m_transforms.clear();
+	m_parentSlot.clear();
+	m_kind.clear();
+	m_renderers.clear();
+	m_world.clear();
+	m_changed.clear();
+	m_blocked.clear();
+	m_boneSkeleton.clear();
+	m_boneIndex.clear();
+	m_renderCorrectionSlot.clear();
+	m_renderCorrections.clear();
+	m_levelOffsets.clear();
+	m_order.clear();
+	m_slotByIndex.clear();
+	m_lastUpdatedCount = 0;
+	m_structureDirty.store(true, std::memory_order_release);
+	m_hasRenderPoses = false;
+}
+
+bool TransformHierarchy::TryGetWorldMatrix(GameObject::Index index, Mathf::xMatrix& outWorld) const
+{
+	if (index < 0 || static_cast<size_t>(index) >= m_slotByIndex.size())
+	{
+		return false;
+	}
+
+	const int32 slot = m_slotByIndex[index];
+	if (slot == NullSlot)
+	{
+		return false;
+	}
+
+	outWorld = m_world[slot];
+	return true;
+}
+
+void TransformHierarchy::ApplyRenderPoses(const std::vector<RenderPose>& poses)
+{
+	// 이번에도 지난번에도 렌더 포즈가 없으면 지울 것도 없다
+	if (poses.empty() && !m_hasRenderPoses)
+	{
+		return;
+	}
+
+	m_renderCorrectionSlot.assign(m_order.size(), NullSlot);
+	m_renderCorrections.clear();
+	for (const RenderPose& pose : poses)
+	{
+		if (pose.index < 0 || static_cast<size_t>(pose.index) >= m_slotByIndex.size())
+		{
+			continue;
+		}
+
+		const int32 slot = m_slotByIndex[pose.index];
+		if (slot == NullSlot || m_blocked[slot])
+		{
+			continue;
+		}
+
+		// 스텝 뒤에 게임 코드가 옮긴 바디는 보간하지 않고 옮긴 자리에 그린다 (렌더에만 영향)
+		const Mathf::xMatrix world = m_transforms[slot]->GetWorldMatrix();
+		if (Mathf::Vector3::DistanceSquared(Mathf::Vector3(world.r[3]), pose.simulatedPosition) > 1e-6f)
+		{
+			continue;
+		}
+
+		Mathf::xMatrix correction;
+		if (pose.positionOnly)
+		{
+			correction = XMMatrixTranslationFromVector(XMVectorSubtract(pose.position, world.r[3]));
+		}
+		else
+		{
+			const Mathf::xMatrix renderWorld = XMMatrixScalingFromVector(pose.scale)
+				* XMMatrixRotationQuaternion(pose.rotation)
+				* XMMatrixTranslationFromVector(pose.position);
+			correction = XMMatrixMultiply(XMMatrixInverse(nullptr, world), renderWorld);
+		}
+
+		m_renderCorrectionSlot[slot] = static_cast<int32>(m_renderCorrections.size());
+		m_renderCorrections.push_back(correction);
+	}
+
+	const size_t levelCount = GetLevelCount();
+	for (size_t level = 0; level < levelCount; ++level)
+	{
+		const uint32 begin = m_levelOffsets[level];
+		const uint32 end = m_levelOffsets[level + 1];
+		const uint32 count = end - begin;
+
+		if (count <= ParallelGrainSize)
+		{
+			ApplyRenderLevel(begin, end);
+			continue;
+		}
+
+		JobHandle levelGroup = JobSystems->ParallelFor(count, ParallelGrainSize, [this, begin](uint32 chunkBegin, uint32 chunkEnd)
+		{
+			ApplyRenderLevel(begin + chunkBegin, begin + chunkEnd);
+		});
+		JobSystems->Wait(levelGroup);
+	}
+
+	m_hasRenderPoses = !m_renderCorrections.empty();
+}
+
+void TransformHierarchy::Rebuild(Scene& scene)
+{
+	auto& objects = scene.m_SceneObjects;
+	const size_t objectCount = objects.size();
+
+	m_slotByIndex.assign(objectCount, NullSlot);
+
+	m_order.clear();
+	m_levelOffsets.clear();
+	m_parentSlot.clear();
+
+	// 씬 루트(0번)의 자식부터 너비 우선으로 깊이 순 정렬
+	std::vector<uint8> visited(objectCount, 0);
+	visited[0] = 1;
+
+	auto pushChildren = [&](GameObject* parent, int32 parentSlot)
+	{
+		for (GameObject::Index childIndex : parent->m_childrenIndices)
+		{
+			if (childIndex < 0 || static_cast<size_t>(childIndex) >= objectCount) continue;
+			if (visited[childIndex] || !objects[childIndex]) continue;
+
+			visited[childIndex] = 1;
+			m_order.push_back(childIndex);
+			m_parentSlot.push_back(parentSlot);
+		}
+	};
+
+	m_levelOffsets.push_back(0);
+	pushChildren(objects[0].get(), NullSlot);
+
+	uint32 levelBegin = 0;
+	while (levelBegin < m_order.size())
+	{
+		const uint32 levelEnd = static_cast<uint32>(m_order.size());
+		m_levelOffsets.push_back(levelEnd);
+
+		for (uint32 slot = levelBegin; slot < levelEnd; ++slot)
+		{
+			pushChildren(objects[m_order[slot]].get(), static_cast<int32>(slot));
+		}
+
+		levelBegin = levelEnd;
+	}
+
+	if (m_levelOffsets.size() == 1)
+	{
+		m_levelOffsets.clear();
+	}
+
+	const size_t nodeCount = m_order.size();
+	m_objects.resize(nodeCount);
+	m_transforms.resize(nodeCount);
+	m_kind.resize(nodeCount);
+	m_renderers.assign(nodeCount, nullptr);
+	m_world.resize(nodeCount);
+	m_changed.assign(nodeCount, 1);
+	m_blocked.assign(nodeCount, 0);
+	m_boneSkeleton.assign(nodeCount, nullptr);
+	m_boneIndex.assign(nodeCount, -1);
+
+	for (size_t slot = 0; slot < nodeCount; ++slot)
+	{
+		GameObject* obj = objects[m_order[slot]].get();
+		m_slotByIndex[m_order[slot]] = static_cast<int32>(slot);
+		m_objects[slot] = obj;
+		m_transforms[slot] = &obj->m_transform;
+		m_world[slot] = obj->m_transform.GetWorldMatrix();
+
+		switch (obj->GetType())
+		{
+		case GameObjectType::UI:
+			m_kind[slot] = NodeKind::UI;
+			break;
+		case GameObjectType::Bone:
+			m_kind[slot] = NodeKind::Bone;
+			break;
+		default:
+			m_kind[slot] = NodeKind::Default;
+			m_renderers[slot] = obj->GetComponent<MeshRenderer>();
+			break;
+		}
+	}
+}
+
+void TransformHierarchy::PropagateLevel(Scene& scene, uint32 begin, uint32 end)
+{
+	size_t updated = 0;
+	for (uint32 slot = begin; slot < end; ++slot)
+	{
+		UpdateNode(scene, slot);
+		updated += m_changed[slot];
+	}
+
+	if (updated)
+	{
+		m_updatedCount.fetch_add(updated, std::memory_order_relaxed);
+	}
+}
+
+void TransformHierarchy::ApplyRenderLevel(uint32 begin, uint32 end)
+{
+	for (uint32 slot = begin; slot < end; ++slot)
+	{
+		int32 correction = m_renderCorrectionSlot[slot];
+		const int32 parentSlot = m_parentSlot[slot];
+		if (correction == NullSlot && parentSlot != NullSlot)
+		{
+			// 자식은 부모 바디의 보정을 그대로 따른다 (render = world * inverse(parentWorld) * parentRender)
+			correction = m_renderCorrectionSlot[parentSlot];
+			m_renderCorrectionSlot[slot] = correction;
+		}
+
+		Transform* transform = m_transforms[slot];
+		if (correction == NullSlot)
+		{
+			transform->ClearRenderMatrix();
+			continue;
+		}
+
+		transform->SetRenderMatrix(XMMatrixMultiply(transform->GetWorldMatrix(), m_renderCorrections[correction]));
+	}
+}
+
+void TransformHierarchy::UpdateNode(Scene& scene, uint32 slot)
+{
+	const int32 parentSlot = m_parentSlot[slot];
+	GameObject* obj = m_objects[slot];
+
+	if ((parentSlot != NullSlot && m_blocked[parentSlot]) || obj->IsDestroyMark())
+	{
+		m_blocked[slot] = 1;
+		m_changed[slot] = 0;
+		return;
+	}
+	m_blocked[slot] = 0;
+
+	const bool parentChanged = m_forceFull || (parentSlot != NullSlot && m_changed[parentSlot]);
+	const Mathf::xMatrix parentWorld = (parentSlot != NullSlot) ? m_world[parentSlot] : XMMatrixIdentity();
+	Transform* transform = m_transforms[slot];
+
+	switch (m_kind[slot])
+	{
+	case NodeKind::UI:
+	{
+		// UI 는 월드 행렬 대신 RectTransform 레이아웃을 갱신하고, 부모 행렬을 그대로 자식에게 넘긴다
+		m_world[slot] = parentWorld;
+		m_changed[slot] = parentChanged;
+
+		const auto& rectTransform = obj->GetComponent<RectTransformComponent>();
+		const auto& objParent = scene.TryGetGameObject(obj->m_parentIndex);
+		if (!rectTransform || !rectTransform->IsEnabled() || !objParent)
+		{
+			m_blocked[slot] = 1;
+			return;
+		}
+		const auto& parentRectTransform = objParent->GetComponent<RectTransformComponent>();
+		if (!parentRectTransform || !parentRectTransform->IsEnabled())
+		{
+			m_blocked[slot] = 1;
+			return;
+		}
+		rectTransform->UpdateLayout(parentRectTransform->GetWorldRect());
+		return;
+	}
+	case NodeKind::Bone:
+	{
+		// 본은 애니메이터 결과로 매 프레임 갱신, 자식에게는 부모 행렬을 그대로 넘긴다
+		m_world[slot] = parentWorld;
+		m_changed[slot] = parentChanged;
+
+		const auto& rootObj = scene.TryGetGameObject(obj->m_rootIndex);
+		if (!rootObj)
+		{
+			m_blocked[slot] = 1;
+			return;
+		}
+		const auto& animator = rootObj->GetComponent<Animator>();
+		if (!animator || !animator->m_Skeleton || !animator->IsEnabled())
+		{
+			m_blocked[slot] = 1;
+			return;
+		}
+
+		if (m_boneSkeleton[slot] != animator->m_Skeleton)
+		{
+			const auto bone = animator->m_Skeleton->FindBone(obj->RemoveSuffixNumberTag());
+			m_boneSkeleton[slot] = animator->m_Skeleton;
+			m_boneIndex[slot] = bone ? bone->m_index : -1;
+		}
+
+		const int boneIndex = m_boneIndex[slot];
+		transform->SetAndDecomposeMatrix(XMMatrixMultiply(boneIndex >= 0 ?
+			animator->m_localTransforms[boneIndex] : transform->GetLocalMatrix(), parentWorld));
+		return;
+	}
+	default:
+	{
+		if (!parentChanged && !transform->IsWorldDirty())
+		{
+			m_changed[slot] = 0;
+			return;
+		}
+
+		const Mathf::xMatrix world = XMMatrixMultiply(transform->GetLocalMatrix(), parentWorld);
+		transform->ClearWorldDirty();
+		transform->SetAndDecomposeMatrix(world);
+		m_world[slot] = world;
+		m_changed[slot] = 1;
+
+		if (MeshRenderer* renderer = m_renderers[slot])
+		{
+			renderer->SetNeedUpdateCulling(true);
+		}
+		return;
+	}
+	}
+}
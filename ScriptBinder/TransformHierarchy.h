@@ -0,0 +1,92 @@
+#pragma once
+#include "Core.Minimal.h"
+#include "GameObject.h"
+
+class Scene;
+class Skeleton;
+class MeshRenderer;
+// 씬의 Transform 계층을 깊이 순으로 정렬된 SoA 배열로 보관하고,
+// 레벨 단위 병렬 + 더티 비트 기반으로 월드 행렬을 전파한다.
+// 로컬 TRS 의 원본은 여전히 GameObject 의 Transform 이다. Transform 은 값 멤버로 리플렉션/직렬화되고
+// (meta_property 오프셋), 프리팹 복사와 물리/스크립트가 직접 읽고 쓰므로 배열의 뷰로 바꾸지 않았다.
+// 이 클래스의 m_world 는 전파용 캐시이며 계산 결과는 Transform 의 월드 행렬에 다시 써 준다.
+// 구조(부모/자식, 씬 오브젝트 추가/삭제, MeshRenderer 등록/해제)는 매 프레임 검사하지 않고 Scene 의 훅이 MarkStructureDirty 로 알린다.
+// 성능: TrainAsis -headless -bench transform (deep/wide/bushy 계층, ns/node)
+class TransformHierarchy
+{
+public:
+	enum class NodeKind : uint8
+	{
+		Default,
+		Bone,
+		UI,
+	};
+
+	// 물리 보간처럼 렌더에만 쓰는 포즈. 게임 코드가 읽는 Transform 값은 바꾸지 않는다
+	struct RenderPose
+	{
+		GameObject::Index	index{ GameObject::INVALID_INDEX };
+		Mathf::Vector3		simulatedPosition;	// 마지막 시뮬레이션 위치 (그 뒤 게임 코드가 옮겼으면 적용하지 않는다)
+		Mathf::Vector3		position;
+		Mathf::Quaternion	rotation;
+		Mathf::Vector3		scale{ 1.f, 1.f, 1.f };
+		bool				positionOnly{ false };	// CCT : 회전은 게임 코드가 정한다
+	};
+
+	TransformHierarchy() = default;
+	~TransformHierarchy() = default;
+
+	// 계층 구조가 바뀌었음을 알린다 (다음 Update 에서 재구성). 로딩 스레드의 Awake 에서도 불릴 수 있다
+	void MarkStructureDirty() { m_structureDirty.store(true, std::memory_order_release); }
+	void Update(Scene& scene);
+	void Clear();
+
+	size_t GetNodeCount() const { return m_order.size(); }
+	size_t GetLevelCount() const { return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1; }
+	// 마지막 Update 에서 월드 행렬이 다시 계산된 노드 수
+	size_t GetLastUpdatedCount() const { return m_lastUpdatedCount; }
+
+	// GameObject::Index 로 계산된 월드 행렬을 조회한다.
+	bool TryGetWorldMatrix(GameObject::Index index, Mathf::xMatrix& outWorld) const;
+
+	// 마지막 Update 결과 위에 렌더 포즈를 얹는다. 포즈를 받은 노드의 서브트리도 같은 보정을 따르고,
+	// 포즈가 없는 노드는 렌더 행렬을 지운다
+	void ApplyRenderPoses(const std::vector<RenderPose>& poses);
+
+private:
+	void Rebuild(Scene& scene);
+	void PropagateLevel(Scene& scene, uint32 begin, uint32 end);
+	void UpdateNode(Scene& scene, uint32 slot);
+	void ApplyRenderLevel(uint32 begin, uint32 end);
+
+private:
+	static constexpr int32	 NullSlot = -1;
+	static constexpr uint32 ParallelGrainSize = 256;
+
+	// slot(깊이 순 정렬) 기준 SoA
+	std::vector<GameObject*>		m_objects;
+	std::vector<Transform*>			m_transforms;
+	std::vector<int32>				m_parentSlot;
+	std::vector<NodeKind>			m_kind;
+	std::vector<MeshRenderer*>		m_renderers;	// Default 노드의 컬링 갱신 대상 (등록/해제 시 재구성)
+	std::vector<Mathf::xMatrix>		m_world;
+	std::vector<uint8>				m_changed;	// 이번 Update 에서 월드가 바뀜 (자식 전파용)
+	std::vector<uint8>				m_blocked;	// 파괴 예정 등으로 서브트리 갱신 중단
+	std::vector<Skeleton*>			m_boneSkeleton;
+	std::vector<int>				m_boneIndex;
+	std::vector<int32>				m_renderCorrectionSlot;	// m_renderCorrections 인덱스 (부모에게서 물려받음)
+	std::vector<Mathf::xMatrix>		m_renderCorrections;	// 시뮬레이션 월드 -> 렌더 월드
+
+	// 레벨 l 의 slot 범위 : [m_levelOffsets[l], m_levelOffsets[l + 1])
+	std::vector<uint32>				m_levelOffsets;
+	std::vector<GameObject::Index>	m_order;
+
+	// GameObject::Index -> slot
+	std::vector<int32>				m_slotByIndex;
+
+	std::atomic<size_t>				m_updatedCount{ 0 };
+	size_t							m_lastUpdatedCount{ 0 };
+	std::atomic<bool>				m_structureDirty{ true };
+	bool							m_forceFull{ false };
+	bool							m_hasRenderPoses{ false };	// 지난 ApplyRenderPoses 에서 렌더 행렬을 쓴 노드가 있음
+};
@@ -0,0 +1,483 @@
+#include "VirtualVoiceSystem.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace
+{
+	constexpr float MinChannelGain = 1e-3f;
+
+	void EqualPowerGains(float blend01, float& w2D, float& w3D)
+	{
+		const float t = std::clamp(blend01, 0.0f, 1.0f);
+		w2D = cosf(t * (3.14159265f * 0.5f));
+		w3D = sinf(t * (3.14159265f * 0.5f));
+	}
+}
+
+VirtualVoiceSystem::VirtualVoiceSystem(IAudioBackend& backend)
+	: m_backend(backend)
+{
+}
+
+VirtualVoiceSystem::~VirtualVoiceSystem()
+{
+	StopAll();
+}
+
+void VirtualVoiceSystem::SetBusLimit(uint32_t bus, uint32_t maxRealVoices)
+{
+	if (bus < MaxBuses) m_buses[bus].maxRealVoices = maxRealVoices;
+}
+
+void VirtualVoiceSystem::SetBusRank(uint32_t bus, VoiceRank rank)
+{
+	if (bus < MaxBuses) m_buses[bus].rank = rank;
+}
+
+void VirtualVoiceSystem::SetBusPreemptSameClip(uint32_t bus, bool preempt)
+{
+	if (bus < MaxBuses) m_buses[bus].preemptSameClip = preempt;
+}
+
+void VirtualVoiceSystem::SetBusGain(uint32_t bus, float gain)
+{
+	if (bus < MaxBuses) m_buses[bus].gain = std::max(0.0f, gain);
+}
+
+void VirtualVoiceSystem::SetListener(const AudioVector& position)
+{
+	m_listener = position;
+}
+
+VoiceHandle VirtualVoiceSystem::Play(const VoiceDesc& desc)
+{
+	if (InvalidAudioClip == desc.clip || desc.bus >= MaxBuses) return {};
+
+	const BusConfig& bus = m_buses[desc.bus];
+	if (bus.preemptSameClip && 0 != bus.maxRealVoices && m_realCount[desc.bus] >= bus.maxRealVoices)
+	{
+		PreemptSameClip(desc.bus, desc.clip);
+	}
+
+	const uint32_t slot = Allocate();
+	m_desc[slot] = desc;
+	if (desc.is3D)
+	{
+		float w2D = 1.f, w3D = 0.f;
+		EqualPowerGains(desc.spatialBlend, w2D, w3D);
+		m_gain2D[slot] = desc.volume * w2D;
+		m_gain3D[slot] = desc.volume * w3D;
+	}
+	else
+	{
+		m_gain2D[slot] = desc.volume;
+		m_gain3D[slot] = 0.f;
+	}
+	m_elapsedMs[slot] = 0.f;
+	m_lengthMs[slot] = m_backend.GetClipLengthMs(desc.clip);
+	m_sequence[slot] = m_nextSequence++;
+	m_channel2D[slot] = 0;
+	m_channel3D[slot] = 0;
+	m_flags[slot] = Flag_Active;
+	m_activeIndex[slot] = static_cast<uint32_t>(m_active.size());
+	m_active.push_back(slot);
+
+	// 자리가 남아 있으면 바로 실제 채널을 붙인다 (자리 다툼은 다음 Update 에서 순위로 정한다)
+	if ((0 == bus.maxRealVoices || m_realCount[desc.bus] < bus.maxRealVoices)
+		&& ComputeAudibility(slot) >= InaudibleThreshold)
+	{
+		Promote(slot);
+	}
+
+	return { slot, m_generation[slot] };
+}
+
+VoiceHandle VirtualVoiceSystem::PlayPooled(const VoiceDesc& desc)
+{
+	if (InvalidAudioClip == desc.clip || desc.bus >= MaxBuses) return {};
+
+	Pool& pool = m_pools[PoolKey(desc.clip, desc.bus)];
+	if (pool.slots.empty()) pool.slots.resize(DefaultPoolCapacity);
+
+	VoiceHandle& pooled = pool.slots[pool.cursor++ % pool.slots.size()];
+	Stop(pooled);
+	pooled = Play(desc);
+	return pooled;
+}
+
+void VirtualVoiceSystem::ConfigurePool(AudioClipId clip, uint32_t bus, uint32_t capacity)
+{
+	Pool& pool = m_pools[PoolKey(clip, bus)];
+	pool.cursor = 0;
+	pool.slots.clear();
+	pool.slots.resize(std::max(1u, capacity));
+}
+
+void VirtualVoiceSystem::ClearPool(AudioClipId clip, uint32_t bus)
+{
+	auto it = m_pools.find(PoolKey(clip, bus));
+	if (it == m_pools.end()) return;
+
+	for (VoiceHandle handle : it->second.slots)
+	{
+		Stop(handle);
+	}
+	m_pools.erase(it);
+}
+
+void VirtualVoiceSystem::Stop(VoiceHandle handle)
+{
+	uint32_t slot = 0;
+	if (Resolve(handle, slot)) Release(slot);
+}
+
+void VirtualVoiceSystem::StopByOwner(void* ownerTag, uint32_t bus)
+{
+	if (nullptr == ownerTag) return;
+
+	m_retireScratch.clear();
+	for (uint32_t slot : m_active)
+	{
+		const VoiceDesc& desc = m_desc[slot];
+		if (desc.ownerTag == ownerTag && (AllBuses == bus || desc.bus == bus))
+		{
+			m_retireScratch.push_back(slot);
+		}
+	}
+
+	for (uint32_t slot : m_retireScratch)
+	{
+		Release(slot);
+	}
+}
+
+void VirtualVoiceSystem::StopAll()
+{
+	while (!m_active.empty())
+	{
+		Release(m_active.back());
+	}
+}
+
+bool VirtualVoiceSystem::IsPlaying(VoiceHandle handle) const
+{
+	uint32_t slot = 0;
+	return Resolve(handle, slot);
+}
+
+bool VirtualVoiceSystem::IsReal(VoiceHandle handle) const
+{
+	uint32_t slot = 0;
+	return Resolve(handle, slot) && (m_flags[slot] & Flag_Real);
+}
+
+void VirtualVoiceSystem::SetPaused(VoiceHandle handle, bool paused)
+{
+	uint32_t slot = 0;
+	if (!Resolve(handle, slot)) return;
+
+	if (paused) m_flags[slot] |= Flag_Paused;
+	else		m_flags[slot] &= ~Flag_Paused;
+
+	if (m_channel2D[slot]) m_backend.SetPaused(m_channel2D[slot], paused);
+	if (m_channel3D[slot]) m_backend.SetPaused(m_channel3D[slot], paused);
+}
+
+void VirtualVoiceSystem::Set3DAttributes(VoiceHandle handle, const AudioVector& position, const AudioVector& velocity)
+{
+	uint32_t slot = 0;
+	if (!Resolve(handle, slot)) return;
+
+	m_desc[slot].position = position;
+	m_desc[slot].velocity = velocity;
+	if (m_channel3D[slot]) m_backend.Set3DAttributes(m_channel3D[slot], position, velocity);
+}
+
+void VirtualVoiceSystem::SetGains(VoiceHandle handle, float gain2D, float gain3D)
+{
+	uint32_t slot = 0;
+	if (!Resolve(handle, slot)) return;
+
+	m_gain2D[slot] = gain2D;
+	m_gain3D[slot] = gain3D;
+	if (m_channel2D[slot]) m_backend.SetVolume(m_channel2D[slot], gain2D);
+	if (m_channel3D[slot]) m_backend.SetVolume(m_channel3D[slot], gain3D);
+}
+
+AudioChannelId VirtualVoiceSystem::GetChannel(VoiceHandle handle, bool is3D) const
+{
+	uint32_t slot = 0;
+	if (!Resolve(handle, slot)) return 0;
+	return is3D ? m_channel3D[slot] : m_channel2D[slot];
+}
+
+void VirtualVoiceSystem::Update(float deltaSeconds)
+{
+	const float deltaMs = std::max(0.0f, deltaSeconds) * 1000.f;
+
+	// 1) 재생 위치를 진행하고 끝난 보이스를 모은다
+	m_retireScratch.clear();
+	for (uint32_t slot : m_active)
+	{
+		if (m_flags[slot] & Flag_Paused) continue;
+
+		const VoiceDesc& desc = m_desc[slot];
+		const bool wasRanked = m_elapsedMs[slot] > 0.f;
+		m_elapsedMs[slot] += deltaMs * desc.pitch;
+
+		if (m_flags[slot] & Flag_Real)
+		{
+			const bool isPlaying = (m_channel2D[slot] && m_backend.IsPlaying(m_channel2D[slot]))
+				|| (m_channel3D[slot] && m_backend.IsPlaying(m_channel3D[slot]));
+			if (!isPlaying)
+			{
+				if (!desc.loop)
+				{
+					m_retireScratch.push_back(slot);
+					continue;
+				}
+				// 루프인데 채널이 사라졌으면 가상으로 돌렸다가 다시 배정받는다
+				Demote(slot);
+			}
+		}
+
+		const uint32_t lengthMs = m_lengthMs[slot];
+		if (0 == lengthMs)
+		{
+			// 길이를 모르는 원샷은 실제 채널이 없으면 끝을 알 수 없으므로 한 번 순위에 든 뒤 정리한다
+			if (!desc.loop && !(m_flags[slot] & Flag_Real) && wasRanked)
+			{
+				m_retireScratch.push_back(slot);
+			}
+			continue;
+		}
+
+		if (m_elapsedMs[slot] >= static_cast<float>(lengthMs))
+		{
+			if (desc.loop)	m_elapsedMs[slot] = std::fmod(m_elapsedMs[slot], static_cast<float>(lengthMs));
+			else			m_retireScratch.push_back(slot);
+		}
+	}
+
+	for (uint32_t slot : m_retireScratch)
+	{
+		Release(slot);
+	}
+
+	// 2) 가청도를 계산해 버스별로 나누고, 들리지 않는 보이스는 가상으로 돌린다
+	std::array<uint32_t, MaxBuses> pausedReal{};
+	for (auto& bucket : m_rankScratch)
+	{
+		bucket.clear();
+	}
+
+	for (uint32_t slot : m_active)
+	{
+		const uint32_t bus = m_desc[slot].bus;
+		if (m_flags[slot] & Flag_Paused)
+		{
+			if (m_flags[slot] & Flag_Real) ++pausedReal[bus];
+			continue;
+		}
+
+		if (ComputeAudibility(slot) < InaudibleThreshold)
+		{
+			if (m_flags[slot] & Flag_Real) Demote(slot);
+			continue;
+		}
+
+		m_rankScratch[bus].push_back({ MakeRankKey(slot, m_buses[bus].rank), slot });
+	}
+
+	// 3) 버스별 상위 N 개만 실제 채널을 갖는다 (빼앗을 채널을 먼저 비우고 새로 붙인다)
+	for (uint32_t bus = 0; bus < MaxBuses; ++bus)
+	{
+		auto& bucket = m_rankScratch[bus];
+		if (bucket.empty()) continue;
+
+		const uint32_t limit = m_buses[bus].maxRealVoices;
+		size_t capacity = bucket.size();
+		if (0 != limit)
+		{
+			capacity = std::min<size_t>(capacity, limit - std::min(limit, pausedReal[bus]));
+		}
+
+		if (capacity < bucket.size())
+		{
+			std::nth_element(bucket.begin(), bucket.begin() + capacity, bucket.end(),
+				[](const RankEntry& lhs, const RankEntry& rhs) { return lhs.key > rhs.key; });
+
+			for (size_t i = capacity; i < bucket.size(); ++i)
+			{
+				if (m_flags[bucket[i].slot] & Flag_Real) Demote(bucket[i].slot);
+			}
+		}
+
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			if (!(m_flags[bucket[i].slot] & Flag_Real)) Promote(bucket[i].slot);
+		}
+	}
+}
+
+uint32_t VirtualVoiceSystem::GetRealCount() const
+{
+	uint32_t count = 0;
+	for (uint32_t realCount : m_realCount)
+	{
+		count += realCount;
+	}
+	return count;
+}
+
+bool VirtualVoiceSystem::Resolve(VoiceHandle handle, uint32_t& outSlot) const
+{
+	if (handle.index >= m_generation.size()) return false;
+	if (m_generation[handle.index] != handle.generation || !(m_flags[handle.index] & Flag_Active)) return false;
+
+	outSlot = handle.index;
+	return true;
+}
+
+uint32_t VirtualVoiceSystem::Allocate()
+{
+	if (!m_freeSlots.empty())
+	{
+		const uint32_t slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		return slot;
+	}
+
+	const uint32_t slot = static_cast<uint32_t>(m_generation.size());
+	m_generation.push_back(0);
+	m_flags.push_back(0);
+	m_activeIndex.push_back(0);
+	m_desc.emplace_back();
+	m_gain2D.push_back(0.f);
+	m_gain3D.push_back(0.f);
+	m_elapsedMs.push_back(0.f);
+	m_lengthMs.push_back(0);
+	m_sequence.push_back(0);
+	m_channel2D.push_back(0);
+	m_channel3D.push_back(0);
+	return slot;
+}
+
+void VirtualVoiceSystem::Release(uint32_t slot)
+{
+	if (m_flags[slot] & Flag_Real) Demote(slot);
+
+	const uint32_t index = m_activeIndex[slot];
+	const uint32_t last = m_active.back();
+	m_active[index] = last;
+	m_activeIndex[last] = index;
+	m_active.pop_back();
+
+	m_flags[slot] = 0;
+	m_desc[slot].ownerTag = nullptr;
+	++m_generation[slot];
+	m_freeSlots.push_back(slot);
+}
+
+float VirtualVoiceSystem::ComputeAudibility(uint32_t slot) const
+{
+	const VoiceDesc& desc = m_desc[slot];
+	float audible = m_gain2D[slot];
+
+	if (m_gain3D[slot] > 0.f)
+	{
+		const float dx = desc.position.x - m_listener.x;
+		const float dy = desc.position.y - m_listener.y;
+		const float dz = desc.position.z - m_listener.z;
+		const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+		const float minDistance = std::max(desc.minDistance, 1e-3f);
+		const float maxDistance = std::max(desc.maxDistance, minDistance);
+		const float attenuation = minDistance / std::clamp(distance, minDistance, maxDistance);
+		audible = std::max(audible, m_gain3D[slot] * attenuation);
+	}
+
+	return audible * m_buses[desc.bus].gain;
+}
+
+uint64_t VirtualVoiceSystem::MakeRankKey(uint32_t slot, VoiceRank rank) const
+{
+	float audible = ComputeAudibility(slot);
+	if (m_flags[slot] & Flag_Real) audible *= RealVoiceBias;
+
+	// 양수 float 는 비트 그대로 정수 비교해도 순서가 같다
+	const uint64_t audibleBits = std::bit_cast<uint32_t>(audible);
+	const uint64_t importance = 255 - static_cast<uint64_t>(std::clamp(m_desc[slot].priority, 0, 255));
+
+	switch (rank)
+	{
+	case VoiceRank::Age:		return m_sequence[slot];
+	case VoiceRank::Priority:	return (importance << 32) | audibleBits;
+	case VoiceRank::Audibility:
+	default:					return (audibleBits << 8) | importance;
+	}
+}
+
+bool VirtualVoiceSystem::Promote(uint32_t slot)
+{
+	const VoiceDesc& desc = m_desc[slot];
+
+	AudioStartParams params{};
+	params.clip = desc.clip;
+	params.bus = desc.bus;
+	params.pitch = desc.pitch;
+	params.priority = desc.priority;
+	params.loop = desc.loop;
+	params.position = desc.position;
+	params.velocity = desc.velocity;
+	params.minDistance = desc.minDistance;
+	params.maxDistance = desc.maxDistance;
+	params.startMs = static_cast<uint32_t>(m_elapsedMs[slot]);
+	params.userData = desc.ownerTag;
+
+	if (m_gain2D[slot] > MinChannelGain)
+	{
+		params.is3D = false;
+		params.volume = m_gain2D[slot];
+		m_channel2D[slot] = m_backend.Start(params);
+	}
+	if (m_gain3D[slot] > MinChannelGain)
+	{
+		params.is3D = true;
+		params.volume = m_gain3D[slot];
+		m_channel3D[slot] = m_backend.Start(params);
+	}
+
+	if (0 == m_channel2D[slot] && 0 == m_channel3D[slot]) return false;
+
+	m_flags[slot] |= Flag_Real;
+	++m_realCount[desc.bus];
+	return true;
+}
+
+void VirtualVoiceSystem::Demote(uint32_t slot)
+{
+	if (m_channel2D[slot]) m_backend.Stop(m_channel2D[slot]);
+	if (m_channel3D[slot]) m_backend.Stop(m_channel3D[slot]);
+	m_channel2D[slot] = 0;
+	m_channel3D[slot] = 0;
+
+	if (m_flags[slot] & Flag_Real)
+	{
+		m_flags[slot] &= ~Flag_Real;
+		--m_realCount[m_desc[slot].bus];
+	}
+}
+
+void VirtualVoiceSystem::PreemptSameClip(uint32_t bus, AudioClipId clip)
+{
+	uint32_t oldest = UINT32_MAX;
+	for (uint32_t slot : m_active)
+	{
+		if (!(m_flags[slot] & Flag_Real) || m_desc[slot].bus != bus || m_desc[slot].clip != clip) continue;
+		if (UINT32_MAX == oldest || m_sequence[slot] < m_sequence[oldest]) oldest = slot;
+	}
+
+	if (UINT32_MAX != oldest) Release(oldest);
+}
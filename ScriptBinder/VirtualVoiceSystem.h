@@ -0,0 +1,149 @@
+#pragma once
+#include "AudioBackend.h"
+#include <array>
+#include <unordered_map>
+
+struct VoiceHandle
+{
+	uint32_t index{ UINT32_MAX };
+	uint32_t generation{};
+
+	bool IsValid() const { return UINT32_MAX != index; }
+};
+
+struct VoiceDesc
+{
+	AudioClipId	clip{ InvalidAudioClip };
+	uint32_t	bus{};
+	float		volume{ 1.f };
+	float		pitch{ 1.f };
+	int			priority{ 128 };	// FMOD 과 같이 0 이 가장 중요
+	float		spatialBlend{};		// 0 = 2D, 1 = 3D, 중간은 2D/3D 두 채널 equal-power 블렌드
+	bool		loop{ false };
+	bool		is3D{ false };		// false 면 spatialBlend 를 무시하고 2D 로만 낸다
+	AudioVector	position{};
+	AudioVector	velocity{};
+	float		minDistance{ 1.f };
+	float		maxDistance{ 50.f };
+	void*		ownerTag{};
+};
+
+// 버스별 실제 채널 수가 모자랄 때 무엇부터 가상으로 돌릴지
+enum class VoiceRank : uint8_t
+{
+	Audibility,	// 가장 조용한 것부터
+	Age,		// 가장 오래된 것부터
+	Priority,	// priority 가 가장 낮은 것부터 (같으면 조용한 것부터)
+};
+
+// 가상 보이스: 재생 요청은 모두 가상 보이스로 받고, 버스마다 들리는 정도가 큰 상위 N 개에만 실제 채널을 붙인다
+// - 상태는 슬롯 인덱스로 접근하는 평평한 배열에 두고, 실제 채널에 상태를 묻지 않는다 (끝났는지 확인만 예외)
+// - 가상인 동안에도 재생 위치는 흘러가서, 다시 실제가 되면 그 위치부터 낸다
+// - 가청도 = 버스 볼륨 * max(2D 게인, 3D 게인 * 거리 감쇠) (FMOD inverse rolloff 와 같은 식)
+// - 게임 스레드 전용 (락 없음)
+class VirtualVoiceSystem
+{
+public:
+	static constexpr uint32_t MaxBuses = 8;
+	static constexpr uint32_t AllBuses = UINT32_MAX;
+	static constexpr float    InaudibleThreshold = 0.001f;
+	static constexpr uint32_t DefaultPoolCapacity = 8;
+	static constexpr float    RealVoiceBias = 1.1f;	// 이미 실제인 보이스에 주는 가산점 (경계에서 채널이 오가는 것을 막는다)
+
+	explicit VirtualVoiceSystem(IAudioBackend& backend);
+	~VirtualVoiceSystem();
+
+	// maxRealVoices 0 = 무제한 (들리지 않는 보이스만 가상으로 돈다)
+	void SetBusLimit(uint32_t bus, uint32_t maxRealVoices);
+	void SetBusRank(uint32_t bus, VoiceRank rank);
+	void SetBusPreemptSameClip(uint32_t bus, bool preempt);
+	void SetBusGain(uint32_t bus, float gain);
+	void SetListener(const AudioVector& position);
+
+	VoiceHandle Play(const VoiceDesc& desc);
+	// (클립, 버스)별 라운드로빈 풀: 풀이 차면 그 자리의 이전 보이스를 멈춘다
+	VoiceHandle PlayPooled(const VoiceDesc& desc);
+	void ConfigurePool(AudioClipId clip, uint32_t bus, uint32_t capacity);
+	void ClearPool(AudioClipId clip, uint32_t bus);
+
+	void Stop(VoiceHandle handle);
+	void StopByOwner(void* ownerTag, uint32_t bus = AllBuses);
+	void StopAll();
+
+	bool IsPlaying(VoiceHandle handle) const;
+	bool IsReal(VoiceHandle handle) const;
+	void SetPaused(VoiceHandle handle, bool paused);
+	void Set3DAttributes(VoiceHandle handle, const AudioVector& position, const AudioVector& velocity);
+	// 2D/3D 채널 볼륨을 직접 지정한다 (SoundComponent 의 커스텀 감쇠)
+	void SetGains(VoiceHandle handle, float gain2D, float gain3D);
+	AudioChannelId GetChannel(VoiceHandle handle, bool is3D) const;
+
+	// 재생 위치 진행 -> 끝난 보이스 정리 -> 버스별 순위를 매겨 실제 채널 재배정
+	void Update(float deltaSeconds);
+
+	uint32_t GetActiveCount() const { return static_cast<uint32_t>(m_active.size()); }
+	uint32_t GetRealCount() const;
+
+private:
+	enum VoiceFlags : uint8_t
+	{
+		Flag_Active = 1 << 0,
+		Flag_Real	= 1 << 1,
+		Flag_Paused	= 1 << 2,
+	};
+
+	struct BusConfig
+	{
+		uint32_t	maxRealVoices{};
+		VoiceRank	rank{ VoiceRank::Audibility };
+		bool		preemptSameClip{ false };
+		float		gain{ 1.f };
+	};
+
+	struct Pool
+	{
+		uint32_t					cursor{};
+		std::vector<VoiceHandle>	slots;
+	};
+
+	struct RankEntry
+	{
+		uint64_t key{};	// 클수록 먼저 실제 채널을 받는다
+		uint32_t slot{};
+	};
+
+	bool Resolve(VoiceHandle handle, uint32_t& outSlot) const;
+	uint32_t Allocate();
+	void Release(uint32_t slot);
+	float ComputeAudibility(uint32_t slot) const;
+	uint64_t MakeRankKey(uint32_t slot, VoiceRank rank) const;
+	bool Promote(uint32_t slot);
+	void Demote(uint32_t slot);
+	void PreemptSameClip(uint32_t bus, AudioClipId clip);
+	static uint64_t PoolKey(AudioClipId clip, uint32_t bus) { return (static_cast<uint64_t>(clip) << 8) | bus; }
+
+	IAudioBackend&					m_backend;
+	std::array<BusConfig, MaxBuses>	m_buses{};
+	std::array<uint32_t, MaxBuses>	m_realCount{};
+	AudioVector						m_listener{};
+
+	// 슬롯별 상태 (SoA)
+	std::vector<uint32_t>			m_generation;
+	std::vector<uint8_t>			m_flags;
+	std::vector<uint32_t>			m_activeIndex;	// m_active 안에서의 위치
+	std::vector<VoiceDesc>			m_desc;
+	std::vector<float>				m_gain2D;
+	std::vector<float>				m_gain3D;
+	std::vector<float>				m_elapsedMs;
+	std::vector<uint32_t>			m_lengthMs;
+	std::vector<uint32_t>			m_sequence;		// 재생 요청 순서 (Age 순위용)
+	std::vector<AudioChannelId>		m_channel2D;
+	std::vector<AudioChannelId>		m_channel3D;
+
+	std::vector<uint32_t>			m_active;
+	std::vector<uint32_t>			m_freeSlots;
+	std::array<std::vector<RankEntry>, MaxBuses> m_rankScratch;
+	std::vector<uint32_t>			m_retireScratch;
+	std::unordered_map<uint64_t, Pool> m_pools;
+	uint32_t						m_nextSequence{};
+};
@@ -2,6 +2,7 @@
 #include "SceneManager.h"
 #include "DataSystem.h"
 #include "EngineSetting.h"
+#include "Core.PakFileSystem.h"
 
 void VolumeComponent::Awake()
 {
@@ -13,9 +14,10 @@ void VolumeComponent::Awake()
             return;
 
         file::path path = DataSystems->GetFilePath(m_volumeProfileGuid);
-        if (!path.empty() && file::exists(path))
+        if (!path.empty() && PakFileSystems->Exists(path))
         {
-            MetaYml::Node node = MetaYml::LoadFile(path.string());
+            AssetStream profileFile(path);
+            MetaYml::Node node = MetaYml::Load(profileFile);
             if (node["settings"])
             {
                 Meta::Deserialize(&m_profile.settings, node["settings"]);
@@ -45,9 +47,10 @@ void VolumeComponent::LoadProfile(FileGuid profileGuid)
         return;
     m_volumeProfileGuid = profileGuid;
     file::path path = DataSystems->GetFilePath(m_volumeProfileGuid);
-    if (!path.empty() && file::exists(path))
+    if (!path.empty() && PakFileSystems->Exists(path))
     {
-        MetaYml::Node node = MetaYml::LoadFile(path.string());
+        AssetStream profileFile(path);
+        MetaYml::Node node = MetaYml::Load(profileFile);
         if (node["settings"])
         {
             Meta::Deserialize(&m_profile.settings, node["settings"]);
@@ -0,0 +1,331 @@
+#include "HeadlessBench.h"
+#include "BTHeader.h"
+
+#include <new>
+
+namespace
+{
+	constexpr int Repeat = 20;
+	constexpr size_t AgentCount = 500;
+	constexpr size_t FillerKeyCount = 20;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	// 몬스터 BT 가 틱마다 읽고 쓰는 키 (IsDaed, IsChase, ChaseAction, IsAtteck, AtteckAction, Idle)
+	const std::string IdentityName = "Identity";
+	const std::string StateName = "State";
+	const std::string CurrHPName = "CurrHP";
+	const std::string ChaseRangeName = "ChaseRange";
+	const std::string ChaseOutTimeName = "ChaseOutTime";
+	const std::string AtkRangeName = "AtkRange";
+	const std::string DistanceName = "TargetDistance";
+	const std::string IsAttackingName = "IsAttacking";
+
+	void FillBlackBoard(BlackBoard& blackBoard, size_t agent)
+	{
+		// 실제 .blackboard 파일처럼 자주 쓰는 키가 뒤쪽 슬롯에 섞여 있게 넣는다
+		for (size_t i = 0; i < FillerKeyCount; ++i)
+		{
+			blackBoard.SetValueAsFloat("Filler_" + std::to_string(i), static_cast<float>(i));
+		}
+		blackBoard.SetValueAsString(IdentityName, "MonsterNormal");
+		blackBoard.SetValueAsString(StateName, "Idle");
+		blackBoard.SetValueAsInt(CurrHPName, agent % 50 == 0 ? 0 : 100);
+		blackBoard.SetValueAsFloat(ChaseRangeName, 8.f);
+		blackBoard.SetValueAsFloat(ChaseOutTimeName, 0.f);
+		blackBoard.SetValueAsFloat(AtkRangeName, 2.f);
+		// 에이전트마다 거리를 달리 해 틱마다 공격/추적/대기 가지가 섞이게 한다
+		blackBoard.SetValueAsFloat(DistanceName, static_cast<float>(agent % 12));
+		blackBoard.SetValueAsBool(IsAttackingName, false);
+	}
+
+	// Key 가 std::string 이면 틱마다 이름으로 찾고, BlackBoardKey 면 ResolveKeys 에서 찾아 둔 슬롯을 쓴다
+	template<typename Key>
+	void ResolveKey(const Key& key, const BlackBoard& blackBoard)
+	{
+		if constexpr (std::is_same_v<Key, BlackBoardKey>)
+		{
+			key.Resolve(blackBoard);
+		}
+	}
+
+	template<typename Key>
+	class BenchIsDaed : public BT::ConditionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override { ResolveKey(m_currHPKey, blackBoard); }
+		bool ConditionCheck(float, const BlackBoard& blackBoard) override
+		{
+			return blackBoard.HasKey(m_currHPKey) && blackBoard.GetValueAsInt(m_currHPKey) <= 0;
+		}
+
+	private:
+		Key m_currHPKey{ CurrHPName };
+	};
+
+	template<typename Key>
+	class BenchDaedAction : public BT::ActionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override { ResolveKey(m_stateKey, blackBoard); }
+		NodeStatus Tick(float, BlackBoard& blackBoard) override
+		{
+			blackBoard.SetValueAsString(m_stateKey, "Dead");
+			return NodeStatus::Success;
+		}
+
+	private:
+		Key m_stateKey{ StateName };
+	};
+
+	template<typename Key>
+	class BenchIsAtteck : public BT::ConditionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override
+		{
+			ResolveKey(m_identityKey, blackBoard);
+			ResolveKey(m_atkRangeKey, blackBoard);
+			ResolveKey(m_distanceKey, blackBoard);
+		}
+		bool ConditionCheck(float, const BlackBoard& blackBoard) override
+		{
+			if (!blackBoard.HasKey(m_identityKey) || blackBoard.GetValueAsString(m_identityKey).empty())
+			{
+				return false;
+			}
+			return blackBoard.GetValueAsFloat(m_distanceKey) <= blackBoard.GetValueAsFloat(m_atkRangeKey);
+		}
+
+	private:
+		Key m_identityKey{ IdentityName };
+		Key m_atkRangeKey{ AtkRangeName };
+		Key m_distanceKey{ DistanceName };
+	};
+
+	template<typename Key>
+	class BenchAtteckAction : public BT::ActionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override
+		{
+			ResolveKey(m_stateKey, blackBoard);
+			ResolveKey(m_isAttackingKey, blackBoard);
+		}
+		NodeStatus Tick(float, BlackBoard& blackBoard) override
+		{
+			blackBoard.SetValueAsString(m_stateKey, "Atteck");
+			blackBoard.SetValueAsBool(m_isAttackingKey, !blackBoard.GetValueAsBool(m_isAttackingKey));
+			return NodeStatus::Success;
+		}
+
+	private:
+		Key m_stateKey{ StateName };
+		Key m_isAttackingKey{ IsAttackingName };
+	};
+
+	template<typename Key>
+	class BenchIsChase : public BT::ConditionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override
+		{
+			ResolveKey(m_stateKey, blackBoard);
+			ResolveKey(m_chaseRangeKey, blackBoard);
+			ResolveKey(m_chaseOutTimeKey, blackBoard);
+			ResolveKey(m_distanceKey, blackBoard);
+		}
+		bool ConditionCheck(float, const BlackBoard& blackBoard) override
+		{
+			if (blackBoard.GetValueAsString(m_stateKey) == "Chase" && blackBoard.GetValueAsFloat(m_chaseOutTimeKey) > 0.f)
+			{
+				return true;
+			}
+			return blackBoard.HasKey(m_chaseRangeKey)
+				&& blackBoard.GetValueAsFloat(m_distanceKey) <= blackBoard.GetValueAsFloat(m_chaseRangeKey);
+		}
+
+	private:
+		Key m_stateKey{ StateName };
+		Key m_chaseRangeKey{ ChaseRangeName };
+		Key m_chaseOutTimeKey{ ChaseOutTimeName };
+		Key m_distanceKey{ DistanceName };
+	};
+
+	template<typename Key>
+	class BenchChaseAction : public BT::ActionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override
+		{
+			ResolveKey(m_stateKey, blackBoard);
+			ResolveKey(m_chaseOutTimeKey, blackBoard);
+		}
+		NodeStatus Tick(float deltatime, BlackBoard& blackBoard) override
+		{
+			blackBoard.SetValueAsString(m_stateKey, "Chase");
+			const float chaseOutTime = blackBoard.GetValueAsFloat(m_chaseOutTimeKey);
+			blackBoard.SetValueAsFloat(m_chaseOutTimeKey, chaseOutTime > 0.f ? chaseOutTime - deltatime : 1.f);
+			return NodeStatus::Success;
+		}
+
+	private:
+		Key m_stateKey{ StateName };
+		Key m_chaseOutTimeKey{ ChaseOutTimeName };
+	};
+
+	template<typename Key>
+	class BenchIdle : public BT::ActionNode
+	{
+	public:
+		void ResolveKeys(const BlackBoard& blackBoard) override
+		{
+			ResolveKey(m_identityKey, blackBoard);
+			ResolveKey(m_stateKey, blackBoard);
+		}
+		NodeStatus Tick(float, BlackBoard& blackBoard) override
+		{
+			if (blackBoard.GetValueAsString(m_identityKey).empty())
+			{
+				return NodeStatus::Failure;
+			}
+			blackBoard.SetValueAsString(m_stateKey, "Idle");
+			return NodeStatus::Success;
+		}
+
+	private:
+		Key m_identityKey{ IdentityName };
+		Key m_stateKey{ StateName };
+	};
+
+	// BehaviorTreeComponent::BuildTreeRecursively 처럼 노드를 만들 때마다 ResolveKeys 를 부른다
+	template<typename Node>
+	BT::BTNode::NodePtr BuildNode(const BlackBoard& blackBoard)
+	{
+		auto node = std::make_shared<Node>();
+		node->ResolveKeys(blackBoard);
+		return node;
+	}
+
+	template<typename Condition, typename Action>
+	BT::BTNode::NodePtr BuildBranch(const BlackBoard& blackBoard)
+	{
+		auto sequence = std::make_shared<BT::SequenceNode>("Sequence");
+		sequence->AddChild(BuildNode<Condition>(blackBoard));
+		sequence->AddChild(BuildNode<Action>(blackBoard));
+		return sequence;
+	}
+
+	// 일반 몬스터 트리: Selector(사망 -> 공격 -> 추적 -> 대기)
+	template<typename Key>
+	BT::BTNode::NodePtr BuildMonsterTree(const BlackBoard& blackBoard)
+	{
+		auto root = std::make_shared<BT::SelectorNode>("Root");
+		root->AddChild(BuildBranch<BenchIsDaed<Key>, BenchDaedAction<Key>>(blackBoard));
+		root->AddChild(BuildBranch<BenchIsAtteck<Key>, BenchAtteckAction<Key>>(blackBoard));
+		root->AddChild(BuildBranch<BenchIsChase<Key>, BenchChaseAction<Key>>(blackBoard));
+		root->AddChild(BuildNode<BenchIdle<Key>>(blackBoard));
+		return root;
+	}
+
+	template<typename Key>
+	std::vector<BT::BTNode::NodePtr> BuildTrees(std::vector<BlackBoard>& blackBoards)
+	{
+		std::vector<BT::BTNode::NodePtr> trees;
+		trees.reserve(blackBoards.size());
+		for (const BlackBoard& blackBoard : blackBoards)
+		{
+			trees.push_back(BuildMonsterTree<Key>(blackBoard));
+		}
+		return trees;
+	}
+
+	void TickTrees(std::vector<BT::BTNode::NodePtr>& trees, std::vector<BlackBoard>& blackBoards)
+	{
+		for (size_t agent = 0; agent < trees.size(); ++agent)
+		{
+			trees[agent]->Tick(DeltaTime, blackBoards[agent]);
+		}
+	}
+
+	std::vector<BlackBoard> MakeBlackBoards()
+	{
+		std::vector<BlackBoard> blackBoards(AgentCount);
+		for (size_t agent = 0; agent < AgentCount; ++agent)
+		{
+			FillBlackBoard(blackBoards[agent], agent);
+		}
+		return blackBoards;
+	}
+
+	// 두 트리가 같은 상태로 끝났는지 (키 방식만 다르고 로직은 같다)
+	bool SameState(const std::vector<BlackBoard>& lhs, const std::vector<BlackBoard>& rhs)
+	{
+		for (size_t agent = 0; agent < lhs.size(); ++agent)
+		{
+			if (lhs[agent].GetValueAsString(StateName) != rhs[agent].GetValueAsString(StateName)
+				|| lhs[agent].GetValueAsFloat(ChaseOutTimeName) != rhs[agent].GetValueAsFloat(ChaseOutTimeName)
+				|| lhs[agent].GetValueAsBool(IsAttackingName) != rhs[agent].GetValueAsBool(IsAttackingName))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void GameBuilder::BlackBoardBench(BenchReport& report)
+{
+	std::vector<BlackBoard> stringBoards = MakeBlackBoards();
+	std::vector<BlackBoard> slotBoards = MakeBlackBoards();
+	std::vector<BT::BTNode::NodePtr> stringTrees = BuildTrees<std::string>(stringBoards);
+	std::vector<BT::BTNode::NodePtr> slotTrees = BuildTrees<BlackBoardKey>(slotBoards);
+
+	// 틱 하나 = 에이전트 하나의 트리 전체 (Selector 가 고른 가지까지 노드 Tick 이 돈다)
+	const std::string suffix = " " + std::to_string(AgentCount);
+	report.Measure("blackboard/string_key_bt_tick" + suffix, AgentCount, Repeat, [&]
+	{
+		TickTrees(stringTrees, stringBoards);
+	});
+	report.Measure("blackboard/slot_key_bt_tick" + suffix, AgentCount, Repeat, [&]
+	{
+		TickTrees(slotTrees, slotBoards);
+	});
+	report.Check(SameState(stringBoards, slotBoards), "blackboard/slot_tree_matches_string_tree");
+
+	// 에디터/핫 리로드로 슬롯 배치가 바뀐 직후 첫 틱 (노드 키마다 이름으로 다시 찾는다)
+	for (size_t agent = 0; agent < AgentCount; ++agent)
+	{
+		stringBoards[agent].RemoveKey("Filler_0");
+		slotBoards[agent].RemoveKey("Filler_0");
+	}
+	report.Measure("blackboard/slot_key_bt_tick_after_relayout" + suffix, AgentCount, 1, [&]
+	{
+		TickTrees(slotTrees, slotBoards);
+	});
+	TickTrees(stringTrees, stringBoards);
+	// RemoveKey 는 마지막 슬롯을 빈자리로 옮기므로, 옮겨진 키로 돌린 트리도 같은 결과여야 한다
+	report.Check(SameState(stringBoards, slotBoards), "blackboard/key_follows_swap_remove");
+
+	BlackBoard& first = slotBoards.front();
+	BlackBoardKey distance{ DistanceName };
+	distance.Resolve(first);
+	first.RenameKey(DistanceName, "TargetDistance2");
+	report.Check(!first.HasKey(distance), "blackboard/key_invalid_after_rename");
+	first.RenameKey("TargetDistance2", DistanceName);
+	report.Check(first.HasKey(distance) && first.GetValueAsFloat(distance) == 0.f,
+		"blackboard/key_valid_after_rename_back");
+
+	// 같은 주소에 새 블랙보드를 만들어도 (ABA) 예전 블랙보드의 슬롯을 쓰면 안 된다
+	alignas(BlackBoard) unsigned char storage[sizeof(BlackBoard)];
+	BlackBoard* before = new (storage) BlackBoard();
+	before->SetValueAsFloat("A", 1.f);
+	before->SetValueAsFloat(DistanceName, 2.f);
+	BlackBoardKey reused{ DistanceName };
+	reused.Resolve(*before);
+	before->~BlackBoard();
+	BlackBoard* after = new (storage) BlackBoard();
+	after->SetValueAsFloat(DistanceName, 3.f);
+	after->SetValueAsFloat("A", 4.f);
+	report.Check(after->GetValueAsFloat(reused) == 3.f, "blackboard/key_not_reused_across_blackboards");
+	after->~BlackBoard();
+}
@@ -0,0 +1,174 @@
+#include "HeadlessBench.h"
+#include "Physx.h"
+#include "ContactEventBuffer.h"
+
+#include <array>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr uint32_t PairCount = 25'000;	// 두 방향이라 스텝당 이벤트 50k
+	constexpr uint32_t PointsPerPair = 4;
+	constexpr uint32_t StackColumns = 10;
+	constexpr uint32_t StackHeight = 10;
+	constexpr int StepCount = 60;
+	constexpr float FixedDeltaTime = 1.f / 60.f;
+	// 로드된 씬의 콜라이더 ID 와 겹치지 않게 높은 번호를 쓴다
+	constexpr unsigned int BaseId = 0x50000000u;
+
+	using Vector3 = DirectX::SimpleMath::Vector3;
+
+	// 예전 PhysicsManager::m_callbacks 항목 (이벤트마다 접점 벡터를 따로 할당)
+	struct LegacyCallbackInfo
+	{
+		CollisionData		data;
+		ECollisionEventType	type;
+	};
+
+	void RunRecord(GameBuilder::BenchReport& report)
+	{
+		const std::string suffix = " " + std::to_string(PairCount * 2);
+		std::array<Vector3, PointsPerPair> points{};
+		for (uint32_t i = 0; i < PointsPerPair; ++i)
+		{
+			points[i] = { static_cast<float>(i), 0.f, 0.f };
+		}
+
+		// 한 스텝 분량을 기록한다. 바깥 벡터는 예전처럼 clear 로 용량을 남긴다
+		std::vector<LegacyCallbackInfo> legacy;
+		report.Measure("contact_events/legacy_record" + suffix, PairCount * 2, Repeat, [&]
+		{
+			legacy.clear();
+			for (uint32_t pair = 0; pair < PairCount; ++pair)
+			{
+				CollisionData first;
+				first.thisId = pair * 2;
+				first.otherId = pair * 2 + 1;
+				first.contactPoints.assign(points.begin(), points.end());
+				CollisionData second = first;
+				std::swap(second.thisId, second.otherId);
+
+				legacy.push_back({ std::move(first), ECollisionEventType::ON_COLLISION });
+				legacy.push_back({ std::move(second), ECollisionEventType::ON_COLLISION });
+			}
+		});
+
+		ContactEventBuffer buffer;
+		report.Measure("contact_events/soa_record" + suffix, PairCount * 2, Repeat, [&]
+		{
+			buffer.Clear();
+			for (uint32_t pair = 0; pair < PairCount; ++pair)
+			{
+				const uint32_t offset = buffer.AppendPoints(points.data(), PointsPerPair);
+				buffer.Push(pair * 2, pair * 2 + 1, 0, 0, ECollisionEventType::ON_COLLISION, offset, PointsPerPair, { 0.f, 1.f, 0.f }, 1.f);
+				buffer.Push(pair * 2 + 1, pair * 2, 0, 0, ECollisionEventType::ON_COLLISION, offset, PointsPerPair, { 0.f, -1.f, 0.f }, 1.f);
+			}
+		});
+		report.Check(buffer.Size() == legacy.size() && buffer.points.size() == PairCount * PointsPerPair,
+			"contact_events/pair_directions_share_points");
+
+		// 디스패치 쪽이 이벤트마다 하는 일: 종류/쌍을 읽고 접점 구간을 훑는다
+		float legacySum{};
+		report.Measure("contact_events/legacy_drain" + suffix, PairCount * 2, Repeat, [&]
+		{
+			for (const LegacyCallbackInfo& info : legacy)
+			{
+				for (const Vector3& point : info.data.contactPoints)
+				{
+					legacySum += point.x + static_cast<float>(info.data.otherId & 1);
+				}
+			}
+		});
+		float soaSum{};
+		report.Measure("contact_events/soa_drain" + suffix, PairCount * 2, Repeat, [&]
+		{
+			const uint32_t eventCount = static_cast<uint32_t>(buffer.Size());
+			for (uint32_t i = 0; i < eventCount; ++i)
+			{
+				const Vector3* begin = buffer.points.data() + buffer.pointOffsets[i];
+				for (uint32_t p = 0; p < buffer.pointCounts[i]; ++p)
+				{
+					soaSum += begin[p].x + static_cast<float>(buffer.otherIds[i] & 1);
+				}
+			}
+		});
+		report.Check(legacySum == soaSum, "contact_events/soa_drain_matches_legacy");
+	}
+
+	// 실제 PhysX 스텝: 바닥 위에 쌓인 박스 기둥들이 매 스텝 접점을 만든다
+	void RunLive(GameBuilder::BenchReport& report)
+	{
+		BoxColliderInfo ground{};
+		ground.colliderInfo.id = BaseId;
+		ground.colliderInfo.collsionTransform.worldPosition = { 0.f, -0.5f, 0.f };
+		ground.colliderInfo.collsionTransform.worldRotation = DirectX::SimpleMath::Quaternion::Identity;
+		ground.colliderInfo.collsionTransform.worldScale = { 1.f, 1.f, 1.f };
+		ground.boxExtent = { 50.f, 0.5f, 50.f };
+		Physics->CreateStaticBody(ground, EColliderType::COLLISION);
+
+		uint32_t bodyCount = 0;
+		for (uint32_t column = 0; column < StackColumns * StackColumns; ++column)
+		{
+			for (uint32_t level = 0; level < StackHeight; ++level)
+			{
+				BoxColliderInfo info{};
+				info.colliderInfo.id = BaseId + 1 + bodyCount++;
+				info.colliderInfo.collsionTransform.worldPosition = {
+					static_cast<float>(column % StackColumns) * 3.f - 15.f,
+					0.5f + static_cast<float>(level),
+					static_cast<float>(column / StackColumns) * 3.f - 15.f };
+				info.colliderInfo.collsionTransform.worldRotation = DirectX::SimpleMath::Quaternion::Identity;
+				info.colliderInfo.collsionTransform.worldScale = { 1.f, 1.f, 1.f };
+				info.boxExtent = { 0.5f, 0.5f, 0.5f };
+				Physics->CreateDynamicBody(info, EColliderType::COLLISION, false);
+			}
+		}
+
+		// PhysicsManager 의 버퍼 대신 벤치 버퍼에 기록하게 잠깐 바꾼다
+		ContactEventBuffer* managerBuffer = Physics->GetContactEventBuffer();
+		ContactEventBuffer buffer;
+		Physics->SetContactEventBuffer(&buffer);
+		Physics->Update(FixedDeltaTime);
+		buffer.Clear();
+
+		size_t maxEvents{};
+		bool rangesValid = true;
+		bool pairsMirrored = true;
+		report.Measure("contact_events/live_step " + std::to_string(bodyCount) + " bodies", StepCount, 1, [&]
+		{
+			for (int step = 0; step < StepCount; ++step)
+			{
+				Physics->Update(FixedDeltaTime);
+				maxEvents = (std::max)(maxEvents, buffer.Size());
+
+				// 두 방향 이벤트는 연달아 들어오고 같은 접점 구간을 가리킨다
+				for (size_t i = 0; i < buffer.Size(); ++i)
+				{
+					rangesValid &= buffer.pointOffsets[i] + buffer.pointCounts[i] <= buffer.points.size();
+				}
+				for (size_t i = 0; i + 1 < buffer.Size(); i += 2)
+				{
+					pairsMirrored &= buffer.thisIds[i] == buffer.otherIds[i + 1] && buffer.otherIds[i] == buffer.thisIds[i + 1]
+						&& buffer.pointOffsets[i] == buffer.pointOffsets[i + 1];
+				}
+				buffer.Clear();
+			}
+		});
+
+		Physics->SetContactEventBuffer(managerBuffer);
+		report.Check(0 != maxEvents, "contact_events/live_step_records_events");
+		report.Check(rangesValid && pairsMirrored, "contact_events/live_pairs_share_point_range");
+
+		for (uint32_t i = 0; i <= bodyCount; ++i)
+		{
+			Physics->DestroyActor(BaseId + i);
+		}
+		Physics->Update(FixedDeltaTime);
+	}
+}
+
+void GameBuilder::ContactEventBench(BenchReport& report)
+{
+	RunRecord(report);
+	RunLive(report);
+}
@@ -0,0 +1,217 @@
+#include "HeadlessBench.h"
+#include "CharacterControllerBackend.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <random>
+
+namespace
+{
+	using Vector3 = DirectX::SimpleMath::Vector3;
+
+	constexpr uint32_t ControllerCount = 256;
+	constexpr unsigned int BaseId = 100;
+	constexpr float FixedDeltaTime = 1.f / 60.f;
+
+	struct ControllerState
+	{
+		Vector3	input;
+		Vector3	velocity;
+		float	maxSpeed{};
+		float	acceleration{};
+		bool	isDynamic{};
+		bool	isFall{};
+		uint8_t	restrictMask{};
+	};
+
+	struct ReferenceStep
+	{
+		Vector3 velocity;	// 읽기 결과 속도 (제한 전 출력 벡터)
+		Vector3 move;		// 이번 스텝 변위 (이동 제한 적용)
+	};
+
+	// CharacterMovement::Update + CharacterController::ComputeMove 를 마찰/점프 가속/중력이 0 인 기본값으로 풀어 쓴 기준값.
+	// 가속은 deltaTime 에 비례하므로 백엔드가 스텝 길이를 틀리게 쓰면 값이 어긋난다
+	ReferenceStep Reference(const ControllerState& state, float deltaTime)
+	{
+		Vector3 velocity = state.velocity;
+		if (!state.isFall)
+		{
+			velocity.x += state.input.x * state.acceleration * deltaTime;
+			velocity.z += state.input.z * state.acceleration * deltaTime;
+			if (state.input.y != 0.f)
+			{
+				velocity.y = state.input.y; // 점프
+			}
+		}
+
+		const float planar = std::sqrt(velocity.x * velocity.x + velocity.z * velocity.z);
+		const float speed = std::min(planar, state.maxSpeed);
+		Vector3 out{ 0.f, velocity.y, 0.f };
+		if (planar >= 0.001f)
+		{
+			out.x = velocity.x / planar * speed;
+			out.z = velocity.z / planar * speed;
+		}
+
+		auto isRestricted = [&](ERestrictDirection direction)
+		{
+			return 0 != (state.restrictMask & (1u << static_cast<int>(direction)));
+		};
+		Vector3 move = out;
+		if (move.x < 0.f && isRestricted(ERestrictDirection::MINUS_X)) move.x = 0.f;
+		else if (move.x > 0.f && isRestricted(ERestrictDirection::PlUS_X)) move.x = 0.f;
+		if (move.z < 0.f && isRestricted(ERestrictDirection::MINUS_Z)) move.z = 0.f;
+		else if (move.z > 0.f && isRestricted(ERestrictDirection::PLUS_Z)) move.z = 0.f;
+		return { out, move };
+	}
+
+	void Add(ControllerUploadBatch& batch, unsigned int id, const Vector3& position, const ControllerState& state)
+	{
+		batch.ids.push_back(id);
+		batch.positions.push_back(position);
+		batch.layers.push_back(UINT_MAX);
+		batch.inputs.push_back(state.input);
+		batch.isDynamic.push_back(state.isDynamic ? 1 : 0);
+		batch.velocities.push_back(state.velocity);
+		batch.maxSpeeds.push_back(state.maxSpeed);
+		batch.accelerations.push_back(state.acceleration);
+		batch.isFall.push_back(state.isFall ? 1 : 0);
+		batch.restricts.push_back(state.restrictMask);
+	}
+
+	ControllerState StateAt(const ControllerUploadBatch& batch, size_t index)
+	{
+		return { batch.inputs[index], batch.velocities[index], batch.maxSpeeds[index], batch.accelerations[index],
+			0 != batch.isDynamic[index], 0 != batch.isFall[index], batch.restricts[index] };
+	}
+
+	ControllerUploadBatch MakeBatch(std::mt19937& random, uint32_t count, float deltaTime)
+	{
+		std::uniform_real_distribution<float> position(-50.f, 50.f);
+		std::uniform_real_distribution<float> axis(-1.f, 1.f);
+		std::uniform_real_distribution<float> velocity(-6.f, 6.f);
+		std::uniform_real_distribution<float> speed(1.f, 8.f);
+		std::uniform_real_distribution<float> acceleration(10.f, 200.f);
+		std::uniform_int_distribution<int> restrictMask(0, 15);
+		std::uniform_int_distribution<int> coin(0, 3);
+
+		ControllerUploadBatch batch;
+		batch.deltaTime = deltaTime;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			ControllerState state;
+			// y 입력은 점프 속도다. 네 번에 한 번만 점프하고 네 번에 한 번은 떨어지는 중이다
+			state.input = { axis(random), 0 == coin(random) ? 5.f : 0.f, axis(random) };
+			state.velocity = { velocity(random), 0.f, velocity(random) };
+			state.maxSpeed = speed(random);
+			state.acceleration = acceleration(random);
+			state.isDynamic = 0 == coin(random);
+			state.isFall = 0 == coin(random);
+			state.restrictMask = static_cast<uint8_t>(restrictMask(random));
+			Add(batch, BaseId + i, { position(random), 0.f, position(random) }, state);
+		}
+		return batch;
+	}
+
+	bool NearEqual(const Vector3& a, const Vector3& b)
+	{
+		return (a - b).LengthSquared() < 1e-8f;
+	}
+
+	// 읽은 결과가 제출한 항목마다 기준값과 같은지 본다
+	bool MatchesReference(const ControllerUploadBatch& batch, const ControllerReadbackBatch& readback, const std::vector<uint32_t>& slots)
+	{
+		bool passed = true;
+		for (size_t i = 0; i < batch.Size(); ++i)
+		{
+			const uint32_t slot = slots[i];
+			const ReferenceStep step = Reference(StateAt(batch, i), batch.deltaTime);
+			passed &= readback.ids[slot] == batch.ids[i];
+			passed &= NearEqual(readback.velocities[slot], step.velocity);
+			passed &= NearEqual(readback.positions[slot], batch.positions[i] + step.move);
+		}
+		return passed;
+	}
+}
+
+void GameBuilder::ControllerCheck(BenchReport& report)
+{
+	std::mt19937 random(23);
+	NullCharacterControllerBackend backend;
+	ControllerReadbackBatch readback;
+
+	// 첫 스텝: 제출한 순서대로 슬롯이 잡히고 결과도 그 순서로 읽힌다
+	const ControllerUploadBatch first = MakeBatch(random, ControllerCount, FixedDeltaTime);
+	backend.Submit(first);
+	backend.Read(readback);
+
+	std::vector<uint32_t> slots(ControllerCount);
+	for (uint32_t i = 0; i < ControllerCount; ++i)
+	{
+		slots[i] = i;
+	}
+	bool noneFalling = std::all_of(readback.isFall.begin(), readback.isFall.end(), [](uint8_t isFall) { return 0 == isFall; });
+	report.Check(ControllerCount == readback.Size() && MatchesReference(first, readback, slots), "controller/batch_matches_per_controller_move");
+	report.Check(noneFalling, "controller/null_backend_never_falls");
+
+	// 둘째 스텝: 절반만 거꾸로 다시 제출하고 새 컨트롤러 하나를 더한다
+	// 고정 스텝 길이가 바뀐 경우도 본다
+	ControllerUploadBatch second;
+	second.deltaTime = FixedDeltaTime * 2.f;
+	std::vector<uint32_t> secondSlots;
+	const ControllerUploadBatch moved = MakeBatch(random, ControllerCount, second.deltaTime);
+	for (uint32_t i = ControllerCount; i > 0; i -= 2)
+	{
+		const uint32_t index = i - 1;
+		Add(second, moved.ids[index], moved.positions[index], StateAt(moved, index));
+		secondSlots.push_back(index);
+	}
+	ControllerState added;
+	added.input = { 1.f, 0.f, 0.f };
+	added.maxSpeed = 2.f;
+	added.acceleration = 30.f;
+	Add(second, BaseId + ControllerCount, { 1.f, 0.f, 1.f }, added);
+	secondSlots.push_back(ControllerCount);
+
+	const ControllerReadbackBatch before = readback;
+	backend.Submit(second);
+	backend.Read(readback);
+
+	bool untouchedKept = true;
+	for (uint32_t i = 0; i < ControllerCount; i += 2)
+	{
+		untouchedKept &= readback.ids[i] == before.ids[i] && NearEqual(readback.positions[i], before.positions[i]);
+	}
+	report.Check(ControllerCount + 1 == readback.Size() && MatchesReference(second, readback, secondSlots), "controller/resubmit_updates_in_place");
+	report.Check(untouchedKept, "controller/unsubmitted_results_kept");
+
+	// 빈 제출은 결과를 바꾸지 않고, Clear 뒤에는 읽을 것이 없다
+	const ControllerReadbackBatch afterSecond = readback;
+	backend.Submit(ControllerUploadBatch{});
+	backend.Read(readback);
+	report.Check(readback.ids == afterSecond.ids && 3 == backend.GetSubmitCount(), "controller/empty_submit_keeps_results");
+
+	// 정지 상태에서 최대 속도에 못 미치게 가속하면 변위는 스텝 길이에 정비례한다
+	ControllerState accelerating;
+	accelerating.input = { 1.f, 0.f, 0.f };
+	accelerating.maxSpeed = 100.f;
+	accelerating.acceleration = 60.f;
+	ControllerUploadBatch shortStep;
+	shortStep.deltaTime = FixedDeltaTime;
+	Add(shortStep, BaseId, {}, accelerating);
+	ControllerUploadBatch longStep = shortStep;
+	longStep.deltaTime = FixedDeltaTime * 2.f;
+	backend.Submit(shortStep);
+	backend.Read(readback);
+	const float shortMove = readback.positions[0].x;
+	backend.Submit(longStep);
+	backend.Read(readback);
+	const float longMove = readback.positions[0].x;
+	report.Check(shortMove > 0.f && std::abs(longMove - 2.f * shortMove) < 1e-5f, "controller/move_scales_with_step_delta");
+
+	backend.Clear();
+	backend.Read(readback);
+	report.Check(0 == readback.Size() && 0 == backend.GetControllerCount(), "controller/clear_drops_controllers");
+}
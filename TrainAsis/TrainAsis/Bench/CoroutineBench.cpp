@@ -0,0 +1,139 @@
+#include "HeadlessBench.h"
+#include "Core.Coroutine.h"
+
+#include <coroutine>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr size_t LiveFrames = 1000;
+	constexpr size_t FrameSizes[] = { 128, 512, 1536 };
+	constexpr int CoroutineCount = 10'000;
+	constexpr int WaitFrameCount = 60;
+	constexpr int WaitSpread = 600;	// 대기 길이를 1 ~ 600 프레임으로 흩어 프레임마다 일부만 기한이 된다
+
+	// 풀 없이 전역 힙에서 프레임을 받는 예전 promise 와 같은 코루틴
+	struct HeapCoroutine
+	{
+		struct promise_type
+		{
+			HeapCoroutine get_return_object() { return HeapCoroutine{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+			std::suspend_always initial_suspend() { return {}; }
+			std::suspend_always final_suspend() noexcept { return {}; }
+			std::suspend_always yield_value(YieldInstruction) { return {}; }
+			void return_void() {}
+			void unhandled_exception() { std::terminate(); }
+		};
+
+		explicit HeapCoroutine(std::coroutine_handle<promise_type> h) : handle(h) {}
+		HeapCoroutine(HeapCoroutine&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+		~HeapCoroutine()
+		{
+			if (handle)
+				handle.destroy();
+		}
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	HeapCoroutine HeapYieldOnce()
+	{
+		co_yield ReturnNull();
+	}
+
+	Coroutine<> PooledYieldOnce()
+	{
+		co_yield ReturnNull();
+	}
+
+	Coroutine<> WaitFrames(int frames)
+	{
+		co_yield WaitForFrames(frames);
+	}
+
+	void RunFrameSize(GameBuilder::BenchReport& report, size_t size)
+	{
+		const std::string suffix = " " + std::to_string(size) + "B";
+		std::vector<void*> frames(LiveFrames);
+
+		// 한꺼번에 LiveFrames 개를 받았다가 돌려준다 (코루틴이 몰려 시작하고 끝나는 프레임)
+		report.Measure("coroutine/global_new" + suffix, LiveFrames, Repeat, [&]
+		{
+			for (void*& frame : frames)
+			{
+				frame = ::operator new(size);
+			}
+			for (void* frame : frames)
+			{
+				::operator delete(frame, size);
+			}
+		});
+		report.Measure("coroutine/frame_pool" + suffix, LiveFrames, Repeat, [&]
+		{
+			for (void*& frame : frames)
+			{
+				frame = CoroutineFrameAllocator::Allocate(size);
+			}
+			for (void* frame : frames)
+			{
+				CoroutineFrameAllocator::Deallocate(frame, size);
+			}
+		});
+	}
+}
+
+void GameBuilder::CoroutineBench(BenchReport& report)
+{
+	for (size_t size : FrameSizes)
+	{
+		RunFrameSize(report, size);
+	}
+
+	// 실제 코루틴 프레임 생성/파괴만 비교한다
+	const std::string countSuffix = " " + std::to_string(CoroutineCount);
+	report.Measure("coroutine/heap_frame_create_destroy" + countSuffix, CoroutineCount, Repeat, [&]
+	{
+		for (int i = 0; i < CoroutineCount; ++i)
+		{
+			HeapCoroutine coroutine = HeapYieldOnce();
+		}
+	});
+	report.Measure("coroutine/pooled_frame_create_destroy" + countSuffix, CoroutineCount, Repeat, [&]
+	{
+		for (int i = 0; i < CoroutineCount; ++i)
+		{
+			Coroutine<> coroutine = PooledYieldOnce();
+		}
+	});
+
+	// -bench 는 씬을 틱하지 않으므로 씬 코루틴은 버리고 빈 매니저에서 잰다
+	CoroutineManagers->DestroyAllCoroutines();
+
+	// StartCoroutine 부터 끝난 코루틴 정리까지 매니저를 한 바퀴 도는 비용
+	report.Measure("coroutine/start_run_destroy" + countSuffix, CoroutineCount, Repeat, [&]
+	{
+		for (int i = 0; i < CoroutineCount; ++i)
+		{
+			StartCoroutine(PooledYieldOnce());
+		}
+		CoroutineManagers->yield_StartCoroutine();
+		CoroutineManagers->yield_Null();
+	});
+
+	// 많은 코루틴이 프레임 대기 중일 때 한 프레임 비용 (기한이 된 것만 건드린다)
+	for (int i = 0; i < CoroutineCount; ++i)
+	{
+		StartCoroutine(WaitFrames(1 + i % WaitSpread));
+	}
+	CoroutineManagers->yield_StartCoroutine();
+	report.Measure("coroutine/frame_wait_tick" + countSuffix + " waiting", static_cast<uint64_t>(CoroutineCount) * WaitFrameCount, 1, [&]
+	{
+		for (int frame = 0; frame < WaitFrameCount; ++frame)
+		{
+			CoroutineManagers->yield_OtherEvent();
+			CoroutineManagers->yield_Null();
+		}
+	});
+
+	CoroutineManagers->DestroyAllCoroutines();
+}
@@ -0,0 +1,133 @@
+#include "HeadlessBench.h"
+#include "Core.Coroutine.h"
+
+namespace
+{
+	constexpr int CoroutineCount = 1000;
+	constexpr int Rounds = 20;
+	constexpr float NeverDue = 1'000'000.f;
+
+	Coroutine<> WaitFramesThenCount(int frames, int* counter)
+	{
+		co_yield WaitForFrames(frames);
+		++*counter;
+	}
+
+	Coroutine<> WaitSecondsThenCount(float seconds, int* counter)
+	{
+		co_yield WaitForSeconds(seconds);
+		++*counter;
+	}
+
+	Coroutine<> CountEveryFrame(int frames, int* counter)
+	{
+		for (int i = 0; i < frames; ++i)
+		{
+			co_yield WaitForFrames(1);
+			++*counter;
+		}
+	}
+
+	// 시작 큐를 한 번 돌려 첫 co_yield 까지 진행시킨다 (여기서 타이머 힙에 들어간다)
+	template <typename Make>
+	void StartAll(Make&& make)
+	{
+		for (int i = 0; i < CoroutineCount; ++i)
+		{
+			StartCoroutine(make());
+		}
+		CoroutineManagers->yield_StartCoroutine();
+	}
+
+	void AdvanceFrames(int frames)
+	{
+		for (int i = 0; i < frames; ++i)
+		{
+			CoroutineManagers->yield_OtherEvent();
+		}
+	}
+
+	// 멈춘 코루틴의 타이머 항목은 힙에 남는다. 같은 래퍼가 새 코루틴에 재사용된 뒤
+	// 그 항목의 기한이 와도 waitSerial 이 달라 새 코루틴을 일찍 깨우면 안 된다
+	bool StaleFrameEntriesAfterRestart()
+	{
+		bool passed = true;
+		for (int round = 0; round < Rounds; ++round)
+		{
+			int stopped = 0;
+			int restarted = 0;
+			StartAll([&] { return WaitFramesThenCount(3, &stopped); });
+			CoroutineManagers->StopAllCoroutines();
+			AdvanceFrames(1);
+			CoroutineManagers->yield_Null();
+
+			StartAll([&] { return WaitFramesThenCount(6, &restarted); });
+			AdvanceFrames(3);
+			passed &= 0 == stopped && 0 == restarted;
+			AdvanceFrames(3);
+			passed &= 0 == stopped && CoroutineCount == restarted;
+			CoroutineManagers->yield_Null();
+		}
+		return passed;
+	}
+
+	// 멈췄지만 아직 정리 전인 코루틴은 기한이 와도 깨우지 않는다
+	bool MarkedEntriesSkipped()
+	{
+		int stopped = 0;
+		StartAll([&] { return WaitFramesThenCount(1, &stopped); });
+		CoroutineManagers->StopAllCoroutines();
+		AdvanceFrames(2);
+		CoroutineManagers->yield_Null();
+		return 0 == stopped;
+	}
+
+	// WaitForSeconds 힙도 같은 규칙을 따른다. 바로 기한이 되는 옛 항목이 먼 기한의 새 대기를 깨우면 안 된다
+	bool StaleSecondsEntriesAfterRestart()
+	{
+		int stopped = 0;
+		int restarted = 0;
+		StartAll([&] { return WaitSecondsThenCount(0.f, &stopped); });
+		CoroutineManagers->StopAllCoroutines();
+		CoroutineManagers->yield_Null();
+
+		StartAll([&] { return WaitSecondsThenCount(NeverDue, &restarted); });
+		CoroutineManagers->yield_WaitForSeconds();
+		const bool passed = 0 == stopped && 0 == restarted;
+
+		CoroutineManagers->StopAllCoroutines();
+		CoroutineManagers->yield_Null();
+		return passed;
+	}
+
+	// 매 프레임 다시 대기하는 코루틴은 프레임당 정확히 한 번 깨어난다
+	bool RescheduledWaitsRunOncePerFrame()
+	{
+		constexpr int Frames = 5;
+		int counter = 0;
+		StartAll([&] { return CountEveryFrame(Frames, &counter); });
+
+		bool passed = true;
+		for (int frame = 1; frame <= Frames; ++frame)
+		{
+			AdvanceFrames(1);
+			passed &= frame * CoroutineCount == counter;
+		}
+		CoroutineManagers->yield_Null();
+		return passed;
+	}
+}
+
+void GameBuilder::CoroutineCheck(BenchReport& report)
+{
+	// -check 는 씬을 틱하지 않으므로 씬이 시작한 코루틴은 여기서 버리고 빈 상태에서 시작한다
+	CoroutineManagers->DestroyAllCoroutines();
+
+	report.Check(StaleFrameEntriesAfterRestart(), "coroutine/stale_frame_entries_ignored_after_restart");
+	report.Check(MarkedEntriesSkipped(), "coroutine/stopped_waits_not_resumed");
+	report.Check(StaleSecondsEntriesAfterRestart(), "coroutine/stale_seconds_entries_ignored_after_restart");
+	report.Check(RescheduledWaitsRunOncePerFrame(), "coroutine/rescheduled_waits_run_once_per_frame");
+
+	// 남은 타이머 항목까지 비운다
+	CoroutineManagers->DestroyAllCoroutines();
+}
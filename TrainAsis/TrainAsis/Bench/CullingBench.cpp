@@ -0,0 +1,168 @@
+#include "HeadlessBench.h"
+#include "Core.DynamicBVH.h"
+
+#include <DirectXMath.h>
+#include <random>
+
+using namespace DirectX;
+
+// brute_force 행은 DirectXCollision 의 BoundingFrustum::Intersects 를 그대로 잰다.
+// Linux 에서 대체 DirectXCollision(평면 대 박스 검사)으로 빌드해 잰 수치는 참고용이고,
+// 기준 수치는 Windows(DirectXMath) 빌드에서 다시 잰다.
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr size_t CameraCount = 4;
+
+	// 2km x 2km 필드에 소품/몬스터 크기의 박스를 흩뿌린다
+	std::vector<BoundingBox> MakeBoxes(size_t count)
+	{
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> position(-1000.f, 1000.f);
+		std::uniform_real_distribution<float> height(0.f, 50.f);
+		std::uniform_real_distribution<float> extent(0.5f, 3.f);
+
+		std::vector<BoundingBox> boxes(count);
+		for (BoundingBox& box : boxes)
+		{
+			box.Center = { position(random), height(random), position(random) };
+			box.Extents = { extent(random), extent(random), extent(random) };
+		}
+		return boxes;
+	}
+
+	// 필드 안쪽에서 서로 다른 방향을 보는 카메라들 (메인 + 그림자/서브 카메라 흉내)
+	std::vector<BoundingFrustum> MakeFrustums()
+	{
+		const XMMATRIX projection = XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.f / 9.f, 0.1f, 500.f);
+
+		std::vector<BoundingFrustum> frustums;
+		for (size_t i = 0; i < CameraCount; ++i)
+		{
+			BoundingFrustum local(projection);
+			BoundingFrustum world;
+			const float yaw = XM_PIDIV2 * static_cast<float>(i);
+			local.Transform(world, 1.f, XMQuaternionRotationRollPitchYaw(0.2f, yaw, 0.f), XMVectorSet(100.f * i, 10.f, -100.f * i, 0.f));
+			frustums.push_back(world);
+		}
+		return frustums;
+	}
+
+	void* ToUserData(size_t index)
+	{
+		return reinterpret_cast<void*>(index + 1);
+	}
+
+	void RunCount(GameBuilder::BenchReport& report, size_t count)
+	{
+		const std::string suffix = " " + std::to_string(count);
+		const std::vector<BoundingBox> boxes = MakeBoxes(count);
+		const std::vector<BoundingFrustum> frustums = MakeFrustums();
+
+		std::vector<Core::SIMDCulling::FrustumPlanesSoA> planes;
+		for (const BoundingFrustum& frustum : frustums)
+		{
+			planes.push_back(Core::SIMDCulling::MakePlanes(frustum));
+		}
+
+		// 예전 Scene::CullMeshData 처럼 카메라마다 렌더러를 하나씩 검사한다
+		std::vector<std::vector<void*>> bruteVisible(CameraCount);
+		auto bruteForce = [&](size_t cameraCount)
+		{
+			for (size_t camera = 0; camera < cameraCount; ++camera)
+			{
+				auto& visible = bruteVisible[camera];
+				visible.clear();
+				for (size_t i = 0; i < boxes.size(); ++i)
+				{
+					if (frustums[camera].Intersects(boxes[i]))
+					{
+						visible.push_back(ToUserData(i));
+					}
+				}
+			}
+		};
+		report.Measure("culling/brute_force x1" + suffix, count, Repeat, [&] { bruteForce(1); });
+		report.Measure("culling/brute_force x4" + suffix, count * CameraCount, Repeat, [&] { bruteForce(CameraCount); });
+
+		DynamicBVH bvh;
+		std::vector<DynamicBVH::ProxyID> proxies(count);
+		report.Measure("culling/bvh_build" + suffix, count, 3, [&]
+		{
+			bvh.Clear();
+			for (size_t i = 0; i < count; ++i)
+			{
+				proxies[i] = bvh.CreateProxy(boxes[i], ToUserData(i));
+			}
+		});
+
+		std::vector<std::vector<void*>> bvhVisible(CameraCount);
+		auto cull = [&](uint32_t cameraCount)
+		{
+			for (auto& visible : bvhVisible)
+			{
+				visible.clear();
+			}
+			bvh.CullFrustums(planes.data(), cameraCount, bvhVisible.data());
+		};
+		report.Measure("culling/bvh_cull x1" + suffix, count, Repeat, [&] { cull(1); });
+		report.Measure("culling/bvh_cull x4" + suffix, count * CameraCount, Repeat, [&] { cull(static_cast<uint32_t>(CameraCount)); });
+
+		// fat AABB 때문에 BVH 쪽이 더 많이 보일 수는 있어도 적게 보이면 안 된다
+		bruteForce(CameraCount);
+		bool superset = true;
+		for (size_t camera = 0; camera < CameraCount; ++camera)
+		{
+			superset &= bvhVisible[camera].size() >= bruteVisible[camera].size();
+		}
+		report.Check(superset, "culling/bvh_visible_superset" + suffix);
+
+		// 10% 가 움직인다. 대부분은 fat AABB 안이고 1% 는 멀리 이동해 재삽입된다
+		std::mt19937 random(5678);
+		std::uniform_int_distribution<size_t> pick(0, count - 1);
+		std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+		std::uniform_real_distribution<float> jump(-1000.f, 1000.f);
+		const size_t movedCount = count / 10;
+		std::vector<std::pair<size_t, BoundingBox>> moves(movedCount);
+		for (size_t i = 0; i < movedCount; ++i)
+		{
+			const size_t index = pick(random);
+			BoundingBox moved = boxes[index];
+			if (0 == i % 10)
+			{
+				moved.Center = { jump(random), moved.Center.y, jump(random) };
+			}
+			else
+			{
+				moved.Center.x += jitter(random);
+				moved.Center.z += jitter(random);
+			}
+			moves[i] = { index, moved };
+		}
+
+		report.Measure("culling/bvh_refit 10%" + suffix, movedCount, 1, [&]
+		{
+			for (const auto& [index, box] : moves)
+			{
+				bvh.MoveProxy(proxies[index], box);
+			}
+		});
+
+		// CullingManager::Clear 가 메쉬 상태를 되돌릴 때 쓰는 순회. 재삽입 뒤에도 프록시마다 한 번씩 돌아야 한다
+		size_t visited = 0;
+		bool sameUserData = true;
+		bvh.ForEachProxy([&](DynamicBVH::ProxyID proxyId, void* userData)
+		{
+			++visited;
+			sameUserData &= bvh.GetUserData(proxyId) == userData;
+		});
+		report.Check(visited == count && sameUserData, "culling/bvh_for_each_proxy" + suffix);
+	}
+}
+
+void GameBuilder::CullingBench(BenchReport& report)
+{
+	RunCount(report, 10'000);
+	RunCount(report, 100'000);
+}
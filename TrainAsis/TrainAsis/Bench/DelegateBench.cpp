@@ -0,0 +1,213 @@
+#include "HeadlessBench.h"
+#include "Delegate.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 20;
+	constexpr size_t TargetCount = 100;
+
+	// 예전 Core::Delegate 의 Broadcast/TargetInvoke 와 같은 방식:
+	// 호출할 때마다 잠금 안에서 std::function 목록 전체를 복사하고, TargetInvoke 는 그 사본을 선형 탐색한다
+	class LegacyDelegate
+	{
+	public:
+		Core::DelegateHandle AddLambda(std::function<void(int)> func)
+		{
+			callbacks_.push_back({ Core::DelegateHandle(nextID_++), std::move(func) });
+			return callbacks_.back().handle;
+		}
+
+		void Broadcast(int value)
+		{
+			std::vector<CallbackInfo> callbacksToInvoke;
+			{
+				SpinLock lock(atomic_flag_);
+				callbacksToInvoke = callbacks_;
+			}
+
+			for (auto& info : callbacksToInvoke)
+			{
+				info.callback(value);
+			}
+		}
+
+		void TargetInvoke(const Core::DelegateHandle& handle, int value)
+		{
+			std::vector<CallbackInfo> callbacksToInvoke;
+			{
+				SpinLock lock(atomic_flag_);
+				callbacksToInvoke = callbacks_;
+			}
+
+			auto it = std::find_if(callbacksToInvoke.begin(), callbacksToInvoke.end(),
+				[&handle](const CallbackInfo& info) { return info.handle == handle; });
+			if (it != callbacksToInvoke.end())
+			{
+				it->callback(value);
+			}
+		}
+
+	private:
+		struct CallbackInfo
+		{
+			Core::DelegateHandle handle;
+			std::function<void(int)> callback;
+		};
+
+		std::atomic_flag atomic_flag_ = ATOMIC_FLAG_INIT;
+		std::vector<CallbackInfo> callbacks_;
+		std::uint32_t nextID_{ 1 };
+	};
+
+	// 컴포넌트 콜백처럼 this 와 몇 개의 값을 캡처한 리스너
+	struct Listener
+	{
+		int64_t sum{};
+	};
+
+	template <typename DelegateType>
+	std::vector<Core::DelegateHandle> AddListeners(DelegateType& delegate, std::vector<Listener>& listeners)
+	{
+		std::vector<Core::DelegateHandle> handles;
+		handles.reserve(listeners.size());
+		for (size_t i = 0; i < listeners.size(); ++i)
+		{
+			Listener* listener = &listeners[i];
+			const int scale = static_cast<int>(i % 7) + 1;
+			const int64_t bias = static_cast<int64_t>(i);
+			const float weight = 0.5f;
+			handles.push_back(delegate.AddLambda([listener, scale, bias, weight](int value)
+			{
+				listener->sum += value * scale + bias + static_cast<int64_t>(weight);
+			}));
+		}
+		return handles;
+	}
+
+	int64_t Sum(const std::vector<Listener>& listeners)
+	{
+		int64_t sum{};
+		for (const Listener& listener : listeners)
+		{
+			sum += listener.sum;
+		}
+		return sum;
+	}
+
+	void RunCount(GameBuilder::BenchReport& report, size_t count)
+	{
+		const std::string suffix = " " + std::to_string(count);
+
+		std::vector<Listener> legacyListeners(count);
+		LegacyDelegate legacy;
+		const std::vector<Core::DelegateHandle> legacyHandles = AddListeners(legacy, legacyListeners);
+
+		std::vector<Listener> listeners(count);
+		Core::Delegate<void, int> delegate;
+		const std::vector<Core::DelegateHandle> handles = AddListeners(delegate, listeners);
+
+		report.Measure("delegate/legacy_broadcast" + suffix, count, Repeat, [&] { legacy.Broadcast(1); });
+		report.Measure("delegate/broadcast" + suffix, count, Repeat, [&] { delegate.Broadcast(1); });
+		report.Check(Sum(legacyListeners) == Sum(listeners), "delegate/broadcast_matches_legacy" + suffix);
+
+		// 무작위 핸들 TargetInvoke (예전 방식은 호출마다 목록 전체 복사 + 선형 탐색)
+		std::mt19937 random(3);
+		std::uniform_int_distribution<size_t> pick(0, count - 1);
+		std::vector<size_t> targets(TargetCount);
+		for (size_t& target : targets)
+		{
+			target = pick(random);
+		}
+
+		report.Measure("delegate/legacy_target_invoke" + suffix, TargetCount, 3, [&]
+		{
+			for (size_t target : targets)
+			{
+				legacy.TargetInvoke(legacyHandles[target], 2);
+			}
+		});
+		report.Measure("delegate/target_invoke" + suffix, TargetCount, 3, [&]
+		{
+			for (size_t target : targets)
+			{
+				Core::DelegateHandle handle = handles[target];
+				delegate.TargetInvoke(handle, 2);
+			}
+		});
+		report.Check(Sum(legacyListeners) == Sum(listeners), "delegate/target_invoke_matches_legacy" + suffix);
+
+		// 리스너 10% 를 빼고 다시 넣은 뒤 첫 브로드캐스트 (스냅샷 재생성 포함)
+		std::vector<Core::DelegateHandle> churn(handles.begin(), handles.begin() + count / 10);
+		report.Measure("delegate/remove_add_broadcast 10%" + suffix, count, 1, [&]
+		{
+			for (Core::DelegateHandle& handle : churn)
+			{
+				delegate.Remove(handle);
+			}
+			std::vector<Listener> extra(churn.size());
+			AddListeners(delegate, extra);
+			delegate.Broadcast(0);
+		});
+	}
+
+	// 브로드캐스트 도중 제거/추가와 재사용된 슬롯의 옛 핸들 처리
+	void CheckSemantics(GameBuilder::BenchReport& report)
+	{
+		Core::Delegate<void, int> delegate;
+		int firstCalls{}, secondCalls{}, addedCalls{};
+		Core::DelegateHandle second;
+		delegate.AddLambda([&](int)
+		{
+			++firstCalls;
+			delegate.Remove(second);
+			delegate.AddLambda([&](int) { ++addedCalls; });
+		}, 1);
+		second = delegate.AddLambda([&](int) { ++secondCalls; }, 0);
+
+		delegate.Broadcast(0);
+		report.Check(1 == firstCalls && 0 == secondCalls && 0 == addedCalls, "delegate/remove_during_broadcast_skips");
+
+		delegate.Broadcast(0);
+		report.Check(1 == addedCalls, "delegate/add_during_broadcast_runs_next_time");
+
+		int staleCalls{}, freshCalls{};
+		Core::DelegateHandle stale = delegate.AddLambda([&](int) { ++staleCalls; });
+		Core::DelegateHandle removed = stale;
+		delegate.Remove(removed);
+		Core::DelegateHandle fresh = delegate.AddLambda([&](int) { ++freshCalls; });
+		delegate.TargetInvoke(stale, 0);
+		delegate.TargetInvoke(fresh, 0);
+		report.Check(0 == staleCalls && 1 == freshCalls, "delegate/stale_handle_ignored_after_slot_reuse");
+
+		// UnsafeBroadcast 도 순회 중 목록 변경에 영향을 받지 않아야 한다
+		Core::Delegate<void, int> unsafeDelegate;
+		int nextCalls{}, lastCalls{}, repeatCalls{}, frontCalls{};
+		Core::DelegateHandle self;
+		self = unsafeDelegate.AddLambda([&](int) { unsafeDelegate.Remove(self); }, 2);
+		unsafeDelegate.AddLambda([&](int) { ++nextCalls; }, 1);
+		unsafeDelegate.AddLambda([&](int)
+		{
+			if (0 == repeatCalls++)
+			{
+				unsafeDelegate.AddLambda([&](int) { ++frontCalls; }, 5);
+			}
+		}, 0);
+		unsafeDelegate.AddLambda([&](int) { ++lastCalls; }, -1);
+
+		unsafeDelegate.UnsafeBroadcast(0);
+		report.Check(1 == nextCalls && 1 == lastCalls, "delegate/unsafe_self_remove_keeps_next");
+		report.Check(1 == repeatCalls && 0 == frontCalls, "delegate/unsafe_add_does_not_repeat");
+
+		unsafeDelegate.UnsafeBroadcast(0);
+		report.Check(2 == nextCalls && 2 == repeatCalls && 1 == frontCalls, "delegate/unsafe_add_runs_next_time");
+	}
+}
+
+void GameBuilder::DelegateBench(BenchReport& report)
+{
+	RunCount(report, 1'000);
+	RunCount(report, 10'000);
+	CheckSemantics(report);
+}
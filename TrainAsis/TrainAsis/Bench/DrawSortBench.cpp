@@ -0,0 +1,184 @@
+#include "HeadlessBench.h"
+#include "Scene.h"
+#include "MeshRenderer.h"
+#include "MeshRendererProxy.h"
+#include "RenderQueueSorter.h"
+#include "Material.h"
+#include "Mesh.h"
+
+#include <map>
+#include <numeric>
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 20;
+	constexpr size_t MaterialCount = 48;
+	constexpr size_t MeshCount = 96;
+	constexpr size_t AnimatorCount = 16;
+
+	using ProxyFilter = PrimitiveRenderProxy::ProxyFilter;
+
+	// 예전 RenderPassData::SortRenderQueue 의 비교 함수 (프록시를 따라가서 비교)
+	bool LegacyCompare(PrimitiveRenderProxy* a, PrimitiveRenderProxy* b)
+	{
+		if (a->m_animatorGuid == b->m_animatorGuid)
+		{
+			return a->m_materialGuid < b->m_materialGuid;
+		}
+		return a->m_animatorGuid < b->m_animatorGuid;
+	}
+
+	struct Pools
+	{
+		std::vector<std::unique_ptr<Material>>	materials;
+		std::vector<std::unique_ptr<Mesh>>		meshes;
+	};
+
+	// 씬 오브젝트의 MeshRenderer 로 프록시 하나를 만들고, 메쉬/머티리얼/위치만 바꾼 사본을 count 개 만든다.
+	// 힙 곳곳에 흩어진 실제 프록시처럼 할당 순서를 섞는다.
+	std::vector<std::unique_ptr<PrimitiveRenderProxy>> MakeProxies(size_t count, const Pools& pools, MeshRenderer* renderer)
+	{
+		const PrimitiveRenderProxy prototype(renderer);
+
+		std::mt19937 random(19);
+		std::uniform_int_distribution<size_t> pickMaterial(0, pools.materials.size() - 1);
+		std::uniform_int_distribution<size_t> pickMesh(0, pools.meshes.size() - 1);
+		std::uniform_int_distribution<uint32> pickLOD(0, 2);
+		std::uniform_int_distribution<int> percent(0, 99);
+		std::uniform_real_distribution<float> position(-200.f, 200.f);
+
+		std::vector<std::unique_ptr<PrimitiveRenderProxy>> proxies(count);
+		std::vector<size_t> order(count);
+		std::iota(order.begin(), order.end(), size_t{ 0 });
+		std::shuffle(order.begin(), order.end(), random);
+		for (size_t index : order)
+		{
+			auto proxy = std::make_unique<PrimitiveRenderProxy>(prototype);
+			Material* material = pools.materials[pickMaterial(random)].get();
+			proxy->m_Material = material;
+			proxy->m_materialGuid = material->m_materialGuid;
+			const size_t meshIndex = pickMesh(random);
+			proxy->m_Mesh = pools.meshes[meshIndex].get();
+			// LOD 는 메쉬 에셋 단위로 켜져 있다 (절반의 메쉬)
+			proxy->m_EnableLOD = 0 == meshIndex % 2;
+			proxy->m_currLOD = proxy->m_EnableLOD ? pickLOD(random) : 0u;
+			proxy->m_worldPosition = { position(random), 0.f, position(random) };
+			proxy->m_worldMatrix = XMMatrixTranslation(proxy->m_worldPosition.x, 0.f, proxy->m_worldPosition.z);
+			// 10% 는 애니메이터가 붙은 스킨 메쉬
+			if (percent(random) < 10)
+			{
+				proxy->m_isAnimationEnabled = true;
+				proxy->m_animatorGuid = HashedGuid(1 + index % AnimatorCount);
+			}
+			proxies[index] = std::move(proxy);
+		}
+		return proxies;
+	}
+
+	void RunCount(GameBuilder::BenchReport& report, size_t count, const Pools& pools, MeshRenderer* renderer)
+	{
+		const std::string suffix = " " + std::to_string(count);
+		const auto proxies = MakeProxies(count, pools, renderer);
+
+		std::mt19937 random(23);
+		std::uniform_real_distribution<float> depth(0.f, 1.f);
+		std::vector<PrimitiveRenderProxy*> queue;
+		std::vector<DrawKeyEntry> keys;
+		for (const auto& proxy : proxies)
+		{
+			queue.push_back(proxy.get());
+			keys.push_back({ RenderQueueSorter::MakeOpaqueKey(*proxy, proxy->m_currLOD, depth(random)), proxy.get() });
+		}
+
+		// 예전 방식: 프록시 비교 정렬 후 GBufferPass 가 매 프레임 std::map 으로 인스턴스 그룹을 만들고 행렬을 모은다
+		size_t legacyGroupCount{};
+		size_t legacyInstanceCount{};
+		report.Measure("draw_sort/legacy_sort+group" + suffix, count, Repeat, [&]
+		{
+			std::vector<PrimitiveRenderProxy*> sorted = queue;
+			std::ranges::sort(sorted, LegacyCompare);
+
+			std::map<ProxyFilter, std::vector<PrimitiveRenderProxy*>> instanceGroups;
+			for (PrimitiveRenderProxy* proxy : sorted)
+			{
+				if (RenderQueueSorter::Category::Instanced != RenderQueueSorter::GetCategory(*proxy))
+				{
+					continue;
+				}
+				ProxyFilter key{ proxy->m_materialGuid, proxy->m_Mesh->m_hashingMesh, proxy->m_EnableLOD, proxy->m_currLOD, proxy->m_bitflag };
+				instanceGroups[key].push_back(proxy);
+			}
+
+			legacyInstanceCount = 0;
+			for (const auto& [groupKey, groupProxies] : instanceGroups)
+			{
+				std::vector<Mathf::xMatrix> instanceMatrices;
+				instanceMatrices.reserve(groupProxies.size());
+				for (PrimitiveRenderProxy* proxy : groupProxies)
+				{
+					instanceMatrices.push_back(proxy->m_worldMatrix);
+				}
+				legacyInstanceCount += instanceMatrices.size();
+			}
+			legacyGroupCount = instanceGroups.size();
+		});
+
+		// 같은 키를 비교 정렬로 정렬했을 때 (키만으로 얻는 이득과 기수 정렬의 이득을 나눠 보기 위함)
+		std::vector<DrawKeyEntry> sorted;
+		report.Measure("draw_sort/key_stable_sort" + suffix, count, Repeat, [&]
+		{
+			sorted = keys;
+			std::stable_sort(sorted.begin(), sorted.end(), [](const DrawKeyEntry& a, const DrawKeyEntry& b) { return a.key < b.key; });
+		});
+		const std::vector<DrawKeyEntry> reference = sorted;
+
+		std::vector<DrawKeyEntry> scratch;
+		report.Measure("draw_sort/key_radix_sort" + suffix, count, Repeat, [&]
+		{
+			sorted = keys;
+			RenderQueueSorter::Sort(sorted, scratch);
+		});
+
+		bool matches = sorted.size() == reference.size();
+		for (size_t i = 0; i < sorted.size() && matches; ++i)
+		{
+			matches = sorted[i].key == reference[i].key && sorted[i].proxy == reference[i].proxy;
+		}
+		report.Check(matches, "draw_sort/radix_matches_stable_sort" + suffix);
+
+		std::vector<InstanceBatch> batches;
+		std::vector<Mathf::xMatrix> matrices;
+		report.Measure("draw_sort/radix_sort+batch" + suffix, count, Repeat, [&]
+		{
+			sorted = keys;
+			RenderQueueSorter::Sort(sorted, scratch);
+			RenderQueueSorter::BuildInstanceBatches(sorted, batches, matrices);
+		});
+
+		// 정렬 뒤 연속 구간으로 묶어도 예전 map 그룹과 같은 수의 드로우가 나와야 한다
+		report.Check(batches.size() == legacyGroupCount && matrices.size() == legacyInstanceCount,
+			"draw_sort/batches_match_legacy_groups" + suffix);
+	}
+}
+
+void GameBuilder::DrawSortBench(BenchReport& report)
+{
+	Pools pools;
+	for (size_t i = 0; i < MaterialCount; ++i)
+	{
+		pools.materials.push_back(std::make_unique<Material>());
+	}
+	for (size_t i = 0; i < MeshCount; ++i)
+	{
+		pools.meshes.push_back(std::make_unique<Mesh>());
+	}
+
+	// 프록시 생성자가 요구하는 소유 오브젝트만 있는 빈 씬 (Awake 가 돌지 않아 렌더 씬에 등록되지 않는다)
+	std::unique_ptr<Scene> scene(Scene::CreateNewScene("DrawSortBench"));
+	auto object = scene->CreateGameObject("DrawSortProxy");
+	MeshRenderer* renderer = object->AddComponent<MeshRenderer>();
+
+	RunCount(report, 2'000, pools, renderer);
+	RunCount(report, 20'000, pools, renderer);
+}
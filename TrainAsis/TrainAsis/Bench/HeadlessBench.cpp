@@ -0,0 +1,123 @@
+#include "HeadlessBench.h"
+#include "LogSystem.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+	struct BenchEntry
+	{
+		const wchar_t* name;
+		void (*run)(GameBuilder::BenchReport&);
+	};
+
+	constexpr BenchEntry Benches[] =
+	{
+		{ L"culling", &GameBuilder::CullingBench },
+		{ L"transform", &GameBuilder::TransformBench },
+		{ L"physics_sync", &GameBuilder::PhysicsSyncBench },
+		{ L"jobs", &GameBuilder::JobSystemBench },
+		{ L"blackboard", &GameBuilder::BlackBoardBench },
+		{ L"delegate", &GameBuilder::DelegateBench },
+		{ L"draw_sort", &GameBuilder::DrawSortBench },
+		{ L"voice", &GameBuilder::VoiceBench },
+		{ L"scene_query", &GameBuilder::SceneQueryBench },
+		{ L"contact_events", &GameBuilder::ContactEventBench },
+		{ L"coroutine", &GameBuilder::CoroutineBench },
+	};
+
+	constexpr BenchEntry Checks[] =
+	{
+		{ L"coroutine", &GameBuilder::CoroutineCheck },
+		{ L"input", &GameBuilder::InputCheck },
+		{ L"controller", &GameBuilder::ControllerCheck },
+	};
+
+	template <size_t N>
+	void RunEntries(const BenchEntry (&entries)[N], std::wstring_view filter, GameBuilder::BenchReport& report)
+	{
+		for (const BenchEntry& entry : entries)
+		{
+			if (filter == L"all" || filter == entry.name)
+			{
+				entry.run(report);
+			}
+		}
+	}
+}
+
+void GameBuilder::BenchReport::AddTiming(std::string_view name, uint64_t items, double bestMs, double avgMs)
+{
+	m_timings.push_back({ std::string(name), items, bestMs, avgMs });
+}
+
+void GameBuilder::BenchReport::Check(bool condition, std::string_view name)
+{
+	m_checks.push_back({ std::string(name), condition });
+	if (!condition)
+	{
+		Debug->LogError("[Check] failed: " + std::string(name));
+	}
+}
+
+bool GameBuilder::BenchReport::HasFailure() const
+{
+	return std::any_of(m_checks.begin(), m_checks.end(), [](const CheckResult& check) { return !check.passed; });
+}
+
+void GameBuilder::BenchReport::Print() const
+{
+	std::ostringstream oss;
+	oss << std::fixed << std::setprecision(4);
+	for (const Timing& timing : m_timings)
+	{
+		const double nsPerItem = timing.bestMs * 1'000'000.0 / static_cast<double>((std::max)(timing.items, uint64_t{ 1 }));
+		oss << "[Bench] " << std::left << std::setw(40) << timing.name << std::right
+			<< " items: " << std::setw(8) << timing.items
+			<< " best: " << timing.bestMs << "ms"
+			<< " avg: " << timing.avgMs << "ms"
+			<< " " << std::setprecision(2) << nsPerItem << "ns/item\n" << std::setprecision(4);
+	}
+
+	for (const CheckResult& check : m_checks)
+	{
+		oss << "[Check] " << (check.passed ? "pass " : "FAIL ") << check.name << "\n";
+	}
+
+	Debug->Log(oss.str());
+}
+
+void GameBuilder::BenchReport::Write(const std::string& reportPath) const
+{
+	std::ofstream reportFile(reportPath, std::ios::trunc);
+	if (!reportFile.is_open())
+	{
+		Debug->LogError("Failed to open bench report file: " + reportPath);
+		return;
+	}
+
+	reportFile << "name,items,best_ms,avg_ms,ns_per_item\n";
+	reportFile << std::fixed << std::setprecision(4);
+	for (const Timing& timing : m_timings)
+	{
+		const double nsPerItem = timing.bestMs * 1'000'000.0 / static_cast<double>((std::max)(timing.items, uint64_t{ 1 }));
+		reportFile << timing.name << "," << timing.items << "," << timing.bestMs << "," << timing.avgMs << "," << nsPerItem << "\n";
+	}
+
+	for (const CheckResult& check : m_checks)
+	{
+		reportFile << "check:" << check.name << ",," << (check.passed ? "pass" : "fail") << ",,\n";
+	}
+}
+
+void GameBuilder::RunBenches(std::wstring_view filter, BenchReport& report)
+{
+	RunEntries(Benches, filter, report);
+}
+
+void GameBuilder::RunChecks(std::wstring_view filter, BenchReport& report)
+{
+	RunEntries(Checks, filter, report);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GameBuilder
+{
+	// -bench / -check 로 도는 합성 벤치마크와 동작 검사 결과를 모은다.
+	// 벤치는 같은 작업을 여러 번 돌려 가장 빠른 회차를 항목(노드, 메쉬, 호출 ...) 당 ns 로 남긴다.
+	class BenchReport
+	{
+	public:
+		struct Timing
+		{
+			std::string name;
+			uint64_t	items{};
+			double		bestMs{};
+			double		avgMs{};
+		};
+
+		struct CheckResult
+		{
+			std::string name;
+			bool		passed{};
+		};
+
+		// func 을 repeat 번 돌리고 items 개를 처리한 시간으로 기록한다
+		template <typename Func>
+		void Measure(std::string_view name, uint64_t items, int repeat, Func&& func)
+		{
+			double best = (std::numeric_limits<double>::max)();
+			double total{};
+			for (int i = 0; i < repeat; ++i)
+			{
+				Benchmark benchmark;
+				func();
+				const double elapsed = benchmark.GetElapsedTime();
+				best = (std::min)(best, elapsed);
+				total += elapsed;
+			}
+			AddTiming(name, items, best, total / (std::max)(repeat, 1));
+		}
+
+		void AddTiming(std::string_view name, uint64_t items, double bestMs, double avgMs);
+		void Check(bool condition, std::string_view name);
+
+		bool HasFailure() const;
+		void Print() const;
+		void Write(const std::string& reportPath) const;
+
+	private:
+		std::vector<Timing>			m_timings;
+		std::vector<CheckResult>	m_checks;
+	};
+
+	// filter 가 all 이면 전부, 아니면 이름이 같은 것만 돈다
+	void RunBenches(std::wstring_view filter, BenchReport& report);
+	void RunChecks(std::wstring_view filter, BenchReport& report);
+
+	// 벤치 파일마다 하나씩 (HeadlessBench.cpp 의 표에 이름과 함께 올린다)
+	void CullingBench(BenchReport& report);
+	void TransformBench(BenchReport& report);
+	void PhysicsSyncBench(BenchReport& report);
+	void JobSystemBench(BenchReport& report);
+	void BlackBoardBench(BenchReport& report);
+	void DelegateBench(BenchReport& report);
+	void DrawSortBench(BenchReport& report);
+	void VoiceBench(BenchReport& report);
+	void SceneQueryBench(BenchReport& report);
+	void ContactEventBench(BenchReport& report);
+	void CoroutineBench(BenchReport& report);
+
+	// 검사 파일마다 하나씩 (시간은 재지 않고 Check 만 남긴다)
+	void CoroutineCheck(BenchReport& report);
+	void InputCheck(BenchReport& report);
+	void ControllerCheck(BenchReport& report);
+}
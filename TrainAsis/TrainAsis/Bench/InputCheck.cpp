@@ -0,0 +1,118 @@
+#include "HeadlessBench.h"
+#include "ModuleBehavior.h"
+#include "ActionMap.h"
+#include "InputBindingTable.h"
+
+#include <array>
+
+namespace
+{
+	// 액션이 부르는 메서드를 호출 순서대로 남기는 검사용 스크립트
+	class InputProbe : public ModuleBehavior
+	{
+	public:
+		MODULE_BEHAVIOR_BODY(InputProbe)
+
+		void Jump() { calls.push_back("Jump"); }
+		void Charge() { calls.push_back("Charge"); }
+		void Release() { calls.push_back("Release"); }
+		void Fire() { calls.push_back("Fire"); }
+		void Move(Mathf::Vector2 value)
+		{
+			calls.push_back("Move(" + std::to_string(static_cast<int>(value.x)) + "," + std::to_string(static_cast<int>(value.y)) + ")");
+		}
+
+		std::vector<std::string> calls;
+	};
+
+	// 핫로드 스크립트처럼 이름으로 찾을 수 있게 메서드 목록을 등록한다
+	void RegisterProbeType()
+	{
+		static const std::array<Meta::Method, 5> methods
+		{
+			Meta::MakeMethod("Jump", &InputProbe::Jump),
+			Meta::MakeMethod("Charge", &InputProbe::Charge),
+			Meta::MakeMethod("Release", &InputProbe::Release),
+			Meta::MakeMethod("Fire", &InputProbe::Fire),
+			Meta::MakeMethod("Move", &InputProbe::Move, { "value" }),
+		};
+
+		Meta::Type type{};
+		type.name = "InputProbe";
+		type.methods = methods;
+		type.typeID = type_guid(InputProbe);
+		Meta::Registry::GetInstance()->ScriptRegister(type.name, type);
+	}
+
+	void AddButton(ActionMap& actionMap, const std::string& scriptName, const std::string& funName, KeyBoard key, KeyState keystate)
+	{
+		InputAction* action = actionMap.AddAction();
+		action->m_scriptName = scriptName;
+		action->funName = funName;
+		action->inputType = InputType::KeyBoard;
+		action->actionType = ActionType::Button;
+		action->keystate = keystate;
+		action->key = { static_cast<size_t>(key) };
+	}
+
+	void AddKeyAxis(ActionMap& actionMap, const std::string& scriptName, const std::string& funName)
+	{
+		InputAction* action = actionMap.AddAction();
+		action->m_scriptName = scriptName;
+		action->funName = funName;
+		action->inputType = InputType::KeyBoard;
+		action->actionType = ActionType::Value;
+		action->valueType = InputValueType::Vector2;
+		action->key = { static_cast<size_t>(KeyBoard::A), static_cast<size_t>(KeyBoard::D), static_cast<size_t>(KeyBoard::S), static_cast<size_t>(KeyBoard::W) };
+	}
+
+	// 슬롯은 Build 가 처음 만난 키 순서로 정한다 (아래 액션맵 기준)
+	constexpr uint64 SpaceBit = 1ull << 0;
+	constexpr uint64 LeftBit = 1ull << 1;	// A
+	constexpr uint64 RightBit = 1ull << 2;	// D
+	constexpr uint64 FireBit = 1ull << 5;	// F
+
+	std::vector<std::string> Step(InputBindingTable& table, InputProbe& probe, uint64 buttons)
+	{
+		probe.calls.clear();
+		table.Diff({ buttons });
+		table.Dispatch();
+		return probe.calls;
+	}
+}
+
+void GameBuilder::InputCheck(BenchReport& report)
+{
+	RegisterProbeType();
+
+	// 맨 앞 액션은 다른 스크립트 것이다. 예전 CheckAction 은 여기서 return 해 뒤 액션을 전부 건너뛰었다
+	ActionMap actionMap;
+	AddButton(actionMap, "MissingScript", "Jump", KeyBoard::Space, KeyState::Down);
+	AddButton(actionMap, "InputProbe", "Jump", KeyBoard::Space, KeyState::Down);
+	AddButton(actionMap, "InputProbe", "Charge", KeyBoard::Space, KeyState::Pressed);
+	AddButton(actionMap, "InputProbe", "Release", KeyBoard::Space, KeyState::Released);
+	AddKeyAxis(actionMap, "InputProbe", "Move");
+	AddButton(actionMap, "InputProbe", "Fire", KeyBoard::F, KeyState::Down);
+
+	InputProbe probe;
+	InputBindingTable table;
+	table.Build(actionMap, { &probe });
+	report.Check(!table.IsEmpty(), "input/actions_after_other_script_are_bound");
+
+	using Calls = std::vector<std::string>;
+
+	// 같은 프레임 안에서는 액션맵 순서대로 호출된다
+	report.Check(Step(table, probe, SpaceBit | LeftBit | FireBit) == Calls{ "Jump", "Move(-1,0)", "Fire" }, "input/press_frame_dispatches_in_map_order");
+	// 누르고 있으면 Down 대신 Pressed, 양쪽 키가 같이 눌리면 음수 쪽이 이긴다
+	report.Check(Step(table, probe, SpaceBit | LeftBit | RightBit) == Calls{ "Charge", "Move(-1,0)" }, "input/held_frame_dispatches_pressed");
+	// 뗀 프레임은 Released 와 0 으로 돌아간 축 값을 한 번 보낸다
+	report.Check(Step(table, probe, 0) == Calls{ "Release", "Move(0,0)" }, "input/release_frame_dispatches_released_and_zero_axis");
+	// 입력이 없으면 아무것도 부르지 않는다
+	report.Check(Step(table, probe, 0).empty(), "input/idle_frame_dispatches_nothing");
+
+	// 다시 빌드해도 같은 순서를 유지하고 이전 프레임 상태는 초기화된다
+	table.Build(actionMap, { &probe });
+	report.Check(Step(table, probe, SpaceBit | FireBit) == Calls{ "Jump", "Fire" }, "input/rebuild_resets_previous_frame");
+
+	Meta::Registry::GetInstance()->UnRegister("InputProbe");
+}
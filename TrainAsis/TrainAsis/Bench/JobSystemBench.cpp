@@ -0,0 +1,164 @@
+#include "HeadlessBench.h"
+#include "Core.JobSystem.h"
+#include "Core.ThreadPool.h"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr uint32 EmptyJobCount = 10'000;
+	constexpr uint32 ForCount = 1'000'000;
+	constexpr uint32 ChainLength = 1'000;
+
+	// 잡 하나당 대략 수십 ns 정도의 가벼운 일
+	float Work(uint32 index)
+	{
+		return std::sqrt(static_cast<float>(index) * 0.5f + 1.f);
+	}
+}
+
+void GameBuilder::JobSystemBench(BenchReport& report)
+{
+	std::atomic<uint32> counter{};
+
+	// 빈 잡을 한 그룹에 넣고 기다리는 비용 (스케줄 + 실행 + 완료 통지)
+	report.Measure("jobs/group_schedule_wait " + std::to_string(EmptyJobCount), EmptyJobCount, Repeat, [&]
+	{
+		JobHandle group = JobSystems->CreateGroup();
+		for (uint32 i = 0; i < EmptyJobCount; ++i)
+		{
+			JobSystems->Schedule(group, [&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+		}
+		JobSystems->Wait(group);
+	});
+	report.Check(counter.load() == EmptyJobCount * Repeat, "jobs/group_runs_every_job");
+
+	// 예전 풀처럼 Enqueue 후 NotifyAllAndWait 로 기다리는 비용 (스레드 수는 워커 수와 맞춘다)
+	{
+		ThreadPool<std::function<void()>> pool(static_cast<int>(JobSystems->GetWorkerCount()));
+		counter.store(0);
+		report.Measure("jobs/legacy_pool_enqueue_wait " + std::to_string(EmptyJobCount), EmptyJobCount, Repeat, [&]
+		{
+			for (uint32 i = 0; i < EmptyJobCount; ++i)
+			{
+				pool.Enqueue([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+			}
+			pool.NotifyAllAndWait();
+		});
+		report.Check(counter.load() == EmptyJobCount * Repeat, "jobs/legacy_pool_runs_every_job");
+	}
+
+	// ParallelFor 처리량: grain 0 은 스레드당 4 조각, 나머지는 고정 크기
+	std::vector<float> output(ForCount);
+	for (uint32 grain : { 0u, 256u, 4096u, 65536u })
+	{
+		report.Measure("jobs/parallel_for grain " + std::to_string(grain) + " " + std::to_string(ForCount), ForCount, Repeat, [&]
+		{
+			JobSystems->Wait(JobSystems->ParallelFor(ForCount, grain, [&output](uint32 begin, uint32 end)
+			{
+				for (uint32 i = begin; i < end; ++i)
+				{
+					output[i] = Work(i);
+				}
+			}));
+		});
+	}
+	report.Measure("jobs/serial_for " + std::to_string(ForCount), ForCount, Repeat, [&]
+	{
+		for (uint32 i = 0; i < ForCount; ++i)
+		{
+			output[i] = Work(i);
+		}
+	});
+
+	// 앞 잡이 끝나야 다음 잡이 큐에 들어가는 일자 체인 (continuation 지연)
+	std::vector<uint32> order;
+	order.reserve(ChainLength);
+	report.Measure("jobs/dependency_chain " + std::to_string(ChainLength), ChainLength, Repeat, [&]
+	{
+		order.clear();
+		JobHandle previous;
+		for (uint32 i = 0; i < ChainLength; ++i)
+		{
+			previous = JobSystems->Schedule([&order, i] { order.push_back(i); }, previous);
+		}
+		JobSystems->Wait(previous);
+	});
+	bool ordered = order.size() == ChainLength;
+	for (uint32 i = 0; i < order.size() && ordered; ++i)
+	{
+		ordered = order[i] == i;
+	}
+	report.Check(ordered, "jobs/dependency_chain_in_order");
+
+	// 팬아웃 뒤 하나의 잡이 전체를 모으는 팬인 (컬링 -> 정렬 같은 흐름)
+	std::atomic<uint32> fanIn{};
+	report.Measure("jobs/fan_out_fan_in " + std::to_string(ForCount), ForCount, Repeat, [&]
+	{
+		JobHandle gather = JobSystems->Schedule([&]
+		{
+			fanIn.store(static_cast<uint32>(output.size()), std::memory_order_relaxed);
+		}, JobSystems->ParallelFor(ForCount, 0, [&output](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				output[i] = Work(i);
+			}
+		}));
+		JobSystems->Wait(gather);
+	});
+	report.Check(fanIn.load() == ForCount, "jobs/fan_in_runs_after_fan_out");
+
+	// 잡 안에서 다시 ParallelFor 를 돌리고 Wait 해도 교착되지 않아야 한다
+	counter.store(0);
+	const uint32 outer = JobSystems->GetWorkerCount() * 2;
+	report.Measure("jobs/nested_wait " + std::to_string(outer) + "x1024", outer * 1024ull, Repeat, [&]
+	{
+		JobSystems->Wait(JobSystems->ParallelFor(outer, 1, [&counter](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				JobSystems->Wait(JobSystems->ParallelFor(1024, 64, [&counter](uint32 innerBegin, uint32 innerEnd)
+				{
+					counter.fetch_add(innerEnd - innerBegin, std::memory_order_relaxed);
+				}));
+			}
+		}));
+	});
+	report.Check(counter.load() == outer * 1024u * Repeat, "jobs/nested_wait_completes");
+
+	// 예외를 던진 잡도 카운터를 끝내야 Wait 가 돌아온다. 나머지 잡은 그대로 실행된다
+	counter.store(0);
+	JobHandle failing = JobSystems->CreateGroup();
+	for (uint32 i = 0; i < 64; ++i)
+	{
+		JobSystems->Schedule(failing, [&counter, i]
+		{
+			if (0 == i % 16)
+			{
+				throw std::runtime_error("job failure");
+			}
+			counter.fetch_add(1, std::memory_order_relaxed);
+		});
+	}
+	JobSystems->Wait(failing);
+	report.Check(failing->IsDone() && failing->HasFailed() && 60 == counter.load(), "jobs/throwing_job_finishes_group");
+
+	// 잡 안에 들어가지 않는 큰 캡처는 힙으로 옮겨도 똑같이 실행되고 정리된다
+	std::array<uint64, 32> large{};
+	large.fill(3);
+	std::atomic<uint64> largeSum{};
+	JobSystems->Wait(JobSystems->Schedule([large, &largeSum]
+	{
+		uint64 sum = 0;
+		for (uint64 value : large)
+		{
+			sum += value;
+		}
+		largeSum.store(sum);
+	}));
+	report.Check(96 == largeSum.load(), "jobs/large_capture_runs");
+}
@@ -0,0 +1,111 @@
+#include "HeadlessBench.h"
+#include "Physx.h"
+#include "PhysicsSyncBuffer.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr size_t BodyCount = 2000;
+	// 로드된 씬의 콜라이더 ID 와 겹치지 않게 높은 번호를 쓴다
+	constexpr unsigned int BaseId = 0x40000000u;
+	constexpr float FixedDeltaTime = 1.f / 60.f;
+
+	DirectX::SimpleMath::Vector3 GridPosition(size_t index)
+	{
+		const float x = static_cast<float>(index % 50) * 3.f;
+		const float z = static_cast<float>(index / 50) * 3.f;
+		return { x, 2.f, z };
+	}
+}
+
+void GameBuilder::PhysicsSyncBench(BenchReport& report)
+{
+	const std::string suffix = " " + std::to_string(BodyCount);
+	const unsigned int groundId = BaseId + static_cast<unsigned int>(BodyCount);
+
+	// 바디들이 내려앉아 잠들 수 있게 바닥을 깐다
+	BoxColliderInfo ground{};
+	ground.colliderInfo.id = groundId;
+	ground.colliderInfo.collsionTransform.worldPosition = { 75.f, -0.5f, 60.f };
+	ground.colliderInfo.collsionTransform.worldRotation = DirectX::SimpleMath::Quaternion::Identity;
+	ground.colliderInfo.collsionTransform.worldScale = { 1.f, 1.f, 1.f };
+	ground.boxExtent = { 100.f, 0.5f, 100.f };
+	Physics->CreateStaticBody(ground, EColliderType::COLLISION);
+
+	for (size_t i = 0; i < BodyCount; ++i)
+	{
+		BoxColliderInfo info{};
+		info.colliderInfo.id = BaseId + static_cast<unsigned int>(i);
+		info.colliderInfo.collsionTransform.worldPosition = GridPosition(i);
+		info.colliderInfo.collsionTransform.worldRotation = DirectX::SimpleMath::Quaternion::Identity;
+		info.colliderInfo.collsionTransform.worldScale = { 1.f, 1.f, 1.f };
+		info.boxExtent = { 0.5f, 0.5f, 0.5f };
+		Physics->CreateDynamicBody(info, EColliderType::COLLISION, false);
+	}
+	// 새 바디는 다음 Update 에서 씬에 들어간다
+	Physics->Update(FixedDeltaTime);
+
+	// 예전 SetPhysicData/GetPhysicData 처럼 매 스텝 모든 바디를 읽고 전체 데이터를 다시 쓴다
+	report.Measure("physics_sync/legacy_upload_all" + suffix, BodyCount, Repeat, [&]
+	{
+		for (size_t i = 0; i < BodyCount; ++i)
+		{
+			const unsigned int id = BaseId + static_cast<unsigned int>(i);
+			RigidBodyGetSetData data = Physics->GetRigidBodyData(id);
+			data.position = GridPosition(i);
+			Physics->SetRigidBodyData(id, data);
+		}
+	});
+	report.Measure("physics_sync/legacy_readback_all" + suffix, BodyCount, Repeat, [&]
+	{
+		for (size_t i = 0; i < BodyCount; ++i)
+		{
+			RigidBodyGetSetData data = Physics->GetRigidBodyData(BaseId + static_cast<unsigned int>(i));
+			(void)data;
+		}
+	});
+
+	// 바뀐 10% 의 포즈만 SoA 배치로 올린다
+	std::mt19937 random(11);
+	std::uniform_int_distribution<size_t> pick(0, BodyCount - 1);
+	RigidBodyUploadBatch upload;
+	for (size_t i = 0; i < BodyCount / 10; ++i)
+	{
+		const size_t index = pick(random);
+		upload.poseIds.push_back(BaseId + static_cast<unsigned int>(index));
+		upload.posePositions.push_back(GridPosition(index));
+		upload.poseRotations.push_back(DirectX::SimpleMath::Quaternion::Identity);
+		upload.poseScales.push_back({ 1.f, 1.f, 1.f });
+	}
+	report.Measure("physics_sync/batch_upload 10%" + suffix, BodyCount, Repeat, [&] { Physics->ApplyRigidBodyBatch(upload); });
+
+	// 스텝 직후(대부분 깨어 있음)와 충분히 재운 뒤의 active 목록 읽기
+	RigidBodyReadbackBatch readback;
+	Physics->Update(FixedDeltaTime);
+	report.Measure("physics_sync/active_readback awake" + suffix, BodyCount, 1, [&]
+	{
+		readback.Clear();
+		Physics->ReadActiveRigidBodies(readback);
+	});
+	const size_t awakeCount = readback.Size();
+
+	for (int step = 0; step < 300; ++step)
+	{
+		Physics->Update(FixedDeltaTime);
+	}
+	report.Measure("physics_sync/active_readback settled" + suffix, BodyCount, 1, [&]
+	{
+		readback.Clear();
+		Physics->ReadActiveRigidBodies(readback);
+	});
+	report.Check(readback.Size() < awakeCount, "physics_sync/settled_bodies_leave_active_list");
+
+	for (size_t i = 0; i < BodyCount; ++i)
+	{
+		Physics->DestroyActor(BaseId + static_cast<unsigned int>(i));
+	}
+	Physics->DestroyActor(groundId);
+	Physics->Update(FixedDeltaTime);
+}
@@ -0,0 +1,226 @@
+#include "HeadlessBench.h"
+#include "Physx.h"
+#include "ReferenceSceneQuery.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr uint32_t ShapeCount = 4'096;
+	constexpr uint32_t LayerCount = 8;
+	constexpr uint32_t RayCount = 512;
+	constexpr uint32_t OverlapCount = 256;
+	constexpr uint32_t SweepCount = 256;
+	constexpr uint32_t PhysXBoxCount = 2'000;
+	// 로드된 씬의 콜라이더 ID 와 겹치지 않게 높은 번호를 쓴다
+	constexpr unsigned int BaseId = 0x48000000u;
+
+	using Vector3 = DirectX::SimpleMath::Vector3;
+
+	// 몬스터 장애물 더듬이 레이, 근접 공격 오버랩, 돌진 스윕을 섞은 한 프레임 분량
+	void FillFrameQueries(SceneQueryBatch& batch, unsigned int layerMask)
+	{
+		std::mt19937 random(24);
+		std::uniform_real_distribution<float> position(-100.f, 100.f);
+		std::uniform_real_distribution<float> angle(0.f, 6.2831853f);
+
+		for (uint32_t i = 0; i < RayCount; ++i)
+		{
+			const float yaw = angle(random);
+			batch.AddRaycast({ position(random), 1.f, position(random) }, { std::cos(yaw), 0.f, std::sin(yaw) }, 10.f, layerMask);
+		}
+		for (uint32_t i = 0; i < OverlapCount; ++i)
+		{
+			OverlapInput in{};
+			in.position = { position(random), 1.f, position(random) };
+			in.rotation = DirectX::SimpleMath::Quaternion::Identity;
+			in.layerMask = layerMask;
+			batch.AddSphereOverlap(in, 2.f);
+		}
+		for (uint32_t i = 0; i < SweepCount; ++i)
+		{
+			const float yaw = angle(random);
+			SweepInput in{};
+			in.startPosition = { position(random), 1.f, position(random) };
+			in.startRotation = DirectX::SimpleMath::Quaternion::Identity;
+			in.direction = { std::cos(yaw), 0.f, std::sin(yaw) };
+			in.distance = 6.f;
+			in.layerMask = layerMask;
+			batch.AddSphereSweep(in, 0.5f);
+		}
+	}
+
+	bool SameHits(const SceneQueryBatch& lhs, uint32_t lhsQuery, const SceneQueryBatch& rhs, uint32_t rhsQuery)
+	{
+		const uint32_t count = lhs.GetHitCount(lhsQuery);
+		if (count != rhs.GetHitCount(rhsQuery)) return false;
+
+		const SceneQueryHit* lhsHits = lhs.GetHits(lhsQuery);
+		const SceneQueryHit* rhsHits = rhs.GetHits(rhsQuery);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (lhsHits[i].id != rhsHits[i].id) return false;
+		}
+		return true;
+	}
+
+	// PhysX 없이 구/AABB 로만 도는 참조 백엔드: 배치 실행과 쿼리 하나씩 실행하는 경우
+	void RunReference(GameBuilder::BenchReport& report)
+	{
+		ReferenceSceneQueryBackend backend;
+		std::vector<Vector3> shapeMin, shapeMax;
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> position(-100.f, 100.f);
+		std::uniform_real_distribution<float> size(0.3f, 1.5f);
+		for (uint32_t i = 0; i < ShapeCount; ++i)
+		{
+			const Vector3 center(position(random), size(random), position(random));
+			Vector3 extents;
+			if (0 == i % 2)
+			{
+				const float radius = size(random);
+				extents = { radius, radius, radius };
+				backend.AddSphere(i + 1, i % LayerCount, center, radius);
+			}
+			else
+			{
+				extents = { size(random), size(random), size(random) };
+				backend.AddBox(i + 1, i % LayerCount, center, extents);
+			}
+			shapeMin.push_back(center - extents);
+			shapeMax.push_back(center + extents);
+		}
+
+		// 지형/벽/몬스터 3 개 레이어만 본다
+		const unsigned int layerMask = (1u << 0) | (1u << 2) | (1u << 5);
+		SceneQueryBatch batch;
+		FillFrameQueries(batch, layerMask);
+		const uint64_t queryCount = batch.Size();
+		const std::string suffix = " " + std::to_string(queryCount) + "q " + std::to_string(ShapeCount) + "s";
+
+		report.Measure("scene_query/reference_batch" + suffix, queryCount, Repeat, [&] { backend.Execute(batch); });
+
+		// 예전처럼 호출할 때마다 쿼리 하나를 실행한다 (배치를 재사용해 할당 비용은 뺀다)
+		SceneQueryBatch single;
+		bool matches = true;
+		report.Measure("scene_query/reference_per_query" + suffix, queryCount, Repeat, [&]
+		{
+			for (uint32_t i = 0; i < queryCount; ++i)
+			{
+				single.Clear();
+				single.Add(batch.queries[i]);
+				backend.Execute(single);
+				matches &= SameHits(batch, i, single, 0);
+			}
+		});
+		report.Check(matches, "scene_query/reference_batch_matches_per_query");
+
+		// SSE 사전 필터와 비교할 스칼라 AoS 필터 (레이어 + 쿼리 경계 상자만, 교차 검사는 하지 않는다)
+		uint64_t candidateCount{};
+		report.Measure("scene_query/scalar_prefilter_only" + suffix, queryCount, Repeat, [&]
+		{
+			for (const SceneQuery& query : batch.queries)
+			{
+				Vector3 direction = query.direction;
+				direction.Normalize();
+				const Vector3 end = query.origin + direction * query.distance;
+				const float radius = query.shape.x;
+				const Vector3 boundsMin = Vector3::Min(query.origin, end) - Vector3(radius, radius, radius);
+				const Vector3 boundsMax = Vector3::Max(query.origin, end) + Vector3(radius, radius, radius);
+				for (uint32_t i = 0; i < ShapeCount; ++i)
+				{
+					if (0 == ((1u << (i % LayerCount)) & layerMask)) continue;
+					if (shapeMin[i].x > boundsMax.x || boundsMin.x > shapeMax[i].x) continue;
+					if (shapeMin[i].y > boundsMax.y || boundsMin.y > shapeMax[i].y) continue;
+					if (shapeMin[i].z > boundsMax.z || boundsMin.z > shapeMax[i].z) continue;
+					++candidateCount;
+				}
+			}
+		});
+		report.Check(0 != candidateCount, "scene_query/scalar_prefilter_finds_candidates");
+
+		// 레이어 마스크 0 은 실행하지 않고, 필터 밖 레이어는 결과에 나오지 않는다
+		bool layersRespected = true;
+		for (uint32_t i = 0; i < queryCount; ++i)
+		{
+			const SceneQueryHit* hits = batch.GetHits(i);
+			for (uint32_t h = 0; h < batch.GetHitCount(i); ++h)
+			{
+				layersRespected &= 0 != ((1u << hits[h].layer) & layerMask);
+			}
+		}
+		SceneQueryBatch masked;
+		FillFrameQueries(masked, 0);
+		backend.Execute(masked);
+		bool maskedEmpty = true;
+		for (uint32_t i = 0; i < masked.Size(); ++i)
+		{
+			maskedEmpty &= 0 == masked.GetHitCount(i);
+		}
+		report.Check(layersRespected && maskedEmpty, "scene_query/reference_layer_mask_filters_hits");
+	}
+
+	// PhysX 백엔드: 잡 시스템으로 나눠 도는 배치 레이캐스트와 예전 단일 RaycastAll 호출
+	void RunPhysX(GameBuilder::BenchReport& report)
+	{
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> position(-100.f, 100.f);
+		for (uint32_t i = 0; i < PhysXBoxCount; ++i)
+		{
+			BoxColliderInfo info{};
+			info.colliderInfo.id = BaseId + i;
+			info.colliderInfo.layerNumber = i % LayerCount;
+			info.colliderInfo.collsionTransform.worldPosition = { position(random), 1.f, position(random) };
+			info.colliderInfo.collsionTransform.worldRotation = DirectX::SimpleMath::Quaternion::Identity;
+			info.colliderInfo.collsionTransform.worldScale = { 1.f, 1.f, 1.f };
+			info.boxExtent = { 1.f, 1.f, 1.f };
+			Physics->CreateStaticBody(info, EColliderType::COLLISION);
+		}
+		// 새 액터는 다음 Update 에서 씬에 들어간다
+		Physics->Update(1.f / 60.f);
+
+		std::uniform_real_distribution<float> angle(0.f, 6.2831853f);
+		SceneQueryBatch batch;
+		std::vector<RayCastInput> rays(RayCount);
+		for (RayCastInput& ray : rays)
+		{
+			const float yaw = angle(random);
+			ray.layerNumber = ~0u;
+			ray.origin = { position(random), 1.f, position(random) };
+			ray.direction = { std::cos(yaw), 0.f, std::sin(yaw) };
+			ray.distance = 10.f;
+			batch.AddRaycast(ray.origin, ray.direction, ray.distance, ray.layerNumber);
+		}
+
+		const std::string suffix = " " + std::to_string(RayCount) + "q " + std::to_string(PhysXBoxCount) + "s";
+		std::vector<uint32_t> singleCounts(RayCount);
+		report.Measure("scene_query/physx_single_raycast_all" + suffix, RayCount, Repeat, [&]
+		{
+			for (uint32_t i = 0; i < RayCount; ++i)
+			{
+				singleCounts[i] = Physics->RaycastAll(rays[i]).hitSize;
+			}
+		});
+		report.Measure("scene_query/physx_batch" + suffix, RayCount, Repeat, [&] { Physics->ExecuteSceneQueries(batch); });
+
+		bool matches = true;
+		for (uint32_t i = 0; i < RayCount; ++i)
+		{
+			matches &= singleCounts[i] == batch.GetHitCount(i);
+		}
+		report.Check(matches, "scene_query/physx_batch_matches_single");
+
+		for (uint32_t i = 0; i < PhysXBoxCount; ++i)
+		{
+			Physics->DestroyActor(BaseId + i);
+		}
+		Physics->Update(1.f / 60.f);
+	}
+}
+
+void GameBuilder::SceneQueryBench(BenchReport& report)
+{
+	RunReference(report);
+	RunPhysX(report);
+}
@@ -0,0 +1,160 @@
+#include "HeadlessBench.h"
+#include "Scene.h"
+#include "MeshRenderer.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 20;
+
+	struct Shape
+	{
+		const char* name;
+		size_t		roots;
+		size_t		childrenPerNode;	// 0 이면 roots 아래로 depth 만큼 일자 체인
+		size_t		depth;
+	};
+
+	// 노드 수는 16k ~ 22k
+	constexpr Shape Shapes[] =
+	{
+		{ "deep",  32,  0,   511 },	// 32 개의 512 단 체인 (레벨 512 개, 레벨당 32 노드)
+		{ "wide",  128, 127, 1   },	// 128 루트 x 127 자식 (레벨 2 개, 병렬 구간이 넓다)
+		{ "bushy", 4,   4,   6   },	// 4 루트, 4 갈래 7 단 트리
+	};
+
+	std::unique_ptr<Scene> BuildScene(const Shape& shape, std::vector<GameObject*>& outNodes)
+	{
+		std::unique_ptr<Scene> scene(Scene::CreateNewScene("TransformBench"));
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> offset(-2.f, 2.f);
+
+		size_t serial = 0;
+		auto create = [&](GameObject::Index parentIndex)
+		{
+			// 고유 이름을 직접 붙여 GenerateUniqueGameObjectName 의 접미사 탐색을 피한다
+			auto object = scene->CreateGameObject("Node_" + std::to_string(serial++), GameObjectType::Empty, parentIndex);
+			object->m_transform.SetPosition({ offset(random), offset(random), offset(random) });
+			object->m_transform.SetRotation(Mathf::Quaternion::CreateFromYawPitchRoll(offset(random), 0.f, 0.f));
+			outNodes.push_back(object.get());
+			return object->m_index;
+		};
+
+		std::vector<GameObject::Index> frontier;
+		for (size_t i = 0; i < shape.roots; ++i)
+		{
+			frontier.push_back(create(0));
+		}
+
+		for (size_t level = 0; level < shape.depth; ++level)
+		{
+			std::vector<GameObject::Index> next;
+			for (GameObject::Index parent : frontier)
+			{
+				const size_t children = (0 == shape.childrenPerNode) ? 1 : shape.childrenPerNode;
+				for (size_t c = 0; c < children; ++c)
+				{
+					next.push_back(create(parent));
+				}
+			}
+			frontier.swap(next);
+		}
+
+		return scene;
+	}
+
+	// 예전 Scene::UpdateModelRecursive 와 같은 일: shared_ptr 를 따라 내려가며 노드마다
+	// GetComponent<MeshRenderer> 를 찾고 움직임과 상관없이 전부 다시 계산한다
+	void UpdateRecursive(Scene& scene, GameObject::Index index, const Mathf::xMatrix& parentWorld)
+	{
+		const auto& object = scene.m_SceneObjects[index];
+		if (!object || object->IsDestroyMark())
+		{
+			return;
+		}
+
+		if (object->m_transform.IsDirty())
+		{
+			if (auto renderer = object->GetComponent<MeshRenderer>())
+			{
+				renderer->SetNeedUpdateCulling(true);
+			}
+		}
+
+		const Mathf::xMatrix world = XMMatrixMultiply(object->m_transform.GetLocalMatrix(), parentWorld);
+		object->m_transform.SetAndDecomposeMatrix(world);
+
+		for (GameObject::Index child : object->m_childrenIndices)
+		{
+			if (child != index)
+			{
+				UpdateRecursive(scene, child, world);
+			}
+		}
+	}
+
+	void RunShape(GameBuilder::BenchReport& report, const Shape& shape)
+	{
+		std::vector<GameObject*> nodes;
+		std::unique_ptr<Scene> scene = BuildScene(shape, nodes);
+		const uint64_t nodeCount = nodes.size();
+		const std::string suffix = std::string(" ") + shape.name + " " + std::to_string(nodeCount);
+
+		// 첫 Update 는 깊이 순 재구성 + 전체 전파
+		report.Measure("transform/rebuild+full" + suffix, nodeCount, 1, [&] { scene->AllUpdateWorldMatrix(); });
+
+		// 아무것도 안 움직인 프레임
+		report.Measure("transform/clean" + suffix, nodeCount, Repeat, [&] { scene->AllUpdateWorldMatrix(); });
+
+		// 10% 가 움직인 프레임 (움직인 노드의 서브트리까지 다시 계산된다)
+		std::mt19937 random(7);
+		std::uniform_int_distribution<size_t> pick(0, nodes.size() - 1);
+		std::vector<GameObject*> movers(nodes.size() / 10);
+		for (GameObject*& mover : movers)
+		{
+			mover = nodes[pick(random)];
+		}
+		report.Measure("transform/dirty10%" + suffix, nodeCount, Repeat, [&]
+		{
+			for (GameObject* mover : movers)
+			{
+				mover->m_transform.AddPosition({ 0.01f, 0.f, 0.f });
+			}
+			scene->AllUpdateWorldMatrix();
+		});
+
+		// 계층이 낸 월드 행렬이 예전 재귀 방식 결과와 같아야 한다
+		std::vector<Mathf::xMatrix> propagated;
+		propagated.reserve(nodes.size());
+		for (GameObject* node : nodes)
+		{
+			propagated.push_back(node->m_transform.GetWorldMatrix());
+		}
+
+		// 같은 계층을 예전 재귀 방식으로 돌린 기준값
+		report.Measure("transform/legacy_recursive" + suffix, nodeCount, Repeat, [&]
+		{
+			UpdateRecursive(*scene, 0, XMMatrixIdentity());
+		});
+
+		bool matches = true;
+		for (size_t i = 0; i < nodes.size() && matches; ++i)
+		{
+			const Mathf::xMatrix recursive = nodes[i]->m_transform.GetWorldMatrix();
+			for (int row = 0; row < 4; ++row)
+			{
+				matches &= XMVector4NearEqual(propagated[i].r[row], recursive.r[row], XMVectorReplicate(1e-3f));
+			}
+		}
+		report.Check(matches, "transform/matches_recursive" + suffix);
+	}
+}
+
+void GameBuilder::TransformBench(BenchReport& report)
+{
+	for (const Shape& shape : Shapes)
+	{
+		RunShape(report, shape);
+	}
+}
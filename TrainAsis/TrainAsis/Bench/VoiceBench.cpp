@@ -0,0 +1,150 @@
+#include "HeadlessBench.h"
+#include "VirtualVoiceSystem.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int Repeat = 10;
+	constexpr uint32_t SfxBus = 0;
+	constexpr uint32_t UiBus = 1;
+	constexpr uint32_t SfxChannels = 32;
+	constexpr AudioClipId ClipCount = 16;
+	constexpr int FrameCount = 60;
+	constexpr float FrameSeconds = 1.f / 60.f;
+
+	// 200m 필드에 흩어진 루프 3D 소리 (횃불, 물, 몬스터 숨소리 ...)
+	VoiceDesc MakeAmbient(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> position(-100.f, 100.f);
+		std::uniform_int_distribution<AudioClipId> clip(0, ClipCount - 1);
+
+		VoiceDesc desc{};
+		desc.clip = clip(random);
+		desc.bus = SfxBus;
+		desc.loop = true;
+		desc.is3D = true;
+		desc.spatialBlend = 1.f;
+		desc.position = { position(random), 0.f, position(random) };
+		desc.minDistance = 2.f;
+		desc.maxDistance = 40.f;
+		return desc;
+	}
+
+	void RunVoiceCount(GameBuilder::BenchReport& report, uint32_t voiceCount)
+	{
+		const std::string suffix = " " + std::to_string(voiceCount);
+
+		NullAudioBackend backend;
+		for (AudioClipId clip = 0; clip < ClipCount; ++clip)
+		{
+			backend.SetClipLengthMs(clip, 2'000 + clip * 250);
+		}
+
+		VirtualVoiceSystem voices(backend);
+		voices.SetBusLimit(SfxBus, SfxChannels);
+
+		std::mt19937 random(22);
+		for (uint32_t i = 0; i < voiceCount; ++i)
+		{
+			voices.Play(MakeAmbient(random));
+		}
+
+		// 플레이어가 필드를 가로지르며 걷는 동안의 프레임당 Update (순위 재배정 포함)
+		bool withinLimit = true;
+		report.Measure("voice/update" + suffix, voiceCount * static_cast<uint64_t>(FrameCount), Repeat, [&]
+		{
+			for (int frame = 0; frame < FrameCount; ++frame)
+			{
+				const float x = -100.f + 200.f * static_cast<float>(frame) / FrameCount;
+				voices.SetListener({ x, 0.f, 0.f });
+				voices.Update(FrameSeconds);
+				withinLimit &= voices.GetRealCount() <= SfxChannels;
+			}
+		});
+		report.Check(withinLimit && backend.GetPlayingCount() == voices.GetRealCount(), "voice/real_channels_within_bus_limit" + suffix);
+	}
+
+	void RunPlayStop(GameBuilder::BenchReport& report)
+	{
+		constexpr uint32_t PlayCount = 10'000;
+		NullAudioBackend backend;
+		backend.SetClipLengthMs(0, 500);
+		VirtualVoiceSystem voices(backend);
+		voices.SetBusLimit(SfxBus, SfxChannels);
+
+		// 원샷 SFX 요청과 정지 (슬롯 재사용)
+		VoiceDesc desc{};
+		desc.clip = 0;
+		desc.bus = SfxBus;
+		std::vector<VoiceHandle> handles(PlayCount);
+		report.Measure("voice/play+stop " + std::to_string(PlayCount), PlayCount, Repeat, [&]
+		{
+			for (VoiceHandle& handle : handles)
+			{
+				handle = voices.Play(desc);
+			}
+			for (VoiceHandle handle : handles)
+			{
+				voices.Stop(handle);
+			}
+		});
+		report.Check(0 == voices.GetActiveCount() && 0 == voices.GetRealCount(), "voice/play_stop_releases_every_slot");
+
+		// 타격음처럼 같은 클립을 연타하는 라운드로빈 풀 (클립/버스 정수 키)
+		std::mt19937 random(7);
+		std::uniform_int_distribution<AudioClipId> clip(0, ClipCount - 1);
+		report.Measure("voice/play_pooled " + std::to_string(PlayCount), PlayCount, Repeat, [&]
+		{
+			for (uint32_t i = 0; i < PlayCount; ++i)
+			{
+				desc.clip = clip(random);
+				voices.PlayPooled(desc);
+			}
+		});
+		report.Check(voices.GetActiveCount() <= ClipCount * VirtualVoiceSystem::DefaultPoolCapacity, "voice/pool_caps_active_voices");
+	}
+
+	// 가상으로 밀려난 동안에도 재생 위치가 흐르고, 다시 실제가 되면 그 위치부터 시작해야 한다
+	void CheckVirtualResume(GameBuilder::BenchReport& report)
+	{
+		NullAudioBackend backend;
+		backend.SetClipLengthMs(0, 10'000);
+		VirtualVoiceSystem voices(backend);
+		voices.SetBusLimit(UiBus, 1);
+
+		VoiceDesc quiet{};
+		quiet.clip = 0;
+		quiet.bus = UiBus;
+		quiet.volume = 0.5f;
+		const VoiceHandle background = voices.Play(quiet);
+		voices.Update(1.f);
+
+		VoiceDesc loud = quiet;
+		loud.volume = 1.f;
+		const VoiceHandle stolen = voices.Play(loud);
+		voices.Update(0.5f);
+		report.Check(voices.IsReal(stolen) && !voices.IsReal(background) && voices.IsPlaying(background),
+			"voice/louder_voice_takes_channel");
+
+		voices.Stop(stolen);
+		voices.Update(0.5f);
+		const NullAudioBackend::Channel* channel = backend.Find(voices.GetChannel(background, false));
+		report.Check(channel && 2'000 == channel->params.startMs, "voice/virtual_voice_resumes_at_elapsed_offset");
+
+		// 멈춘 보이스의 슬롯을 새 보이스가 재사용해도 옛 핸들은 새 보이스를 건드리지 못한다
+		const VoiceHandle reused = voices.Play(loud);
+		voices.Stop(stolen);
+		report.Check(stolen.index == reused.index && !voices.IsPlaying(stolen) && voices.IsPlaying(reused),
+			"voice/stale_handle_ignored_after_slot_reuse");
+	}
+}
+
+void GameBuilder::VoiceBench(BenchReport& report)
+{
+	RunVoiceCount(report, 256);
+	RunVoiceCount(report, 1'024);
+	RunVoiceCount(report, 4'096);
+	RunPlayStop(report);
+	CheckVirtualResume(report);
+}
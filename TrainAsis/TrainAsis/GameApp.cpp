@@ -23,13 +23,20 @@
 #include "InputActionManager.h"
 #include "EngineBootstrap.h"
 #include "PakHelper.h"
+#include "HeadlessApp.h"
 
 #pragma comment(linker,"\"/manifestdependency:type='win32' \
 name='Microsoft.Windows.Common-Controls' version='6.0.0.0' \
 processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
 
-MAIN_ENTRY wWinMain(HINSTANCE hInstance, HINSTANCE, PWSTR, int nCmdShow)
+MAIN_ENTRY wWinMain(HINSTANCE hInstance, HINSTANCE, PWSTR lpCmdLine, int nCmdShow)
 {
+	// -headless : â  ùķ̼Ǹ  ýۺ ð  (CI )
+	if (nullptr != lpCmdLine && nullptr != wcsstr(lpCmdLine, L"-headless"))
+	{
+		return EngineBootstrap::Run<GameBuilder::HeadlessApp>(hInstance, L"Kori: the Spritail", 1920, 1080);
+	}
+
 	return EngineBootstrap::Run<GameBuilder::App>(hInstance, L"Kori: the Spritail", 1920, 1080);
 }
 
@@ -49,7 +56,7 @@ void GameBuilder::App::Finalize()
 {
 	m_main->Finalize();
 	m_deviceResources->ReportLiveDeviceObjects();
-	CleanupUnpackedGameAssets();
+	PakFileSystems->Unmount();
 }
 
 void GameBuilder::App::SetWindow(CoreWindow& coreWindow)
@@ -41,10 +41,7 @@ void DirectX11::GameMain::Initialize()
 {
     m_deviceResources->RegisterDeviceNotify(this);
 
-    XMFLOAT3 center = { 0.0f, 0.0f, 0.0f };
-    XMFLOAT3 extents = { 2000.f, 2000.f, 2000.f };
-    BoundingBox fixedBounds(center, extents);
-    CullingManagers->Initialize(fixedBounds, 3, 30);
+    CullingManagers->Initialize();
     TagManagers->Initialize();
 
     m_sceneRenderer = std::make_shared<SceneRenderer>(m_deviceResources);
@@ -193,6 +190,7 @@ void DirectX11::GameMain::Update()
         InfoWindow();
         InputManagement->Update(EngineSettingInstance->frameDeltaTime);
 
+        SceneManagers->WaitAIUpdate();
         SceneManagers->Initialization();
         SceneManagers->InputEvents(EngineSettingInstance->frameDeltaTime);
         if (!SceneManagers->IsGamePaused())
@@ -0,0 +1,119 @@
+#include "HeadlessApp.h"
+#include "EngineSetting.h"
+#include "SceneManager.h"
+#include "PakHelper.h"
+#include "Bench/HeadlessBench.h"
+#include <shellapi.h>
+
+void GameBuilder::HeadlessApp::Initialize(HINSTANCE hInstance, const wchar_t* title, int width, int height)
+{
+	m_sceneName = EngineSettingInstance->GetStartupSceneName();
+	ParseCommandLine();
+
+	m_main = std::make_unique<DirectX11::HeadlessMain>();
+	m_main->Initialize(m_sceneName);
+
+	if (IsBenchRun())
+	{
+		RunBench();
+		return;
+	}
+
+	Run();
+}
+
+void GameBuilder::HeadlessApp::Finalize()
+{
+	if (!IsBenchRun())
+	{
+		m_main->Report(m_reportPath);
+	}
+	m_main->Finalize();
+	PakFileSystems->Unmount();
+}
+
+void GameBuilder::HeadlessApp::ParseCommandLine()
+{
+	int argc = 0;
+	LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+	if (nullptr == argv)
+	{
+		return;
+	}
+
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		const std::wstring_view option = argv[i];
+		const wchar_t* value = argv[i + 1];
+		if (option == L"-ticks")
+		{
+			m_tickCount = static_cast<uint32_t>(std::wcstoul(value, nullptr, 10));
+			++i;
+		}
+		else if (option == L"-dt")
+		{
+			const float deltaSecond = std::wcstof(value, nullptr);
+			if (0.f < deltaSecond)
+			{
+				m_deltaSecond = deltaSecond;
+			}
+			++i;
+		}
+		else if (option == L"-scene")
+		{
+			m_sceneName = value;
+			++i;
+		}
+		else if (option == L"-report")
+		{
+			m_reportPath = file::path(value).string();
+			++i;
+		}
+		else if (option == L"-bench")
+		{
+			m_benchFilter = value;
+			++i;
+		}
+		else if (option == L"-check")
+		{
+			m_checkFilter = value;
+			++i;
+		}
+	}
+
+	LocalFree(argv);
+}
+
+void GameBuilder::HeadlessApp::Run()
+{
+	for (uint32_t tick = 0; tick < m_tickCount; ++tick)
+	{
+		if (SceneManagers->IsDecommissioning())
+		{
+			break;
+		}
+
+		m_main->Tick(m_deltaSecond);
+	}
+}
+
+void GameBuilder::HeadlessApp::RunBench()
+{
+	BenchReport report;
+	if (!m_benchFilter.empty())
+	{
+		RunBenches(m_benchFilter, report);
+	}
+	if (!m_checkFilter.empty())
+	{
+		RunChecks(m_checkFilter, report);
+	}
+
+	report.Print();
+	if (!m_reportPath.empty())
+	{
+		report.Write(m_reportPath);
+	}
+
+	m_exitCode = report.HasFailure() ? 1 : 0;
+}
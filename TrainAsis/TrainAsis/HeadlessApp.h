@@ -0,0 +1,40 @@
+#pragma once
+#include "Core.Minimal.h"
+#include "HeadlessMain.h"
+#include <memory>
+#include <string>
+
+namespace GameBuilder
+{
+	// -headless 로 실행했을 때의 앱. 창도 D3D 디바이스도 만들지 않고 정해진 틱 수만큼 시뮬레이션한 뒤 시스템별 시간을 남긴다.
+	// 옵션: -ticks <횟수> -dt <초> -scene <씬 파일> -report <csv 경로>
+	//       -bench <이름|all> : 틱 대신 합성 벤치마크를 돌리고 결과를 -report 에 남긴다
+	//       -check <이름|all> : 틱 대신 동작 검사를 돌린다 (-bench 와 같이 주면 둘 다 돈다)
+	class HeadlessApp final
+	{
+	public:
+		HeadlessApp() = default;
+		~HeadlessApp() = default;
+		void Initialize(HINSTANCE hInstance, const wchar_t* title, int width, int height);
+		void Finalize();
+		// 검사가 실패하면 0 이 아닌 값을 돌려줘 CI 가 알 수 있게 한다
+		int GetExitCode() const { return m_exitCode; }
+
+	private:
+		void ParseCommandLine();
+		void Run();
+		void RunBench();
+		bool IsBenchRun() const { return !m_benchFilter.empty() || !m_checkFilter.empty(); }
+
+	private:
+		std::unique_ptr<DirectX11::HeadlessMain> m_main;
+
+		uint32_t m_tickCount{ 600 };
+		float m_deltaSecond{ 1.f / 60.f };
+		std::wstring m_sceneName;
+		std::string m_reportPath;
+		std::wstring m_benchFilter;
+		std::wstring m_checkFilter;
+		int m_exitCode{};
+	};
+}
@@ -0,0 +1,171 @@
+#include "HeadlessMain.h"
+#include "Benchmark.hpp"
+#include "TimeSystem.h"
+#include "HotLoadSystem.h"
+#include "DataSystem.h"
+#include "SceneManager.h"
+#include "Scene.h"
+#include "EngineSetting.h"
+#include "CullingManager.h"
+#include "TagManager.h"
+#include "ProxyCommandQueue.h"
+#include "ProxyUpdateStream.h"
+#include "EffectProxyController.h"
+#include "Core.JobSystem.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace
+{
+	constexpr const char* PhaseNames[] =
+	{
+		"Initialization",
+		"Physics",
+		"Update",
+		"Coroutine",
+		"Animation",
+		"LateUpdate",
+		"DisableOrEnable",
+		"AI",
+		"EndOfFrame",
+		"ProxySink",
+	};
+	static_assert(std::size(PhaseNames) == static_cast<size_t>(DirectX11::HeadlessMain::Phase::Count));
+}
+
+DirectX11::HeadlessMain::HeadlessMain()
+{
+}
+
+DirectX11::HeadlessMain::~HeadlessMain()
+{
+}
+
+void DirectX11::HeadlessMain::Initialize(const std::wstring& sceneName)
+{
+    // DeviceStates 는 비워 둔다. 텍스처/폰트/카메라 버퍼 생성은 디바이스가 없으면 건너뛴다.
+    CullingManagers->Initialize();
+    TagManagers->Initialize();
+
+    // 컴포넌트가 등록할 곳만 있으면 되므로 SceneRenderer 없이 헤드리스 RenderScene 만 만든다
+    m_renderScene = std::make_shared<RenderScene>();
+    SceneManagers->SetRenderScene(m_renderScene.get());
+    m_renderScene->InitializeHeadless();
+
+    ScriptManager->Initialize();
+    DataSystems->Initialize();
+    SceneManagers->CreateScene();
+
+    SceneManagers->ManagerInitialize();
+    PhysicsManagers->Initialize();
+
+    file::path scenePath = PathFinder::Relative("Scenes").append(sceneName);
+    SceneManagers->LoadSceneImmediate(scenePath.string());
+}
+
+void DirectX11::HeadlessMain::Finalize()
+{
+    TagManagers->Finalize();
+    SceneManagers->Decommissioning();
+    DrainProxyCommands();
+
+    m_renderScene->Finalize();
+}
+
+void DirectX11::HeadlessMain::Tick(float deltaSecond)
+{
+    auto measure = [&](Phase phase, auto&& func)
+    {
+        Benchmark benchmark;
+        func();
+        const double elapsed = benchmark.GetElapsedTime();
+
+        PhaseStat& stat = m_phaseStats[static_cast<size_t>(phase)];
+        stat.totalMs += elapsed;
+        stat.maxMs = (std::max)(stat.maxMs, elapsed);
+    };
+
+    Benchmark tickBenchmark;
+    EngineSettingInstance->frameDeltaTime = deltaSecond;
+
+    Time->ManualTick(TimeSystem::SecondsToTicks(deltaSecond), [&]
+    {
+        // SceneManager::GameLogic 과 같은 순서로 돌리되 시스템별로 나눠 잰다
+        // AI 는 창 모드와 같이 지난 틱 끝에 띄운 작업을 프레임 시작에서 기다린 시간이다
+        measure(Phase::AI, [&] { SceneManagers->WaitAIUpdate(); });
+        measure(Phase::Initialization, [&] { SceneManagers->Initialization(); });
+        SceneManagers->InputEvents(deltaSecond);
+
+        Scene* scene = SceneManagers->GetActiveScene();
+        measure(Phase::Physics,     [&] { SceneManagers->Physics(deltaSecond); });
+        measure(Phase::Update,      [&] { scene->Update(deltaSecond); });
+        measure(Phase::Coroutine,   [&] { scene->YieldNull(); });
+        measure(Phase::Animation,   [&] { InternalAnimationUpdateEvent.Broadcast(deltaSecond); });
+        measure(Phase::LateUpdate,  [&] { scene->LateUpdate(deltaSecond); });
+    });
+
+    measure(Phase::DisableOrEnable, [&] { SceneManagers->DisableOrEnable(); });
+    measure(Phase::EndOfFrame, [&] { SceneManagers->EndOfFrame(); });
+    measure(Phase::ProxySink, [&] { DrainProxyCommands(); });
+
+    const double tickElapsed = tickBenchmark.GetElapsedTime();
+    m_tickTotalMs += tickElapsed;
+    m_tickMaxMs = (std::max)(m_tickMaxMs, tickElapsed);
+    ++m_tickCount;
+}
+
+void DirectX11::HeadlessMain::DrainProxyCommands()
+{
+    // 헤드리스 RenderScene 은 프록시를 만들지 않지만 큐에 들어온 명령(이펙트 등)은 프레임마다 버린다.
+    // 비우지 않으면 명령 큐와 갱신 스트림이 프레임마다 쌓이기만 한다.
+    m_renderScene->OnProxyDestroy();
+
+    ProxyUpdateStream->PublishFrame(ProxyCommandQueue->AddFrame());
+    ProxyUpdateStream->Execute();
+
+    EffectProxyController::GetInstance()->AddFrame();
+    EffectProxyController::GetInstance()->DiscardEffectCommands();
+}
+
+void DirectX11::HeadlessMain::Report(const std::string& reportPath) const
+{
+    const double tickCount = static_cast<double>((std::max)(m_tickCount, uint64_t{ 1 }));
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(4);
+    oss << "[Headless] ticks: " << m_tickCount
+        << " avg: " << m_tickTotalMs / tickCount << "ms"
+        << " max: " << m_tickMaxMs << "ms\n";
+
+    for (size_t i = 0; i < m_phaseStats.size(); ++i)
+    {
+        const PhaseStat& stat = m_phaseStats[i];
+        oss << "  " << std::left << std::setw(16) << PhaseNames[i] << std::right
+            << " avg: " << stat.totalMs / tickCount << "ms"
+            << " max: " << stat.maxMs << "ms"
+            << " total: " << stat.totalMs << "ms\n";
+    }
+
+    Debug->Log(oss.str());
+
+    if (!reportPath.empty())
+    {
+        std::ofstream reportFile(reportPath, std::ios::trunc);
+        if (!reportFile.is_open())
+        {
+            Debug->LogError("Failed to open headless report file: " + reportPath);
+            return;
+        }
+
+        reportFile << "phase,avg_ms,max_ms,total_ms\n";
+        reportFile << std::fixed << std::setprecision(4);
+        reportFile << "Tick," << m_tickTotalMs / tickCount << "," << m_tickMaxMs << "," << m_tickTotalMs << "\n";
+        for (size_t i = 0; i < m_phaseStats.size(); ++i)
+        {
+            const PhaseStat& stat = m_phaseStats[i];
+            reportFile << PhaseNames[i] << "," << stat.totalMs / tickCount << "," << stat.maxMs << "," << stat.totalMs << "\n";
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "RenderScene.h"
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace DirectX11
+{
+	// 창/스왑체인/렌더 스레드 없이 씬, 물리, AI, 애니메이션, 코루틴만 고정 틱으로 돌린다 (CI 용)
+	// D3D 디바이스, ShaderSystem, 이펙트 풀 없이 돈다. RenderScene 은 헤드리스 모드로 만들어 프록시 등록을 버린다.
+	class HeadlessMain
+	{
+	public:
+		enum class Phase
+		{
+			Initialization,
+			Physics,
+			Update,
+			Coroutine,
+			Animation,
+			LateUpdate,
+			DisableOrEnable,
+			AI,
+			EndOfFrame,
+			ProxySink,
+			Count,
+		};
+
+		struct PhaseStat
+		{
+			double totalMs{};
+			double maxMs{};
+		};
+
+		HeadlessMain();
+		~HeadlessMain();
+
+		void Initialize(const std::wstring& sceneName);
+		void Finalize();
+
+		// 실제 시간과 상관없이 deltaSecond 만큼 한 프레임 진행한다
+		void Tick(float deltaSecond);
+		void Report(const std::string& reportPath) const;
+
+	private:
+		void DrainProxyCommands();
+
+	private:
+		std::shared_ptr<RenderScene> m_renderScene;
+
+		std::array<PhaseStat, static_cast<size_t>(Phase::Count)> m_phaseStats{};
+		uint64_t m_tickCount{};
+		double m_tickTotalMs{};
+		double m_tickMaxMs{};
+	};
+}
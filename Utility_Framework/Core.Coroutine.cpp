@@ -1,84 +1,188 @@
 #include "Core.Coroutine.h"
 #include "TimeSystem.h"
+#include "SpinLock.h"
+
+namespace
+{
+    // 64 바이트 단위 크기 클래스. 이보다 큰 프레임은 전역 힙으로 보낸다
+    constexpr std::size_t FrameGranularity = 64;
+    constexpr std::size_t MaxPooledFrameSize = 2048;
+    constexpr std::size_t FrameClassCount = MaxPooledFrameSize / FrameGranularity;
+    constexpr std::size_t FramesPerPage = 32;
+
+    struct FreeFrame
+    {
+        FreeFrame* next;
+    };
+
+    struct FramePool
+    {
+        std::atomic_flag flag{};
+        FreeFrame* head{ nullptr };
+        std::vector<std::unique_ptr<std::byte[]>> pages;
+    };
+
+    FramePool& GetFramePool(std::size_t classIndex)
+    {
+        // 종료 중에 소멸되는 코루틴도 반납할 수 있도록 풀은 해제하지 않는다
+        static FramePool* pools = new FramePool[FrameClassCount];
+        return pools[classIndex];
+    }
+
+    std::size_t GetFrameClass(std::size_t size)
+    {
+        return (size + FrameGranularity - 1) / FrameGranularity - 1;
+    }
+}
+
+void* CoroutineFrameAllocator::Allocate(std::size_t size)
+{
+    if (size > MaxPooledFrameSize)
+    {
+        return ::operator new(size);
+    }
+
+    const std::size_t classIndex = GetFrameClass(size);
+    FramePool& pool = GetFramePool(classIndex);
+
+    SpinLock lock(pool.flag);
+    if (nullptr == pool.head)
+    {
+        const std::size_t blockSize = (classIndex + 1) * FrameGranularity;
+        auto page = std::make_unique<std::byte[]>(blockSize * FramesPerPage);
+        for (std::size_t i = 0; i < FramesPerPage; ++i)
+        {
+            FreeFrame* frame = reinterpret_cast<FreeFrame*>(page.get() + blockSize * i);
+            frame->next = pool.head;
+            pool.head = frame;
+        }
+        pool.pages.push_back(std::move(page));
+    }
+
+    FreeFrame* frame = pool.head;
+    pool.head = frame->next;
+    return frame;
+}
+
+void CoroutineFrameAllocator::Deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (nullptr == ptr)
+    {
+        return;
+    }
+
+    if (size > MaxPooledFrameSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    FramePool& pool = GetFramePool(GetFrameClass(size));
+
+    SpinLock lock(pool.flag);
+    FreeFrame* frame = static_cast<FreeFrame*>(ptr);
+    frame->next = pool.head;
+    pool.head = frame;
+}
+
+void CoroutineManager::TimerQueue::Push(double due, CoroutineWrapper* wrapper)
+{
+    heap.push_back({ due, wrapper, wrapper->waitSerial });
+    std::push_heap(heap.begin(), heap.end(), [](const TimerEntry& a, const TimerEntry& b) { return a.due > b.due; });
+}
+
+void CoroutineManager::TimerQueue::PopDue(double now, std::vector<CoroutineWrapper*>& dueWrappers)
+{
+    auto later = [](const TimerEntry& a, const TimerEntry& b) { return a.due > b.due; };
+    while (!heap.empty() && heap.front().due <= now)
+    {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        const TimerEntry entry = heap.back();
+        heap.pop_back();
+
+        // 기다리는 사이 멈췄거나 다른 대기로 넘어간 코루틴이면 버린다
+        CoroutineWrapper* wrapper = entry.wrapper;
+        if (wrapper->markedForDelete || wrapper->waitSerial != entry.waitSerial)
+        {
+            continue;
+        }
+
+        dueWrappers.push_back(wrapper);
+    }
+}
 
 void CoroutineManager::StartCoroutine(Coroutine<> coroutine)
 {
-    CoroutineWrapper* wrapper = new CoroutineWrapper(std::move(coroutine));
+    CoroutineWrapper* wrapper = AcquireWrapper(std::move(coroutine));
+    wrapper->queue = &StartCoroutineQueue;
     StartCoroutineQueue.Link(wrapper);
-    activeCoroutines.push_back(wrapper);
 }
 
 void CoroutineManager::StartCoroutine(const std::string& alias, Coroutine<> coroutine)
 {
-	CoroutineWrapper* wrapper = new CoroutineWrapper(std::move(coroutine));
+	CoroutineWrapper* wrapper = AcquireWrapper(std::move(coroutine));
 	wrapper->aliasName = alias;
+	wrapper->queue = &StartCoroutineQueue;
 	StartCoroutineQueue.Link(wrapper);
-	activeCoroutines.push_back(wrapper);
 }
 
 void CoroutineManager::StopAllCoroutines()
 {
     for (CoroutineWrapper* wrapper : activeCoroutines)
     {
-        wrapper->markedForDelete = true;
+        MarkForDelete(wrapper);
     }
 }
 
 void CoroutineManager::DestroyCoroutine()
 {
-    for (auto it = activeCoroutines.begin(); it != activeCoroutines.end(); ) {
-        CoroutineWrapper* wrapper = *it;
-        if (wrapper->markedForDelete)
+    // 끝났거나 멈춘 코루틴만 모아 두었으므로 활성 코루틴 전체를 훑지 않는다
+    {
+        SpinLock lock(pendingDestroyFlag);
+        destroyingCoroutines.swap(pendingDestroyCoroutines);
+    }
+
+    for (CoroutineWrapper* wrapper : destroyingCoroutines)
+    {
+        if (wrapper->queue)
         {
-            nullQueue.Unlink(wrapper);
-            waitForFixedUpdateQueue.Unlink(wrapper);
-            waitForEndOfFrameQueue.Unlink(wrapper);
-            it = activeCoroutines.erase(it);
-            coroutineMap.erase(wrapper->aliasName);
-            delete wrapper;
+            wrapper->queue->Unlink(wrapper);
+            wrapper->queue = nullptr;
         }
-        else
+
+        // swap-and-pop
+        CoroutineWrapper* last = activeCoroutines.back();
+        activeCoroutines[wrapper->activeIndex] = last;
+        last->activeIndex = wrapper->activeIndex;
+        activeCoroutines.pop_back();
+
+        if (!wrapper->aliasName.empty())
         {
-            ++it;
+            auto it = coroutineMap.find(wrapper->aliasName);
+            if (it != coroutineMap.end() && it->second == wrapper)
+            {
+                coroutineMap.erase(it);
+            }
         }
+
+        ReleaseWrapper(wrapper);
     }
+    destroyingCoroutines.clear();
 }
 
 void CoroutineManager::DestroyAllCoroutines()
 {
-    for (auto it = activeCoroutines.begin(); it != activeCoroutines.end(); )
-    {
-        CoroutineWrapper* wrapper = *it;
-        nullQueue.Unlink(wrapper);
-        waitForFixedUpdateQueue.Unlink(wrapper);
-        waitForEndOfFrameQueue.Unlink(wrapper);
-        it = activeCoroutines.erase(it);
-        coroutineMap.erase(wrapper->aliasName);
-        delete wrapper;
-    }
-    activeCoroutines.clear();
+    StopAllCoroutines();
+    DestroyCoroutine();
+
+    waitForSecondsTimers.heap.clear();
+    waitForFramesTimers.heap.clear();
 }
 
 void CoroutineManager::yield_Null()
 {
     ProcessQueue(nullQueue);
-
-    for (auto it = activeCoroutines.begin(); it != activeCoroutines.end(); ) {
-        CoroutineWrapper* wrapper = *it;
-        if (wrapper->markedForDelete)
-        {
-            nullQueue.Unlink(wrapper);
-            waitForFixedUpdateQueue.Unlink(wrapper);
-            waitForEndOfFrameQueue.Unlink(wrapper);
-            it = activeCoroutines.erase(it);
-			coroutineMap.erase(wrapper->aliasName);
-            delete wrapper;
-        }
-        else
-        {
-            ++it;
-        }
-    }
+    DestroyCoroutine();
 }
 
 void CoroutineManager::yield_StartCoroutine()
@@ -88,7 +192,8 @@ void CoroutineManager::yield_StartCoroutine()
 
 void CoroutineManager::yield_WaitForSeconds()
 {
-    ProcessQueue(waitForSecondsQueue);
+    m_secondsClock += Time != nullptr ? Time->GetElapsedSeconds() : 0.16f;
+    ProcessTimers(waitForSecondsTimers, m_secondsClock);
 }
 
 void CoroutineManager::yield_WaitForFixedUpdate()
@@ -103,7 +208,8 @@ void CoroutineManager::yield_WaitForEndOfFrame()
 
 void CoroutineManager::yield_OtherEvent()
 {
-    ProcessQueue(waitForFramesQueue);
+    m_frameClock += 1.0;
+    ProcessTimers(waitForFramesTimers, m_frameClock);
     ProcessQueue(waitUntilQueue);
     ProcessQueue(waitForSignalQueue);
 }
@@ -113,74 +219,163 @@ void CoroutineManager::yield_OnRender()
     ProcessQueue(onRenderQueue);
 }
 
+CoroutineManager::CoroutineWrapper* CoroutineManager::AcquireWrapper(Coroutine<>&& coroutine)
+{
+    if (freeWrappers.empty())
+    {
+        auto chunk = std::make_unique<CoroutineWrapper[]>(WrapperChunkSize);
+        for (uint32_t i = WrapperChunkSize; i > 0; --i)
+        {
+            freeWrappers.push_back(&chunk[i - 1]);
+        }
+        wrapperChunks.push_back(std::move(chunk));
+    }
+
+    CoroutineWrapper* wrapper = freeWrappers.back();
+    freeWrappers.pop_back();
+
+    wrapper->coroutine = std::move(coroutine);
+    wrapper->markedForDelete = false;
+    wrapper->activeIndex = static_cast<uint32_t>(activeCoroutines.size());
+    activeCoroutines.push_back(wrapper);
+    return wrapper;
+}
+
+void CoroutineManager::ReleaseWrapper(CoroutineWrapper* wrapper)
+{
+    // 남아 있는 타이머 항목이 재사용된 래퍼를 깨우지 않도록 한다
+    ++wrapper->waitSerial;
+    wrapper->coroutine = Coroutine<>{};
+    wrapper->aliasName.clear();
+    wrapper->onDone = nullptr;
+    freeWrappers.push_back(wrapper);
+}
+
+void CoroutineManager::MarkForDelete(CoroutineWrapper* wrapper)
+{
+    if (wrapper->markedForDelete)
+    {
+        return;
+    }
+
+    wrapper->markedForDelete = true;
+
+    // OnRender 큐에서 끝난 코루틴은 렌더 스레드에서 들어온다
+    SpinLock lock(pendingDestroyFlag);
+    pendingDestroyCoroutines.push_back(wrapper);
+}
+
+void CoroutineManager::Enqueue(CoroutineWrapper* wrapper)
+{
+    const YieldInstruction& instruction = wrapper->coroutine.current();
+
+    LinkedList<CoroutineWrapper>* queue = nullptr;
+    switch (instruction.type)
+    {
+    case YieldInstructionType::None:
+        queue = &StartCoroutineQueue;
+        break;
+    case YieldInstructionType::WaitForFixedUpdate:
+        queue = &waitForFixedUpdateQueue;
+        break;
+    case YieldInstructionType::Null:
+        queue = &nullQueue;
+        break;
+    case YieldInstructionType::WaitForSeconds:
+        ++wrapper->waitSerial;
+        waitForSecondsTimers.Push(m_secondsClock + instruction.timeRemaining, wrapper);
+        return;
+    case YieldInstructionType::WaitForFrames:
+        // 기존처럼 최소 한 프레임은 기다린다
+        ++wrapper->waitSerial;
+        waitForFramesTimers.Push(m_frameClock + (std::max)(instruction.frameRemaining, 1), wrapper);
+        return;
+    case YieldInstructionType::WaitUntil:
+        queue = &waitUntilQueue;
+        break;
+    case YieldInstructionType::WaitForSignal:
+        queue = &waitForSignalQueue;
+        break;
+    case YieldInstructionType::WaitForEndOfFrame:
+        queue = &waitForEndOfFrameQueue;
+        break;
+    case YieldInstructionType::OnRender:
+        queue = &onRenderQueue;
+        break;
+    default:
+        queue = &nullQueue;
+        break;
+    }
+
+    wrapper->queue = queue;
+    queue->Link(wrapper);
+}
+
+void CoroutineManager::Resume(CoroutineWrapper* wrapper)
+{
+    wrapper->coroutine.resume();
+
+    if (wrapper->coroutine.is_done())
+    {
+        if (wrapper->onDone) wrapper->onDone();
+        MarkForDelete(wrapper);
+        return;
+    }
+
+    Enqueue(wrapper);
+}
+
 void CoroutineManager::ProcessQueue(LinkedList<CoroutineWrapper>& queue)
 {
     float deltaTime = Time != nullptr ? Time->GetElapsedSeconds() : 0.16f;
-    for (auto it = queue.begin(); it != queue.end(); )
+
+    // 이번 호출에 들어 있던 코루틴만 처리한다. 깨어나서 같은 큐로 돌아온 코루틴은 다음 호출에서 본다
+    // OnRender 큐는 렌더 스레드에서 돌기 때문에 스레드별 버퍼를 쓴다
+    thread_local std::vector<CoroutineWrapper*> processing;
+    processing.clear();
+    for (auto it = queue.begin(); it != queue.end(); ++it)
     {
-        CoroutineWrapper* wrapper = &(*it);
-        ++it;
+        processing.push_back(&(*it));
+    }
 
-        if (wrapper->markedForDelete)
+    for (CoroutineWrapper* wrapper : processing)
+    {
+        if (wrapper->markedForDelete || wrapper->queue != &queue)
             continue;
 
         if (wrapper->coroutine.is_done())
         {
             if (wrapper->onDone) wrapper->onDone();
             queue.Unlink(wrapper);
-            wrapper->markedForDelete = true;
+            wrapper->queue = nullptr;
+            MarkForDelete(wrapper);
             continue;
         }
 
-        if (wrapper->coroutine.current().Tick(deltaTime))
+        if (!wrapper->coroutine.current().Tick(deltaTime))
         {
-            wrapper->coroutine.resume();
+            continue;
         }
 
-        if (!wrapper->coroutine.is_done())
-        {
-            YieldInstructionType type = wrapper->coroutine.current().type;
-            queue.Unlink(wrapper);
+        queue.Unlink(wrapper);
+        wrapper->queue = nullptr;
+        Resume(wrapper);
+    }
+}
 
-            switch (type)
-            {
-            case YieldInstructionType::None:
-                StartCoroutineQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitForFixedUpdate:
-                waitForFixedUpdateQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::Null:
-                nullQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitForSeconds:
-                waitForSecondsQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitForFrames:
-                waitForFramesQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitUntil:
-                waitUntilQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitForSignal:
-                waitForSignalQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::WaitForEndOfFrame:
-                waitForEndOfFrameQueue.Link(wrapper);
-                break;
-            case YieldInstructionType::OnRender:
-                onRenderQueue.Link(wrapper);
-                break;
-            default:
-                nullQueue.Link(wrapper);
-                break;
-            }
-        }
-        else
+void CoroutineManager::ProcessTimers(TimerQueue& timers, double now)
+{
+    // 먼저 기한이 된 것만 모아 두고 깨운다. 깨어난 코루틴이 다시 넣은 대기는 다음 호출부터 본다
+    dueCoroutines.clear();
+    timers.PopDue(now, dueCoroutines);
+
+    for (CoroutineWrapper* wrapper : dueCoroutines)
+    {
+        if (wrapper->markedForDelete)
         {
-            if (wrapper->onDone) wrapper->onDone();
-            queue.Unlink(wrapper);
-            wrapper->markedForDelete = true;
+            continue;
         }
+
+        Resume(wrapper);
     }
 }
@@ -29,28 +29,66 @@ private:
         Coroutine<> coroutine;
         std::string aliasName;
         std::function<void()> onDone;
+        LinkedList<CoroutineWrapper>* queue{ nullptr };	// 지금 들어 있는 대기 큐 (타이머 대기 중이면 nullptr)
+        uint32_t activeIndex{};							// activeCoroutines 안의 위치 (swap-and-pop 용)
+        uint32_t waitSerial{};							// 타이머 항목이 아직 이 대기를 가리키는지 확인용
         bool markedForDelete = false;
 
-        CoroutineWrapper(Coroutine<> c)
-            : coroutine(std::move(c)), LinkProperty(this)
+        CoroutineWrapper()
+            : LinkProperty(this)
         {
         }
     };
 
+    // WaitForSeconds / WaitForFrames 용 최소 힙. 기한이 된 코루틴만 꺼내므로 대기 중인 코루틴 수와 상관없이 싸다
+    struct TimerEntry
+    {
+        double due{};
+        CoroutineWrapper* wrapper{};
+        uint32_t waitSerial{};
+    };
+
+    struct TimerQueue
+    {
+        std::vector<TimerEntry> heap;
+
+        void Push(double due, CoroutineWrapper* wrapper);
+        // due 가 now 이하인 항목을 꺼내 dueWrappers 에 담는다. 취소된 항목은 버린다
+        void PopDue(double now, std::vector<CoroutineWrapper*>& dueWrappers);
+    };
+
+    static constexpr uint32_t WrapperChunkSize = 64;
+
     LinkedList<CoroutineWrapper> StartCoroutineQueue;
     LinkedList<CoroutineWrapper> waitForFixedUpdateQueue;
     LinkedList<CoroutineWrapper> nullQueue;
-    LinkedList<CoroutineWrapper> waitForSecondsQueue;
-    LinkedList<CoroutineWrapper> waitForFramesQueue;
     LinkedList<CoroutineWrapper> waitUntilQueue;
     LinkedList<CoroutineWrapper> waitForSignalQueue;
     LinkedList<CoroutineWrapper> waitForEndOfFrameQueue;
     LinkedList<CoroutineWrapper> onRenderQueue;
 
+    TimerQueue waitForSecondsTimers;
+    TimerQueue waitForFramesTimers;
+    double m_secondsClock{};	// yield_WaitForSeconds 마다 누적한 시간
+    double m_frameClock{};		// yield_OtherEvent 호출 횟수
+
 	std::unordered_map<std::string, CoroutineWrapper*> coroutineMap;
     std::vector<CoroutineWrapper*> activeCoroutines;
-
+    std::vector<CoroutineWrapper*> pendingDestroyCoroutines;	// 끝났거나 멈춰서 yield_Null 에서 정리할 코루틴
+    std::vector<CoroutineWrapper*> destroyingCoroutines;
+    std::vector<CoroutineWrapper*> dueCoroutines;
+    std::atomic_flag pendingDestroyFlag{};
+
+    std::vector<std::unique_ptr<CoroutineWrapper[]>> wrapperChunks;
+    std::vector<CoroutineWrapper*> freeWrappers;
+
+    CoroutineWrapper* AcquireWrapper(Coroutine<>&& coroutine);
+    void ReleaseWrapper(CoroutineWrapper* wrapper);
+    void MarkForDelete(CoroutineWrapper* wrapper);
+    void Enqueue(CoroutineWrapper* wrapper);
+    void Resume(CoroutineWrapper* wrapper);
     void ProcessQueue(LinkedList<CoroutineWrapper>& queue);
+    void ProcessTimers(TimerQueue& timers, double now);
    
 };
 static auto& CoroutineManagers = CoroutineManager::GetInstance();
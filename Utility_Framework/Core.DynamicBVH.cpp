@@ -0,0 +1,556 @@
+#include "Core.DynamicBVH.h"
+#include <algorithm>
+#include <bit>
+
+using namespace DirectX;
+
+namespace
+{
+	constexpr float FatMarginRatio = 0.1f;	// extents 대비 여유 비율
+	constexpr float FatMarginMin = 0.05f;		// 최소 여유
+	constexpr float RefitShrinkRatio = 4.f;	// fat 박스가 실제 박스보다 이만큼 커지면 다시 맞춘다
+}
+
+DynamicBVH::DynamicBVH()
+{
+	m_nodes.reserve(256);
+}
+
+int32_t DynamicBVH::AllocateNode()
+{
+	if (m_freeList == NullNode)
+	{
+		const int32_t nodeId = static_cast<int32_t>(m_nodes.size());
+		m_nodes.emplace_back();
+		m_centerX.push_back(0.f);
+		m_centerY.push_back(0.f);
+		m_centerZ.push_back(0.f);
+		m_extentX.push_back(0.f);
+		m_extentY.push_back(0.f);
+		m_extentZ.push_back(0.f);
+		m_nodes[nodeId].height = 0;
+		return nodeId;
+	}
+
+	const int32_t nodeId = m_freeList;
+	m_freeList = m_nodes[nodeId].parent;
+
+	Node& node = m_nodes[nodeId];
+	node.parent = NullNode;
+	node.child1 = NullNode;
+	node.child2 = NullNode;
+	node.height = 0;
+	node.userData = nullptr;
+	return nodeId;
+}
+
+void DynamicBVH::FreeNode(int32_t nodeId)
+{
+	Node& node = m_nodes[nodeId];
+	node.parent = m_freeList;
+	node.child1 = NullNode;
+	node.child2 = NullNode;
+	node.height = -1;
+	node.userData = nullptr;
+	m_freeList = nodeId;
+}
+
+DynamicBVH::ProxyID DynamicBVH::CreateProxy(const BoundingBox& box, void* userData)
+{
+	const int32_t proxyId = AllocateNode();
+	SetBounds(proxyId, Fatten(FromBox(box)));
+	m_nodes[proxyId].userData = userData;
+	m_nodes[proxyId].height = 0;
+
+	InsertLeaf(proxyId);
+	++m_proxyCount;
+
+	return proxyId;
+}
+
+void DynamicBVH::DestroyProxy(ProxyID proxyId)
+{
+	if (!IsValidProxy(proxyId))
+		return;
+
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	--m_proxyCount;
+}
+
+bool DynamicBVH::MoveProxy(ProxyID proxyId, const BoundingBox& box)
+{
+	if (!IsValidProxy(proxyId))
+		return false;
+
+	const Bounds tight = FromBox(box);
+	const Bounds fat = GetBounds(proxyId);
+
+	if (Contains(fat, tight))
+	{
+		// 너무 커진 fat 박스는 다시 맞춘다 (축소된 물체가 계속 넓게 잡히는 것 방지)
+		const float fatArea = Area(fat);
+		const float tightArea = Area(Fatten(tight));
+		if (fatArea <= tightArea * RefitShrinkRatio)
+			return false;
+	}
+
+	RemoveLeaf(proxyId);
+	SetBounds(proxyId, Fatten(tight));
+	InsertLeaf(proxyId);
+
+	return true;
+}
+
+void* DynamicBVH::GetUserData(ProxyID proxyId) const
+{
+	return IsValidProxy(proxyId) ? m_nodes[proxyId].userData : nullptr;
+}
+
+bool DynamicBVH::IsValidProxy(ProxyID proxyId) const
+{
+	return proxyId >= 0
+		&& proxyId < static_cast<int32_t>(m_nodes.size())
+		&& m_nodes[proxyId].height == 0
+		&& m_nodes[proxyId].IsLeaf();
+}
+
+BoundingBox DynamicBVH::GetFatAABB(ProxyID proxyId) const
+{
+	BoundingBox box;
+	box.Center = { m_centerX[proxyId], m_centerY[proxyId], m_centerZ[proxyId] };
+	box.Extents = { m_extentX[proxyId], m_extentY[proxyId], m_extentZ[proxyId] };
+	return box;
+}
+
+void DynamicBVH::Clear()
+{
+	m_nodes.clear();
+	m_centerX.clear();
+	m_centerY.clear();
+	m_centerZ.clear();
+	m_extentX.clear();
+	m_extentY.clear();
+	m_extentZ.clear();
+	m_root = NullNode;
+	m_freeList = NullNode;
+	m_proxyCount = 0;
+}
+
+int32_t DynamicBVH::GetHeight() const
+{
+	return m_root == NullNode ? 0 : m_nodes[m_root].height;
+}
+
+void DynamicBVH::InsertLeaf(int32_t leaf)
+{
+	if (m_root == NullNode)
+	{
+		m_root = leaf;
+		m_nodes[leaf].parent = NullNode;
+		return;
+	}
+
+	// 표면적 비용이 가장 작은 형제 노드를 찾는다
+	const Bounds leafBounds = GetBounds(leaf);
+	int32_t index = m_root;
+	while (!m_nodes[index].IsLeaf())
+	{
+		const int32_t child1 = m_nodes[index].child1;
+		const int32_t child2 = m_nodes[index].child2;
+
+		const Bounds nodeBounds = GetBounds(index);
+		const float area = Area(nodeBounds);
+		const float combinedArea = Area(Union(nodeBounds, leafBounds));
+
+		const float cost = 2.f * combinedArea;
+		const float inheritanceCost = 2.f * (combinedArea - area);
+
+		auto childCost = [&](int32_t child)
+		{
+			const Bounds childBounds = GetBounds(child);
+			const float newArea = Area(Union(leafBounds, childBounds));
+			if (m_nodes[child].IsLeaf())
+				return newArea + inheritanceCost;
+			return (newArea - Area(childBounds)) + inheritanceCost;
+		};
+
+		const float cost1 = childCost(child1);
+		const float cost2 = childCost(child2);
+
+		if (cost < cost1 && cost < cost2)
+			break;
+
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+
+	const int32_t sibling = index;
+	const int32_t oldParent = m_nodes[sibling].parent;
+	const int32_t newParent = AllocateNode();
+
+	m_nodes[newParent].parent = oldParent;
+	m_nodes[newParent].height = m_nodes[sibling].height + 1;
+	SetUnionBounds(newParent, leaf, sibling);
+
+	if (oldParent != NullNode)
+	{
+		if (m_nodes[oldParent].child1 == sibling)
+			m_nodes[oldParent].child1 = newParent;
+		else
+			m_nodes[oldParent].child2 = newParent;
+	}
+	else
+	{
+		m_root = newParent;
+	}
+
+	m_nodes[newParent].child1 = sibling;
+	m_nodes[newParent].child2 = leaf;
+	m_nodes[sibling].parent = newParent;
+	m_nodes[leaf].parent = newParent;
+
+	// 위로 올라가며 바운드/높이 갱신
+	index = m_nodes[leaf].parent;
+	while (index != NullNode)
+	{
+		index = Balance(index);
+
+		const int32_t child1 = m_nodes[index].child1;
+		const int32_t child2 = m_nodes[index].child2;
+
+		m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+		SetUnionBounds(index, child1, child2);
+
+		index = m_nodes[index].parent;
+	}
+}
+
+void DynamicBVH::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == m_root)
+	{
+		m_root = NullNode;
+		return;
+	}
+
+	const int32_t parent = m_nodes[leaf].parent;
+	const int32_t grandParent = m_nodes[parent].parent;
+	const int32_t sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+	if (grandParent != NullNode)
+	{
+		if (m_nodes[grandParent].child1 == parent)
+			m_nodes[grandParent].child1 = sibling;
+		else
+			m_nodes[grandParent].child2 = sibling;
+
+		m_nodes[sibling].parent = grandParent;
+		FreeNode(parent);
+
+		int32_t index = grandParent;
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			const int32_t child1 = m_nodes[index].child1;
+			const int32_t child2 = m_nodes[index].child2;
+
+			SetUnionBounds(index, child1, child2);
+			m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+
+			index = m_nodes[index].parent;
+		}
+	}
+	else
+	{
+		m_root = sibling;
+		m_nodes[sibling].parent = NullNode;
+		FreeNode(parent);
+	}
+
+	m_nodes[leaf].parent = NullNode;
+}
+
+// A 가 불균형이면 좌/우 회전, 새 서브트리 루트를 반환
+int32_t DynamicBVH::Balance(int32_t iA)
+{
+	Node& A = m_nodes[iA];
+	if (A.IsLeaf() || A.height < 2)
+		return iA;
+
+	const int32_t iB = A.child1;
+	const int32_t iC = A.child2;
+	Node& B = m_nodes[iB];
+	Node& C = m_nodes[iC];
+
+	const int32_t balance = C.height - B.height;
+
+	// C 를 올린다
+	if (balance > 1)
+	{
+		const int32_t iF = C.child1;
+		const int32_t iG = C.child2;
+		Node& F = m_nodes[iF];
+		Node& G = m_nodes[iG];
+
+		C.child1 = iA;
+		C.parent = A.parent;
+		A.parent = iC;
+
+		if (C.parent != NullNode)
+		{
+			if (m_nodes[C.parent].child1 == iA)
+				m_nodes[C.parent].child1 = iC;
+			else
+				m_nodes[C.parent].child2 = iC;
+		}
+		else
+		{
+			m_root = iC;
+		}
+
+		if (F.height > G.height)
+		{
+			C.child2 = iF;
+			A.child2 = iG;
+			G.parent = iA;
+			SetUnionBounds(iA, iB, iG);
+			SetUnionBounds(iC, iA, iF);
+
+			A.height = 1 + std::max(B.height, G.height);
+			C.height = 1 + std::max(A.height, F.height);
+		}
+		else
+		{
+			C.child2 = iG;
+			A.child2 = iF;
+			F.parent = iA;
+			SetUnionBounds(iA, iB, iF);
+			SetUnionBounds(iC, iA, iG);
+
+			A.height = 1 + std::max(B.height, F.height);
+			C.height = 1 + std::max(A.height, G.height);
+		}
+
+		return iC;
+	}
+
+	// B 를 올린다
+	if (balance < -1)
+	{
+		const int32_t iD = B.child1;
+		const int32_t iE = B.child2;
+		Node& D = m_nodes[iD];
+		Node& E = m_nodes[iE];
+
+		B.child1 = iA;
+		B.parent = A.parent;
+		A.parent = iB;
+
+		if (B.parent != NullNode)
+		{
+			if (m_nodes[B.parent].child1 == iA)
+				m_nodes[B.parent].child1 = iB;
+			else
+				m_nodes[B.parent].child2 = iB;
+		}
+		else
+		{
+			m_root = iB;
+		}
+
+		if (D.height > E.height)
+		{
+			B.child2 = iD;
+			A.child1 = iE;
+			E.parent = iA;
+			SetUnionBounds(iA, iC, iE);
+			SetUnionBounds(iB, iA, iD);
+
+			A.height = 1 + std::max(C.height, E.height);
+			B.height = 1 + std::max(A.height, D.height);
+		}
+		else
+		{
+			B.child2 = iE;
+			A.child1 = iD;
+			D.parent = iA;
+			SetUnionBounds(iA, iC, iD);
+			SetUnionBounds(iB, iA, iE);
+
+			A.height = 1 + std::max(C.height, D.height);
+			B.height = 1 + std::max(A.height, E.height);
+		}
+
+		return iB;
+	}
+
+	return iA;
+}
+
+void DynamicBVH::CullFrustums(const Core::SIMDCulling::FrustumPlanesSoA* planes, uint32_t frustumCount,
+	std::vector<void*>* outVisible) const
+{
+	if (m_root == NullNode || frustumCount == 0)
+		return;
+
+	frustumCount = std::min(frustumCount, MaxFrustumCount);
+	const uint32_t allMask = (frustumCount == 32) ? 0xFFFFFFFFu : ((1u << frustumCount) - 1u);
+
+	m_current.clear();
+	m_next.clear();
+	m_current.push_back({ m_root, allMask, 0u });
+
+	const float* cx = m_centerX.data();
+	const float* cy = m_centerY.data();
+	const float* cz = m_centerZ.data();
+	const float* ex = m_extentX.data();
+	const float* ey = m_extentY.data();
+	const float* ez = m_extentZ.data();
+
+	// 너비 우선으로 한 레벨씩 진행하며, 같은 레벨의 노드를 4개씩 묶어 검사한다
+	while (!m_current.empty())
+	{
+		const size_t count = m_current.size();
+		for (size_t base = 0; base < count; base += 4)
+		{
+			const size_t lanes = std::min<size_t>(4, count - base);
+			const TraverseEntry* entries = &m_current[base];
+
+			alignas(16) float lcx[4]{}, lcy[4]{}, lcz[4]{}, lex[4]{}, ley[4]{}, lez[4]{};
+			uint32_t testUnion = 0;
+			for (size_t lane = 0; lane < lanes; ++lane)
+			{
+				const int32_t n = entries[lane].node;
+				lcx[lane] = cx[n]; lcy[lane] = cy[n]; lcz[lane] = cz[n];
+				lex[lane] = ex[n]; ley[lane] = ey[n]; lez[lane] = ez[n];
+				testUnion |= entries[lane].testMask;
+			}
+
+			uint32_t visible[4]{};
+			uint32_t inside[4]{};
+			for (size_t lane = 0; lane < lanes; ++lane)
+			{
+				visible[lane] = entries[lane].acceptMask;
+				inside[lane] = entries[lane].acceptMask;
+			}
+
+			if (testUnion)
+			{
+				const __m128 vcx = _mm_load_ps(lcx), vcy = _mm_load_ps(lcy), vcz = _mm_load_ps(lcz);
+				const __m128 vex = _mm_load_ps(lex), vey = _mm_load_ps(ley), vez = _mm_load_ps(lez);
+
+				uint32_t bits = testUnion;
+				while (bits)
+				{
+					const uint32_t frustumIndex = static_cast<uint32_t>(std::countr_zero(bits));
+					const uint32_t frustumBit = 1u << frustumIndex;
+					bits &= bits - 1;
+
+					const auto result = Core::SIMDCulling::TestAABB4(planes[frustumIndex], vcx, vcy, vcz, vex, vey, vez);
+					for (size_t lane = 0; lane < lanes; ++lane)
+					{
+						if (!(entries[lane].testMask & frustumBit))
+							continue;
+						if (result.visibleMask & (1 << lane))
+							visible[lane] |= frustumBit;
+						if (result.insideMask & (1 << lane))
+							inside[lane] |= frustumBit;
+					}
+				}
+			}
+
+			for (size_t lane = 0; lane < lanes; ++lane)
+			{
+				if (!visible[lane])
+					continue;
+
+				const Node& node = m_nodes[entries[lane].node];
+				if (node.IsLeaf())
+				{
+					uint32_t bits = visible[lane];
+					while (bits)
+					{
+						const uint32_t frustumIndex = static_cast<uint32_t>(std::countr_zero(bits));
+						bits &= bits - 1;
+						outVisible[frustumIndex].push_back(node.userData);
+					}
+				}
+				else
+				{
+					const uint32_t testMask = visible[lane] & ~inside[lane];
+					m_next.push_back({ node.child1, testMask, inside[lane] });
+					m_next.push_back({ node.child2, testMask, inside[lane] });
+				}
+			}
+		}
+
+		m_current.swap(m_next);
+		m_next.clear();
+	}
+}
+
+DynamicBVH::Bounds DynamicBVH::GetBounds(int32_t nodeId) const
+{
+	return {
+		m_centerX[nodeId] - m_extentX[nodeId],
+		m_centerY[nodeId] - m_extentY[nodeId],
+		m_centerZ[nodeId] - m_extentZ[nodeId],
+		m_centerX[nodeId] + m_extentX[nodeId],
+		m_centerY[nodeId] + m_extentY[nodeId],
+		m_centerZ[nodeId] + m_extentZ[nodeId]
+	};
+}
+
+void DynamicBVH::SetBounds(int32_t nodeId, const Bounds& b)
+{
+	m_centerX[nodeId] = (b.minX + b.maxX) * 0.5f;
+	m_centerY[nodeId] = (b.minY + b.maxY) * 0.5f;
+	m_centerZ[nodeId] = (b.minZ + b.maxZ) * 0.5f;
+	m_extentX[nodeId] = (b.maxX - b.minX) * 0.5f;
+	m_extentY[nodeId] = (b.maxY - b.minY) * 0.5f;
+	m_extentZ[nodeId] = (b.maxZ - b.minZ) * 0.5f;
+}
+
+void DynamicBVH::SetUnionBounds(int32_t nodeId, int32_t a, int32_t b)
+{
+	SetBounds(nodeId, Union(GetBounds(a), GetBounds(b)));
+}
+
+DynamicBVH::Bounds DynamicBVH::Union(const Bounds& a, const Bounds& b)
+{
+	return {
+		std::min(a.minX, b.minX), std::min(a.minY, b.minY), std::min(a.minZ, b.minZ),
+		std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY), std::max(a.maxZ, b.maxZ)
+	};
+}
+
+float DynamicBVH::Area(const Bounds& b)
+{
+	const float dx = b.maxX - b.minX;
+	const float dy = b.maxY - b.minY;
+	const float dz = b.maxZ - b.minZ;
+	return dx * dy + dy * dz + dz * dx;
+}
+
+bool DynamicBVH::Contains(const Bounds& outer, const Bounds& inner)
+{
+	return outer.minX <= inner.minX && outer.minY <= inner.minY && outer.minZ <= inner.minZ
+		&& outer.maxX >= inner.maxX && outer.maxY >= inner.maxY && outer.maxZ >= inner.maxZ;
+}
+
+DynamicBVH::Bounds DynamicBVH::FromBox(const BoundingBox& box)
+{
+	return {
+		box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z,
+		box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z
+	};
+}
+
+DynamicBVH::Bounds DynamicBVH::Fatten(const Bounds& b)
+{
+	const float mx = std::max((b.maxX - b.minX) * 0.5f * FatMarginRatio, FatMarginMin);
+	const float my = std::max((b.maxY - b.minY) * 0.5f * FatMarginRatio, FatMarginMin);
+	const float mz = std::max((b.maxZ - b.minZ) * 0.5f * FatMarginRatio, FatMarginMin);
+	return { b.minX - mx, b.minY - my, b.minZ - mz, b.maxX + mx, b.maxY + my, b.maxZ + mz };
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <DirectXCollision.h>
+#include <cstdint>
+#include <vector>
+#include "Core.SIMDCulling.h"
+
+// 동적 AABB 트리 (Dynamic BVH)
+// - 리프 하나가 프록시 하나를 가지며, 프록시 ID == 리프 노드 인덱스
+// - 리프는 여유(margin)를 둔 fat AABB를 보관하여 작은 이동은 트리 갱신 없이 흡수한다
+// - 삽입은 표면적 휴리스틱, 삭제/삽입 후 회전으로 높이 균형을 맞춘다
+// - 노드 바운드는 center/extents SoA 배열로 보관하여 4개씩 SIMD 절두체 검사를 한다
+class DynamicBVH
+{
+public:
+	using ProxyID = int32_t;
+	static constexpr int32_t NullNode = -1;
+	static constexpr uint32_t MaxFrustumCount = 32;
+
+	DynamicBVH();
+	~DynamicBVH() = default;
+
+	ProxyID CreateProxy(const DirectX::BoundingBox& box, void* userData);
+	void DestroyProxy(ProxyID proxyId);
+
+	// fat AABB를 벗어나거나 과하게 커진 경우에만 재삽입한다. 재삽입 했으면 true
+	bool MoveProxy(ProxyID proxyId, const DirectX::BoundingBox& box);
+
+	void* GetUserData(ProxyID proxyId) const;
+	bool IsValidProxy(ProxyID proxyId) const;
+	DirectX::BoundingBox GetFatAABB(ProxyID proxyId) const;
+
+	// 살아 있는 프록시마다 func(proxyId, userData) 를 부른다
+	template<typename Func>
+	void ForEachProxy(Func&& func) const
+	{
+		for (int32_t i = 0; i < static_cast<int32_t>(m_nodes.size()); ++i)
+		{
+			if (IsValidProxy(i))
+			{
+				func(i, m_nodes[i].userData);
+			}
+		}
+	}
+
+	void Clear();
+
+	size_t GetProxyCount() const { return m_proxyCount; }
+	int32_t GetHeight() const;
+
+	// 한 번의 순회로 여러 절두체를 동시에 처리한다.
+	// outVisible[i] 에 i번째 절두체에 보이는 프록시의 userData가 추가된다.
+	void CullFrustums(const Core::SIMDCulling::FrustumPlanesSoA* planes, uint32_t frustumCount,
+		std::vector<void*>* outVisible) const;
+
+private:
+	struct Node
+	{
+		int32_t parent{ NullNode };	// free list 에서는 next 로 사용
+		int32_t child1{ NullNode };
+		int32_t child2{ NullNode };
+		int32_t height{ -1 };			// leaf = 0, free = -1
+		void*	userData{ nullptr };
+
+		bool IsLeaf() const { return child1 == NullNode; }
+	};
+
+	struct Bounds
+	{
+		float minX, minY, minZ;
+		float maxX, maxY, maxZ;
+	};
+
+	int32_t AllocateNode();
+	void FreeNode(int32_t nodeId);
+
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+	int32_t Balance(int32_t iA);
+
+	Bounds GetBounds(int32_t nodeId) const;
+	void SetBounds(int32_t nodeId, const Bounds& bounds);
+	void SetUnionBounds(int32_t nodeId, int32_t a, int32_t b);
+
+	static Bounds Union(const Bounds& a, const Bounds& b);
+	static float Area(const Bounds& b);
+	static bool Contains(const Bounds& outer, const Bounds& inner);
+	static Bounds FromBox(const DirectX::BoundingBox& box);
+	static Bounds Fatten(const Bounds& b);
+
+private:
+	std::vector<Node>	m_nodes;
+	// SoA bounds (node index)
+	std::vector<float>	m_centerX;
+	std::vector<float>	m_centerY;
+	std::vector<float>	m_centerZ;
+	std::vector<float>	m_extentX;
+	std::vector<float>	m_extentY;
+	std::vector<float>	m_extentZ;
+
+	int32_t m_root{ NullNode };
+	int32_t m_freeList{ NullNode };
+	size_t	m_proxyCount{ 0 };
+
+	struct TraverseEntry
+	{
+		int32_t  node;
+		uint32_t testMask;		// 아직 검사가 필요한 절두체
+		uint32_t acceptMask;	// 조상이 완전히 포함되어 검사 없이 통과하는 절두체
+	};
+	mutable std::vector<TraverseEntry> m_current;
+	mutable std::vector<TraverseEntry> m_next;
+};
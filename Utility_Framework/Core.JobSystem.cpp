@@ -0,0 +1,386 @@
+#include "Core.JobSystem.h"
+#include "SpinLock.h"
+
+namespace
+{
+	constexpr uint32 UnassignedQueue = 0xFFFFFFFE;
+	constexpr uint32 JobsPerPage = 256;
+	constexpr uint32 LocalJobCacheSize = 128;	// 넘치면 절반을 공용 목록으로 돌려준다
+	thread_local uint32 t_jobQueueIndex = UnassignedQueue;
+	thread_local uint32 t_stealCursor = 0;
+	thread_local std::vector<Job*> t_jobCache;
+}
+
+bool JobSystem::WorkQueue::Push(Job* job)
+{
+	SpinLock lock(flag);
+	if (bottom - top >= QueueCapacity)
+	{
+		return false;
+	}
+
+	jobs[bottom & (QueueCapacity - 1)] = job;
+	++bottom;
+	return true;
+}
+
+Job* JobSystem::WorkQueue::Pop()
+{
+	SpinLock lock(flag);
+	if (bottom == top)
+	{
+		return nullptr;
+	}
+
+	--bottom;
+	return jobs[bottom & (QueueCapacity - 1)];
+}
+
+Job* JobSystem::WorkQueue::Steal()
+{
+	SpinLock lock(flag);
+	if (bottom == top)
+	{
+		return nullptr;
+	}
+
+	Job* job = jobs[top & (QueueCapacity - 1)];
+	++top;
+	return job;
+}
+
+void JobSystem::OverflowQueue::Push(Job* job)
+{
+	SpinLock lock(flag);
+	jobs.push_back(job);
+	size.fetch_add(1, std::memory_order_release);
+}
+
+Job* JobSystem::OverflowQueue::TryPop()
+{
+	// 거의 항상 비어 있으므로 잠그기 전에 먼저 본다
+	if (0 == size.load(std::memory_order_acquire))
+	{
+		return nullptr;
+	}
+
+	SpinLock lock(flag);
+	if (jobs.empty())
+	{
+		return nullptr;
+	}
+
+	Job* job = jobs.front();
+	jobs.pop_front();
+	size.fetch_sub(1, std::memory_order_relaxed);
+	return job;
+}
+
+JobSystem::JobSystem()
+{
+	// 대기하는 스레드도 잡을 실행하므로 코어 하나는 남겨 둔다 (0 은 알 수 없음)
+	const uint32 processorCount = (std::max)(1u, std::thread::hardware_concurrency());
+	m_workerCount = (std::max)(1u, processorCount - 1);
+	m_queueCount = m_workerCount + MaxExternalQueues;
+	m_queues = std::make_unique<WorkQueue[]>(m_queueCount);
+	m_nextExternalQueue.store(m_workerCount);
+
+	m_threads.reserve(m_workerCount);
+	for (uint32 i = 0; i < m_workerCount; ++i)
+	{
+		m_threads.emplace_back([this, i]() { WorkerLoop(i); });
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	m_exitFlag.store(true, std::memory_order_release);
+	m_semaphore.release(static_cast<std::ptrdiff_t>(m_workerCount));
+
+	for (std::thread& thread : m_threads)
+	{
+		thread.join();
+	}
+
+	// 종료 시점까지 남은 잡은 실행하지 않고 작업만 정리한다 (잡 메모리는 페이지와 함께 해제된다)
+	for (uint32 i = 0; i < m_queueCount; ++i)
+	{
+		while (Job* job = m_queues[i].Pop())
+		{
+			job->destroy(*job);
+		}
+	}
+
+	while (Job* job = m_overflow.TryPop())
+	{
+		job->destroy(*job);
+	}
+}
+
+JobHandle JobSystem::CreateGroup()
+{
+	return std::make_shared<JobCounter>();
+}
+
+void JobSystem::Wait(const JobHandle& handle)
+{
+	if (!handle)
+	{
+		return;
+	}
+
+	const uint32 queueIndex = GetQueueIndex();
+	uint32 idleCount = 0;
+	while (!handle->IsDone())
+	{
+		if (Job* job = TryGetJob(queueIndex))
+		{
+			Execute(job);
+			idleCount = 0;
+			continue;
+		}
+
+		// 남은 잡이 다른 스레드에서 실행 중이면 잠깐 양보한다
+		if (++idleCount < 64)
+		{
+			CpuRelax();
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::Wait(std::initializer_list<JobHandle> handles)
+{
+	for (const JobHandle& handle : handles)
+	{
+		Wait(handle);
+	}
+}
+
+uint32 JobSystem::GetDefaultGrainSize(uint32 count) const
+{
+	// 스레드당 4 조각 정도로 나눠 훔쳐 갈 여지를 남긴다
+	const uint32 sliceCount = (m_workerCount + 1) * 4;
+	return (std::max)(1u, (count + sliceCount - 1) / sliceCount);
+}
+
+Job* JobSystem::AcquireJob()
+{
+	std::vector<Job*>& cache = t_jobCache;
+	if (cache.empty())
+	{
+		SpinLock lock(m_jobPoolFlag);
+		while (m_freeJobs && cache.size() < LocalJobCacheSize / 2)
+		{
+			cache.push_back(m_freeJobs);
+			m_freeJobs = m_freeJobs->next;
+		}
+
+		if (cache.empty())
+		{
+			auto page = std::make_unique<Job[]>(JobsPerPage);
+			for (uint32 i = 0; i < JobsPerPage; ++i)
+			{
+				cache.push_back(&page[i]);
+			}
+			m_jobPages.push_back(std::move(page));
+		}
+	}
+
+	Job* job = cache.back();
+	cache.pop_back();
+	return job;
+}
+
+void JobSystem::ReleaseJob(Job* job)
+{
+	job->destroy(*job);
+	job->invoke = nullptr;
+	job->destroy = nullptr;
+	job->dependencies.store(1, std::memory_order_relaxed);
+
+	// 잡은 보통 만든 스레드가 아닌 워커에서 끝나므로 한쪽 캐시에만 쌓이지 않게 넘치는 만큼 돌려준다
+	std::vector<Job*>& cache = t_jobCache;
+	cache.push_back(job);
+	if (cache.size() <= LocalJobCacheSize)
+	{
+		return;
+	}
+
+	SpinLock lock(m_jobPoolFlag);
+	while (cache.size() > LocalJobCacheSize / 2)
+	{
+		Job* freeJob = cache.back();
+		cache.pop_back();
+		freeJob->next = m_freeJobs;
+		m_freeJobs = freeJob;
+	}
+}
+
+void JobSystem::Submit(const JobHandle& group, Job* job, const JobHandle* dependencies, size_t dependencyCount)
+{
+	group->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+	job->counter = group;
+	for (size_t i = 0; i < dependencyCount; ++i)
+	{
+		const JobHandle& dependency = dependencies[i];
+		if (dependency && !dependency->IsDone())
+		{
+			job->dependencies.fetch_add(1, std::memory_order_relaxed);
+			AddContinuation(dependency.get(), job);
+		}
+	}
+
+	ReleaseDependency(job);
+}
+
+void JobSystem::AddContinuation(JobCounter* counter, Job* job)
+{
+	{
+		SpinLock lock(counter->m_continuationFlag);
+		if (!counter->IsDone())
+		{
+			counter->m_continuations.push_back(job);
+			return;
+		}
+	}
+
+	// 등록하는 사이에 끝난 경우
+	ReleaseDependency(job);
+}
+
+void JobSystem::ReleaseDependency(Job* job)
+{
+	if (1 == job->dependencies.fetch_sub(1, std::memory_order_acq_rel))
+	{
+		Push(job);
+	}
+}
+
+void JobSystem::Push(Job* job)
+{
+	const uint32 queueIndex = GetQueueIndex();
+	if (queueIndex == InvalidQueue || !m_queues[queueIndex].Push(job))
+	{
+		m_overflow.Push(job);
+	}
+
+	// 잠들려는 워커가 큐를 다시 확인하는 것과 순서를 맞춘다
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (0 < m_sleepingCount.load(std::memory_order_relaxed))
+	{
+		m_semaphore.release();
+	}
+}
+
+void JobSystem::Execute(Job* job)
+{
+	JobHandle counter = std::move(job->counter);
+	try
+	{
+		job->invoke(*job);
+	}
+	catch (...)
+	{
+		// 예외가 나도 카운터를 끝내야 이 그룹을 기다리는 스레드가 멈추지 않는다
+		SpinLock lock(counter->m_continuationFlag);
+		if (!counter->m_exception)
+		{
+			counter->m_exception = std::current_exception();
+		}
+	}
+	ReleaseJob(job);
+
+	if (1 != counter->m_pending.fetch_sub(1, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	std::vector<Job*> continuations;
+	{
+		SpinLock lock(counter->m_continuationFlag);
+		continuations.swap(counter->m_continuations);
+	}
+
+	for (Job* continuation : continuations)
+	{
+		ReleaseDependency(continuation);
+	}
+}
+
+Job* JobSystem::TryGetJob(uint32 queueIndex)
+{
+	if (queueIndex != InvalidQueue)
+	{
+		if (Job* job = m_queues[queueIndex].Pop())
+		{
+			return job;
+		}
+	}
+
+	if (Job* job = m_overflow.TryPop())
+	{
+		return job;
+	}
+
+	const uint32 start = t_stealCursor++;
+	for (uint32 i = 0; i < m_queueCount; ++i)
+	{
+		const uint32 victim = (start + i) % m_queueCount;
+		if (victim == queueIndex)
+		{
+			continue;
+		}
+
+		if (Job* stolen = m_queues[victim].Steal())
+		{
+			return stolen;
+		}
+	}
+
+	return nullptr;
+}
+
+uint32 JobSystem::GetQueueIndex()
+{
+	if (t_jobQueueIndex == UnassignedQueue)
+	{
+		// 워커가 아닌 스레드는 처음 사용할 때 외부 큐를 하나 배정받는다. 다 쓰면 m_overflow 만 사용한다
+		const uint32 index = m_nextExternalQueue.fetch_add(1, std::memory_order_relaxed);
+		t_jobQueueIndex = index < m_queueCount ? index : InvalidQueue;
+	}
+
+	return t_jobQueueIndex;
+}
+
+void JobSystem::WorkerLoop(uint32 workerIndex)
+{
+	t_jobQueueIndex = workerIndex;
+	t_stealCursor = workerIndex + 1;
+
+	while (!m_exitFlag.load(std::memory_order_acquire))
+	{
+		if (Job* job = TryGetJob(workerIndex))
+		{
+			Execute(job);
+			continue;
+		}
+
+		// 잠들기 전에 한 번 더 확인해 Push 와 엇갈려 깨우는 신호를 놓치지 않는다
+		m_sleepingCount.fetch_add(1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (Job* job = TryGetJob(workerIndex))
+		{
+			m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+			Execute(job);
+			continue;
+		}
+
+		m_semaphore.acquire();
+		m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <vector>
+#include <array>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <new>
+#include <semaphore>
+#include <thread>
+#include <type_traits>
+#include "BaseTypeDef.h"
+#include "ClassProperty.h"
+
+struct Job;
+
+// 잡 완료 카운터 (JobHandle 이 가리키는 대상)
+// 카운터에 묶인 잡이 모두 끝나 0 이 되는 순간, 이 카운터를 선행으로 지정한 잡들이 큐에 들어간다.
+class JobCounter
+{
+public:
+	bool IsDone() const { return 0 == m_pending.load(std::memory_order_acquire); }
+	// 묶인 잡 중 하나라도 예외를 던졌으면 첫 예외를 남긴다 (IsDone 이후에 읽는다)
+	bool HasFailed() const { return nullptr != m_exception; }
+	std::exception_ptr GetException() const { return m_exception; }
+
+private:
+	friend class JobSystem;
+
+	std::atomic<int32>	m_pending{ 0 };
+	std::atomic_flag	m_continuationFlag{};
+	std::vector<Job*>	m_continuations;
+	std::exception_ptr	m_exception;
+};
+
+using JobHandle = std::shared_ptr<JobCounter>;
+
+// 잡 하나. 작은 작업(람다 캡처 포함)은 잡 안에 바로 만들고, 큰 것만 힙에 둔다
+// 잡 자체는 JobSystem 의 풀에서 꺼내 쓰므로 Schedule 마다 할당하지 않는다
+struct Job
+{
+	static constexpr size_t InlineTaskSize = 64;
+
+	alignas(std::max_align_t) std::byte	storage[InlineTaskSize];
+	void (*invoke)(Job& job){ nullptr };
+	void (*destroy)(Job& job){ nullptr };
+	JobHandle							counter;
+	std::atomic<int32>					dependencies{ 1 };	// 남은 선행 카운터 수 + 등록 중 보호용 1
+	Job*								next{ nullptr };	// 풀의 빈 목록
+
+	template<typename F>
+	void SetTask(F&& task)
+	{
+		using Task = std::decay_t<F>;
+		if constexpr (sizeof(Task) <= InlineTaskSize && alignof(Task) <= alignof(std::max_align_t))
+		{
+			::new (static_cast<void*>(storage)) Task(std::forward<F>(task));
+			invoke = [](Job& job) { (*std::launder(reinterpret_cast<Task*>(job.storage)))(); };
+			destroy = [](Job& job) { std::launder(reinterpret_cast<Task*>(job.storage))->~Task(); };
+		}
+		else
+		{
+			::new (static_cast<void*>(storage)) Task*(new Task(std::forward<F>(task)));
+			invoke = [](Job& job) { (**std::launder(reinterpret_cast<Task**>(job.storage)))(); };
+			destroy = [](Job& job) { delete *std::launder(reinterpret_cast<Task**>(job.storage)); };
+		}
+	}
+};
+
+template<typename F>
+concept JobTask = std::invocable<std::decay_t<F>&>;
+
+// 코어당 워커 + 워크 스틸링 잡 시스템 (표준 라이브러리만 사용한다)
+// - 워커마다 자기 큐를 가지고 LIFO 로 꺼내며, 비면 다른 큐의 반대쪽에서 훔쳐온다
+// - 잡 하나 또는 여러 잡을 묶은 그룹을 JobHandle 로 기다리거나 다른 잡의 선행으로 쓸 수 있다
+// - Wait 는 블로킹하지 않고 카운터가 0 이 될 때까지 다른 잡을 대신 실행한다 (잡 안에서 Wait 해도 교착되지 않음)
+// - 잡이 예외를 던져도 카운터는 끝난 것으로 처리하고 예외는 JobCounter 에 남긴다
+class JobSystem : public Singleton<JobSystem>
+{
+private:
+	friend class Singleton;
+
+	static constexpr uint32 QueueCapacity = 4096;		// 2 의 거듭제곱
+	static constexpr uint32 MaxExternalQueues = 8;		// 워커가 아닌 스레드(게임/로딩 스레드)용 큐
+	static constexpr uint32 InvalidQueue = 0xFFFFFFFF;
+
+	// 소유 스레드는 bottom 에서 넣고 빼고, 다른 스레드는 top 에서 훔친다
+	struct alignas(64) WorkQueue
+	{
+		std::atomic_flag					flag{};
+		uint32								top{};
+		uint32								bottom{};
+		std::array<Job*, QueueCapacity>		jobs{};
+
+		bool Push(Job* job);
+		Job* Pop();
+		Job* Steal();
+	};
+
+	// 여러 스레드가 넣고 빼는 크기 제한 없는 큐. 워커 큐가 가득 찼거나 외부 큐를 못 받은 스레드만 쓴다
+	struct alignas(64) OverflowQueue
+	{
+		std::atomic_flag					flag{};
+		std::atomic<uint32>					size{};		// 비었을 때 잠그지 않고 지나가기 위한 근사값
+		std::deque<Job*>					jobs;
+
+		void Push(Job* job);
+		Job* TryPop();
+	};
+
+	JobSystem();
+	~JobSystem();
+
+public:
+	// 잡을 나중에 추가할 수 있는 빈 그룹
+	JobHandle CreateGroup();
+
+	// dependency 가 끝난 뒤 실행된다 (nullptr 이면 바로 실행 가능)
+	template<JobTask F>
+	JobHandle Schedule(F&& task, const JobHandle& dependency = nullptr)
+	{
+		JobHandle group = CreateGroup();
+		Submit(group, MakeJob(std::forward<F>(task)), &dependency, 1);
+		return group;
+	}
+
+	template<JobTask F>
+	JobHandle Schedule(F&& task, std::initializer_list<JobHandle> dependencies)
+	{
+		JobHandle group = CreateGroup();
+		Submit(group, MakeJob(std::forward<F>(task)), dependencies.begin(), dependencies.size());
+		return group;
+	}
+
+	// 기존 그룹에 잡을 추가한다
+	template<JobTask F>
+	void Schedule(const JobHandle& group, F&& task, const JobHandle& dependency = nullptr)
+	{
+		Submit(group, MakeJob(std::forward<F>(task)), &dependency, 1);
+	}
+
+	// [0, count) 를 grainSize 단위로 나눠 func(begin, end) 를 실행한다.
+	// grainSize 가 0 이면 스레드 수 기준으로 정한다. 한 조각이면 호출 스레드에서 바로 실행한다.
+	template<typename F>
+	JobHandle ParallelFor(uint32 count, uint32 grainSize, F func, const JobHandle& dependency = nullptr)
+	{
+		JobHandle group = CreateGroup();
+		if (0 == count)
+		{
+			return group;
+		}
+
+		if (0 == grainSize)
+		{
+			grainSize = GetDefaultGrainSize(count);
+		}
+
+		if (count <= grainSize && (!dependency || dependency->IsDone()))
+		{
+			func(0u, count);
+			return group;
+		}
+
+		for (uint32 begin = 0; begin < count; begin += grainSize)
+		{
+			const uint32 end = (std::min)(begin + grainSize, count);
+			Schedule(group, [func, begin, end]() { func(begin, end); }, dependency);
+		}
+		return group;
+	}
+
+	// 핸들이 끝날 때까지 다른 잡을 실행하며 기다린다
+	void Wait(const JobHandle& handle);
+	void Wait(std::initializer_list<JobHandle> handles);
+
+	uint32 GetWorkerCount() const { return m_workerCount; }
+	uint32 GetDefaultGrainSize(uint32 count) const;
+
+private:
+	template<typename F>
+	Job* MakeJob(F&& task)
+	{
+		Job* job = AcquireJob();
+		job->SetTask(std::forward<F>(task));
+		return job;
+	}
+
+	Job* AcquireJob();
+	void ReleaseJob(Job* job);
+	void Submit(const JobHandle& group, Job* job, const JobHandle* dependencies, size_t dependencyCount);
+	void AddContinuation(JobCounter* counter, Job* job);
+	void ReleaseDependency(Job* job);
+	void Push(Job* job);
+	void Execute(Job* job);
+	Job* TryGetJob(uint32 queueIndex);
+	uint32 GetQueueIndex();
+	void WorkerLoop(uint32 workerIndex);
+
+private:
+	uint32									m_workerCount{};
+	std::vector<std::thread>				m_threads;
+	std::unique_ptr<WorkQueue[]>			m_queues;		// 워커 m_workerCount 개 + 외부 MaxExternalQueues 개
+	uint32									m_queueCount{};
+	std::atomic<uint32>						m_nextExternalQueue{};
+	OverflowQueue							m_overflow;
+
+	// 잡 풀: 스레드별 캐시가 비거나 넘치면 여기서 묶음으로 주고받는다
+	std::atomic_flag						m_jobPoolFlag{};
+	Job*									m_freeJobs{ nullptr };
+	std::vector<std::unique_ptr<Job[]>>		m_jobPages;
+
+	std::counting_semaphore<>				m_semaphore{ 0 };
+	std::atomic<int32>						m_sleepingCount{};
+	std::atomic<bool>						m_exitFlag{ false };
+};
+
+// 스크립트 DLL 은 자기 JobSystem 인스턴스(워커 스레드)를 따로 만들지 않도록 전역 접근자를 쓰지 않는다
+#ifndef DYNAMICCPP_EXPORTS
+static auto& JobSystems = JobSystem::GetInstance();
+#endif // !DYNAMICCPP_EXPORTS
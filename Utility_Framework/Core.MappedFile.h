@@ -0,0 +1,98 @@
+#pragma once
+#include <windows.h>
+#include <filesystem>
+#include <cstddef>
+
+// 읽기 전용 메모리 매핑 파일 (쿠킹된 바이너리 에셋을 복사 없이 읽을 때 사용)
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	explicit MappedFile(const std::filesystem::path& path) { Open(path); }
+	~MappedFile() { Close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			m_file = other.m_file;
+			m_mapping = other.m_mapping;
+			m_view = other.m_view;
+			m_size = other.m_size;
+			other.m_file = INVALID_HANDLE_VALUE;
+			other.m_mapping = nullptr;
+			other.m_view = nullptr;
+			other.m_size = 0;
+		}
+		return *this;
+	}
+
+	bool Open(const std::filesystem::path& path)
+	{
+		Close();
+
+		m_file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize{};
+		if (!::GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+
+		m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_mapping)
+		{
+			Close();
+			return false;
+		}
+
+		m_view = ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!m_view)
+		{
+			Close();
+			return false;
+		}
+
+		m_size = static_cast<size_t>(fileSize.QuadPart);
+		return true;
+	}
+
+	void Close()
+	{
+		if (m_view)
+		{
+			::UnmapViewOfFile(m_view);
+			m_view = nullptr;
+		}
+		if (m_mapping)
+		{
+			::CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+		if (m_file != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+		}
+		m_size = 0;
+	}
+
+	bool IsOpen() const { return m_view != nullptr; }
+	const std::byte* Data() const { return static_cast<const std::byte*>(m_view); }
+	size_t Size() const { return m_size; }
+
+private:
+	HANDLE	m_file{ INVALID_HANDLE_VALUE };
+	HANDLE	m_mapping{ nullptr };
+	void*	m_view{ nullptr };
+	size_t	m_size{ 0 };
+};
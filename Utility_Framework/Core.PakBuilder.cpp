@@ -0,0 +1,793 @@
+#include "Paklib.hpp"
+#include "Core.PakBuilder.h"
+#include "Core.JobSystem.h"
+#include "Core.MappedFile.h"
+#include "LogSystem.h"
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+	using Digest = std::array<uint8, 32>;
+
+	constexpr uint8 EncryptedFlag = 1;
+	constexpr uint8 CompressedFlag = 2;
+
+	constexpr char ManifestMagic[4] = { 'P', 'K', 'M', '1' };
+	constexpr uint32 ManifestVersion = 1;
+
+	// 한 번에 메모리에 올릴 원본 크기. 넘으면 여기까지 인코딩/기록하고 버퍼를 비운다
+	constexpr uint64 BatchBudget = 256ull * 1024 * 1024;
+
+	struct DigestHash
+	{
+		size_t operator()(const Digest& digest) const noexcept
+		{
+			size_t value{};
+			std::memcpy(&value, digest.data(), sizeof(value));
+			return value;
+		}
+	};
+
+	struct ManifestRecord
+	{
+		uint64	size{};
+		int64	writeTime{};
+		Digest	contentHash{};
+	};
+
+	struct Manifest
+	{
+		uint32									chunkSize{};
+		uint8									flags{};
+		Digest									keyFingerprint{};
+		Digest									indexHash{};
+		std::unordered_map<std::string, ManifestRecord>	records;
+	};
+
+	// 청크 하나를 기록하기 전까지의 상태
+	struct PendingChunk
+	{
+		bool				copy{};				// 이전 pak 에서 그대로 옮기는 청크
+		bool				written{};
+		uint32				batchFile{};
+		uint64				sourceOffset{};		// 원본 파일 오프셋, copy 면 이전 pak 오프셋
+		uint32				uncompressedSize{};
+		uint32				compressedSize{};	// copy 일 때만
+		uint64				fileId{};
+		uint64				counterOffset{};
+		std::vector<uint8>	data;
+		Pak::ChunkInfo		info{};
+	};
+
+	// 항목의 청크 자리. 기록 전에는 pending 을, 기록 후에는 info 를 본다
+	struct ChunkSlot
+	{
+		int32			pending{ -1 };
+		Pak::ChunkInfo	info{};
+	};
+
+	Digest KeyFingerprint(const std::optional<std::array<uint8, 32>>& key)
+	{
+		return key ? Pak::Crypto::sha256(*key) : Digest{};
+	}
+
+	std::string GetExtensionKey(std::string_view virtualPath)
+	{
+		const size_t slash = virtualPath.find_last_of('/');
+		const size_t dot = virtualPath.find_last_of('.');
+		if (std::string_view::npos == dot || (std::string_view::npos != slash && dot < slash))
+			return "(none)";
+
+		std::string extension(virtualPath.substr(dot));
+		for (char& c : extension)
+		{
+			if (c >= 'A' && c <= 'Z')
+				c = static_cast<char>(c - 'A' + 'a');
+		}
+		return extension;
+	}
+
+	bool ReadSourceFile(const std::filesystem::path& path, std::vector<uint8>& out)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in.is_open())
+			return false;
+
+		const std::streamoff size = in.tellg();
+		if (size < 0)
+			return false;
+
+		out.resize(static_cast<size_t>(size));
+		in.seekg(0);
+		return size == 0 || static_cast<bool>(in.read(reinterpret_cast<char*>(out.data()), size));
+	}
+
+	template<typename T>
+	bool ReadValue(std::istream& in, T& value)
+	{
+		return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+
+	template<typename T>
+	void WriteValue(std::ostream& out, const T& value)
+	{
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	bool LoadManifest(const std::filesystem::path& path, Manifest& manifest)
+	{
+		std::ifstream in(path, std::ios::binary);
+		if (!in.is_open())
+			return false;
+
+		char magic[4]{};
+		uint32 version{};
+		uint32 recordCount{};
+		if (!in.read(magic, sizeof(magic)) || 0 != std::memcmp(magic, ManifestMagic, sizeof(magic))
+			|| !ReadValue(in, version) || ManifestVersion != version
+			|| !ReadValue(in, manifest.chunkSize) || !ReadValue(in, manifest.flags)
+			|| !ReadValue(in, manifest.keyFingerprint) || !ReadValue(in, manifest.indexHash)
+			|| !ReadValue(in, recordCount))
+		{
+			return false;
+		}
+
+		manifest.records.reserve(recordCount);
+		for (uint32 i = 0; i < recordCount; ++i)
+		{
+			uint16 pathLength{};
+			std::string path;
+			ManifestRecord record;
+			if (!ReadValue(in, pathLength))
+				return false;
+
+			path.resize(pathLength);
+			if (!in.read(path.data(), pathLength) || !ReadValue(in, record.size)
+				|| !ReadValue(in, record.writeTime) || !ReadValue(in, record.contentHash))
+			{
+				return false;
+			}
+			manifest.records.emplace(std::move(path), record);
+		}
+		return true;
+	}
+}
+
+std::string PakBuildReport::ToString() const
+{
+	constexpr double MiB = 1024.0 * 1024.0;
+
+	uint32 fileCount{};
+	uint64 bytesIn{};
+	uint64 bytesOut{};
+	for (const auto& [extension, stat] : extensions)
+	{
+		fileCount += stat.fileCount;
+		bytesIn += stat.bytesIn;
+		bytesOut += stat.bytesOut;
+	}
+
+	std::ostringstream oss;
+	oss << std::fixed << std::setprecision(2);
+	oss << "[Pak] " << (incremental ? "incremental" : "full") << " build, files: " << fileCount
+		<< " (reused: " << reusedFileCount << ", duplicate files: " << dedupFileCount
+		<< ", duplicate chunks: " << dedupChunkCount << ", deduplicated: " << dedupBytes / MiB << "MiB)\n";
+	oss << "  in: " << bytesIn / MiB << "MiB out: " << bytesOut / MiB << "MiB ratio: "
+		<< (0 == bytesIn ? 0.0 : static_cast<double>(bytesOut) / static_cast<double>(bytesIn)) << "\n";
+	oss << "  scan: " << scanMs << "ms hash: " << hashMs << "ms compress: " << compressMs
+		<< "ms encrypt: " << encryptMs << "ms write: " << writeMs << "ms index: " << indexMs
+		<< "ms total: " << totalMs << "ms\n";
+
+	for (const auto& [extension, stat] : extensions)
+	{
+		oss << "  " << std::left << std::setw(10) << extension << std::right
+			<< " files: " << stat.fileCount << " reused: " << stat.reusedCount
+			<< " in: " << stat.bytesIn / MiB << "MiB out: " << stat.bytesOut / MiB
+			<< "MiB ratio: " << stat.Ratio() << "\n";
+	}
+	return oss.str();
+}
+
+PakBuilder::PakBuilder(std::filesystem::path outPak, Options options) :
+	m_outPak(std::move(outPak)),
+	m_options(std::move(options))
+{
+}
+
+void PakBuilder::AddFile(std::string virtualPath, std::filesystem::path sourcePath)
+{
+	Source& source = m_sources.emplace_back();
+	source.virtualPath = std::move(virtualPath);
+	source.sourcePath = std::move(sourcePath);
+}
+
+std::filesystem::path PakBuilder::GetManifestPath(const std::filesystem::path& pakPath)
+{
+	std::filesystem::path manifestPath = pakPath;
+	manifestPath += L".manifest";
+	return manifestPath;
+}
+
+bool PakBuilder::Build(PakBuildReport& report)
+{
+	namespace fs = std::filesystem;
+
+	Benchmark totalBenchmark;
+	report = PakBuildReport{};
+
+	if (m_sources.empty())
+	{
+		Debug->LogWarning("No files were added to the pak builder.");
+		return false;
+	}
+
+	const uint32 sourceCount = static_cast<uint32>(m_sources.size());
+	const uint32 chunkSize = m_options.chunkSize;
+	const bool encrypt = m_options.key.has_value();
+	uint8 entryFlags = 0;
+	if (encrypt) entryFlags |= EncryptedFlag;
+	if (m_options.compress) entryFlags |= CompressedFlag;
+
+	std::atomic<int64> failedIndex{ -1 };
+
+	// 1. 크기와 수정 시간
+	{
+		Benchmark scanBenchmark;
+		JobSystems->Wait(JobSystems->ParallelFor(sourceCount, 0, [&](uint32 begin, uint32 end)
+		{
+			for (uint32 i = begin; i < end; ++i)
+			{
+				Source& source = m_sources[i];
+				std::error_code ec;
+				source.size = fs::file_size(source.sourcePath, ec);
+				if (!ec)
+				{
+					source.writeTime = static_cast<int64>(fs::last_write_time(source.sourcePath, ec).time_since_epoch().count());
+				}
+				if (ec)
+				{
+					failedIndex = i;
+				}
+			}
+		}));
+		report.scanMs = scanBenchmark.GetElapsedTime();
+	}
+
+	if (failedIndex >= 0)
+	{
+		Debug->LogError("Failed to query pak source: " + m_sources[failedIndex].sourcePath.string());
+		return false;
+	}
+
+	// 2. 이전 pak (매니페스트와 인덱스 해시가 맞고 설정이 같을 때만 쓴다)
+	Manifest previous;
+	std::optional<Pak::Archive> previousArchive;
+	MappedFile previousPak;
+	std::unordered_map<std::string, const Pak::Entry*> previousEntries;
+	if (m_options.incremental && LoadManifest(GetManifestPath(m_outPak), previous)
+		&& previous.chunkSize == chunkSize && previous.flags == entryFlags
+		&& previous.keyFingerprint == KeyFingerprint(m_options.key))
+	{
+		try
+		{
+			previousArchive.emplace(m_outPak, Pak::OpenOptions{ m_options.key });
+		}
+		catch (const std::exception& e)
+		{
+			Debug->LogWarning(std::string("Previous pak is not reusable, rebuilding: ") + e.what());
+		}
+
+		if (previousArchive
+			&& 0 == std::memcmp(previousArchive->indexHeader().indexHash, previous.indexHash.data(), previous.indexHash.size())
+			&& previousPak.Open(m_outPak))
+		{
+			for (const Pak::Entry& entry : previousArchive->entries())
+			{
+				previousEntries.emplace(entry.path, &entry);
+			}
+			report.incremental = true;
+		}
+		else
+		{
+			previousArchive.reset();
+			previousPak.Close();
+		}
+	}
+
+	Pak::Header header{};
+	header.chunkSize = chunkSize;
+	header.flags = entryFlags;
+	uint64 nextFileId = 1;
+	if (report.incremental)
+	{
+		// 그대로 옮기는 청크의 CTR 이 맞도록 salt 와 fileId 를 이어 쓴다
+		std::memcpy(header.salt, previousArchive->header().salt, sizeof(header.salt));
+		for (const Pak::Entry& entry : previousArchive->entries())
+		{
+			nextFileId = (std::max<uint64>)(nextFileId, entry.fileId + 1);
+		}
+	}
+	else
+	{
+		BCryptGenRandom(NULL, header.salt, sizeof(header.salt), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+	}
+
+	// 크기와 수정 시간이 같으면 매니페스트의 내용 해시를 믿고 파일을 읽지 않는다
+	std::vector<uint8> needsRead(sourceCount, 1);
+	if (report.incremental)
+	{
+		for (uint32 i = 0; i < sourceCount; ++i)
+		{
+			Source& source = m_sources[i];
+			auto recordIt = previous.records.find(source.virtualPath);
+			if (recordIt != previous.records.end() && previousEntries.contains(source.virtualPath)
+				&& recordIt->second.size == source.size && recordIt->second.writeTime == source.writeTime)
+			{
+				source.contentHash = recordIt->second.contentHash;
+				needsRead[i] = 0;
+			}
+		}
+	}
+
+	// 이전 pak 을 읽는 동안에는 덮어쓸 수 없으므로 임시 파일에 쓰고 마지막에 바꾼다
+	fs::path tempPath = m_outPak;
+	tempPath += L".tmp";
+	std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+	if (!out.is_open())
+	{
+		Debug->LogError("Failed to open pak output: " + tempPath.string());
+		return false;
+	}
+
+	auto abortBuild = [&](const std::string& message)
+	{
+		Debug->LogError(message);
+		out.close();
+		std::error_code ec;
+		fs::remove(tempPath, ec);
+		return false;
+	};
+
+	WriteValue(out, header);
+	uint64 writeOffset = sizeof(Pak::Header);
+	header.dataStart = writeOffset;
+
+	std::vector<Pak::Entry> entries(sourceCount);
+	std::vector<std::vector<ChunkSlot>> slots(sourceCount);
+	std::unordered_map<Digest, uint32, DigestHash> contentToEntry;
+	std::unordered_map<Digest, Pak::ChunkInfo, DigestHash> writtenChunks;
+	std::unordered_map<uint64, Pak::ChunkInfo> copiedChunks;		// 이전 pak 오프셋 -> 새 위치
+
+	std::vector<PendingChunk> pending;
+	std::unordered_map<Digest, uint32, DigestHash> batchChunks;
+	std::unordered_map<uint64, uint32> batchCopies;
+	std::vector<std::vector<uint8>> fileData;
+	std::vector<std::vector<Digest>> chunkDigests;
+	std::vector<uint8> isNewEntry;
+
+	uint32 batchBegin = 0;
+	while (batchBegin < sourceCount)
+	{
+		uint32 batchEnd = batchBegin;
+		uint64 batchBytes = 0;
+		do
+		{
+			if (needsRead[batchEnd])
+			{
+				batchBytes += m_sources[batchEnd].size;
+			}
+			++batchEnd;
+		} while (batchEnd < sourceCount && batchBytes < BatchBudget);
+
+		const uint32 batchCount = batchEnd - batchBegin;
+		fileData.assign(batchCount, {});
+		chunkDigests.assign(batchCount, {});
+		isNewEntry.assign(batchCount, 0);
+		pending.clear();
+		batchChunks.clear();
+		batchCopies.clear();
+
+		// 3. 읽기 + 내용 해시 (암호화하지 않으면 청크 해시도)
+		{
+			Benchmark hashBenchmark;
+			JobSystems->Wait(JobSystems->ParallelFor(batchCount, 1, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 j = begin; j < end; ++j)
+				{
+					const uint32 i = batchBegin + j;
+					if (!needsRead[i])
+						continue;
+
+					Source& source = m_sources[i];
+					std::vector<uint8>& data = fileData[j];
+					if (!ReadSourceFile(source.sourcePath, data))
+					{
+						failedIndex = i;
+						continue;
+					}
+
+					try
+					{
+						source.size = data.size();
+						source.contentHash = Pak::Crypto::sha256(data);
+						if (!encrypt)
+						{
+							const size_t chunkCount = (data.size() + chunkSize - 1) / chunkSize;
+							chunkDigests[j].resize(chunkCount);
+							for (size_t c = 0; c < chunkCount; ++c)
+							{
+								const size_t offset = c * chunkSize;
+								const size_t size = (std::min<size_t>)(chunkSize, data.size() - offset);
+								chunkDigests[j][c] = Pak::Crypto::sha256(std::span<const uint8>(data.data() + offset, size));
+							}
+						}
+					}
+					catch (const std::exception&)
+					{
+						failedIndex = i;
+					}
+				}
+			}));
+			report.hashMs += hashBenchmark.GetElapsedTime();
+		}
+
+		if (failedIndex >= 0)
+		{
+			return abortBuild("Failed to read pak source: " + m_sources[failedIndex].sourcePath.string());
+		}
+
+		// 4. 항목마다 청크를 어디서 가져올지 정한다
+		for (uint32 j = 0; j < batchCount; ++j)
+		{
+			const uint32 i = batchBegin + j;
+			const Source& source = m_sources[i];
+			Pak::Entry& entry = entries[i];
+			entry.path = source.virtualPath;
+			entry.pathHash = Pak::fnv1a64(entry.path);
+			entry.uncompressedSize = source.size;
+			entry.chunkSize = chunkSize;
+			entry.flags = entryFlags;
+
+			PakBuildReport::ExtensionStat& stat = report.extensions[GetExtensionKey(source.virtualPath)];
+			++stat.fileCount;
+			stat.bytesIn += source.size;
+
+			// 내용이 같은 파일은 청크와 fileId 를 같이 쓴다 (같은 fileId 면 암호문도 같다)
+			if (auto contentIt = contentToEntry.find(source.contentHash); contentIt != contentToEntry.end())
+			{
+				entry.fileId = entries[contentIt->second].fileId;
+				slots[i] = slots[contentIt->second];
+				++report.dedupFileCount;
+				report.dedupBytes += source.size;
+				continue;
+			}
+			contentToEntry.emplace(source.contentHash, i);
+
+			auto previousIt = previousEntries.find(source.virtualPath);
+			auto recordIt = previous.records.find(source.virtualPath);
+			if (previousIt != previousEntries.end() && recordIt != previous.records.end()
+				&& recordIt->second.contentHash == source.contentHash
+				&& previousIt->second->uncompressedSize == source.size)
+			{
+				const Pak::Entry& previousEntry = *previousIt->second;
+				entry.fileId = previousEntry.fileId;
+				++stat.reusedCount;
+				++report.reusedFileCount;
+
+				slots[i].reserve(previousEntry.chunks.size());
+				for (const Pak::ChunkInfo& chunk : previousEntry.chunks)
+				{
+					ChunkSlot& slot = slots[i].emplace_back();
+					if (auto copiedIt = copiedChunks.find(chunk.ofs); copiedIt != copiedChunks.end())
+					{
+						slot.info = copiedIt->second;
+					}
+					else if (auto batchIt = batchCopies.find(chunk.ofs); batchIt != batchCopies.end())
+					{
+						slot.pending = static_cast<int32>(batchIt->second);
+					}
+					else
+					{
+						slot.pending = static_cast<int32>(pending.size());
+						batchCopies.emplace(chunk.ofs, slot.pending);
+
+						PendingChunk& chunkToCopy = pending.emplace_back();
+						chunkToCopy.copy = true;
+						chunkToCopy.sourceOffset = chunk.ofs;
+						chunkToCopy.compressedSize = chunk.compSize;
+						chunkToCopy.uncompressedSize = chunk.uncompSize;
+					}
+				}
+				continue;
+			}
+
+			entry.fileId = nextFileId++;
+			isNewEntry[j] = 1;
+
+			const uint32 chunkCount = static_cast<uint32>((source.size + chunkSize - 1) / chunkSize);
+			slots[i].reserve(chunkCount);
+			for (uint32 c = 0; c < chunkCount; ++c)
+			{
+				const uint64 offset = static_cast<uint64>(c) * chunkSize;
+				const uint32 size = static_cast<uint32>((std::min<uint64>)(chunkSize, source.size - offset));
+				ChunkSlot& slot = slots[i].emplace_back();
+
+				// 암호화하면 청크마다 카운터가 달라 같은 내용이라도 암호문이 다르므로 청크 중복 제거는 하지 않는다
+				if (!encrypt)
+				{
+					const Digest& digest = chunkDigests[j][c];
+					if (auto writtenIt = writtenChunks.find(digest); writtenIt != writtenChunks.end())
+					{
+						slot.info = writtenIt->second;
+						++report.dedupChunkCount;
+						report.dedupBytes += size;
+						continue;
+					}
+					if (auto batchIt = batchChunks.find(digest); batchIt != batchChunks.end())
+					{
+						slot.pending = static_cast<int32>(batchIt->second);
+						++report.dedupChunkCount;
+						report.dedupBytes += size;
+						continue;
+					}
+					batchChunks.emplace(digest, static_cast<uint32>(pending.size()));
+				}
+
+				slot.pending = static_cast<int32>(pending.size());
+				PendingChunk& chunkToEncode = pending.emplace_back();
+				chunkToEncode.batchFile = j;
+				chunkToEncode.sourceOffset = offset;
+				chunkToEncode.uncompressedSize = size;
+				chunkToEncode.fileId = entry.fileId;
+			}
+		}
+
+		const uint32 pendingCount = static_cast<uint32>(pending.size());
+
+		// 5. 압축
+		{
+			Benchmark compressBenchmark;
+			JobSystems->Wait(JobSystems->ParallelFor(pendingCount, 1, [&](uint32 begin, uint32 end)
+			{
+				Pak::Compression::LZ4Codec codec;
+				for (uint32 k = begin; k < end; ++k)
+				{
+					PendingChunk& chunk = pending[k];
+					if (chunk.copy)
+						continue;
+
+					const std::vector<uint8>& data = fileData[chunk.batchFile];
+					std::span<const uint8> src(data.data() + chunk.sourceOffset, chunk.uncompressedSize);
+					try
+					{
+						chunk.data = (entryFlags & CompressedFlag) ? codec.compress(src) : std::vector<uint8>(src.begin(), src.end());
+					}
+					catch (const std::exception&)
+					{
+						failedIndex = batchBegin + chunk.batchFile;
+					}
+				}
+			}));
+			report.compressMs += compressBenchmark.GetElapsedTime();
+		}
+
+		if (failedIndex >= 0)
+		{
+			return abortBuild("Failed to compress pak source: " + m_sources[failedIndex].sourcePath.string());
+		}
+
+		// 6. 암호화. 압축 크기가 정해져야 청크별 카운터 위치를 알 수 있다
+		if (encrypt)
+		{
+			Benchmark encryptBenchmark;
+			for (uint32 j = 0; j < batchCount; ++j)
+			{
+				if (!isNewEntry[j])
+					continue;
+
+				uint64 counter = 0;
+				for (const ChunkSlot& slot : slots[batchBegin + j])
+				{
+					PendingChunk& chunk = pending[slot.pending];
+					chunk.counterOffset = counter;
+					counter += (chunk.data.size() + 15) / 16;
+				}
+			}
+
+			JobSystems->Wait(JobSystems->ParallelFor(pendingCount, 1, [&](uint32 begin, uint32 end)
+			{
+				for (uint32 k = begin; k < end; ++k)
+				{
+					PendingChunk& chunk = pending[k];
+					if (chunk.copy || chunk.data.empty())
+						continue;
+
+					try
+					{
+						std::array<uint8, 16> iv = Pak::Crypto::Aes256Ctr::makeCtrIV(header.salt, chunk.fileId);
+						Pak::Crypto::Aes256Ctr::advanceCtr(iv, chunk.counterOffset);
+						Pak::Crypto::Aes256Ctr aes;
+						aes.init(m_options.key.value(), iv);
+						aes.crypt_inplace(chunk.data.data(), chunk.data.size());
+					}
+					catch (const std::exception&)
+					{
+						failedIndex = batchBegin + chunk.batchFile;
+					}
+				}
+			}));
+			report.encryptMs += encryptBenchmark.GetElapsedTime();
+
+			if (failedIndex >= 0)
+			{
+				return abortBuild("Failed to encrypt pak source: " + m_sources[failedIndex].sourcePath.string());
+			}
+		}
+
+		// 7. 파일 순서대로 기록
+		{
+			Benchmark writeBenchmark;
+			for (uint32 j = 0; j < batchCount; ++j)
+			{
+				const uint32 i = batchBegin + j;
+				Pak::Entry& entry = entries[i];
+				PakBuildReport::ExtensionStat& stat = report.extensions[GetExtensionKey(entry.path)];
+
+				for (ChunkSlot& slot : slots[i])
+				{
+					if (slot.pending < 0)
+						continue;
+
+					PendingChunk& chunk = pending[slot.pending];
+					if (!chunk.written)
+					{
+						const uint8* data = chunk.data.data();
+						uint32 size = static_cast<uint32>(chunk.data.size());
+						if (chunk.copy)
+						{
+							if (chunk.sourceOffset + chunk.compressedSize > previousPak.Size())
+							{
+								return abortBuild("Previous pak is truncated: " + m_outPak.string());
+							}
+							data = reinterpret_cast<const uint8*>(previousPak.Data()) + chunk.sourceOffset;
+							size = chunk.compressedSize;
+							copiedChunks.emplace(chunk.sourceOffset, Pak::ChunkInfo{ size, chunk.uncompressedSize, writeOffset });
+						}
+
+						out.write(reinterpret_cast<const char*>(data), size);
+						chunk.info = Pak::ChunkInfo{ size, chunk.uncompressedSize, writeOffset };
+						chunk.written = true;
+						chunk.data = {};
+						writeOffset += size;
+						stat.bytesOut += size;
+					}
+
+					slot.info = chunk.info;
+					slot.pending = -1;
+				}
+
+				entry.chunks.clear();
+				entry.chunks.reserve(slots[i].size());
+				for (const ChunkSlot& slot : slots[i])
+				{
+					entry.chunks.push_back(slot.info);
+				}
+				entry.chunkCount = static_cast<uint32>(entry.chunks.size());
+				entry.dataOfs = entry.chunks.empty() ? writeOffset : entry.chunks.front().ofs;
+			}
+
+			for (const auto& [digest, index] : batchChunks)
+			{
+				writtenChunks.emplace(digest, pending[index].info);
+			}
+			report.writeMs += writeBenchmark.GetElapsedTime();
+		}
+
+		if (!out)
+		{
+			return abortBuild("Failed to write pak output: " + tempPath.string());
+		}
+
+		batchBegin = batchEnd;
+	}
+
+	// 8. 인덱스 (Pak::Builder 와 같은 배치)
+	Pak::IndexHeader indexHeader{};
+	{
+		Benchmark indexBenchmark;
+		std::vector<uint8> body;
+		auto append = [&body](const void* data, size_t size)
+		{
+			const uint8* bytes = static_cast<const uint8*>(data);
+			body.insert(body.end(), bytes, bytes + size);
+		};
+
+		for (const Pak::Entry& entry : entries)
+		{
+			const uint16 pathLength = static_cast<uint16>(entry.path.size());
+			append(&pathLength, sizeof(pathLength));
+			append(entry.path.data(), pathLength);
+			append(&entry.pathHash, sizeof(entry.pathHash));
+			append(&entry.fileId, sizeof(entry.fileId));
+			append(&entry.uncompressedSize, sizeof(entry.uncompressedSize));
+			append(&entry.dataOfs, sizeof(entry.dataOfs));
+			append(&entry.chunkSize, sizeof(entry.chunkSize));
+			append(&entry.chunkCount, sizeof(entry.chunkCount));
+			append(&entry.flags, sizeof(entry.flags));
+			for (const Pak::ChunkInfo& chunk : entry.chunks)
+			{
+				append(&chunk, sizeof(Pak::ChunkInfo));
+			}
+		}
+
+		indexHeader.fileCount = sourceCount;
+		indexHeader.compAlgo = static_cast<uint8>(m_options.compress ? Pak::CompAlgo::LZ4 : Pak::CompAlgo::None);
+		indexHeader.encAlgo = static_cast<uint8>(encrypt ? Pak::EncAlgo::AES256CTR : Pak::EncAlgo::None);
+		const Digest indexHash = Pak::Crypto::sha256(body);
+		std::memcpy(indexHeader.indexHash, indexHash.data(), indexHash.size());
+
+		header.indexOfs = writeOffset;
+		header.indexSize = sizeof(Pak::IndexHeader) + body.size();
+
+		WriteValue(out, indexHeader);
+		out.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+		out.seekp(0);
+		WriteValue(out, header);
+		out.close();
+		report.indexMs = indexBenchmark.GetElapsedTime();
+	}
+
+	if (!out)
+	{
+		return abortBuild("Failed to write pak index: " + tempPath.string());
+	}
+
+	previousArchive.reset();
+	previousPak.Close();
+
+	std::error_code ec;
+	fs::rename(tempPath, m_outPak, ec);
+	if (ec)
+	{
+		return abortBuild("Failed to replace pak '" + m_outPak.string() + "': " + ec.message());
+	}
+
+	// 다음 빌드에서 비교할 매니페스트
+	std::ofstream manifestFile(GetManifestPath(m_outPak), std::ios::binary | std::ios::trunc);
+	if (manifestFile.is_open())
+	{
+		manifestFile.write(ManifestMagic, sizeof(ManifestMagic));
+		WriteValue(manifestFile, ManifestVersion);
+		WriteValue(manifestFile, chunkSize);
+		WriteValue(manifestFile, entryFlags);
+		WriteValue(manifestFile, KeyFingerprint(m_options.key));
+		WriteValue(manifestFile, indexHeader.indexHash);
+		WriteValue(manifestFile, sourceCount);
+		for (const Source& source : m_sources)
+		{
+			const uint16 pathLength = static_cast<uint16>(source.virtualPath.size());
+			WriteValue(manifestFile, pathLength);
+			manifestFile.write(source.virtualPath.data(), pathLength);
+			WriteValue(manifestFile, source.size);
+			WriteValue(manifestFile, source.writeTime);
+			WriteValue(manifestFile, source.contentHash);
+		}
+	}
+
+	if (!manifestFile)
+	{
+		// pak 은 이미 만들어졌으므로 다음 빌드가 전체 빌드가 될 뿐이다
+		Debug->LogWarning("Failed to write pak manifest. The next build will not be incremental.");
+		std::error_code removeError;
+		fs::remove(GetManifestPath(m_outPak), removeError);
+	}
+
+	report.totalMs = totalBenchmark.GetElapsedTime();
+	return true;
+}
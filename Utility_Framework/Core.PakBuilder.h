@@ -0,0 +1,81 @@
+#pragma once
+#ifndef DYNAMICCPP_EXPORTS
+#include <array>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "BaseTypeDef.h"
+
+// pak 빌드 결과 (확장자별 용량, 단계별 시간)
+struct PakBuildReport
+{
+	struct ExtensionStat
+	{
+		uint32 fileCount{};
+		uint32 reusedCount{};	// 이전 pak 에서 그대로 옮긴 파일 수
+		uint64 bytesIn{};
+		uint64 bytesOut{};		// 이 확장자 파일 때문에 새로 기록한 바이트 (중복 제거된 청크는 빠진다)
+
+		double Ratio() const { return 0 == bytesIn ? 0.0 : static_cast<double>(bytesOut) / static_cast<double>(bytesIn); }
+	};
+
+	std::map<std::string, ExtensionStat> extensions;
+	bool	incremental{};
+	uint32	reusedFileCount{};
+	uint32	dedupFileCount{};
+	uint64	dedupChunkCount{};
+	uint64	dedupBytes{};
+
+	double	scanMs{};
+	double	hashMs{};
+	double	compressMs{};
+	double	encryptMs{};
+	double	writeMs{};
+	double	indexMs{};
+	double	totalMs{};
+
+	std::string ToString() const;
+};
+
+// Pak::Builder 와 같은 PAK1 포맷을 만드는 병렬 빌더
+// - 청크 압축/암호화는 잡 시스템에서 나눠 하고, 기록은 파일 순서대로 한다.
+// - 내용이 같은 파일은 한 번만 기록한다. 암호화하지 않으면 같은 청크도 한 번만 기록한다.
+// - pak 옆에 매니페스트(경로, 크기, 수정 시간, 내용 해시)를 남겨 두고, 다음 빌드에서 바뀌지 않은 항목은
+//   이전 pak 의 청크를 다시 압축/암호화하지 않고 그대로 옮긴다.
+class PakBuilder
+{
+public:
+	struct Options
+	{
+		uint32									chunkSize{ 256 * 1024 };
+		bool									compress{ true };
+		std::optional<std::array<uint8, 32>>	key;				// 없으면 암호화하지 않는다
+		bool									incremental{ true };
+	};
+
+	PakBuilder(std::filesystem::path outPak, Options options);
+
+	void AddFile(std::string virtualPath, std::filesystem::path sourcePath);
+	size_t GetFileCount() const { return m_sources.size(); }
+
+	bool Build(PakBuildReport& report);
+
+	static std::filesystem::path GetManifestPath(const std::filesystem::path& pakPath);
+
+private:
+	struct Source
+	{
+		std::string				virtualPath;
+		std::filesystem::path	sourcePath;
+		uint64					size{};
+		int64					writeTime{};
+		std::array<uint8, 32>	contentHash{};
+	};
+
+	std::filesystem::path	m_outPak;
+	Options					m_options;
+	std::vector<Source>		m_sources;
+};
+#endif // !DYNAMICCPP_EXPORTS
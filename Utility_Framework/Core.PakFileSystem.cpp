@@ -0,0 +1,477 @@
+#include "Paklib.hpp"
+#include "Core.PakFileSystem.h"
+#include "Core.JobSystem.h"
+#include "LogSystem.h"
+
+#include <atomic>
+#include <unordered_set>
+
+namespace
+{
+	constexpr uint8 EncryptedFlag = 1;
+	constexpr uint8 CompressedFlag = 2;
+
+	// pak 인덱스를 매핑된 메모리에서 그대로 읽는다 (범위를 넘으면 실패)
+	struct IndexReader
+	{
+		const std::byte* cursor{};
+		const std::byte* end{};
+
+		template<typename T>
+		bool Read(T& value)
+		{
+			if (static_cast<size_t>(end - cursor) < sizeof(T))
+				return false;
+
+			std::memcpy(&value, cursor, sizeof(T));
+			cursor += sizeof(T);
+			return true;
+		}
+
+		bool Read(std::string& value, size_t length)
+		{
+			if (static_cast<size_t>(end - cursor) < length)
+				return false;
+
+			value.assign(reinterpret_cast<const char*>(cursor), length);
+			cursor += length;
+			return true;
+		}
+	};
+
+	std::string NormalizeKey(std::string_view path)
+	{
+		std::string key(path);
+		for (char& c : key)
+		{
+			if (c == '\\')
+				c = '/';
+			else if (c >= 'A' && c <= 'Z')
+				c = static_cast<char>(c - 'A' + 'a');
+		}
+
+		while (!key.empty() && key.back() == '/')
+		{
+			key.pop_back();
+		}
+		return key;
+	}
+
+	std::string NormalizePathKey(const std::filesystem::path& path)
+	{
+		const std::u8string u8 = path.lexically_normal().generic_u8string();
+		return NormalizeKey(std::string_view(reinterpret_cast<const char*>(u8.data()), u8.size()));
+	}
+
+	template<typename Container>
+	bool ReadDiskFile(const std::filesystem::path& path, Container& out)
+	{
+		std::ifstream in(path, std::ios::binary | std::ios::ate);
+		if (!in.is_open())
+			return false;
+
+		const std::streamoff size = in.tellg();
+		if (size < 0)
+			return false;
+
+		out.resize(static_cast<size_t>(size));
+		in.seekg(0);
+		return size == 0 || static_cast<bool>(in.read(reinterpret_cast<char*>(out.data()), size));
+	}
+}
+
+ByteStreamBuf::pos_type ByteStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+	if (0 == (which & std::ios_base::in))
+		return pos_type(off_type(-1));
+
+	char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+	const off_type target = (base - eback()) + off;
+	if (target < 0 || target > egptr() - eback())
+		return pos_type(off_type(-1));
+
+	setg(eback(), eback() + target, egptr());
+	return pos_type(target);
+}
+
+ByteStreamBuf::pos_type ByteStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+bool PakFileSystem::Mount(const std::filesystem::path& pakPath, const std::filesystem::path& mountRoot,
+	const std::optional<std::array<uint8, 32>>& key)
+{
+	Unmount();
+
+	if (!m_pak.Open(pakPath))
+	{
+		Debug->LogError("PakFileSystem: failed to map pak " + pakPath.string());
+		return false;
+	}
+
+	m_mountRoot = mountRoot.lexically_normal();
+	m_mountKey = NormalizePathKey(m_mountRoot);
+	m_key = key;
+
+	if (!ParseIndex())
+	{
+		Debug->LogError("PakFileSystem: invalid pak index " + pakPath.string());
+		Unmount();
+		return false;
+	}
+
+	Debug->Log("PakFileSystem: mounted " + std::to_string(m_entries.size()) + " entries from " + pakPath.string());
+	return true;
+}
+
+void PakFileSystem::Unmount()
+{
+	m_pak.Close();
+	m_mountRoot.clear();
+	m_mountKey.clear();
+	m_key.reset();
+	m_entries.clear();
+	m_chunks.clear();
+	m_lookup.clear();
+}
+
+bool PakFileSystem::ParseIndex()
+{
+	const std::byte* data = m_pak.Data();
+	const size_t fileSize = m_pak.Size();
+
+	Pak::Header header{};
+	if (fileSize < sizeof(header))
+		return false;
+
+	std::memcpy(&header, data, sizeof(header));
+	if (std::string_view(header.magic, 4) != "PAK1" ||
+		header.indexOfs > fileSize ||
+		header.indexSize < sizeof(Pak::IndexHeader) ||
+		header.indexSize > fileSize - header.indexOfs)
+	{
+		return false;
+	}
+
+	std::memcpy(m_salt.data(), header.salt, m_salt.size());
+
+	IndexReader reader{ data + header.indexOfs, data + header.indexOfs + header.indexSize };
+	Pak::IndexHeader indexHeader{};
+	reader.Read(indexHeader);
+
+	// 인덱스 본문 무결성 확인 (Archive 와 같은 범위)
+	const auto digest = Pak::Crypto::sha256({ reinterpret_cast<const uint8*>(reader.cursor), static_cast<size_t>(reader.end - reader.cursor) });
+	if (0 != std::memcmp(digest.data(), indexHeader.indexHash, digest.size()))
+		return false;
+
+	m_entries.reserve(indexHeader.fileCount);
+	m_lookup.reserve(indexHeader.fileCount);
+
+	bool needsKey = false;
+	for (uint32 i = 0; i < indexHeader.fileCount; ++i)
+	{
+		Entry entry{};
+		uint16 pathLength{};
+		uint64 pathHash{};
+		uint64 dataOffset{};
+		uint32 chunkSize{};
+		if (!reader.Read(pathLength) || !reader.Read(entry.path, pathLength) ||
+			!reader.Read(pathHash) || !reader.Read(entry.fileId) || !reader.Read(entry.size) ||
+			!reader.Read(dataOffset) || !reader.Read(chunkSize) || !reader.Read(entry.chunkCount) || !reader.Read(entry.flags))
+		{
+			return false;
+		}
+
+		entry.key = NormalizeKey(entry.path);
+		entry.firstChunk = static_cast<uint32>(m_chunks.size());
+		entry.contiguous = true;
+		needsKey |= 0 != (entry.flags & EncryptedFlag);
+
+		uint64 nextOffset = dataOffset;
+		uint64 counterOffset = 0;
+		uint64 outputOffset = 0;
+		for (uint32 c = 0; c < entry.chunkCount; ++c)
+		{
+			Pak::ChunkInfo info{};
+			if (!reader.Read(info) || info.ofs > fileSize || info.compSize > fileSize - info.ofs)
+				return false;
+
+			Chunk chunk{};
+			chunk.offset = info.ofs;
+			chunk.compressedSize = info.compSize;
+			chunk.uncompressedSize = info.uncompSize;
+			chunk.counterOffset = counterOffset;
+			chunk.outputOffset = outputOffset;
+			m_chunks.push_back(chunk);
+
+			entry.contiguous &= info.ofs == nextOffset && info.compSize == info.uncompSize;
+			nextOffset = info.ofs + info.compSize;
+			counterOffset += (info.compSize + 15) / 16;
+			outputOffset += info.uncompSize;
+		}
+
+		if (outputOffset != entry.size)
+			return false;
+
+		const uint64 hash = Pak::fnv1a64(entry.key);
+		if (!m_lookup.emplace(hash, static_cast<uint32>(m_entries.size())).second)
+		{
+			// 대소문자만 다른 경로거나 해시 충돌이면 먼저 들어간 항목을 쓴다
+			Debug->LogWarning("PakFileSystem: duplicate path " + entry.path);
+			continue;
+		}
+
+		m_entries.push_back(std::move(entry));
+	}
+
+	if (needsKey && !m_key)
+	{
+		Debug->LogError("PakFileSystem: pak contains encrypted entries but no key was given");
+		return false;
+	}
+
+	return true;
+}
+
+bool PakFileSystem::ToKey(const std::filesystem::path& path, std::string& key) const
+{
+	std::string full = NormalizePathKey(path);
+	if (full.size() < m_mountKey.size() || 0 != full.compare(0, m_mountKey.size(), m_mountKey))
+		return false;
+
+	if (full.size() == m_mountKey.size())
+	{
+		key.clear();
+		return true;
+	}
+
+	if (full[m_mountKey.size()] != '/')
+		return false;
+
+	key = full.substr(m_mountKey.size() + 1);
+	return true;
+}
+
+const PakFileSystem::Entry* PakFileSystem::Find(const std::filesystem::path& path) const
+{
+	if (!IsMounted())
+		return nullptr;
+
+	std::string key;
+	if (!ToKey(path, key) || key.empty())
+		return nullptr;
+
+	auto it = m_lookup.find(Pak::fnv1a64(key));
+	if (it == m_lookup.end())
+		return nullptr;
+
+	const Entry& entry = m_entries[it->second];
+	return entry.key == key ? &entry : nullptr;
+}
+
+bool PakFileSystem::Exists(const std::filesystem::path& path) const
+{
+	if (Contains(path))
+		return true;
+
+	std::error_code ec;
+	return std::filesystem::exists(path, ec);
+}
+
+uint64 PakFileSystem::FileSize(const std::filesystem::path& path) const
+{
+	if (const Entry* entry = Find(path))
+		return entry->size;
+
+	std::error_code ec;
+	const auto size = std::filesystem::file_size(path, ec);
+	return ec ? 0 : static_cast<uint64>(size);
+}
+
+bool PakFileSystem::Read(const std::filesystem::path& path, std::vector<std::byte>& out) const
+{
+	if (const Entry* entry = Find(path))
+	{
+		out.resize(static_cast<size_t>(entry->size));
+		return Decode(*entry, out.data());
+	}
+
+	return ReadDiskFile(path, out);
+}
+
+bool PakFileSystem::ReadText(const std::filesystem::path& path, std::string& out) const
+{
+	if (const Entry* entry = Find(path))
+	{
+		out.resize(static_cast<size_t>(entry->size));
+		return Decode(*entry, reinterpret_cast<std::byte*>(out.data()));
+	}
+
+	return ReadDiskFile(path, out);
+}
+
+std::span<const std::byte> PakFileSystem::View(const std::filesystem::path& path) const
+{
+	const Entry* entry = Find(path);
+	if (!entry || 0 != entry->flags || !entry->contiguous || 0 == entry->chunkCount)
+		return {};
+
+	return { m_pak.Data() + m_chunks[entry->firstChunk].offset, static_cast<size_t>(entry->size) };
+}
+
+void PakFileSystem::ForEachFile(const std::filesystem::path& directory, bool recursive,
+	const std::function<void(const std::filesystem::path&)>& func) const
+{
+	std::unordered_set<std::string> visited;
+
+	std::string directoryKey;
+	const bool inPak = IsMounted() && ToKey(directory, directoryKey);
+	if (inPak)
+	{
+		const std::string prefix = directoryKey.empty() ? std::string{} : directoryKey + '/';
+		for (const Entry& entry : m_entries)
+		{
+			if (0 != entry.key.compare(0, prefix.size(), prefix))
+				continue;
+
+			if (!recursive && std::string_view::npos != std::string_view(entry.key).find('/', prefix.size()))
+				continue;
+
+			visited.insert(entry.key);
+			std::filesystem::path filePath = m_mountRoot / std::filesystem::path(std::u8string(entry.path.begin(), entry.path.end()));
+			func(filePath.make_preferred());
+		}
+	}
+
+	// 디스크에 따로 둔 파일도 같이 본다 (pak 과 겹치면 pak 쪽만)
+	std::error_code ec;
+	if (!std::filesystem::is_directory(directory, ec))
+		return;
+
+	auto visit = [&](const std::filesystem::directory_entry& fileEntry)
+	{
+		if (!fileEntry.is_regular_file(ec))
+			return;
+
+		std::string key;
+		if (inPak && ToKey(fileEntry.path(), key) && visited.contains(key))
+			return;
+
+		func(fileEntry.path());
+	};
+
+	if (recursive)
+	{
+		for (const auto& fileEntry : std::filesystem::recursive_directory_iterator(directory, std::filesystem::directory_options::skip_permission_denied, ec))
+			visit(fileEntry);
+	}
+	else
+	{
+		for (const auto& fileEntry : std::filesystem::directory_iterator(directory, ec))
+			visit(fileEntry);
+	}
+}
+
+bool PakFileSystem::Decode(const Entry& entry, std::byte* dst) const
+{
+	if (entry.chunkCount <= 1)
+	{
+		return 0 == entry.chunkCount || DecodeChunk(entry, m_chunks[entry.firstChunk], dst);
+	}
+
+	// 청크별 CTR 시작 카운터를 알고 있으므로 청크끼리 독립적으로 풀 수 있다
+	std::atomic<bool> succeeded{ true };
+	JobHandle handle = JobSystems->ParallelFor(entry.chunkCount, 1, [&](uint32 begin, uint32 end)
+	{
+		for (uint32 c = begin; c < end; ++c)
+		{
+			const Chunk& chunk = m_chunks[entry.firstChunk + c];
+			if (!DecodeChunk(entry, chunk, dst + chunk.outputOffset))
+			{
+				succeeded.store(false, std::memory_order_relaxed);
+			}
+		}
+	});
+	JobSystems->Wait(handle);
+
+	return succeeded.load(std::memory_order_relaxed);
+}
+
+bool PakFileSystem::DecodeChunk(const Entry& entry, const Chunk& chunk, std::byte* dst) const
+{
+	const std::byte* src = m_pak.Data() + chunk.offset;
+
+	try
+	{
+		if (0 == (entry.flags & CompressedFlag))
+		{
+			const size_t size = (std::min)(chunk.compressedSize, chunk.uncompressedSize);
+			std::memcpy(dst, src, size);
+			if (entry.flags & EncryptedFlag)
+			{
+				std::array<uint8, 16> iv = Pak::Crypto::Aes256Ctr::makeCtrIV(m_salt.data(), entry.fileId);
+				Pak::Crypto::Aes256Ctr::advanceCtr(iv, chunk.counterOffset);
+
+				Pak::Crypto::Aes256Ctr aes;
+				aes.init(*m_key, iv);
+				aes.crypt_inplace(reinterpret_cast<uint8*>(dst), size);
+			}
+			return true;
+		}
+
+		std::vector<uint8> compressed(reinterpret_cast<const uint8*>(src), reinterpret_cast<const uint8*>(src) + chunk.compressedSize);
+		if (entry.flags & EncryptedFlag)
+		{
+			std::array<uint8, 16> iv = Pak::Crypto::Aes256Ctr::makeCtrIV(m_salt.data(), entry.fileId);
+			Pak::Crypto::Aes256Ctr::advanceCtr(iv, chunk.counterOffset);
+
+			Pak::Crypto::Aes256Ctr aes;
+			aes.init(*m_key, iv);
+			aes.crypt_inplace(compressed.data(), compressed.size());
+		}
+
+		Pak::Compression::LZ4Codec codec;
+		const std::vector<uint8> plain = codec.decompress(compressed, chunk.uncompressedSize);
+		if (plain.size() != chunk.uncompressedSize)
+			return false;
+
+		std::memcpy(dst, plain.data(), plain.size());
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		Debug->LogError("PakFileSystem: failed to decode " + entry.path + ": " + e.what());
+	}
+	return false;
+}
+
+AssetStream::AssetStream(const std::filesystem::path& path, std::ios::openmode mode) : std::istream(nullptr)
+{
+	if (PakFileSystems->Contains(path))
+	{
+		m_view = PakFileSystems->View(path);
+		if (m_view.empty())
+		{
+			m_isOpen = PakFileSystems->Read(path, m_bytes);
+			m_view = m_bytes;
+		}
+		else
+		{
+			m_isOpen = true;
+		}
+
+		m_memoryBuf.Reset(m_view.data(), m_view.size());
+		rdbuf(&m_memoryBuf);
+	}
+	else
+	{
+		m_isOpen = nullptr != m_fileBuf.open(path, mode | std::ios::in);
+		rdbuf(&m_fileBuf);
+	}
+
+	if (!m_isOpen)
+	{
+		setstate(std::ios::failbit);
+	}
+}
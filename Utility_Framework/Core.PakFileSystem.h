@@ -0,0 +1,129 @@
+#pragma once
+#ifndef DYNAMICCPP_EXPORTS
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "BaseTypeDef.h"
+#include "ClassProperty.h"
+#include "Core.MappedFile.h"
+
+// 메모리 위의 바이트를 읽는 스트림 버퍼 (seek 지원)
+class ByteStreamBuf : public std::streambuf
+{
+public:
+	void Reset(const std::byte* data, size_t size)
+	{
+		char* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+		setg(begin, begin, begin + size);
+	}
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+// pak 을 메모리 매핑해 두고 항목을 그 자리에서 읽는 가상 파일 시스템
+// - 경로는 마운트 루트 기준 상대 경로로 바꿔 찾는다. 마운트 전이거나 pak 에 없는 경로는 디스크에서 읽는다.
+// - 청크마다 CTR 카운터를 계산할 수 있으므로 여러 청크짜리 항목은 잡 시스템에서 나눠 복호화/해제한다.
+// - 압축/암호화하지 않은 항목은 View 로 복사 없이 매핑된 메모리를 그대로 볼 수 있다.
+class PakFileSystem : public Singleton<PakFileSystem>
+{
+private:
+	friend class Singleton;
+
+	struct Chunk
+	{
+		uint64 offset{};
+		uint32 compressedSize{};
+		uint32 uncompressedSize{};
+		uint64 counterOffset{};		// 항목 IV 에서 이 청크까지 진행한 CTR 블록 수
+		uint64 outputOffset{};
+	};
+
+	struct Entry
+	{
+		std::string		path;		// pak 에 기록된 경로 (Assets/..., ProjectSetting/...)
+		std::string		key;		// 소문자, '/' 구분자로 정규화한 경로
+		uint64			fileId{};
+		uint64			size{};
+		uint8			flags{};	// bit0 = 암호화, bit1 = 압축
+		bool			contiguous{};
+		uint32			firstChunk{};
+		uint32			chunkCount{};
+	};
+
+	PakFileSystem() = default;
+	~PakFileSystem() = default;
+
+public:
+	// pakPath 를 매핑하고 인덱스를 읽는다. mountRoot 아래의 경로가 pak 항목으로 연결된다.
+	bool Mount(const std::filesystem::path& pakPath, const std::filesystem::path& mountRoot,
+		const std::optional<std::array<uint8, 32>>& key = std::nullopt);
+	void Unmount();
+	bool IsMounted() const { return m_pak.IsOpen(); }
+
+	// pak 에 있는지만 본다
+	bool Contains(const std::filesystem::path& path) const { return nullptr != Find(path); }
+	// pak 또는 디스크에 있는지 본다
+	bool Exists(const std::filesystem::path& path) const;
+	uint64 FileSize(const std::filesystem::path& path) const;
+
+	// pak 항목을 풀어 out 에 담는다. pak 에 없으면 디스크 파일을 읽는다.
+	bool Read(const std::filesystem::path& path, std::vector<std::byte>& out) const;
+	bool ReadText(const std::filesystem::path& path, std::string& out) const;
+	// 압축/암호화하지 않은 pak 항목이면 매핑된 메모리를 그대로 돌려준다. 아니면 빈 span.
+	std::span<const std::byte> View(const std::filesystem::path& path) const;
+
+	// directory 아래 파일을 pak 과 디스크에서 모두 찾아 넘긴다 (같은 경로는 한 번만)
+	void ForEachFile(const std::filesystem::path& directory, bool recursive,
+		const std::function<void(const std::filesystem::path&)>& func) const;
+
+private:
+	bool ParseIndex();
+	const Entry* Find(const std::filesystem::path& path) const;
+	bool ToKey(const std::filesystem::path& path, std::string& key) const;
+	bool Decode(const Entry& entry, std::byte* dst) const;
+	bool DecodeChunk(const Entry& entry, const Chunk& chunk, std::byte* dst) const;
+
+private:
+	MappedFile								m_pak;
+	std::filesystem::path					m_mountRoot;
+	std::string								m_mountKey;		// 정규화한 마운트 루트
+	std::array<uint8, 16>					m_salt{};
+	std::optional<std::array<uint8, 32>>	m_key;
+	std::vector<Entry>						m_entries;
+	std::vector<Chunk>						m_chunks;
+	std::unordered_map<uint64, uint32>		m_lookup;		// 정규화 경로 해시 -> 항목 번호
+};
+
+static auto& PakFileSystems = PakFileSystem::GetInstance();
+
+// std::ifstream 대신 쓰는 에셋 읽기 스트림
+// 마운트된 pak 에 있으면 풀어 둔 메모리에서, 없으면 디스크 파일에서 읽는다.
+class AssetStream : public std::istream
+{
+public:
+	explicit AssetStream(const std::filesystem::path& path, std::ios::openmode mode = std::ios::in);
+
+	bool is_open() const { return m_isOpen; }
+	// pak 에서 열었으면 전체 내용 (디스크에서 열었으면 빈 span)
+	std::span<const std::byte> Bytes() const { return m_view; }
+
+private:
+	std::vector<std::byte>		m_bytes;
+	std::span<const std::byte>	m_view;
+	ByteStreamBuf				m_memoryBuf;
+	std::filebuf				m_fileBuf;
+	bool						m_isOpen{ false };
+};
+#endif // !DYNAMICCPP_EXPORTS
@@ -0,0 +1,95 @@
+#pragma once
+#include <DirectXCollision.h>
+#include <xmmintrin.h>
+#include <cstdint>
+#include <cmath>
+
+// SoA 형태로 패킹된 AABB를 4개씩 한 번에 절두체 평면과 검사하기 위한 헬퍼.
+// 평면은 DirectX::BoundingFrustum::GetPlanes()와 동일하게 바깥쪽을 향하는 법선을 사용한다.
+// (dot(n, p) + d > 0 이면 평면 바깥)
+namespace Core::SIMDCulling
+{
+	constexpr int PlaneCount = 6;
+
+	struct alignas(16) FrustumPlanesSoA
+	{
+		__m128 nx[PlaneCount];
+		__m128 ny[PlaneCount];
+		__m128 nz[PlaneCount];
+		__m128 d[PlaneCount];
+		// |n| : 박스 반경(투영 extents) 계산용
+		__m128 ax[PlaneCount];
+		__m128 ay[PlaneCount];
+		__m128 az[PlaneCount];
+	};
+
+	inline FrustumPlanesSoA MakePlanes(const DirectX::BoundingFrustum& frustum)
+	{
+		using namespace DirectX;
+
+		XMVECTOR planes[PlaneCount];
+		frustum.GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
+
+		FrustumPlanesSoA out{};
+		for (int i = 0; i < PlaneCount; ++i)
+		{
+			XMFLOAT4 p;
+			XMStoreFloat4(&p, XMPlaneNormalize(planes[i]));
+			out.nx[i] = _mm_set1_ps(p.x);
+			out.ny[i] = _mm_set1_ps(p.y);
+			out.nz[i] = _mm_set1_ps(p.z);
+			out.d[i]  = _mm_set1_ps(p.w);
+			out.ax[i] = _mm_set1_ps(std::fabs(p.x));
+			out.ay[i] = _mm_set1_ps(std::fabs(p.y));
+			out.az[i] = _mm_set1_ps(std::fabs(p.z));
+		}
+		return out;
+	}
+
+	struct TestResult4
+	{
+		int visibleMask;	// bit i : i번째 박스가 절두체와 겹치거나 포함됨
+		int insideMask;		// bit i : i번째 박스가 절두체에 완전히 포함됨
+	};
+
+	// center(cx,cy,cz) / extents(ex,ey,ez) 4개를 한 번에 검사
+	inline TestResult4 TestAABB4(const FrustumPlanesSoA& planes,
+		__m128 cx, __m128 cy, __m128 cz,
+		__m128 ex, __m128 ey, __m128 ez)
+	{
+		__m128 outside = _mm_setzero_ps();
+		__m128 straddle = _mm_setzero_ps();
+
+		for (int i = 0; i < PlaneCount; ++i)
+		{
+			__m128 dist = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(planes.nx[i], cx), _mm_mul_ps(planes.ny[i], cy)),
+				_mm_add_ps(_mm_mul_ps(planes.nz[i], cz), planes.d[i]));
+
+			__m128 radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(planes.ax[i], ex), _mm_mul_ps(planes.ay[i], ey)),
+				_mm_mul_ps(planes.az[i], ez));
+
+			__m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+
+			outside  = _mm_or_ps(outside,  _mm_cmpgt_ps(dist, radius));
+			straddle = _mm_or_ps(straddle, _mm_cmpgt_ps(dist, negRadius));
+		}
+
+		const int outsideMask  = _mm_movemask_ps(outside);
+		const int straddleMask = _mm_movemask_ps(straddle);
+
+		return { (~outsideMask) & 0xF, (~straddleMask) & 0xF };
+	}
+
+	// SoA 배열(min/max 또는 center/extents)에서 base부터 4개를 로드해서 검사.
+	// 배열 길이는 4의 배수로 패딩되어 있어야 한다.
+	inline TestResult4 TestAABB4(const FrustumPlanesSoA& planes,
+		const float* cx, const float* cy, const float* cz,
+		const float* ex, const float* ey, const float* ez, size_t base)
+	{
+		return TestAABB4(planes,
+			_mm_loadu_ps(cx + base), _mm_loadu_ps(cy + base), _mm_loadu_ps(cz + base),
+			_mm_loadu_ps(ex + base), _mm_loadu_ps(ey + base), _mm_loadu_ps(ez + base));
+	}
+}
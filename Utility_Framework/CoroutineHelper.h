@@ -5,6 +5,7 @@
 #include <optional>
 #include <cassert>
 #include <type_traits>
+#include <cstddef>
 #include "LinkedListLib.hpp"
 
 enum class YieldInstructionType 
@@ -66,6 +67,14 @@ struct YieldInstruction
     }
 };
 
+// 코루틴 프레임용 크기별 풀. 반납된 블록은 같은 크기 코루틴이 다시 쓴다 (여러 스레드에서 호출 가능)
+class CoroutineFrameAllocator
+{
+public:
+    static void* Allocate(std::size_t size);
+    static void Deallocate(void* ptr, std::size_t size) noexcept;
+};
+
 template<typename T = YieldInstruction>
 struct Coroutine {
     struct promise_type;
@@ -75,6 +84,10 @@ struct Coroutine {
     {
         std::optional<T> current_value;
 
+        // 코루틴 프레임은 크기별 풀에서 꺼내 쓴다 (짧은 코루틴을 자주 만들어도 전역 힙을 타지 않도록)
+        static void* operator new(std::size_t size) { return CoroutineFrameAllocator::Allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) noexcept { CoroutineFrameAllocator::Deallocate(ptr, size); }
+
         Coroutine get_return_object() 
         {
             return Coroutine{ handle_type::from_promise(*this) };
@@ -93,8 +106,9 @@ struct Coroutine {
         void unhandled_exception() { std::terminate(); }
     };
 
-    handle_type handle;
+    handle_type handle{};
 
+    Coroutine() = default;
     explicit Coroutine(handle_type h) : handle(h) {}
     Coroutine(const Coroutine&) = delete;
     Coroutine(Coroutine&& other) noexcept : handle(other.handle) {
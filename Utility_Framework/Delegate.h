@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <concepts>
 #include <future>
+#include <atomic>
 
 namespace Core
 {
@@ -55,7 +56,7 @@ namespace Core
 	class Delegate
 	{
 	public:
-		Delegate() : nextID_(1) {}
+		Delegate() = default;
 		~Delegate();
 
 		DelegateHandle AddLambda(CallableWithSignature<Ret, Args...> auto&& func, int priority = 0);
@@ -84,19 +85,40 @@ namespace Core
 		}
 
 	private:
-		struct CallbackInfo
+		// 핸들 ID = (세대 << SlotBits) | (슬롯 번호 + 1). 슬롯을 재사용하면 세대가 바뀌어 옛 핸들은 무효가 된다
+		static constexpr std::uint32_t SlotBits = 20;
+		static constexpr std::uint32_t SlotMask = (1u << SlotBits) - 1;
+		static constexpr std::uint32_t GenerationMask = 0xFFFFFFFFu >> SlotBits;
+		static constexpr std::uint32_t ChunkSize = 256;
+
+		// 청크 단위로 할당해 슬롯 주소가 바뀌지 않는다 (스냅샷이 포인터를 들고 있어도 안전)
+		struct Slot
 		{
-			DelegateHandle handle;
 			std::function<Ret(Args...)> callback;
+			std::atomic<bool> isAlive{ false };
+			std::uint32_t generation{ 1 };
 			int priority{};
 		};
 
+		using Snapshot = std::vector<Slot*>;
+
 		DelegateHandle AddInternal(std::function<Ret(Args...)> func, int priority);
+		Slot* FindSlot(const DelegateHandle& handle) const;
+		void ReleaseSlot(std::uint32_t index);
+		std::shared_ptr<const Snapshot> AcquireSnapshot();
+		void EndBroadcast();
+		static void Invoke(Slot* slot, Args... args);
 
 		std::atomic_flag atomic_flag_ = ATOMIC_FLAG_INIT;
-		std::vector<CallbackInfo> callbacks_;
-		std::uint32_t nextID_;
-		bool isStopped_ = false;
+		std::vector<std::unique_ptr<Slot[]>> chunks_;
+		std::vector<std::uint32_t> freeSlots_;
+		std::vector<std::uint32_t> pendingFree_;		// 브로드캐스트 중에 제거된 슬롯. 마지막 브로드캐스트가 끝나면 정리
+		std::vector<Slot*> order_;						// 우선순위 순서 (기준 목록)
+		std::shared_ptr<const Snapshot> snapshot_;		// 브로드캐스트가 공유하는 order_ 사본. 목록이 바뀌면 새로 만든다
+		bool isOrderDirty_ = false;
+		std::atomic<std::uint32_t> broadcastDepth_{ 0 };
+		std::uint32_t slotCount_{ 0 };
+		std::atomic<bool> isStopped_{ false };
 	};
 }
 
@@ -41,22 +41,83 @@ namespace Core
 	auto Delegate<Ret, Args...>::AddInternal(std::function<Ret(Args...)> func, int priority) -> DelegateHandle
 	{
 		SpinLock lock(atomic_flag_);
-		DelegateHandle handle(nextID_++);
-		CallbackInfo info{ handle, std::move(func), priority };
-		auto it = std::lower_bound(callbacks_.begin(), callbacks_.end(), info, [](const CallbackInfo& a, const CallbackInfo& b) {
-			return a.priority > b.priority;
+		std::uint32_t index{};
+		if (!freeSlots_.empty())
+		{
+			index = freeSlots_.back();
+			freeSlots_.pop_back();
+		}
+		else
+		{
+			if (0 == slotCount_ % ChunkSize)
+			{
+				chunks_.emplace_back(std::make_unique<Slot[]>(ChunkSize));
+			}
+			index = slotCount_++;
+		}
+
+		Slot* slot = &chunks_[index / ChunkSize][index % ChunkSize];
+		slot->callback = std::move(func);
+		slot->priority = priority;
+		slot->isAlive.store(true, std::memory_order_release);
+
+		auto it = std::lower_bound(order_.begin(), order_.end(), priority, [](const Slot* a, int p) {
+			return a->priority > p;
 			});
-		callbacks_.insert(it, std::move(info));
-		return handle;
+		order_.insert(it, slot);
+		isOrderDirty_ = true;
+
+		return DelegateHandle((slot->generation << SlotBits) | (index + 1));
+	}
+
+	template <typename Ret, typename... Args>
+	auto Delegate<Ret, Args...>::FindSlot(const DelegateHandle& handle) const -> Slot*
+	{
+		const std::uint32_t id = handle.GetID();
+		const std::uint32_t slotID = id & SlotMask;
+		if (0 == slotID || slotCount_ < slotID) return nullptr;
+
+		const std::uint32_t index = slotID - 1;
+		Slot* slot = &chunks_[index / ChunkSize][index % ChunkSize];
+		if (slot->generation != (id >> SlotBits) || !slot->isAlive.load(std::memory_order_relaxed)) return nullptr;
+
+		return slot;
+	}
+
+	template <typename Ret, typename... Args>
+	void Delegate<Ret, Args...>::ReleaseSlot(std::uint32_t index)
+	{
+		Slot& slot = chunks_[index / ChunkSize][index % ChunkSize];
+		slot.callback = nullptr;
+		slot.generation = (slot.generation % GenerationMask) + 1;
+		freeSlots_.push_back(index);
 	}
 
 	template <typename Ret, typename... Args>
 	void Delegate<Ret, Args...>::Remove(DelegateHandle& handle)
 	{
 		SpinLock lock(atomic_flag_);
-		if (callbacks_.size() == 0) return;
-		callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(),
-			[&handle](const CallbackInfo& info) { return info.handle == handle; }), callbacks_.end());
+		Slot* slot = FindSlot(handle);
+		if (nullptr == slot)
+		{
+			handle.Reset();
+			return;
+		}
+
+		slot->isAlive.store(false, std::memory_order_release);
+		order_.erase(std::find(order_.begin(), order_.end(), slot));
+		isOrderDirty_ = true;
+
+		// 브로드캐스트 중이면 호출 중인 콜백일 수 있으므로 정리를 미룬다
+		const std::uint32_t index = (handle.GetID() & SlotMask) - 1;
+		if (0 < broadcastDepth_.load(std::memory_order_acquire))
+		{
+			pendingFree_.push_back(index);
+		}
+		else
+		{
+			ReleaseSlot(index);
+		}
 
 		handle.Reset();
 	}
@@ -66,81 +127,149 @@ namespace Core
 	{
 		SpinLock lock(atomic_flag_);
 		isStopped_ = true;
-		callbacks_.clear();
+
+		const bool isBroadcasting = 0 < broadcastDepth_.load(std::memory_order_acquire);
+		for (std::uint32_t index = 0; index < slotCount_; ++index)
+		{
+			Slot& slot = chunks_[index / ChunkSize][index % ChunkSize];
+			if (!slot.isAlive.exchange(false, std::memory_order_acq_rel)) continue;
+
+			if (isBroadcasting)
+			{
+				pendingFree_.push_back(index);
+			}
+			else
+			{
+				ReleaseSlot(index);
+			}
+		}
+
+		order_.clear();
+		isOrderDirty_ = true;
 	}
 
 	template <typename Ret, typename... Args>
-	void Delegate<Ret, Args...>::Broadcast(Args... args)
+	auto Delegate<Ret, Args...>::AcquireSnapshot() -> std::shared_ptr<const Snapshot>
 	{
-		std::vector<CallbackInfo> callbacksToInvoke;
+		SpinLock lock(atomic_flag_);
+		if (isOrderDirty_)
 		{
-			SpinLock lock(atomic_flag_);
-			callbacksToInvoke = callbacks_;
+			// 브로드캐스트 중인 스레드는 이전 스냅샷을 계속 사용한다
+			snapshot_ = std::make_shared<const Snapshot>(order_);
+			isOrderDirty_ = false;
+		}
+
+		broadcastDepth_.fetch_add(1, std::memory_order_acq_rel);
+		return snapshot_;
+	}
+
+	template <typename Ret, typename... Args>
+	void Delegate<Ret, Args...>::EndBroadcast()
+	{
+		if (1 != broadcastDepth_.fetch_sub(1, std::memory_order_acq_rel)) return;
+
+		SpinLock lock(atomic_flag_);
+		if (0 != broadcastDepth_.load(std::memory_order_acquire)) return;
+
+		for (std::uint32_t index : pendingFree_)
+		{
+			ReleaseSlot(index);
+		}
+		pendingFree_.clear();
+	}
+
+	template <typename Ret, typename... Args>
+	void Delegate<Ret, Args...>::Invoke(Slot* slot, Args... args)
+	{
+		// 브로드캐스트 도중 제거된 콜백은 건너뛴다
+		if (!slot->isAlive.load(std::memory_order_acquire)) return;
+
+		try
+		{
+			slot->callback(args...);
 		}
+		catch (const std::exception& e) { std::cerr << "Delegate Exception: " << e.what() << std::endl; }
+	}
 
-		for (auto& info : callbacksToInvoke)
+	template <typename Ret, typename... Args>
+	void Delegate<Ret, Args...>::Broadcast(Args... args)
+	{
+		// 콜백은 복사하지 않고 스냅샷의 슬롯을 바로 호출한다. 도중에 추가된 콜백은 다음 브로드캐스트부터 호출된다
+		std::shared_ptr<const Snapshot> snapshot = AcquireSnapshot();
+		if (snapshot)
 		{
-			try 
-			{ 
+			for (Slot* slot : *snapshot)
+			{
 				if (isStopped_) break;
 
-				info.callback(args...); 
+				Invoke(slot, args...);
 			}
-			catch (const std::exception& e) { std::cerr << "Delegate Exception: " << e.what() << std::endl; continue; }
 		}
+		EndBroadcast();
 	}
 
 	template<typename Ret, typename ...Args>
 	inline void Delegate<Ret, Args...>::UnsafeBroadcast(Args ...args)
 	{
-		for (auto& info : callbacks_)
+		// 잠금 없이 스냅샷을 순회한다. 한 스레드에서만 쓰는 델리게이트용
+		// 콜백 안에서 Add/Remove 해도 순회 목록은 그대로다 (제거된 콜백은 Invoke 가 건너뛰고, 추가는 다음 브로드캐스트부터)
+		if (isOrderDirty_)
+		{
+			snapshot_ = std::make_shared<const Snapshot>(order_);
+			isOrderDirty_ = false;
+		}
+
+		broadcastDepth_.fetch_add(1, std::memory_order_acq_rel);
+		std::shared_ptr<const Snapshot> snapshot = snapshot_;
+		if (snapshot)
 		{
-			try 
-			{ 
+			for (Slot* slot : *snapshot)
+			{
 				if (isStopped_) break;
 
-				info.callback(args...); 
+				Invoke(slot, args...);
 			}
-			catch (const std::exception& e) { std::cerr << "Delegate Exception: " << e.what() << std::endl; continue; }
 		}
+		EndBroadcast();
 	}
 
 	template<typename Ret, typename ...Args>
 	inline void Delegate<Ret, Args...>::TargetInvoke(DelegateHandle& DelegateHandle, Args ...args)
 	{
-		std::vector<CallbackInfo> callbacksToInvoke;
+		Slot* slot = nullptr;
 		{
 			SpinLock lock(atomic_flag_);
-			callbacksToInvoke = callbacks_;
+			slot = FindSlot(DelegateHandle);
+			if (nullptr == slot) return;
+
+			broadcastDepth_.fetch_add(1, std::memory_order_acq_rel);
 		}
 
-		auto it = std::find_if(callbacksToInvoke.begin(), callbacksToInvoke.end(),
-			[&DelegateHandle](const CallbackInfo& info) { return info.handle == DelegateHandle; });
-		if (it != callbacksToInvoke.end())
+		if (!isStopped_)
 		{
-			try 
-			{ 
-				if (isStopped_) return;
-
-				it->callback(args...); 
-			}
-			catch (const std::exception& e) { std::cerr << "Delegate Exception: " << e.what() << std::endl; }
+			Invoke(slot, args...);
 		}
+		EndBroadcast();
 	}
 
 	template <typename Ret, typename... Args>
 	template <typename R>
 	auto Delegate<Ret, Args...>::AsyncBroadcast(Args... args) -> std::vector<std::future<R>>
 	{
-		std::vector<CallbackInfo> localCallbacks;
+		// 비동기 작업이 델리게이트보다 오래 살 수 있으므로 여기서만 콜백을 복사한다
+		std::vector<std::future<R>> futures;
+		std::shared_ptr<const Snapshot> snapshot = AcquireSnapshot();
+		if (snapshot)
 		{
-			SpinLock lock(atomic_flag_);
-			localCallbacks = callbacks_;
+			futures.reserve(snapshot->size());
+			for (Slot* slot : *snapshot)
+			{
+				if (!slot->isAlive.load(std::memory_order_acquire)) continue;
+
+				futures.emplace_back(std::async(std::launch::async, slot->callback, args...));
+			}
 		}
-		std::vector<std::future<R>> futures;
-		futures.reserve(localCallbacks.size());
-		for (auto& info : localCallbacks)
-			futures.emplace_back(std::async(std::launch::async, info.callback, args...));
+		EndBroadcast();
 		return futures;
 	}
 }
@@ -42,7 +42,11 @@ DirectX11::DeviceResources::DeviceResources() :
 
 DirectX11::DeviceResources::~DeviceResources()
 {
-    m_swapChain->SetFullscreenState(FALSE, NULL); // 창 모드로
+    // 헤드리스 실행은 SetWindow 를 부르지 않아 스왑체인이 없다
+    if (m_swapChain)
+    {
+        m_swapChain->SetFullscreenState(FALSE, NULL); // 창 모드로
+    }
 }
 
 void DirectX11::DeviceResources::SetWindow(CoreWindow& window)
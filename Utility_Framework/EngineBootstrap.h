@@ -113,6 +113,10 @@ namespace EngineBootstrap
         app.Initialize(hInstance, windowTitle, width, height);
         app.Finalize();
 
+        if constexpr (requires { app.GetExitCode(); })
+        {
+            return app.GetExitCode();
+        }
         return 0;
     }
 }
@@ -3,6 +3,8 @@
 #include "LogSystem.h"
 #include "EngineSetting.h"
 #include "Paklib.hpp"
+#include "Core.PakFileSystem.h"
+#include "Core.PakBuilder.h"
 
 #include <cwctype>
 #include <filesystem>
@@ -110,6 +112,7 @@ namespace
         }
 
         const fs::path projectSettingsRoot = PathFinder::ProjectSettingPath("");
+        const fs::path cookedRoot = PathFinder::CookedPath("");
 
         std::wstring pakStem = SanitizePakStem(L"TRAIN_ASIS");
         if (pakStem.empty())
@@ -135,21 +138,13 @@ namespace
             }
         }
 
+        //  pak   ʴ´. ٲ  ׸ PakBuilder  ״ Ű .
         fs::path pakPath = outputDir / (pakStem + L".pak");
-        if (fs::exists(pakPath, ec) && !ec)
-        {
-            fs::remove(pakPath, ec);
-            if (ec)
-            {
-                Debug->LogWarning("Unable to remove existing pak '" + PathToUtf8(pakPath) + "': " + ec.message());
-                ec.clear();
-            }
-        }
 
         try
         {
-            Pak::BuildOptions options{};
-            Pak::Builder builder(pakPath, options);
+            PakBuilder::Options options{};
+            PakBuilder builder(pakPath, options);
             fs::recursive_directory_iterator it{ assetsRoot, fs::directory_options::skip_permission_denied, ec };
             if (ec)
             {
@@ -176,6 +171,12 @@ namespace
             {
                 sourceRoots.push_back({ projectSettingsRoot, "ProjectSetting" });
             }
+            // ŷ ؽó ( Ÿ  Ѵ)
+            if (!cookedRoot.empty() && fs::exists(cookedRoot, ec))
+            {
+                sourceRoots.push_back({ cookedRoot, "Cooked" });
+            }
+            ec.clear();
 
             std::size_t totalFileCount = 0;
             const fs::recursive_directory_iterator end{};
@@ -232,7 +233,7 @@ namespace
                         continue;
                     }
 
-                    builder.addFile(std::string(virtualPathU8.begin(), virtualPathU8.end()), entry.path());
+                    builder.AddFile(std::string(virtualPathU8.begin(), virtualPathU8.end()), entry.path());
                     ++rootFileCount;
                 }
 
@@ -246,7 +247,14 @@ namespace
                 return false;
             }
 
-            builder.finish();
+            PakBuildReport report{};
+            if (!builder.Build(report))
+            {
+                Debug->LogError("Failed to build asset pak: " + PathToUtf8(pakPath));
+                return false;
+            }
+
+            Debug->Log(report.ToString());
             Debug->Log("Packaged " + std::to_string(totalFileCount) + " files into pak: " + PathToUtf8(pakPath));
             return true;
         }
@@ -262,150 +270,29 @@ namespace
         return false;
     }
 
-    static void SetAttrsNormal(const fs::path& p)
-    {
-        const std::wstring w = p.c_str();
-        DWORD attrs = GetFileAttributesW(w.c_str());
-        if (attrs != INVALID_FILE_ATTRIBUTES)
-        {
-            // /ý/б 
-            attrs &= ~(FILE_ATTRIBUTE_READONLY | FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
-            SetFileAttributesW(w.c_str(), attrs);
-        }
-    }
-
-    static bool DeleteFileWithRetry(const std::wstring& wpath, int tries = 8, DWORD waitMs = 50)
+    //    pak  Ǯ ʰ ״ ƮѴ
+    bool MountGameAssets()
     {
-        for (int i = 0; i < tries; ++i)
-        {
-            if (DeleteFileW(wpath.c_str()))
-                return true;
-
-            DWORD err = GetLastError();
-            if (err == ERROR_SHARING_VIOLATION || err == ERROR_ACCESS_DENIED || err == ERROR_LOCK_VIOLATION)
-                std::this_thread::sleep_for(std::chrono::milliseconds(waitMs));
-            else
-                break;
-        }
-        return false;
-    }
-
-    static bool RemoveDirWithRetry(const std::wstring& wpath, int tries = 8, DWORD waitMs = 50)
-    {
-        for (int i = 0; i < tries; ++i)
-        {
-            if (RemoveDirectoryW(wpath.c_str()))
-                return true;
-
-            DWORD err = GetLastError();
-            if (err == ERROR_SHARING_VIOLATION || err == ERROR_ACCESS_DENIED || err == ERROR_DIR_NOT_EMPTY)
-                std::this_thread::sleep_for(std::chrono::milliseconds(waitMs));
-            else
-                break;
-        }
-        return false;
-    }
-
-    static void ScheduleDeleteOnReboot(const std::wstring& wpath)
-    {
-        // ص ¿  : best-effort
-        MoveFileExW(wpath.c_str(), nullptr, MOVEFILE_DELAY_UNTIL_REBOOT);
-    }
-
-    static bool ForceDeleteTree(const fs::path& root)
-    {
-        if (!fs::exists(root)) return true;
-
-        // ͷ  
-        for (auto it = fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied);
-            it != fs::end(it); ++it)
-        {
-            const auto& p = it->path();
-            std::wstring w = p.c_str();
-
-            // ͸ ߿ ǵ ǳʶ
-            if (it->is_regular_file() || it->is_symlink())
-            {
-                SetAttrsNormal(p);
-                if (!DeleteFileWithRetry(w))
-                {
-                    //  :   
-                    ScheduleDeleteOnReboot(w);
-                }
-            }
-        }
-        //  ͸ ٴڿ  
-        // recursive_directory_iterator  Ʒ Ƿ, ⼱ reverse_iterator 
-        std::vector<fs::path> dirs;
-        for (auto it = fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied);
-            it != fs::end(it); ++it)
-        {
-            if (it->is_directory()) dirs.push_back(it->path());
-        }
-        std::sort(dirs.begin(), dirs.end(),
-            [](const fs::path& a, const fs::path& b) { return a.native().size() > b.native().size(); });
-
-        for (const auto& d : dirs)
-        {
-            SetAttrsNormal(d);
-            if (!RemoveDirWithRetry(d.c_str()))
-                ScheduleDeleteOnReboot(d.c_str());
-        }
-
-        // ֻ 
-        SetAttrsNormal(root);
-        if (!RemoveDirWithRetry(root.c_str()))
-            ScheduleDeleteOnReboot(root.c_str());
-
-        return !fs::exists(root);
-    }
-
-    bool CleanupUnpackedGameAssets()
-    {
-        fs::path pakBaseDir = PathFinder::RelativeToExecutable("");
-        if (pakBaseDir.empty())
-        {
-            pakBaseDir = PathFinder::Relative().parent_path();
-        }
-
-        fs::path extractRootBase;
-
-        std::array<wchar_t, MAX_PATH> tempPathBuffer{};
-        const DWORD tempPathLen = GetTempPathW(static_cast<DWORD>(tempPathBuffer.size()), tempPathBuffer.data());
-
-        if (tempPathLen > 0 && tempPathLen < tempPathBuffer.size())
-        {
-            extractRootBase = fs::path(tempPathBuffer.data());
-        }
-        else
+        std::wstring pakStem = SanitizePakStem(L"TRAIN_ASIS");
+        if (pakStem.empty())
         {
-            extractRootBase = PathFinder::DumpPath();
+            pakStem = L"GameAssets";
         }
 
-        if (extractRootBase.empty())
-        {
-            extractRootBase = pakBaseDir;
-        }
+        const fs::path pakBaseDir = PathFinder::RelativeToExecutable("");
+        const fs::path pakPath = pakBaseDir / (pakStem + L".pak");
 
-        fs::path extractRoot = extractRootBase / "UnpackedAssets";
         std::error_code ec{};
-        if (!fs::exists(extractRoot, ec))
+        if (pakBaseDir.empty() || !fs::exists(pakPath, ec) || ec)
         {
-            if (ec) Debug->LogWarning("Failed to query '" + PathToUtf8(extractRoot) + "': " + ec.message());
-            return true;
-        }
-
-        if (!ForceDeleteTree(extractRoot))
-        {
-            Debug->LogError("Failed to delete unpacked assets directory '" + PathToUtf8(extractRoot) + "'. "
-                "Some entries may be scheduled for deletion on reboot.");
+            Debug->LogError("Pak file not found: " + PathToUtf8(pakPath));
             return false;
         }
 
-        Debug->Log("Removed unpacked assets directory '" + PathToUtf8(extractRoot) + "'.");
-        return true;
+        return PakFileSystems->Mount(pakPath, pakBaseDir);
     }
 
+    //   Ǯ .   ÿ MountGameAssets  .
     bool UnpackageGameAssets()
     {
         std::wstring pakStem = SanitizePakStem(L"TRAIN_ASIS");
@@ -102,6 +102,12 @@ namespace Pak {
                 return out;
             }
 
+            // IV 하위 8 바이트(빅엔디언 카운터)를 blocks 만큼 진행 — 청크 단위로 IV 를 바로 계산할 때 사용
+            static void advanceCtr(std::array<u8, 16>& iv, u64 blocks) {
+                u64 ctr = 0; for (int i = 8; i < 16; i++) ctr = (ctr << 8) | iv[i];
+                ctr += blocks; for (int i = 15; i >= 8; i--) { iv[i] = (u8)(ctr & 0xFF); ctr >>= 8; }
+            }
+
             void init(const std::array<u8, 32>& key, std::array<u8, 16> iv_) {
                 NTSTATUS st = BCryptOpenAlgorithmProvider(&hAlg, BCRYPT_AES_ALGORITHM, nullptr, 0); if (st < 0) fail("BCryptOpenAlgorithmProvider");
                 st = BCryptSetProperty(hAlg, BCRYPT_CHAINING_MODE, (PUCHAR)BCRYPT_CHAIN_MODE_ECB, (ULONG)std::wcslen(BCRYPT_CHAIN_MODE_ECB) * sizeof(wchar_t), 0);
@@ -428,6 +434,11 @@ namespace Pak {
             return out;
         }
 
+        // 증분 빌드에서 이전 pak 의 청크를 그대로 옮길 때 사용
+        const Header& header() const { return m_hdr; }
+        const IndexHeader& indexHeader() const { return m_ih; }
+        const std::vector<Entry>& entries() const { return m_entries; }
+
         bool contains(std::string_view virtualPath) const { return m_hashToIndex.contains(fnv1a64(virtualPath)); }
 
         std::vector<u8> readAll(std::string_view virtualPath) const {
@@ -85,6 +85,7 @@ public:
 	file::path InputMapPath{};
 	file::path GameBuildSlnPath{};
 	file::path animatorPath{};
+	file::path CookedPath{};
 
     inline void Initialize()
     {
@@ -102,20 +103,8 @@ public:
 		BaseProjectPath = file::path(base).append("..\\..\\Dynamic_CPP\\").lexically_normal();
 
 #ifdef BUILD_FLAG
-		std::array<WCHAR, MAX_PATH> tempPathBuffer{};
-		const DWORD tempPathLength = GetTempPathW(static_cast<DWORD>(tempPathBuffer.size()), tempPathBuffer.data());
-
-		file::path assetsRoot;
-		if (tempPathLength > 0 && tempPathLength < tempPathBuffer.size())
-		{
-			assetsRoot = file::path(tempPathBuffer.data()) / L"UnpackedAssets" / L"Assets";
-		}
-		else
-		{
-			assetsRoot = file::path(base).append("..\\..\\Dynamic_CPP\\Assets\\");
-		}
-
-		assetsRoot = assetsRoot.lexically_normal();
+		// 빌드 게임은 실행 파일 옆의 pak 을 마운트해서 읽는다 (PakFileSystem 의 가상 경로)
+		file::path assetsRoot = file::path(base).append("Assets\\").lexically_normal();
 #else
 		file::path assetsRoot = file::path(base).append("..\\..\\Dynamic_CPP\\Assets\\").lexically_normal();
 #endif
@@ -128,13 +117,13 @@ public:
 		PrefabSourcePath = assetsRoot / "Prefabs";
 		ShaderSourcePath = assetsRoot / "Shaders";
 #ifdef BUILD_FLAG
-		DynamicSolutionDir = file::path(tempPathBuffer.data()) / L"UnpackedAssets";
-		ProjectSettingsPath = file::path(tempPathBuffer.data()) / L"UnpackedAssets" / L"ProjectSetting";
-		DynamicSolutionDir = DynamicSolutionDir.lexically_normal();
-		ProjectSettingsPath = ProjectSettingsPath.lexically_normal();
+		DynamicSolutionDir = file::path(base).lexically_normal();
+		ProjectSettingsPath = file::path(base).append("ProjectSetting").lexically_normal();
+		CookedPath = file::path(base).append("Cooked").lexically_normal();
 #else
 		DynamicSolutionDir = file::path(base).append("..\\..\\Dynamic_CPP\\").lexically_normal();
 		ProjectSettingsPath = file::path(base).append("..\\..\\Dynamic_CPP\\ProjectSetting").lexically_normal();
+		CookedPath = file::path(base).append("..\\..\\Dynamic_CPP\\Cooked").lexically_normal();
 #endif
 
 		PrecompiledShaderPath = file::path(base).append("..\\Assets\\Shaders\\").lexically_normal();
@@ -178,6 +167,7 @@ public:
 			NodeEditorPath,
 			InputMapPath,
 			animatorPath,
+			CookedPath,
 		};
 
 #ifndef BUILD_FLAG
@@ -310,6 +300,11 @@ public:
 		return file::path(InternalPath::GetInstance()->DynamicSolutionDir) / path;
 	}
 
+	static inline file::path CookedPath(std::string_view path)
+	{
+		return file::path(InternalPath::GetInstance()->CookedPath) / path;
+	}
+
 	static inline file::path ProjectSettingPath(std::string_view path)
 	{
 		return file::path(InternalPath::GetInstance()->ProjectSettingsPath) / path;
@@ -1,6 +1,20 @@
 #pragma once
 #include <atomic>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
 #include <immintrin.h> // For _mm_pause
+#else
+#include <thread>
+#endif
+
+// Busy-wait hint; falls back to a yield where there is no pause instruction
+inline void CpuRelax()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
 
 template <typename T>
 class SpinLock
@@ -13,7 +27,7 @@ public:
     {
         while (m_lock.test_and_set(std::memory_order_acquire))
         {
-            _mm_pause();
+            CpuRelax();
         }
     }
 
@@ -40,6 +40,8 @@ namespace DirectX11
 		double GetTargetElapsedTicks() { return TicksToSeconds(m_targetElapsedTicks); }
 
 		float GetFixedInterpolatedSeconds() { return m_fixedInterpolatedLerp; }
+		// 고정 스텝을 직접 돌리는 쪽(SceneManager::Physics)이 남은 누적 시간 비율을 알려 준다
+		void SetFixedInterpolatedSeconds(float lerp) { m_fixedInterpolatedLerp = lerp; }
 
 		// Integer format represents time using 10,000,000 ticks per second.
 		static const uint64_t TicksPerSecond = 10000000;
@@ -117,6 +119,20 @@ namespace DirectX11
 			}
 		}
 
+		// 실제 시간과 상관없이 ticks 만큼 진행한다 (헤드리스처럼 정해진 간격으로 시뮬레이션만 돌릴 때)
+		template<typename TUpdate>
+		void ManualTick(uint64 ticks, const TUpdate& update)
+		{
+			UpdateTimeScale(TicksToSeconds(ticks));
+
+			m_elapsedTicks = ticks;
+			m_totalTicks += ticks;
+			m_leftOverTicks = 0;
+			m_frameCount++;
+
+			update();
+		}
+
 		template<typename TUpdate>
 		void FixedTick(const TUpdate& fixedUpdate)
 		{